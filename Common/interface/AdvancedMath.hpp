@@ -620,6 +620,87 @@ inline BoxVisibility GetBoxVisibility(const ViewFrustumExt&      ViewFrustumExt,
     return BoxVisibility::Intersecting;
 }
 
+
+struct IThreadPool;
+
+/// Axis-aligned bounding boxes in the structure-of-arrays layout defined by min and max corners.
+struct BoundBoxMinMaxSOA
+{
+    /// Min[i] points to the array of i-th coordinates of the box min corners.
+    const float* Min[3] = {};
+
+    /// Max[i] points to the array of i-th coordinates of the box max corners.
+    const float* Max[3] = {};
+};
+
+/// Axis-aligned bounding boxes in the structure-of-arrays layout defined by centers and half extents.
+struct BoundBoxCenterExtentsSOA
+{
+    /// Center[i] points to the array of i-th coordinates of the box centers.
+    const float* Center[3] = {};
+
+    /// HalfExtents[i] points to the array of box half extents along the i-th axis.
+    const float* HalfExtents[3] = {};
+};
+
+/// Oriented bounding boxes in the structure-of-arrays layout, see Diligent::OrientedBoundingBox.
+struct OrientedBoundingBoxSOA
+{
+    /// Center[i] points to the array of i-th coordinates of the box centers.
+    const float* Center[3] = {};
+
+    /// Axes[a][i] points to the array of i-th coordinates of the a-th box axis.
+    const float* Axes[3][3] = {};
+
+    /// HalfExtents[a] points to the array of box half extents along the a-th axis.
+    const float* HalfExtents[3] = {};
+};
+
+/// Attributes of the GetBoxesVisibility functions.
+struct GetBoxesVisibilityAttribs
+{
+    /// The number of boxes to test.
+    Uint32 NumBoxes = 0;
+
+    /// Frustum planes to test the boxes against.
+    FRUSTUM_PLANE_FLAGS PlaneFlags = FRUSTUM_PLANE_FLAG_FULL_FRUSTUM;
+
+    /// An optional array of NumBoxes elements that receives the visibility of every box.
+    BoxVisibility* pVisibility = nullptr;
+
+    /// An optional array of (NumBoxes + 31) / 32 elements that receives the visibility bit mask.
+    /// Bit i % 32 of element i / 32 is set if box i is not invisible.
+    Uint32* pVisibilityMask = nullptr;
+
+    /// An optional array of NumBoxes elements that receives the indices of all boxes
+    /// that are not invisible, in ascending order.
+    Uint32* pVisibleIndices = nullptr;
+
+    /// An optional thread pool to split the work across multiple threads.
+    IThreadPool* pThreadPool = nullptr;
+};
+
+/// Tests the visibility of multiple boxes against the view frustum.
+
+/// \return     The number of boxes that are not invisible.
+///
+/// \remarks    The results are the same as if GetBoxVisibility was called for every box.
+///             The boxes are tested in groups using SSE, AVX or NEON instructions when available.
+///             Boxes defined by centers and half extents produce the same results as oriented
+///             bounding boxes with the identity axes.
+///
+///             Overloads that take Diligent::ViewFrustumExt additionally test the frustum corners
+///             against the box planes when all frustum planes are enabled.
+Uint32 GetBoxesVisibility(const ViewFrustum& Frustum, const BoundBoxMinMaxSOA& Boxes, const GetBoxesVisibilityAttribs& Attribs);
+Uint32 GetBoxesVisibility(const ViewFrustum& Frustum, const BoundBoxCenterExtentsSOA& Boxes, const GetBoxesVisibilityAttribs& Attribs);
+Uint32 GetBoxesVisibility(const ViewFrustum& Frustum, const OrientedBoundingBoxSOA& Boxes, const GetBoxesVisibilityAttribs& Attribs);
+Uint32 GetBoxesVisibility(const ViewFrustum& Frustum, const BoundBox* pBoxes, const GetBoxesVisibilityAttribs& Attribs);
+
+Uint32 GetBoxesVisibility(const ViewFrustumExt& FrustumExt, const BoundBoxMinMaxSOA& Boxes, const GetBoxesVisibilityAttribs& Attribs);
+Uint32 GetBoxesVisibility(const ViewFrustumExt& FrustumExt, const BoundBoxCenterExtentsSOA& Boxes, const GetBoxesVisibilityAttribs& Attribs);
+Uint32 GetBoxesVisibility(const ViewFrustumExt& FrustumExt, const OrientedBoundingBoxSOA& Boxes, const GetBoxesVisibilityAttribs& Attribs);
+Uint32 GetBoxesVisibility(const ViewFrustumExt& FrustumExt, const BoundBox* pBoxes, const GetBoxesVisibilityAttribs& Attribs);
+
 inline float GetPointToBoxDistanceSqr(const BoundBox& BB, const float3& Pos)
 {
     VERIFY_EXPR(BB.Max.x >= BB.Min.x &&
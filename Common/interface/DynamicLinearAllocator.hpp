@@ -32,6 +32,7 @@
 
 #include <vector>
 #include <cstring>
+#include <algorithm>
 
 #include "../../Primitives/interface/BasicTypes.h"
 #include "../../Primitives/interface/MemoryAllocator.h"
@@ -72,6 +73,9 @@ public:
             m_pAllocator->Free(block.Data);
         }
         m_Blocks.clear();
+        m_CurrBlockIdx = 0;
+        m_CurrentSize  = 0;
+        m_ReservedSize = 0;
 
         m_pAllocator = nullptr;
     }
@@ -82,6 +86,96 @@ public:
         {
             block.CurrPtr = block.Data;
         }
+        m_CurrBlockIdx = 0;
+        m_CurrentSize  = 0;
+    }
+
+    /// Allocator state that can be restored by Rewind()
+    struct Marker
+    {
+        size_t   BlockIdx    = 0;
+        uint8_t* CurrPtr     = nullptr;
+        size_t   CurrentSize = 0;
+    };
+
+    /// Returns the marker that identifies the current allocator state.
+    Marker GetMarker() const
+    {
+        return m_Blocks.empty() ?
+            Marker{} :
+            Marker{m_CurrBlockIdx, m_Blocks[m_CurrBlockIdx].CurrPtr, m_CurrentSize};
+    }
+
+    /// Releases all allocations made after the marker was obtained.
+
+    /// \remarks   The memory blocks are retained and are reused by subsequent allocations.
+    ///            Markers must be rewound in the reverse order they were obtained.
+    void Rewind(const Marker& M)
+    {
+        if (m_Blocks.empty())
+        {
+            VERIFY(M.CurrPtr == nullptr && M.CurrentSize == 0, "The marker was not obtained from this allocator");
+            return;
+        }
+
+        VERIFY(M.BlockIdx <= m_CurrBlockIdx && M.CurrentSize <= m_CurrentSize, "The marker is newer than the allocator state");
+        for (size_t i = M.BlockIdx + 1; i <= m_CurrBlockIdx; ++i)
+        {
+            m_Blocks[i].CurrPtr = m_Blocks[i].Data;
+        }
+
+        auto& block = m_Blocks[M.BlockIdx];
+        VERIFY(M.CurrPtr == nullptr || (M.CurrPtr >= block.Data && M.CurrPtr <= block.CurrPtr), "The marker is not valid");
+        block.CurrPtr  = M.CurrPtr != nullptr ? M.CurrPtr : block.Data;
+        m_CurrBlockIdx = M.BlockIdx;
+        m_CurrentSize  = M.CurrentSize;
+    }
+
+    /// Rewinds the allocator to the state it had when the object was created.
+    class ScopedMarker
+    {
+    public:
+        explicit ScopedMarker(DynamicLinearAllocator& Allocator) :
+            m_Allocator{Allocator},
+            m_Marker{Allocator.GetMarker()}
+        {}
+
+        ~ScopedMarker()
+        {
+            m_Allocator.Rewind(m_Marker);
+        }
+
+        // clang-format off
+        ScopedMarker           (const ScopedMarker&) = delete;
+        ScopedMarker           (ScopedMarker&&)      = delete;
+        ScopedMarker& operator=(const ScopedMarker&) = delete;
+        ScopedMarker& operator=(ScopedMarker&&)      = delete;
+        // clang-format on
+
+    private:
+        DynamicLinearAllocator& m_Allocator;
+        const Marker            m_Marker;
+    };
+
+    /// Releases unused memory blocks until the total size of all blocks
+    /// does not exceed MaxReservedSize. Blocks that contain allocations are never released.
+    void ReleaseUnusedBlocks(size_t MaxReservedSize = 0)
+    {
+        if (m_Blocks.empty())
+            return;
+
+        // All blocks past the current one are empty
+        const auto& CurrBlock     = m_Blocks[m_CurrBlockIdx];
+        const auto  FirstEmptyIdx = CurrBlock.CurrPtr == CurrBlock.Data ? m_CurrBlockIdx : m_CurrBlockIdx + 1;
+        while (m_ReservedSize > MaxReservedSize && m_Blocks.size() > FirstEmptyIdx)
+        {
+            auto& block = m_Blocks.back();
+            VERIFY_EXPR(block.CurrPtr == block.Data);
+            m_ReservedSize -= block.Size;
+            m_pAllocator->Free(block.Data);
+            m_Blocks.pop_back();
+        }
+        m_CurrBlockIdx = std::min(m_CurrBlockIdx, m_Blocks.empty() ? size_t{0} : m_Blocks.size() - 1);
     }
 
     NODISCARD void* Allocate(size_t size, size_t align)
@@ -89,12 +183,16 @@ public:
         if (size == 0)
             return nullptr;
 
-        for (auto& block : m_Blocks)
+        for (size_t i = m_CurrBlockIdx; i < m_Blocks.size(); ++i)
         {
-            auto* Ptr = AlignUp(block.CurrPtr, align);
+            auto& block = m_Blocks[i];
+            auto* Ptr   = AlignUp(block.CurrPtr, align);
             if (Ptr + size <= block.Data + block.Size)
             {
-                block.CurrPtr = Ptr + size;
+                m_CurrentSize += (Ptr + size) - block.CurrPtr;
+                block.CurrPtr  = Ptr + size;
+                m_CurrBlockIdx = i;
+                m_PeakSize     = std::max(m_PeakSize, m_CurrentSize);
                 return Ptr;
             }
         }
@@ -104,11 +202,15 @@ public:
         while (BlockSize < size + align - 1)
             BlockSize *= 2;
         m_Blocks.emplace_back(m_pAllocator->Allocate(BlockSize, "dynamic linear allocator page", __FILE__, __LINE__), BlockSize);
+        m_ReservedSize += BlockSize;
 
         auto& block = m_Blocks.back();
         auto* Ptr   = AlignUp(block.Data, align);
         VERIFY(Ptr + size <= block.Data + block.Size, "Not enough space in the new block - this is a bug");
         block.CurrPtr = Ptr + size;
+        m_CurrentSize += block.CurrPtr - block.Data;
+        m_CurrBlockIdx = m_Blocks.size() - 1;
+        m_PeakSize     = std::max(m_PeakSize, m_CurrentSize);
         return Ptr;
     }
 
@@ -198,6 +300,29 @@ public:
         return m_Blocks.size();
     }
 
+    /// Returns the number of bytes allocated since the last Discard(), including the alignment padding.
+    size_t GetCurrentSize() const
+    {
+        return m_CurrentSize;
+    }
+
+    /// Returns the maximum value GetCurrentSize() has reached since the last ResetPeakSize() call.
+    size_t GetPeakSize() const
+    {
+        return m_PeakSize;
+    }
+
+    void ResetPeakSize()
+    {
+        m_PeakSize = m_CurrentSize;
+    }
+
+    /// Returns the total size of all memory blocks.
+    size_t GetReservedSize() const
+    {
+        return m_ReservedSize;
+    }
+
     template <typename HandlerType>
     void ProcessBlocks(HandlerType&& Handler) const
     {
@@ -219,6 +344,13 @@ private:
     std::vector<Block> m_Blocks;
     const Uint32       m_BlockSize  = 4 << 10;
     IMemoryAllocator*  m_pAllocator = nullptr;
+
+    // Index of the block new allocations are made from. All blocks past it are empty.
+    size_t m_CurrBlockIdx = 0;
+
+    size_t m_CurrentSize  = 0;
+    size_t m_PeakSize     = 0;
+    size_t m_ReservedSize = 0;
 };
 
 } // namespace Diligent
@@ -30,20 +30,30 @@
 /// \file
 /// Declaration of Diligent::FixedBlockMemoryAllocator class
 
-#include <unordered_map>
 #include <mutex>
-#include <unordered_set>
+#include <array>
 #include <vector>
 #include <cstring>
 #include <memory>
 #include "../../Primitives/interface/Errors.hpp"
 #include "../../Primitives/interface/MemoryAllocator.h"
 #include "STDAllocator.hpp"
+#include "SpinLock.hpp"
+
+#ifdef DILIGENT_DEBUG
+#    include <unordered_set>
+#endif
 
 namespace Diligent
 {
 
 /// Memory allocator that allocates memory in a fixed-size chunks
+
+/// \remarks   Every memory page is aligned by its size (which is always a power of two), so that
+///            the page that owns a block is found by simply masking the block address.
+///            Allocations and deallocations first go through a small set of per-thread block
+///            caches (magazines) that are refilled from and flushed to the pages in batches,
+///            so that the allocator mutex is only taken once per batch.
 class FixedBlockMemoryAllocator final : public IMemoryAllocator
 {
 public:
@@ -56,6 +66,22 @@ public:
     /// Releases memory
     virtual void Free(void* Ptr) override final;
 
+    /// Returns the size of one memory page, in bytes.
+    size_t GetPageSize() const { return m_PageSize; }
+
+    /// Returns the number of blocks in one memory page.
+
+    /// \remarks   This number may be greater than the value passed to the constructor
+    ///            as the page size is rounded up to the next power of two.
+    Uint32 GetNumBlocksInPage() const { return m_NumBlocksInPage; }
+
+    /// Returns the number of blocks that are currently allocated.
+
+    /// \remarks   Blocks held by the thread caches are not counted as allocated.
+    ///            The method locks the allocator and is intended for diagnostics.
+    ///            The result is only exact when no other thread uses the allocator.
+    Uint32 GetNumAllocatedBlocks();
+
 private:
     // clang-format off
     FixedBlockMemoryAllocator             (const FixedBlockMemoryAllocator&) = delete;
@@ -64,10 +90,22 @@ private:
     FixedBlockMemoryAllocator& operator = (FixedBlockMemoryAllocator&&)      = delete;
     // clang-format on
 
-    void CreateNewPage();
+    class MemoryPage;
+
+    void CreateNewChunk();
+
+    // Both methods must be called with m_Mutex locked.
+    void AllocateBlocks(void** ppBlocks, Uint32 NumBlocks);
+    void ReleaseBlocks(void* const* ppBlocks, Uint32 NumBlocks);
+
+    void AddAvailablePage(MemoryPage* pPage);
+    void RemoveAvailablePage(MemoryPage* pPage);
+
+    MemoryPage* GetPage(const void* Ptr) const;
 
     // Memory page class is based on the fixed-size memory pool described in "Fast Efficient Fixed-Size Memory Pool"
-    // by Ben Kenwright
+    // by Ben Kenwright.
+    // The page object is placed at the beginning of the page memory and is followed by the blocks.
     class MemoryPage
     {
     public:
@@ -77,9 +115,13 @@ private:
         static constexpr Uint8 InitializedBlockMemPattern = 0xCF;
 
         MemoryPage(FixedBlockMemoryAllocator& OwnerAllocator);
-        MemoryPage(MemoryPage&& Page) noexcept;
 
-        ~MemoryPage();
+        // clang-format off
+        MemoryPage             (const MemoryPage&) = delete;
+        MemoryPage             (MemoryPage&&)      = delete;
+        MemoryPage& operator = (const MemoryPage&) = delete;
+        MemoryPage& operator = (MemoryPage&&)      = delete;
+        // clang-format on
 
         void* GetBlockStartAddress(Uint32 BlockIndex) const;
 
@@ -93,29 +135,56 @@ private:
         bool HasSpace() const { return m_NumFreeBlocks > 0; }
         bool HasAllocations() const { return m_NumFreeBlocks < m_NumInitializedBlocks; }
 
+        FixedBlockMemoryAllocator* GetOwnerAllocator() const { return m_pOwnerAllocator; }
+
     private:
-        MemoryPage(const MemoryPage&) = delete;
-        MemoryPage& operator=(const MemoryPage) = delete;
-        MemoryPage& operator=(MemoryPage&&) = delete;
-
-        Uint32                     m_NumFreeBlocks        = 0;       // Num of remaining blocks
-        Uint32                     m_NumInitializedBlocks = 0;       // Num of initialized blocks
-        void*                      m_pPageStart           = nullptr; // Beginning of memory pool
-        void*                      m_pNextFreeBlock       = nullptr; // Num of next free block
-        FixedBlockMemoryAllocator* m_pOwnerAllocator      = nullptr;
+        friend FixedBlockMemoryAllocator;
+
+        FixedBlockMemoryAllocator* const m_pOwnerAllocator;
+
+        Uint32 m_NumFreeBlocks        = 0;       // Num of remaining blocks
+        Uint32 m_NumInitializedBlocks = 0;       // Num of initialized blocks
+        void*  m_pNextFreeBlock       = nullptr; // Next free block
+
+        // Intrusive list of pages that have free blocks
+        MemoryPage* m_pPrevAvailable = nullptr;
+        MemoryPage* m_pNextAvailable = nullptr;
+        bool        m_IsAvailable    = false;
     };
 
-    std::vector<MemoryPage, STDAllocatorRawMem<MemoryPage>>                                          m_PagePool;
-    std::unordered_set<size_t, std::hash<size_t>, std::equal_to<size_t>, STDAllocatorRawMem<size_t>> m_AvailablePages;
+    // Block cache (magazine) shared by the threads that map to the same slot.
+    struct ThreadCache
+    {
+        static constexpr Uint32 Capacity  = 32;
+        static constexpr Uint32 BatchSize = Capacity / 2;
+
+        Threading::SpinLock Lock;
+
+        Uint32 NumBlocks = 0;
+        void*  Blocks[Capacity];
+    };
+    static constexpr Uint32 NumThreadCaches = 8;
 
-    using AddrToPageIdMapElem = std::pair<void* const, size_t>;
-    std::unordered_map<void*, size_t, std::hash<void*>, std::equal_to<void*>, STDAllocatorRawMem<AddrToPageIdMapElem>> m_AddrToPageId;
+    std::array<ThreadCache, NumThreadCaches> m_ThreadCaches;
 
     std::mutex m_Mutex;
 
+    std::vector<void*, STDAllocatorRawMem<void*>>             m_Chunks;
+    std::vector<MemoryPage*, STDAllocatorRawMem<MemoryPage*>> m_Pages;
+
+    MemoryPage* m_pAvailablePages     = nullptr;
+    Uint32      m_NumPagesInNextChunk = 2;
+
     IMemoryAllocator& m_RawMemoryAllocator;
     const size_t      m_BlockSize;
+    const size_t      m_PageSize;
     const Uint32      m_NumBlocksInPage;
+
+#ifdef DILIGENT_DEBUG
+    std::mutex m_dbgAllocationsMtx;
+
+    std::unordered_set<void*, std::hash<void*>, std::equal_to<void*>, STDAllocatorRawMem<void*>> m_dbgAllocations;
+#endif
 };
 
 IMemoryAllocator& GetRawAllocator();
@@ -0,0 +1,130 @@
+/*
+ *  Copyright 2019-2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#pragma once
+
+/// \file
+/// Defines Diligent::FrameArena class
+
+#include <vector>
+#include <memory>
+
+#include "../../Primitives/interface/BasicTypes.h"
+#include "DynamicLinearAllocator.hpp"
+
+namespace Diligent
+{
+
+struct FrameArenaStatCounters;
+
+/// Thread-local arena for transient allocations.
+
+/// \remarks   Every thread owns one arena that is accessed through FrameArena::Scope objects.
+///            All memory allocated within a scope is released when the scope ends. Scopes may be
+///            nested, and only the innermost scope may be used to allocate memory.
+///            When the outermost scope ends, the arena keeps up to GetMaxSize() bytes of memory
+///            blocks for subsequent scopes, so that in a steady state no heap allocations are made.
+///            Scopes that require more memory still succeed, but the extra blocks are released.
+class FrameArena
+{
+public:
+    /// Default maximum amount of memory an arena retains between the outermost scopes.
+    static constexpr size_t DefaultMaxSize = size_t{1} << 20;
+
+    /// Arena usage statistics
+    struct Stats
+    {
+        /// The maximum number of bytes used by one outermost scope.
+        size_t PeakSize = 0;
+
+        /// The average number of bytes used by one outermost scope.
+        size_t AverageSize = 0;
+
+        /// The total size of the memory blocks currently retained by the arena.
+        size_t ReservedSize = 0;
+
+        /// The number of outermost scopes.
+        Uint64 NumScopes = 0;
+
+        /// The number of outermost scopes that used more than the maximum arena size.
+        Uint64 NumOverflows = 0;
+    };
+
+    /// Allocation scope in the calling thread's arena
+    class Scope
+    {
+    public:
+        Scope();
+        ~Scope();
+
+        // clang-format off
+        Scope           (const Scope&) = delete;
+        Scope           (Scope&&)      = delete;
+        Scope& operator=(const Scope&) = delete;
+        Scope& operator=(Scope&&)      = delete;
+        // clang-format on
+
+        /// Returns the allocator to use for allocations within this scope.
+        DynamicLinearAllocator& GetAllocator();
+
+    private:
+        FrameArena&                          m_Arena;
+        const DynamicLinearAllocator::Marker m_Marker;
+        const Uint32                         m_Depth;
+    };
+
+    /// Returns the arena of the calling thread.
+    static FrameArena& GetThreadArena();
+
+    /// Sets the maximum amount of memory every arena retains between the outermost scopes.
+    static void SetMaxSize(size_t MaxSize);
+
+    static size_t GetMaxSize();
+
+    /// Returns the statistics of this arena.
+    Stats GetStats() const;
+
+    /// Returns the statistics of the arenas of all running threads.
+
+    /// \remarks   The statistics of the arenas of the threads that have exited are
+    ///            combined into a single entry that is returned last.
+    static std::vector<Stats> GetAllStats();
+
+    ~FrameArena();
+
+private:
+    FrameArena();
+
+    Uint32 BeginScope();
+    void   EndScope();
+
+    DynamicLinearAllocator                  m_Allocator;
+    Uint32                                  m_ScopeDepth = 0;
+    std::shared_ptr<FrameArenaStatCounters> m_pStats;
+};
+
+} // namespace Diligent
@@ -18,12 +18,14 @@
 #pragma once
 
 #include <unordered_map>
-#include <deque>
+#include <list>
+#include <array>
 #include <mutex>
 #include <memory>
 #include <algorithm>
 #include <atomic>
 #include <vector>
+#include <cstdint>
 
 #include "../../../DiligentCore/Platforms/Basic/interface/DebugUtilities.hpp"
 
@@ -100,6 +102,11 @@ public:
         // It will be removed from the cache later when the LRU queue is processed.
         auto Data = pDataWrpr->GetData(std::forward<InitDataType>(InitData), IsNewObject);
 
+        // If the object was found in the cache and the cache size is within the budget,
+        // there is nothing to account for or release, so we don't need to lock the mutex again.
+        if (!IsNewObject && m_CurrSize.load() <= m_MaxSize.load())
+            return Data;
+
         // Process the release queue
         std::vector<std::shared_ptr<DataWrapper>> DeleteList;
         {
@@ -115,7 +122,7 @@ public:
                 if (it != m_Cache.end())
                 {
                     // Check that the object wrapper is the same.
-                    if (it->second == pDataWrpr)
+                    if (it->second->second == pDataWrpr)
                     {
                         // The wrapper is in the cache - label it as accounted and update the cache size.
 
@@ -145,12 +152,13 @@ public:
                 }
             }
 
-            for (int idx = static_cast<int>(m_LRUQueue.size()) - 1; idx >= 0; --idx)
+            // Walk the LRU list starting from the least recently used element
+            for (auto list_it = m_LRUList.end(); list_it != m_LRUList.begin();)
             {
                 if (m_CurrSize <= m_MaxSize)
                     break;
 
-                VERIFY_EXPR(!m_LRUQueue.empty());
+                --list_it;
 
                 // State stransition table:
                 //                                                     Protected by m_Mtx   Accounted Size
@@ -160,8 +168,7 @@ public:
                 //   InitializedUnaccounted -> InitializedAccounted          Yes                !0          <U2A>
                 //   InitializedAccounted                                 Final State
                 //
-                const auto& cache_it = m_LRUQueue[idx];
-                const auto  State    = cache_it->second->GetState(); /* <ReadState> */
+                const auto State = list_it->second->GetState(); /* <ReadState> */
                 if (State == DataWrapper::DataState::Default)
                 {
                     // The object is being initialized in another thread in DataWrapper::Get().
@@ -191,19 +198,21 @@ public:
 
                 // NB: if the state was not InitializedAccounted when we read it in <ReadState>, it can't be
                 //     InitializedAccounted now since the transition <U2A> is protected by mutex in <SA>.
-                VERIFY_EXPR((State == DataWrapper::DataState::InitializedAccounted && cache_it->second->GetState() == DataWrapper::DataState::InitializedAccounted) ||
-                            (State != DataWrapper::DataState::InitializedAccounted && cache_it->second->GetState() != DataWrapper::DataState::InitializedAccounted));
+                VERIFY_EXPR((State == DataWrapper::DataState::InitializedAccounted && list_it->second->GetState() == DataWrapper::DataState::InitializedAccounted) ||
+                            (State != DataWrapper::DataState::InitializedAccounted && list_it->second->GetState() != DataWrapper::DataState::InitializedAccounted));
 
                 // Note that transition to InitializedAccounted state is protected by the mutex in <SA>, so
                 // we can't remove a wrapper before it was accounted for.
-                const auto AccountedSize = cache_it->second->GetAccountedSize();
-                DeleteList.emplace_back(std::move(cache_it->second));
-                m_Cache.erase(cache_it); /* <Erase> */
-                m_LRUQueue.erase(m_LRUQueue.begin() + idx);
+                const auto AccountedSize = list_it->second->GetAccountedSize();
+                DeleteList.emplace_back(std::move(list_it->second));
+                m_Cache.erase(list_it->first); /* <Erase> */
+                // Erase returns the iterator to the next (more recently used) element.
+                // It will be decremented at the beginning of the next iteration.
+                list_it = m_LRUList.erase(list_it);
                 VERIFY_EXPR(m_CurrSize >= AccountedSize);
                 m_CurrSize -= AccountedSize;
             }
-            VERIFY_EXPR(m_Cache.size() == m_LRUQueue.size());
+            VERIFY_EXPR(m_Cache.size() == m_LRUList.size());
         }
 
         // Delete objects after releasing the cache mutex
@@ -228,13 +237,13 @@ public:
     {
 #ifdef DILIGENT_DEBUG
         size_t DbgSize = 0;
-        VERIFY_EXPR(m_Cache.size() == m_LRUQueue.size());
-        while (!m_LRUQueue.empty())
+        VERIFY_EXPR(m_Cache.size() == m_LRUList.size());
+        while (!m_LRUList.empty())
         {
-            auto last_it = m_LRUQueue.back();
-            m_LRUQueue.pop_back();
-            DbgSize += last_it->second->GetAccountedSize();
-            m_Cache.erase(last_it);
+            const auto& Last = m_LRUList.back();
+            DbgSize += Last.second->GetAccountedSize();
+            m_Cache.erase(Last.first);
+            m_LRUList.pop_back();
         }
         VERIFY_EXPR(m_Cache.empty());
         VERIFY_EXPR(DbgSize == m_CurrSize);
@@ -320,28 +329,37 @@ private:
         auto it = m_Cache.find(Key);
         if (it == m_Cache.end())
         {
-            it = m_Cache.emplace(Key, std::make_shared<DataWrapper>()).first;
+            m_LRUList.emplace_front(Key, std::make_shared<DataWrapper>());
+            try
+            {
+                m_Cache.emplace(Key, m_LRUList.begin());
+            }
+            catch (...)
+            {
+                m_LRUList.pop_front();
+                throw;
+            }
         }
         else
         {
-            // Pop the wrapper iterator from the queue
-            auto queue_it = std::find(m_LRUQueue.begin(), m_LRUQueue.end(), it);
-            VERIFY_EXPR(queue_it != m_LRUQueue.end());
-            m_LRUQueue.erase(queue_it);
+            // Move the element to the front of the list.
+            // Splicing does not invalidate the iterator stored in the map.
+            m_LRUList.splice(m_LRUList.begin(), m_LRUList, it->second);
         }
+        VERIFY_EXPR(m_Cache.size() == m_LRUList.size());
 
-        // Move iterator to the front of the queue
-        m_LRUQueue.push_front(it);
-        VERIFY_EXPR(m_Cache.size() == m_LRUQueue.size());
-
-        return it->second;
+        return m_LRUList.front().second;
     }
 
 
-    using CacheType = std::unordered_map<KeyType, std::shared_ptr<DataWrapper>, KeyHasher>;
-    CacheType m_Cache;
+    // The list is ordered from the most recently used element to the least recently used one.
+    using LRUListType = std::list<std::pair<KeyType, std::shared_ptr<DataWrapper>>>;
+    LRUListType m_LRUList;
 
-    std::deque<typename CacheType::iterator> m_LRUQueue;
+    // Maps the key to the element in the LRU list, which allows moving
+    // the element to the front of the list in constant time.
+    using CacheType = std::unordered_map<KeyType, typename LRUListType::iterator, KeyHasher>;
+    CacheType m_Cache;
 
     std::mutex m_Mtx;
 
@@ -349,4 +367,80 @@ private:
     std::atomic<size_t> m_MaxSize{0};
 };
 
+
+/// A thread-safe and exception-safe LRU cache split into NumShards independent shards.
+///
+/// Every key is assigned to one of the shards by its hash, and every shard is an LRUCache
+/// with its own mutex and LRU list. Threads that access keys in different shards
+/// do not contend for the same mutex, which makes this cache suitable for lookups from many
+/// threads. The cache provides the same guarantees as LRUCache: the data for every key is
+/// initialized only once, failed initializations are retried, and the cache size is
+/// accounted using the size returned by the initializer.
+///
+/// \note   The maximum size is evenly distributed between the shards, and every shard only
+///         evicts its own least-recently used elements. The eviction order is thus only
+///         approximately LRU across the whole cache.
+template <typename KeyType, typename DataType, typename KeyHasher = std::hash<KeyType>, size_t NumShards = 16>
+class ShardedLRUCache
+{
+public:
+    static_assert(NumShards > 0 && (NumShards & (NumShards - 1)) == 0, "The number of shards must be a power of two");
+
+    ShardedLRUCache() noexcept
+    {}
+
+    explicit ShardedLRUCache(size_t MaxSize) noexcept
+    {
+        SetMaxSize(MaxSize);
+    }
+
+    /// Finds the data in the cache and returns it. If the data is not found, it is atomically created
+    /// using the provided initializer, see LRUCache::Get().
+    template <typename InitDataType>
+    DataType Get(const KeyType& Key,
+                 InitDataType&& InitData // May throw
+                 ) noexcept(false)
+    {
+        return m_Shards[GetShardIndex(Key)].Cache.Get(Key, std::forward<InitDataType>(InitData));
+    }
+
+    /// Sets the maximum cache size.
+    void SetMaxSize(size_t MaxSize)
+    {
+        const size_t ShardMaxSize = (MaxSize + NumShards - 1) / NumShards;
+        for (auto& Shard : m_Shards)
+            Shard.Cache.SetMaxSize(ShardMaxSize);
+    }
+
+    /// Returns the current cache size.
+    size_t GetCurrSize() const
+    {
+        size_t CurrSize = 0;
+        for (const auto& Shard : m_Shards)
+            CurrSize += Shard.Cache.GetCurrSize();
+        return CurrSize;
+    }
+
+    static constexpr size_t GetNumShards()
+    {
+        return NumShards;
+    }
+
+private:
+    static size_t GetShardIndex(const KeyType& Key)
+    {
+        // Use the upper bits of the multiplicative hash so that the shard index
+        // is not correlated with the bucket index in the shard's hash map.
+        const uint64_t Hash = static_cast<uint64_t>(KeyHasher{}(Key)) * uint64_t{0x9E3779B97F4A7C15};
+        return static_cast<size_t>(Hash >> 32) & (NumShards - 1);
+    }
+
+    // Align shards to the cache line size to avoid false sharing between the shard mutexes
+    struct alignas(64) Shard
+    {
+        LRUCache<KeyType, DataType, KeyHasher> Cache;
+    };
+    std::array<Shard, NumShards> m_Shards;
+};
+
 } // namespace Diligent
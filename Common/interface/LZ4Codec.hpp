@@ -0,0 +1,72 @@
+/*
+ *  Copyright 2019-2024 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// LZ4 block format compression utilities.
+
+#include "../../Primitives/interface/BasicTypes.h"
+
+namespace Diligent
+{
+
+/// Returns the maximum size of the compressed data for the source data of the given size.
+size_t GetLZ4CompressBound(size_t SrcSize);
+
+/// Compresses the data using the LZ4 block format.
+
+/// \param[in]  pSrc        - A pointer to the source data.
+/// \param[in]  SrcSize     - Source data size, in bytes.
+/// \param[out] pDst        - A pointer to the destination buffer.
+/// \param[in]  DstCapacity - Destination buffer size, in bytes.
+///
+/// \return     The size of the compressed data, or 0 if the compressed data does not
+///             fit into the destination buffer. If DstCapacity is at least
+///             GetLZ4CompressBound(SrcSize), the compression always succeeds.
+///
+/// \remarks    The compressor is optimized for the decompression speed rather than the
+///             compression ratio and uses a single-entry hash table to find matches.
+///             The output is a raw LZ4 block without a frame header and can be decompressed
+///             by any LZ4 block decoder.
+size_t LZ4CompressBlock(const void* pSrc, size_t SrcSize, void* pDst, size_t DstCapacity);
+
+/// Decompresses the data in the LZ4 block format.
+
+/// \param[in]  pSrc        - A pointer to the compressed data.
+/// \param[in]  SrcSize     - Compressed data size, in bytes.
+/// \param[out] pDst        - A pointer to the destination buffer.
+/// \param[in]  DstCapacity - Destination buffer size, in bytes.
+///
+/// \return     The size of the decompressed data, or 0 if the compressed data is invalid
+///             or the decompressed data does not fit into the destination buffer.
+///
+/// \remarks    The function validates the input and never reads or writes outside
+///             of the source and destination buffers.
+size_t LZ4DecompressBlock(const void* pSrc, size_t SrcSize, void* pDst, size_t DstCapacity);
+
+} // namespace Diligent
@@ -0,0 +1,99 @@
+/*
+ *  Copyright 2019-2024 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Implementation of the IDataBlob interface backed by a memory-mapped file
+
+#include "../../Primitives/interface/BasicTypes.h"
+#include "../../Primitives/interface/DataBlob.h"
+#include "ObjectBase.hpp"
+#include "RefCntAutoPtr.hpp"
+
+namespace Diligent
+{
+
+/// Data blob that references the contents of a memory-mapped file.
+
+/// \remarks    File pages are loaded by the OS on first access, so creating the blob is cheap
+///             regardless of the file size, and the memory footprint of the blob is proportional
+///             to the amount of data actually accessed.
+///             The mapping is private: the data may be modified without affecting the file.
+class MappedFileDataBlob final : public ObjectBase<IDataBlob>
+{
+public:
+    using TBase = ObjectBase<IDataBlob>;
+
+    /// Creates a data blob that references the contents of the file.
+
+    /// \param [in] FilePath - Path to the file.
+    ///
+    /// \return     Data blob with the contents of the file, or null if the file could not be read.
+    ///
+    /// \remarks    If memory mapping is not supported on the current platform,
+    ///             the function falls back to reading the entire file into memory.
+    static RefCntAutoPtr<IDataBlob> Create(const Char* FilePath);
+
+    ~MappedFileDataBlob() override;
+
+    IMPLEMENT_QUERY_INTERFACE_IN_PLACE(IID_DataBlob, TBase)
+
+    /// Mapped data blob can only be shrunk.
+    virtual void DILIGENT_CALL_TYPE Resize(size_t NewSize) override;
+
+    /// Returns the size of the mapped data
+    virtual size_t DILIGENT_CALL_TYPE GetSize() const override
+    {
+        return m_Size;
+    }
+
+    /// Returns the pointer to the mapped data
+    virtual void* DILIGENT_CALL_TYPE GetDataPtr() override
+    {
+        return m_pData;
+    }
+
+    /// Returns const pointer to the mapped data
+    virtual const void* DILIGENT_CALL_TYPE GetConstDataPtr() const override
+    {
+        return m_pData;
+    }
+
+private:
+    template <typename AllocatorType, typename ObjectType>
+    friend class MakeNewRCObj;
+
+    MappedFileDataBlob(IReferenceCounters* pRefCounters, void* pData, size_t Size) noexcept;
+
+private:
+    void* const  m_pData      = nullptr;
+    const size_t m_MappedSize = 0;
+    size_t       m_Size       = 0;
+};
+
+} // namespace Diligent
@@ -165,6 +165,12 @@ DILIGENT_BEGIN_INTERFACE(IThreadPool, IObject)
     /// 
     /// \note       An application must ensure that the task prerequisites are not circular
     ///             to avoid deadlocks.
+    ///
+    ///             A task whose prerequisites are not finished is not placed into the queue.
+    ///             Instead, it is registered as a successor of every unfinished prerequisite
+    ///             that was enqueued into the same thread pool, and is enqueued when the last of
+    ///             them finishes. Prerequisites that were not enqueued into this thread pool are
+    ///             checked when the task is retrieved from the queue.
     VIRTUAL void METHOD(EnqueueTask)(THIS_
                                      IAsyncTask*  pTask,
                                      IAsyncTask** ppPrerequisites  DEFAULT_VALUE(nullptr),
@@ -212,7 +218,23 @@ DILIGENT_BEGIN_INTERFACE(IThreadPool, IObject)
     VIRTUAL void METHOD(WaitForAllTasks)(THIS) PURE;
 
 
+    /// Waits until the task is finished.
+
+    /// \param[in] pTask - Task to wait for.
+    ///
+    /// \remarks    The method blocks the calling thread on a condition variable until the task
+    ///             is complete or cancelled, or until it is removed from the thread pool.
+    ///             The task must have been enqueued into this thread pool.
+    ///
+    /// \note       This method must not be called from the worker thread of this thread pool
+    ///             as the task may be waiting in the queue behind the calling task.
+    VIRTUAL void METHOD(WaitForTask)(THIS_
+                                     IAsyncTask* pTask) PURE;
+
+
     /// Returns the current queue size.
+
+    /// \remarks    The queue size includes the tasks that wait for their prerequisites.
     VIRTUAL Uint32 METHOD(GetQueueSize)(THIS) PURE;
 
     /// Returns the number of currently running tasks
@@ -292,6 +314,7 @@ DILIGENT_END_INTERFACE
 #    define IThreadPool_ReprioritizeAllTasks(This)  CALL_IFACE_METHOD(ThreadPool, ReprioritizeAllTasks, This)
 #    define IThreadPool_RemoveTask(This, ...)       CALL_IFACE_METHOD(ThreadPool, RemoveTask, This, __VA_ARGS__)
 #    define IThreadPool_WaitForAllTasks(This)       CALL_IFACE_METHOD(ThreadPool, WaitForAllTasks, This)
+#    define IThreadPool_WaitForTask(This, ...)      CALL_IFACE_METHOD(ThreadPool, WaitForTask, This, __VA_ARGS__)
 #    define IThreadPool_GetQueueSize(This)          CALL_IFACE_METHOD(ThreadPool, GetQueueSize, This)
 #    define IThreadPool_GetRunningTaskCount(This)   CALL_IFACE_METHOD(ThreadPool, GetRunningTaskCount, This)
 #    define IThreadPool_StopThreads(This)           CALL_IFACE_METHOD(ThreadPool, StopThreads, This)
@@ -31,6 +31,10 @@
 #include <atomic>
 #include <functional>
 #include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <vector>
+#include <algorithm>
 
 #include "../../Platforms/Basic/interface/DebugUtilities.hpp"
 
@@ -40,6 +44,30 @@
 namespace Diligent
 {
 
+/// Thread pool scheduling mode
+enum THREAD_POOL_SCHEDULING_MODE : Uint8
+{
+    /// All tasks are kept in a single priority queue shared by all worker threads.
+
+    /// \remarks   Tasks are always started in the order of their priorities, but
+    ///            every enqueue and dequeue operation goes through the same lock.
+    THREAD_POOL_SCHEDULING_MODE_PRIORITY_QUEUE = 0,
+
+    /// Every worker thread has its own task queue and steals tasks from
+    /// other workers when its own queue is empty.
+
+    /// \remarks   Task priority is only used as a hint: a task whose priority is higher
+    ///            than the priority of the first task in the queue is placed at the front of
+    ///            the queue, and otherwise it is placed at the back. There is no global order
+    ///            between tasks in different queues.
+    ///
+    ///            This mode significantly reduces the contention when many threads
+    ///            enqueue and process small tasks.
+    THREAD_POOL_SCHEDULING_MODE_WORK_STEALING,
+
+    THREAD_POOL_SCHEDULING_MODE_COUNT
+};
+
 /// Thread pool create information
 struct ThreadPoolCreateInfo
 {
@@ -58,6 +86,9 @@ struct ThreadPoolCreateInfo
     /// An optional function that will be called by the thread pool from
     /// the worker thread before the worker thread exits.
     std::function<void(Uint32)> OnThreadExiting = nullptr;
+
+    /// Task scheduling mode, see Diligent::THREAD_POOL_SCHEDULING_MODE.
+    THREAD_POOL_SCHEDULING_MODE SchedulingMode = THREAD_POOL_SCHEDULING_MODE_PRIORITY_QUEUE;
 };
 
 RefCntAutoPtr<IThreadPool> CreateThreadPool(const ThreadPoolCreateInfo& ThreadPoolCI);
@@ -68,6 +99,11 @@ class AsyncTaskBase : public ObjectBase<IAsyncTask>
 {
 public:
     using TBase = ObjectBase<IAsyncTask>;
+
+    // {2E1A4F37-6B0D-4C58-9A3E-7D15C2B8F064}
+    static constexpr INTERFACE_ID IID_InternalImpl =
+        {0x2e1a4f37, 0x6b0d, 0x4c58, {0x9a, 0x3e, 0x7d, 0x15, 0xc2, 0xb8, 0xf0, 0x64}};
+
     explicit AsyncTaskBase(IReferenceCounters* pRefCounters,
                            float               fPriority = 0) noexcept :
         TBase{pRefCounters},
@@ -76,7 +112,7 @@ public:
     }
     virtual ~AsyncTaskBase() = 0;
 
-    IMPLEMENT_QUERY_INTERFACE_IN_PLACE(IID_AsyncTask, TBase)
+    IMPLEMENT_QUERY_INTERFACE2_IN_PLACE(IID_AsyncTask, IID_InternalImpl, TBase)
 
     virtual void DILIGENT_CALL_TYPE Cancel() override
     {
@@ -120,6 +156,17 @@ public:
         }
 #endif
         m_TaskStatus.store(TaskStatus);
+
+        // NB: the number of waiting threads is incremented before the waiting thread checks
+        //     the status, so either the waiting thread sees the new status, or we see the
+        //     waiting thread and notify it under the mutex.
+        if (m_NumWaitingThreads.load() > 0)
+        {
+            {
+                std::lock_guard<std::mutex> Lock{m_StatusMtx};
+            }
+            m_StatusChangedCond.notify_all();
+        }
     }
 
     virtual ASYNC_TASK_STATUS DILIGENT_CALL_TYPE GetStatus() const override final
@@ -146,22 +193,46 @@ public:
 
     virtual void DILIGENT_CALL_TYPE WaitForCompletion() const override final
     {
-        while (!IsFinished())
-            std::this_thread::yield();
+        WaitForStatus([this]() { return IsFinished(); });
     }
 
     virtual void DILIGENT_CALL_TYPE WaitUntilRunning() const override final
     {
-        while (GetStatus() == ASYNC_TASK_STATUS_NOT_STARTED)
-            std::this_thread::yield();
+        WaitForStatus([this]() { return GetStatus() != ASYNC_TASK_STATUS_NOT_STARTED; });
+    }
+
+    // The tag that the thread pool associates with the task.
+    // It is reserved for the thread pool implementation.
+    std::atomic<Uint64>& GetThreadPoolTag()
+    {
+        return m_ThreadPoolTag;
     }
 
 protected:
     std::atomic<bool> m_bSafelyCancel{false};
 
+private:
+    // Blocks the calling thread until the predicate returns true.
+    template <typename PredicateType>
+    void WaitForStatus(PredicateType&& Predicate) const
+    {
+        if (Predicate())
+            return;
+
+        std::unique_lock<std::mutex> Lock{m_StatusMtx};
+        m_NumWaitingThreads.fetch_add(1);
+        m_StatusChangedCond.wait(Lock, Predicate);
+        m_NumWaitingThreads.fetch_add(-1);
+    }
+
 private:
     std::atomic<float>             m_fPriority{0};
     std::atomic<ASYNC_TASK_STATUS> m_TaskStatus{ASYNC_TASK_STATUS_NOT_STARTED};
+    std::atomic<Uint64>            m_ThreadPoolTag{0};
+
+    mutable std::mutex              m_StatusMtx;
+    mutable std::condition_variable m_StatusChangedCond;
+    mutable std::atomic<int>        m_NumWaitingThreads{0};
 };
 
 
@@ -206,4 +277,53 @@ RefCntAutoPtr<IAsyncTask> EnqueueAsyncWork(IThreadPool* pThreadPool,
     return EnqueueAsyncWork(pThreadPool, nullptr, 0, std::move(Handler), fPriority);
 }
 
+/// Calls Handler(Item) for every item in the range [0, NumItems) using the calling
+/// thread and the threads of the pool.
+
+/// \param [in] pThreadPool - Thread pool to use. If null, all items are processed by
+///                           the calling thread.
+/// \param [in] NumItems    - The number of items to process.
+/// \param [in] Handler     - Item handler. It may be called simultaneously from multiple threads.
+///
+/// \remarks   The function returns when all items have been processed. The calling thread
+///            processes the items too, so the function makes progress even if all
+///            pool threads are busy, and it is safe to call it from a pool thread.
+template <typename HandlerType>
+void ProcessInParallel(IThreadPool* pThreadPool, Uint32 NumItems, HandlerType&& Handler)
+{
+    if (pThreadPool == nullptr || NumItems <= 1)
+    {
+        for (Uint32 Item = 0; Item < NumItems; ++Item)
+            Handler(Item);
+        return;
+    }
+
+    constexpr Uint32 MaxWorkerTasks = 16;
+
+    std::atomic<Uint32> NextItem{0};
+
+    auto ProcessItems = [&]() {
+        for (Uint32 Item = NextItem.fetch_add(1); Item < NumItems; Item = NextItem.fetch_add(1))
+            Handler(Item);
+    };
+
+    std::vector<RefCntAutoPtr<IAsyncTask>> Tasks(std::min(NumItems - 1, MaxWorkerTasks));
+    for (auto& pTask : Tasks)
+    {
+        pTask = EnqueueAsyncWork(pThreadPool,
+                                 [&ProcessItems](Uint32 /*ThreadId*/) {
+                                     ProcessItems();
+                                 });
+    }
+
+    ProcessItems();
+
+    for (auto& pTask : Tasks)
+    {
+        // Tasks that have not started yet have no work left to do
+        if (!pThreadPool->RemoveTask(pTask))
+            pTask->WaitForCompletion();
+    }
+}
+
 } // namespace Diligent
@@ -0,0 +1,549 @@
+/*
+ *  Copyright 2019-2024 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "AdvancedMath.hpp"
+
+#include <algorithm>
+#include <vector>
+#include <cmath>
+
+#include "Intrinsics.hpp"
+#include "DebugUtilities.hpp"
+#include "PlatformMisc.hpp"
+#include "ThreadPool.hpp"
+
+namespace Diligent
+{
+
+namespace
+{
+
+// Every operation set processes Width boxes at a time.
+// The operations must produce the same results as the scalar code in GetBoxVisibility.
+struct ScalarOps
+{
+    static constexpr Uint32 Width = 1;
+
+    using Float = float;
+    using Mask  = bool;
+
+    static Float Load(const float* p) { return *p; }
+    static Float Set(float f) { return f; }
+
+    static Float Add(Float a, Float b) { return a + b; }
+    static Float Sub(Float a, Float b) { return a - b; }
+    static Float Mul(Float a, Float b) { return a * b; }
+    static Float Abs(Float a) { return std::abs(a); }
+    static Float Min(Float a, Float b) { return std::min(a, b); }
+    static Float Max(Float a, Float b) { return std::max(a, b); }
+
+    static Mask Less(Float a, Float b) { return a < b; }
+    static Mask LessEqual(Float a, Float b) { return a <= b; }
+    static Mask Or(Mask a, Mask b) { return a || b; }
+    static Mask And(Mask a, Mask b) { return a && b; }
+    static Mask AndNot(Mask a, Mask b) { return !a && b; }
+    static Mask True() { return true; }
+    static Mask False() { return false; }
+
+    static Uint32 GetBits(Mask m) { return m ? 1u : 0u; }
+};
+
+#if DILIGENT_AVX2_ENABLED
+struct SIMDOps
+{
+    static constexpr Uint32 Width = 8;
+
+    using Float = __m256;
+    using Mask  = __m256;
+
+    static Float Load(const float* p) { return _mm256_loadu_ps(p); }
+    static Float Set(float f) { return _mm256_set1_ps(f); }
+
+    static Float Add(Float a, Float b) { return _mm256_add_ps(a, b); }
+    static Float Sub(Float a, Float b) { return _mm256_sub_ps(a, b); }
+    static Float Mul(Float a, Float b) { return _mm256_mul_ps(a, b); }
+    static Float Abs(Float a) { return _mm256_andnot_ps(_mm256_set1_ps(-0.f), a); }
+    static Float Min(Float a, Float b) { return _mm256_min_ps(a, b); }
+    static Float Max(Float a, Float b) { return _mm256_max_ps(a, b); }
+
+    static Mask Less(Float a, Float b) { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+    static Mask LessEqual(Float a, Float b) { return _mm256_cmp_ps(a, b, _CMP_LE_OQ); }
+    static Mask Or(Mask a, Mask b) { return _mm256_or_ps(a, b); }
+    static Mask And(Mask a, Mask b) { return _mm256_and_ps(a, b); }
+    static Mask AndNot(Mask a, Mask b) { return _mm256_andnot_ps(a, b); }
+    static Mask True() { return _mm256_castsi256_ps(_mm256_set1_epi32(-1)); }
+    static Mask False() { return _mm256_setzero_ps(); }
+
+    static Uint32 GetBits(Mask m) { return static_cast<Uint32>(_mm256_movemask_ps(m)); }
+};
+#elif DILIGENT_SSE2_ENABLED
+struct SIMDOps
+{
+    static constexpr Uint32 Width = 4;
+
+    using Float = __m128;
+    using Mask  = __m128;
+
+    static Float Load(const float* p) { return _mm_loadu_ps(p); }
+    static Float Set(float f) { return _mm_set1_ps(f); }
+
+    static Float Add(Float a, Float b) { return _mm_add_ps(a, b); }
+    static Float Sub(Float a, Float b) { return _mm_sub_ps(a, b); }
+    static Float Mul(Float a, Float b) { return _mm_mul_ps(a, b); }
+    static Float Abs(Float a) { return _mm_andnot_ps(_mm_set1_ps(-0.f), a); }
+    static Float Min(Float a, Float b) { return _mm_min_ps(a, b); }
+    static Float Max(Float a, Float b) { return _mm_max_ps(a, b); }
+
+    static Mask Less(Float a, Float b) { return _mm_cmplt_ps(a, b); }
+    static Mask LessEqual(Float a, Float b) { return _mm_cmple_ps(a, b); }
+    static Mask Or(Mask a, Mask b) { return _mm_or_ps(a, b); }
+    static Mask And(Mask a, Mask b) { return _mm_and_ps(a, b); }
+    static Mask AndNot(Mask a, Mask b) { return _mm_andnot_ps(a, b); }
+    static Mask True() { return _mm_castsi128_ps(_mm_set1_epi32(-1)); }
+    static Mask False() { return _mm_setzero_ps(); }
+
+    static Uint32 GetBits(Mask m) { return static_cast<Uint32>(_mm_movemask_ps(m)); }
+};
+#elif DILIGENT_NEON_ENABLED
+struct SIMDOps
+{
+    static constexpr Uint32 Width = 4;
+
+    using Float = float32x4_t;
+    using Mask  = uint32x4_t;
+
+    static Float Load(const float* p) { return vld1q_f32(p); }
+    static Float Set(float f) { return vdupq_n_f32(f); }
+
+    static Float Add(Float a, Float b) { return vaddq_f32(a, b); }
+    static Float Sub(Float a, Float b) { return vsubq_f32(a, b); }
+    static Float Mul(Float a, Float b) { return vmulq_f32(a, b); }
+    static Float Abs(Float a) { return vabsq_f32(a); }
+    static Float Min(Float a, Float b) { return vminq_f32(a, b); }
+    static Float Max(Float a, Float b) { return vmaxq_f32(a, b); }
+
+    static Mask Less(Float a, Float b) { return vcltq_f32(a, b); }
+    static Mask LessEqual(Float a, Float b) { return vcleq_f32(a, b); }
+    static Mask Or(Mask a, Mask b) { return vorrq_u32(a, b); }
+    static Mask And(Mask a, Mask b) { return vandq_u32(a, b); }
+    static Mask AndNot(Mask a, Mask b) { return vbicq_u32(b, a); }
+    static Mask True() { return vdupq_n_u32(~0u); }
+    static Mask False() { return vdupq_n_u32(0); }
+
+    static Uint32 GetBits(Mask m)
+    {
+        static const Uint32 Bits[] = {1, 2, 4, 8};
+        return vaddvq_u32(vandq_u32(m, vld1q_u32(Bits)));
+    }
+};
+#else
+using SIMDOps = ScalarOps;
+#endif
+
+struct CullingContext
+{
+    Uint32 NumPlanes = 0;
+
+    float Normal[ViewFrustum::NUM_PLANES][3]    = {};
+    float AbsNormal[ViewFrustum::NUM_PLANES][3] = {};
+    float Distance[ViewFrustum::NUM_PLANES]     = {};
+
+    // Frustum corners are only tested when all planes are enabled
+    const ViewFrustumExt* pFrustumExt = nullptr;
+
+    float CornerMin[3] = {};
+    float CornerMax[3] = {};
+
+    CullingContext(const ViewFrustum& Frustum, const ViewFrustumExt* _pFrustumExt, FRUSTUM_PLANE_FLAGS PlaneFlags)
+    {
+        for (Uint32 plane_idx = 0; plane_idx < ViewFrustum::NUM_PLANES; ++plane_idx)
+        {
+            if ((PlaneFlags & (1 << plane_idx)) == 0)
+                continue;
+
+            const Plane3D& Plane = Frustum.GetPlane(static_cast<ViewFrustum::PLANE_IDX>(plane_idx));
+            for (Uint32 c = 0; c < 3; ++c)
+            {
+                Normal[NumPlanes][c]    = Plane.Normal[c];
+                AbsNormal[NumPlanes][c] = std::abs(Plane.Normal[c]);
+            }
+            Distance[NumPlanes] = Plane.Distance;
+            ++NumPlanes;
+        }
+
+        if (_pFrustumExt != nullptr && (PlaneFlags & FRUSTUM_PLANE_FLAG_FULL_FRUSTUM) == FRUSTUM_PLANE_FLAG_FULL_FRUSTUM)
+        {
+            pFrustumExt = _pFrustumExt;
+            for (Uint32 c = 0; c < 3; ++c)
+            {
+                CornerMin[c] = CornerMax[c] = pFrustumExt->FrustumCorners[0][c];
+                for (Uint32 i = 1; i < 8; ++i)
+                {
+                    CornerMin[c] = std::min(CornerMin[c], pFrustumExt->FrustumCorners[i][c]);
+                    CornerMax[c] = std::max(CornerMax[c], pFrustumExt->FrustumCorners[i][c]);
+                }
+            }
+        }
+    }
+};
+
+// Combines the plane test results into the box visibility:
+// the box is invisible if it is outside of any plane, and is fully visible if it is inside all planes.
+template <typename Ops>
+struct VisibilityAccumulator
+{
+    typename Ops::Mask Invisible    = Ops::False();
+    typename Ops::Mask FullyVisible = Ops::True();
+
+    void AddPlane(typename Ops::Float Distance, typename Ops::Float ProjHalfLen)
+    {
+        // 0 - x only differs from -x for zero, where the sign does not affect the comparison
+        Invisible    = Ops::Or(Invisible, Ops::Less(Distance, Ops::Sub(Ops::Set(0), ProjHalfLen)));
+        FullyVisible = Ops::And(FullyVisible, Ops::Less(ProjHalfLen, Distance));
+    }
+};
+
+// Min/max axis-aligned boxes, see GetBoxVisibilityAgainstPlane(const Plane3D&, const BoundBox&)
+template <typename Ops>
+void TestBoxes(const CullingContext& Ctx, const typename Ops::Float Min[3], const typename Ops::Float Max[3], Uint32& InvisibleBits, Uint32& FullyVisibleBits)
+{
+    using Float = typename Ops::Float;
+
+    const Float Sum[]  = {Ops::Add(Max[0], Min[0]), Ops::Add(Max[1], Min[1]), Ops::Add(Max[2], Min[2])};
+    const Float Diff[] = {Ops::Sub(Max[0], Min[0]), Ops::Sub(Max[1], Min[1]), Ops::Sub(Max[2], Min[2])};
+    const Float Half   = Ops::Set(0.5f);
+
+    VisibilityAccumulator<Ops> Vis;
+    for (Uint32 p = 0; p < Ctx.NumPlanes; ++p)
+    {
+        const auto* N = Ctx.Normal[p];
+        const auto* A = Ctx.AbsNormal[p];
+
+        // dot(Box.Max + Box.Min, Plane.Normal) * 0.5f + Plane.Distance
+        const Float Distance = Ops::Add(Ops::Mul(Ops::Add(Ops::Add(Ops::Mul(Sum[0], Ops::Set(N[0])), Ops::Mul(Sum[1], Ops::Set(N[1]))), Ops::Mul(Sum[2], Ops::Set(N[2]))), Half), Ops::Set(Ctx.Distance[p]));
+        // dot(Box.Max - Box.Min, abs(Plane.Normal)) * 0.5f
+        const Float ProjHalfLen = Ops::Mul(Ops::Add(Ops::Add(Ops::Mul(Diff[0], Ops::Set(A[0])), Ops::Mul(Diff[1], Ops::Set(A[1]))), Ops::Mul(Diff[2], Ops::Set(A[2]))), Half);
+        Vis.AddPlane(Distance, ProjHalfLen);
+    }
+
+    if (Ctx.pFrustumExt != nullptr)
+    {
+        // The box is invisible if all frustum corners are outside one of the box planes
+        typename Ops::Mask CornersOutside = Ops::False();
+        for (Uint32 c = 0; c < 3; ++c)
+        {
+            CornersOutside = Ops::Or(CornersOutside, Ops::LessEqual(Max[c], Ops::Set(Ctx.CornerMin[c])));
+            CornersOutside = Ops::Or(CornersOutside, Ops::LessEqual(Ops::Set(Ctx.CornerMax[c]), Min[c]));
+        }
+        Vis.Invisible = Ops::Or(Vis.Invisible, Ops::AndNot(Vis.FullyVisible, CornersOutside));
+    }
+
+    InvisibleBits    = Ops::GetBits(Vis.Invisible);
+    FullyVisibleBits = Ops::GetBits(Vis.FullyVisible);
+}
+
+// Oriented boxes, see GetBoxVisibilityAgainstPlane(const Plane3D&, const OrientedBoundingBox&).
+// When Axes is null, the box axes are the coordinate axes.
+template <typename Ops>
+void TestOrientedBoxes(const CullingContext&     Ctx,
+                       const typename Ops::Float Center[3],
+                       const typename Ops::Float (*Axes)[3],
+                       const typename Ops::Float HalfExtents[3],
+                       Uint32&                   InvisibleBits,
+                       Uint32&                   FullyVisibleBits)
+{
+    using Float = typename Ops::Float;
+
+    auto Dot = [](const Float v[3], const float* n) {
+        return Ops::Add(Ops::Add(Ops::Mul(v[0], Ops::Set(n[0])), Ops::Mul(v[1], Ops::Set(n[1]))), Ops::Mul(v[2], Ops::Set(n[2])));
+    };
+
+    VisibilityAccumulator<Ops> Vis;
+    for (Uint32 p = 0; p < Ctx.NumPlanes; ++p)
+    {
+        const auto* N = Ctx.Normal[p];
+
+        // dot(Box.Center, Plane.Normal) + Plane.Distance
+        const Float Distance = Ops::Add(Dot(Center, N), Ops::Set(Ctx.Distance[p]));
+
+        // abs(dot(Box.Axes[i], Plane.Normal)) * Box.HalfExtents[i]
+        Float ProjHalfExtents[3];
+        for (Uint32 a = 0; a < 3; ++a)
+        {
+            const Float AbsDot = Axes != nullptr ? Ops::Abs(Dot(Axes[a], N)) : Ops::Set(Ctx.AbsNormal[p][a]);
+            ProjHalfExtents[a] = Ops::Mul(AbsDot, HalfExtents[a]);
+        }
+        Vis.AddPlane(Distance, Ops::Add(Ops::Add(ProjHalfExtents[0], ProjHalfExtents[1]), ProjHalfExtents[2]));
+    }
+
+    if (Ctx.pFrustumExt != nullptr)
+    {
+        // The box is invisible if all frustum corners are outside one of the box planes
+        typename Ops::Mask CornersOutside = Ops::False();
+        if (Axes != nullptr)
+        {
+            Float MinProj[3];
+            Float MaxProj[3];
+            for (Uint32 i = 0; i < 8; ++i)
+            {
+                const auto& FrustumCorner = Ctx.pFrustumExt->FrustumCorners[i];
+
+                const Float Corner[] = {
+                    Ops::Sub(Ops::Set(FrustumCorner.x), Center[0]),
+                    Ops::Sub(Ops::Set(FrustumCorner.y), Center[1]),
+                    Ops::Sub(Ops::Set(FrustumCorner.z), Center[2]),
+                };
+                for (Uint32 a = 0; a < 3; ++a)
+                {
+                    const Float Proj = Ops::Add(Ops::Add(Ops::Mul(Corner[0], Axes[a][0]), Ops::Mul(Corner[1], Axes[a][1])), Ops::Mul(Corner[2], Axes[a][2]));
+
+                    MinProj[a] = i == 0 ? Proj : Ops::Min(MinProj[a], Proj);
+                    MaxProj[a] = i == 0 ? Proj : Ops::Max(MaxProj[a], Proj);
+                }
+            }
+            for (Uint32 a = 0; a < 3; ++a)
+            {
+                CornersOutside = Ops::Or(CornersOutside, Ops::LessEqual(HalfExtents[a], MinProj[a]));
+                CornersOutside = Ops::Or(CornersOutside, Ops::LessEqual(MaxProj[a], Ops::Sub(Ops::Set(0), HalfExtents[a])));
+            }
+        }
+        else
+        {
+            for (Uint32 a = 0; a < 3; ++a)
+            {
+                CornersOutside = Ops::Or(CornersOutside, Ops::LessEqual(HalfExtents[a], Ops::Sub(Ops::Set(Ctx.CornerMin[a]), Center[a])));
+                CornersOutside = Ops::Or(CornersOutside, Ops::LessEqual(Ops::Sub(Ops::Set(Ctx.CornerMax[a]), Center[a]), Ops::Sub(Ops::Set(0), HalfExtents[a])));
+            }
+        }
+        Vis.Invisible = Ops::Or(Vis.Invisible, Ops::AndNot(Vis.FullyVisible, CornersOutside));
+    }
+
+    InvisibleBits    = Ops::GetBits(Vis.Invisible);
+    FullyVisibleBits = Ops::GetBits(Vis.FullyVisible);
+}
+
+struct MinMaxSOASource
+{
+    const BoundBoxMinMaxSOA& Boxes;
+
+    template <typename Ops>
+    void Test(const CullingContext& Ctx, Uint32 i, Uint32& InvisibleBits, Uint32& FullyVisibleBits) const
+    {
+        const typename Ops::Float Min[] = {Ops::Load(Boxes.Min[0] + i), Ops::Load(Boxes.Min[1] + i), Ops::Load(Boxes.Min[2] + i)};
+        const typename Ops::Float Max[] = {Ops::Load(Boxes.Max[0] + i), Ops::Load(Boxes.Max[1] + i), Ops::Load(Boxes.Max[2] + i)};
+        TestBoxes<Ops>(Ctx, Min, Max, InvisibleBits, FullyVisibleBits);
+    }
+};
+
+struct BoundBoxArraySource
+{
+    const BoundBox* pBoxes;
+
+    template <typename Ops>
+    void Test(const CullingContext& Ctx, Uint32 i, Uint32& InvisibleBits, Uint32& FullyVisibleBits) const
+    {
+        // Transpose the boxes into the structure-of-arrays layout
+        float MinMax[6][Ops::Width];
+        for (Uint32 b = 0; b < Ops::Width; ++b)
+        {
+            const BoundBox& Box = pBoxes[i + b];
+            for (Uint32 c = 0; c < 3; ++c)
+            {
+                MinMax[c][b]     = Box.Min[c];
+                MinMax[3 + c][b] = Box.Max[c];
+            }
+        }
+        const typename Ops::Float Min[] = {Ops::Load(MinMax[0]), Ops::Load(MinMax[1]), Ops::Load(MinMax[2])};
+        const typename Ops::Float Max[] = {Ops::Load(MinMax[3]), Ops::Load(MinMax[4]), Ops::Load(MinMax[5])};
+        TestBoxes<Ops>(Ctx, Min, Max, InvisibleBits, FullyVisibleBits);
+    }
+};
+
+struct CenterExtentsSOASource
+{
+    const BoundBoxCenterExtentsSOA& Boxes;
+
+    template <typename Ops>
+    void Test(const CullingContext& Ctx, Uint32 i, Uint32& InvisibleBits, Uint32& FullyVisibleBits) const
+    {
+        const typename Ops::Float Center[]      = {Ops::Load(Boxes.Center[0] + i), Ops::Load(Boxes.Center[1] + i), Ops::Load(Boxes.Center[2] + i)};
+        const typename Ops::Float HalfExtents[] = {Ops::Load(Boxes.HalfExtents[0] + i), Ops::Load(Boxes.HalfExtents[1] + i), Ops::Load(Boxes.HalfExtents[2] + i)};
+        TestOrientedBoxes<Ops>(Ctx, Center, nullptr, HalfExtents, InvisibleBits, FullyVisibleBits);
+    }
+};
+
+struct OrientedSOASource
+{
+    const OrientedBoundingBoxSOA& Boxes;
+
+    template <typename Ops>
+    void Test(const CullingContext& Ctx, Uint32 i, Uint32& InvisibleBits, Uint32& FullyVisibleBits) const
+    {
+        const typename Ops::Float Center[] = {Ops::Load(Boxes.Center[0] + i), Ops::Load(Boxes.Center[1] + i), Ops::Load(Boxes.Center[2] + i)};
+
+        typename Ops::Float Axes[3][3];
+        for (Uint32 a = 0; a < 3; ++a)
+        {
+            for (Uint32 c = 0; c < 3; ++c)
+                Axes[a][c] = Ops::Load(Boxes.Axes[a][c] + i);
+        }
+        const typename Ops::Float HalfExtents[] = {Ops::Load(Boxes.HalfExtents[0] + i), Ops::Load(Boxes.HalfExtents[1] + i), Ops::Load(Boxes.HalfExtents[2] + i)};
+        TestOrientedBoxes<Ops>(Ctx, Center, Axes, HalfExtents, InvisibleBits, FullyVisibleBits);
+    }
+};
+
+template <typename Ops, typename SourceType>
+void TestBoxRange(const CullingContext&            Ctx,
+                  const SourceType&                Source,
+                  Uint32                           Start,
+                  Uint32                           End,
+                  const GetBoxesVisibilityAttribs& Attribs,
+                  Uint32*                          pMask)
+{
+    for (Uint32 i = Start; i + Ops::Width <= End; i += Ops::Width)
+    {
+        Uint32 InvisibleBits    = 0;
+        Uint32 FullyVisibleBits = 0;
+        Source.template Test<Ops>(Ctx, i, InvisibleBits, FullyVisibleBits);
+
+        // Start is aligned to 32 and the width is a power of two, so all bits go to the same mask element
+        pMask[i / 32] |= (~InvisibleBits & ((1u << Ops::Width) - 1u)) << (i % 32);
+
+        if (Attribs.pVisibility != nullptr)
+        {
+            for (Uint32 b = 0; b < Ops::Width; ++b)
+            {
+                Attribs.pVisibility[i + b] = (InvisibleBits & (1u << b)) ?
+                    BoxVisibility::Invisible :
+                    ((FullyVisibleBits & (1u << b)) ? BoxVisibility::FullyVisible : BoxVisibility::Intersecting);
+            }
+        }
+    }
+}
+
+template <typename SourceType>
+Uint32 GetBoxesVisibilityImpl(const ViewFrustum&               Frustum,
+                              const ViewFrustumExt*            pFrustumExt,
+                              const SourceType&                Source,
+                              const GetBoxesVisibilityAttribs& Attribs)
+{
+    const Uint32 NumBoxes = Attribs.NumBoxes;
+    if (NumBoxes == 0)
+        return 0;
+
+    const CullingContext Ctx{Frustum, pFrustumExt, Attribs.PlaneFlags};
+
+    const Uint32 NumMaskElements = (NumBoxes + 31) / 32;
+
+    std::vector<Uint32> TmpMask;
+    Uint32*             pMask = Attribs.pVisibilityMask;
+    if (pMask == nullptr)
+    {
+        TmpMask.resize(NumMaskElements);
+        pMask = TmpMask.data();
+    }
+
+    // Every chunk writes its own range of the mask elements
+    constexpr Uint32 ChunkSize = 4096;
+    static_assert(ChunkSize % 32 == 0 && ChunkSize % SIMDOps::Width == 0, "Chunk size must be a multiple of 32 and SIMD width");
+
+    const Uint32 NumChunks = (NumBoxes + ChunkSize - 1) / ChunkSize;
+    ProcessInParallel(Attribs.pThreadPool, NumChunks,
+                      [&](Uint32 Chunk) {
+                          const Uint32 Start = Chunk * ChunkSize;
+                          const Uint32 End   = std::min(Start + ChunkSize, NumBoxes);
+                          std::fill(pMask + Start / 32, pMask + (End + 31) / 32, 0u);
+
+                          const Uint32 SIMDEnd = Start + (End - Start) / SIMDOps::Width * SIMDOps::Width;
+                          TestBoxRange<SIMDOps>(Ctx, Source, Start, SIMDEnd, Attribs, pMask);
+                          TestBoxRange<ScalarOps>(Ctx, Source, SIMDEnd, End, Attribs, pMask);
+                      });
+
+    Uint32 NumVisible = 0;
+    for (Uint32 i = 0; i < NumMaskElements; ++i)
+    {
+        Uint32 Bits = pMask[i];
+        if (Attribs.pVisibleIndices != nullptr)
+        {
+            while (Bits != 0)
+            {
+                Attribs.pVisibleIndices[NumVisible++] = i * 32 + PlatformMisc::GetLSB(Bits);
+                Bits &= Bits - 1;
+            }
+        }
+        else
+        {
+            NumVisible += PlatformMisc::CountOneBits(Bits);
+        }
+    }
+
+    return NumVisible;
+}
+
+} // namespace
+
+Uint32 GetBoxesVisibility(const ViewFrustum& Frustum, const BoundBoxMinMaxSOA& Boxes, const GetBoxesVisibilityAttribs& Attribs)
+{
+    return GetBoxesVisibilityImpl(Frustum, nullptr, MinMaxSOASource{Boxes}, Attribs);
+}
+
+Uint32 GetBoxesVisibility(const ViewFrustum& Frustum, const BoundBoxCenterExtentsSOA& Boxes, const GetBoxesVisibilityAttribs& Attribs)
+{
+    return GetBoxesVisibilityImpl(Frustum, nullptr, CenterExtentsSOASource{Boxes}, Attribs);
+}
+
+Uint32 GetBoxesVisibility(const ViewFrustum& Frustum, const OrientedBoundingBoxSOA& Boxes, const GetBoxesVisibilityAttribs& Attribs)
+{
+    return GetBoxesVisibilityImpl(Frustum, nullptr, OrientedSOASource{Boxes}, Attribs);
+}
+
+Uint32 GetBoxesVisibility(const ViewFrustum& Frustum, const BoundBox* pBoxes, const GetBoxesVisibilityAttribs& Attribs)
+{
+    return GetBoxesVisibilityImpl(Frustum, nullptr, BoundBoxArraySource{pBoxes}, Attribs);
+}
+
+Uint32 GetBoxesVisibility(const ViewFrustumExt& FrustumExt, const BoundBoxMinMaxSOA& Boxes, const GetBoxesVisibilityAttribs& Attribs)
+{
+    return GetBoxesVisibilityImpl(FrustumExt, &FrustumExt, MinMaxSOASource{Boxes}, Attribs);
+}
+
+Uint32 GetBoxesVisibility(const ViewFrustumExt& FrustumExt, const BoundBoxCenterExtentsSOA& Boxes, const GetBoxesVisibilityAttribs& Attribs)
+{
+    return GetBoxesVisibilityImpl(FrustumExt, &FrustumExt, CenterExtentsSOASource{Boxes}, Attribs);
+}
+
+Uint32 GetBoxesVisibility(const ViewFrustumExt& FrustumExt, const OrientedBoundingBoxSOA& Boxes, const GetBoxesVisibilityAttribs& Attribs)
+{
+    return GetBoxesVisibilityImpl(FrustumExt, &FrustumExt, OrientedSOASource{Boxes}, Attribs);
+}
+
+Uint32 GetBoxesVisibility(const ViewFrustumExt& FrustumExt, const BoundBox* pBoxes, const GetBoxesVisibilityAttribs& Attribs)
+{
+    return GetBoxesVisibilityImpl(FrustumExt, &FrustumExt, BoundBoxArraySource{pBoxes}, Attribs);
+}
+
+} // namespace Diligent
@@ -27,6 +27,8 @@
 
 #include "pch.h"
 #include <algorithm>
+#include <atomic>
+#include <cstddef>
 #include "FixedBlockMemoryAllocator.hpp"
 #include "Align.hpp"
 
@@ -42,54 +44,60 @@ inline void FillWithDebugPattern(void* ptr, Uint8 Pattern, size_t NumBytes)
 #    define FillWithDebugPattern(...)
 #endif
 
-FixedBlockMemoryAllocator::MemoryPage::MemoryPage(FixedBlockMemoryAllocator& OwnerAllocator) :
-    // clang-format off
-    m_NumFreeBlocks       {OwnerAllocator.m_NumBlocksInPage},
-    m_NumInitializedBlocks{0},
-    m_pOwnerAllocator     {&OwnerAllocator}
-// clang-format on
+static size_t AdjustBlockSize(size_t BlockSize)
 {
-    const auto PageSize = OwnerAllocator.m_BlockSize * OwnerAllocator.m_NumBlocksInPage;
-    VERIFY_EXPR(PageSize > 0);
-    m_pPageStart = reinterpret_cast<Uint8*>(
-        OwnerAllocator.m_RawMemoryAllocator.Allocate(PageSize, "FixedBlockMemoryAllocator page", __FILE__, __LINE__));
-    m_pNextFreeBlock = m_pPageStart;
-    FillWithDebugPattern(m_pPageStart, NewPageMemPattern, PageSize);
+    return AlignUp(BlockSize, sizeof(void*));
 }
 
-FixedBlockMemoryAllocator::MemoryPage::MemoryPage(MemoryPage&& Page) noexcept :
-    // clang-format off
-    m_NumFreeBlocks       {Page.m_NumFreeBlocks       },
-    m_NumInitializedBlocks{Page.m_NumInitializedBlocks},
-    m_pPageStart          {Page.m_pPageStart          },
-    m_pNextFreeBlock      {Page.m_pNextFreeBlock      },
-    m_pOwnerAllocator     {Page.m_pOwnerAllocator     }
-// clang-format on
+// Blocks start right after the page object
+static constexpr size_t PageHeaderSize = (sizeof(void*) * 8 + alignof(std::max_align_t) - 1) & ~(alignof(std::max_align_t) - 1);
+
+static size_t ComputePageSize(size_t BlockSize, Uint32 NumBlocksInPage)
+{
+    if (BlockSize == 0)
+        return 0;
+
+    // The page size must be a power of two so that pages can be aligned by their size
+    const size_t MinPageSize = PageHeaderSize + BlockSize * std::max(NumBlocksInPage, 1u);
+    size_t       PageSize    = 256;
+    while (PageSize < MinPageSize)
+        PageSize *= 2;
+    return PageSize;
+}
+
+// Returns the index of the block cache used by the calling thread.
+// Threads are assigned to the caches in a round-robin fashion when they
+// first use any fixed block allocator.
+static Uint32 GetThreadCacheIndex(Uint32 NumThreadCaches)
 {
-    Page.m_NumFreeBlocks        = 0;
-    Page.m_NumInitializedBlocks = 0;
-    Page.m_pPageStart           = nullptr;
-    Page.m_pNextFreeBlock       = nullptr;
-    Page.m_pOwnerAllocator      = nullptr;
+    static std::atomic<Uint32>       NextThreadId{0};
+    static thread_local const Uint32 ThreadId = NextThreadId.fetch_add(1);
+    return ThreadId % NumThreadCaches;
 }
 
-FixedBlockMemoryAllocator::MemoryPage::~MemoryPage()
+FixedBlockMemoryAllocator::MemoryPage::MemoryPage(FixedBlockMemoryAllocator& OwnerAllocator) :
+    // clang-format off
+    m_pOwnerAllocator     {&OwnerAllocator},
+    m_NumFreeBlocks       {OwnerAllocator.m_NumBlocksInPage},
+    m_NumInitializedBlocks{0}
+// clang-format on
 {
-    if (m_pOwnerAllocator)
-        m_pOwnerAllocator->m_RawMemoryAllocator.Free(m_pPageStart);
+    static_assert(sizeof(MemoryPage) <= PageHeaderSize, "Page header size is too small");
+    VERIFY_EXPR(OwnerAllocator.m_PageSize > 0);
+    m_pNextFreeBlock = GetBlockStartAddress(0);
+    FillWithDebugPattern(m_pNextFreeBlock, NewPageMemPattern, OwnerAllocator.m_PageSize - PageHeaderSize);
 }
 
 void* FixedBlockMemoryAllocator::MemoryPage::GetBlockStartAddress(Uint32 BlockIndex) const
 {
-    VERIFY_EXPR(m_pOwnerAllocator != nullptr);
     VERIFY(BlockIndex < m_pOwnerAllocator->m_NumBlocksInPage, "Invalid block index");
-    return reinterpret_cast<Uint8*>(m_pPageStart) + BlockIndex * m_pOwnerAllocator->m_BlockSize;
+    return reinterpret_cast<Uint8*>(const_cast<MemoryPage*>(this)) + PageHeaderSize + BlockIndex * m_pOwnerAllocator->m_BlockSize;
 }
 
 #ifdef DILIGENT_DEBUG
 void FixedBlockMemoryAllocator::MemoryPage::dbgVerifyAddress(const void* pBlockAddr) const
 {
-    size_t Delta = reinterpret_cast<const Uint8*>(pBlockAddr) - reinterpret_cast<Uint8*>(m_pPageStart);
+    size_t Delta = reinterpret_cast<const Uint8*>(pBlockAddr) - reinterpret_cast<const Uint8*>(GetBlockStartAddress(0));
     VERIFY(Delta % m_pOwnerAllocator->m_BlockSize == 0, "Invalid address");
     Uint32 BlockIndex = static_cast<Uint32>(Delta / m_pOwnerAllocator->m_BlockSize);
     VERIFY(BlockIndex < m_pOwnerAllocator->m_NumBlocksInPage, "Invalid block index");
@@ -100,8 +108,6 @@ void FixedBlockMemoryAllocator::MemoryPage::dbgVerifyAddress(const void* pBlockA
 
 void* FixedBlockMemoryAllocator::MemoryPage::Allocate()
 {
-    VERIFY_EXPR(m_pOwnerAllocator != nullptr);
-
     if (m_NumFreeBlocks == 0)
     {
         VERIFY_EXPR(m_NumInitializedBlocks == m_pOwnerAllocator->m_NumBlocksInPage);
@@ -153,8 +159,6 @@ void* FixedBlockMemoryAllocator::MemoryPage::Allocate()
 
 void FixedBlockMemoryAllocator::MemoryPage::DeAllocate(void* p)
 {
-    VERIFY_EXPR(m_pOwnerAllocator != nullptr);
-
     dbgVerifyAddress(p);
     FillWithDebugPattern(p, DeallocatedBlockMemPattern, m_pOwnerAllocator->m_BlockSize);
     // Add block to the beginning of the linked list
@@ -164,47 +168,137 @@ void FixedBlockMemoryAllocator::MemoryPage::DeAllocate(void* p)
 }
 
 
-static size_t AdjustBlockSize(size_t BlockSize)
-{
-    return AlignUp(BlockSize, sizeof(void*));
-}
-
 FixedBlockMemoryAllocator::FixedBlockMemoryAllocator(IMemoryAllocator& RawMemoryAllocator,
                                                      size_t            BlockSize,
                                                      Uint32            NumBlocksInPage) :
     // clang-format off
-    m_PagePool          (STD_ALLOCATOR_RAW_MEM(MemoryPage, RawMemoryAllocator, "Allocator for vector<MemoryPage>")),
-    m_AvailablePages    (STD_ALLOCATOR_RAW_MEM(size_t, RawMemoryAllocator, "Allocator for unordered_set<size_t>") ),
-    m_AddrToPageId      (STD_ALLOCATOR_RAW_MEM(AddrToPageIdMapElem, RawMemoryAllocator, "Allocator for unordered_map<void*, size_t>")),
+    m_Chunks            (STD_ALLOCATOR_RAW_MEM(void*, RawMemoryAllocator, "Allocator for vector<void*>")),
+    m_Pages             (STD_ALLOCATOR_RAW_MEM(MemoryPage*, RawMemoryAllocator, "Allocator for vector<MemoryPage*>")),
     m_RawMemoryAllocator{RawMemoryAllocator        },
     m_BlockSize         {AdjustBlockSize(BlockSize)},
-    m_NumBlocksInPage   {NumBlocksInPage           }
+    m_PageSize          {ComputePageSize(m_BlockSize, NumBlocksInPage)},
+    // Use all space that remains in the page after rounding its size up to the power of two
+    m_NumBlocksInPage   {m_BlockSize > 0 ? static_cast<Uint32>((m_PageSize - PageHeaderSize) / m_BlockSize) : 0}
+#ifdef DILIGENT_DEBUG
+  , m_dbgAllocations    (STD_ALLOCATOR_RAW_MEM(void*, RawMemoryAllocator, "Allocator for unordered_set<void*>"))
+#endif
 // clang-format on
 {
-    // Allocate one page
+    // Allocate the first chunk
     if (m_BlockSize > 0)
     {
-        CreateNewPage();
+        CreateNewChunk();
     }
 }
 
 FixedBlockMemoryAllocator::~FixedBlockMemoryAllocator()
 {
+    for (auto& Cache : m_ThreadCaches)
+    {
+        ReleaseBlocks(Cache.Blocks, Cache.NumBlocks);
+        Cache.NumBlocks = 0;
+    }
+
 #ifdef DILIGENT_DEBUG
-    for (size_t p = 0; p < m_PagePool.size(); ++p)
+    VERIFY(m_dbgAllocations.empty(), "Memory leak detected: ", m_dbgAllocations.size(), " block(s) have not been released");
+    for (const auto* pPage : m_Pages)
     {
-        VERIFY(!m_PagePool[p].HasAllocations(), "Memory leak detected: memory page has allocated block");
-        VERIFY(m_AvailablePages.find(p) != m_AvailablePages.end(), "Memory page is not in the available page pool");
+        VERIFY(!pPage->HasAllocations(), "Memory leak detected: memory page has allocated block");
+        VERIFY(pPage->m_IsAvailable, "Memory page is not in the available page list");
     }
 #endif
+
+    for (auto* pPage : m_Pages)
+        pPage->~MemoryPage();
+
+    for (auto* pChunk : m_Chunks)
+        m_RawMemoryAllocator.Free(pChunk);
+}
+
+void FixedBlockMemoryAllocator::CreateNewChunk()
+{
+    VERIFY_EXPR(m_BlockSize > 0 && m_PageSize > 0);
+
+    // Pages are allocated in chunks that grow geometrically. The raw allocator does not support
+    // alignment, so every chunk is over-allocated by one page to align its pages by their size.
+    const Uint32 NumPages = m_NumPagesInNextChunk;
+
+    auto* pChunk = m_RawMemoryAllocator.Allocate(m_PageSize * (NumPages + 1) - 1, "FixedBlockMemoryAllocator page chunk", __FILE__, __LINE__);
+    m_Chunks.emplace_back(pChunk);
+
+    auto* pPageStart = AlignUp(reinterpret_cast<Uint8*>(pChunk), m_PageSize);
+    for (Uint32 p = 0; p < NumPages; ++p)
+    {
+        auto* pPage = new (pPageStart + p * m_PageSize) MemoryPage{*this};
+        m_Pages.emplace_back(pPage);
+        AddAvailablePage(pPage);
+    }
+
+    constexpr size_t MaxChunkSize = size_t{4} << 20;
+    if (m_PageSize * NumPages * 2 <= MaxChunkSize)
+        m_NumPagesInNextChunk = std::min(NumPages * 2, 16u);
+}
+
+void FixedBlockMemoryAllocator::AddAvailablePage(MemoryPage* pPage)
+{
+    VERIFY_EXPR(!pPage->m_IsAvailable && pPage->m_pPrevAvailable == nullptr && pPage->m_pNextAvailable == nullptr);
+    pPage->m_pNextAvailable = m_pAvailablePages;
+    if (m_pAvailablePages != nullptr)
+        m_pAvailablePages->m_pPrevAvailable = pPage;
+    m_pAvailablePages    = pPage;
+    pPage->m_IsAvailable = true;
+}
+
+void FixedBlockMemoryAllocator::RemoveAvailablePage(MemoryPage* pPage)
+{
+    VERIFY_EXPR(pPage->m_IsAvailable);
+    if (pPage->m_pPrevAvailable != nullptr)
+        pPage->m_pPrevAvailable->m_pNextAvailable = pPage->m_pNextAvailable;
+    else
+        m_pAvailablePages = pPage->m_pNextAvailable;
+    if (pPage->m_pNextAvailable != nullptr)
+        pPage->m_pNextAvailable->m_pPrevAvailable = pPage->m_pPrevAvailable;
+
+    pPage->m_pPrevAvailable = nullptr;
+    pPage->m_pNextAvailable = nullptr;
+    pPage->m_IsAvailable    = false;
 }
 
-void FixedBlockMemoryAllocator::CreateNewPage()
+FixedBlockMemoryAllocator::MemoryPage* FixedBlockMemoryAllocator::GetPage(const void* Ptr) const
 {
-    VERIFY_EXPR(m_BlockSize > 0);
-    m_PagePool.emplace_back(*this);
-    m_AvailablePages.insert(m_PagePool.size() - 1);
-    m_AddrToPageId.reserve(m_PagePool.size() * m_NumBlocksInPage);
+    return reinterpret_cast<MemoryPage*>(AlignDown(reinterpret_cast<uintptr_t>(Ptr), m_PageSize));
+}
+
+void FixedBlockMemoryAllocator::AllocateBlocks(void** ppBlocks, Uint32 NumBlocks)
+{
+    for (Uint32 i = 0; i < NumBlocks; ++i)
+    {
+        if (m_pAvailablePages == nullptr)
+        {
+            CreateNewChunk();
+        }
+
+        auto* pPage = m_pAvailablePages;
+        ppBlocks[i] = pPage->Allocate();
+        if (!pPage->HasSpace())
+        {
+            RemoveAvailablePage(pPage);
+        }
+    }
+}
+
+void FixedBlockMemoryAllocator::ReleaseBlocks(void* const* ppBlocks, Uint32 NumBlocks)
+{
+    for (Uint32 i = 0; i < NumBlocks; ++i)
+    {
+        auto* pPage = GetPage(ppBlocks[i]);
+        pPage->DeAllocate(ppBlocks[i]);
+        if (!pPage->m_IsAvailable)
+        {
+            AddAvailablePage(pPage);
+        }
+        // In current implementation pages are never released!
+    }
 }
 
 void* FixedBlockMemoryAllocator::Allocate(size_t Size, const Char* dbgDescription, const char* dbgFileName, const Int32 dbgLineNumber)
@@ -214,48 +308,114 @@ void* FixedBlockMemoryAllocator::Allocate(size_t Size, const Char* dbgDescriptio
     Size = AdjustBlockSize(Size);
     VERIFY(m_BlockSize == Size, "Requested size (", Size, ") does not match the block size (", m_BlockSize, ")");
 
-    std::lock_guard<std::mutex> LockGuard(m_Mutex);
+    auto& Cache = m_ThreadCaches[GetThreadCacheIndex(NumThreadCaches)];
+
+    void* Ptr = nullptr;
+    {
+        Threading::SpinLockGuard CacheGuard{Cache.Lock};
+        if (Cache.NumBlocks > 0)
+            Ptr = Cache.Blocks[--Cache.NumBlocks];
+    }
 
-    if (m_AvailablePages.empty())
+    if (Ptr == nullptr)
     {
-        CreateNewPage();
+        // The cache is empty - take a batch of blocks from the pages
+        void* Batch[ThreadCache::BatchSize];
+        {
+            std::lock_guard<std::mutex> LockGuard{m_Mutex};
+            AllocateBlocks(Batch, ThreadCache::BatchSize);
+        }
+        Ptr = Batch[0];
+
+        // Put the remaining blocks into the cache so that they are returned in the same order.
+        // Another thread that uses the same cache may have filled it in the meantime.
+        Uint32 NumBlocksToRelease = 0;
+        {
+            Threading::SpinLockGuard CacheGuard{Cache.Lock};
+            for (Uint32 i = ThreadCache::BatchSize - 1; i > 0; --i)
+            {
+                if (Cache.NumBlocks < ThreadCache::Capacity)
+                    Cache.Blocks[Cache.NumBlocks++] = Batch[i];
+                else
+                    Batch[NumBlocksToRelease++] = Batch[i];
+            }
+        }
+
+        if (NumBlocksToRelease > 0)
+        {
+            std::lock_guard<std::mutex> LockGuard{m_Mutex};
+            ReleaseBlocks(Batch, NumBlocksToRelease);
+        }
     }
 
-    auto  PageId = *m_AvailablePages.begin();
-    auto& Page   = m_PagePool[PageId];
-    auto* Ptr    = Page.Allocate();
-    m_AddrToPageId.insert(std::make_pair(Ptr, PageId));
-    if (!Page.HasSpace())
+#ifdef DILIGENT_DEBUG
     {
-        m_AvailablePages.erase(m_AvailablePages.begin());
+        std::lock_guard<std::mutex> dbgLock{m_dbgAllocationsMtx};
+        VERIFY(m_dbgAllocations.insert(Ptr).second, "The block has already been allocated");
     }
+#endif
+    FillWithDebugPattern(Ptr, MemoryPage::AllocatedBlockMemPattern, m_BlockSize);
 
     return Ptr;
 }
 
+Uint32 FixedBlockMemoryAllocator::GetNumAllocatedBlocks()
+{
+    std::lock_guard<std::mutex> LockGuard{m_Mutex};
+
+    Uint32 NumAllocatedBlocks = 0;
+    for (const auto* pPage : m_Pages)
+        NumAllocatedBlocks += m_NumBlocksInPage - pPage->m_NumFreeBlocks;
+
+    for (auto& Cache : m_ThreadCaches)
+    {
+        Threading::SpinLockGuard CacheGuard{Cache.Lock};
+        VERIFY_EXPR(NumAllocatedBlocks >= Cache.NumBlocks);
+        NumAllocatedBlocks -= Cache.NumBlocks;
+    }
+
+    return NumAllocatedBlocks;
+}
+
 void FixedBlockMemoryAllocator::Free(void* Ptr)
 {
-    std::lock_guard<std::mutex> LockGuard(m_Mutex);
-    auto                        PageIdIt = m_AddrToPageId.find(Ptr);
-    if (PageIdIt != m_AddrToPageId.end())
+    VERIFY_EXPR(Ptr != nullptr);
+    DEV_CHECK_ERR(GetPage(Ptr)->GetOwnerAllocator() == this, "The block was not allocated by this allocator");
+
+#ifdef DILIGENT_DEBUG
     {
-        auto PageId = PageIdIt->second;
-        VERIFY_EXPR(PageId < m_PagePool.size());
-        m_PagePool[PageId].DeAllocate(Ptr);
-        m_AvailablePages.insert(PageId);
-        m_AddrToPageId.erase(PageIdIt);
-        if (m_AvailablePages.size() > 1 && !m_PagePool[PageId].HasAllocations())
+        std::lock_guard<std::mutex> dbgLock{m_dbgAllocationsMtx};
+        if (m_dbgAllocations.erase(Ptr) == 0)
         {
-            // In current implementation pages are never released!
-            // Note that if we delete a page, all indices past it will be invalid
+            UNEXPECTED("Address not found in the allocations list - double freeing memory?");
+            return;
+        }
+    }
+    GetPage(Ptr)->dbgVerifyAddress(Ptr);
+#endif
+    FillWithDebugPattern(Ptr, MemoryPage::DeallocatedBlockMemPattern, m_BlockSize);
+
+    auto& Cache = m_ThreadCaches[GetThreadCacheIndex(NumThreadCaches)];
 
-            //m_PagePool.erase(m_PagePool.begin() + PageId);
-            //m_AvailablePages.erase(PageId);
+    void*  Batch[ThreadCache::BatchSize];
+    Uint32 NumBlocksToRelease = 0;
+    {
+        Threading::SpinLockGuard CacheGuard{Cache.Lock};
+        if (Cache.NumBlocks == ThreadCache::Capacity)
+        {
+            // The cache is full - return the oldest half of the blocks to the pages
+            NumBlocksToRelease = ThreadCache::BatchSize;
+            memcpy(Batch, Cache.Blocks, sizeof(void*) * NumBlocksToRelease);
+            memmove(Cache.Blocks, Cache.Blocks + NumBlocksToRelease, sizeof(void*) * (Cache.NumBlocks - NumBlocksToRelease));
+            Cache.NumBlocks -= NumBlocksToRelease;
         }
+        Cache.Blocks[Cache.NumBlocks++] = Ptr;
     }
-    else
+
+    if (NumBlocksToRelease > 0)
     {
-        UNEXPECTED("Address not found in the allocations list - double freeing memory?");
+        std::lock_guard<std::mutex> LockGuard{m_Mutex};
+        ReleaseBlocks(Batch, NumBlocksToRelease);
     }
 }
 
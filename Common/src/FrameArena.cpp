@@ -0,0 +1,215 @@
+/*
+ *  Copyright 2019-2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "FrameArena.hpp"
+
+#include <atomic>
+#include <mutex>
+#include <algorithm>
+
+#include "DefaultRawMemoryAllocator.hpp"
+
+namespace Diligent
+{
+
+struct FrameArenaStatCounters
+{
+    std::atomic<size_t> PeakSize{0};
+    std::atomic<size_t> ReservedSize{0};
+    std::atomic<Uint64> TotalSize{0};
+    std::atomic<Uint64> NumScopes{0};
+    std::atomic<Uint64> NumOverflows{0};
+
+    FrameArena::Stats Get() const
+    {
+        FrameArena::Stats S;
+        S.PeakSize     = PeakSize.load(std::memory_order_relaxed);
+        S.ReservedSize = ReservedSize.load(std::memory_order_relaxed);
+        S.NumScopes    = NumScopes.load(std::memory_order_relaxed);
+        S.NumOverflows = NumOverflows.load(std::memory_order_relaxed);
+        S.AverageSize  = S.NumScopes > 0 ? static_cast<size_t>(TotalSize.load(std::memory_order_relaxed) / S.NumScopes) : 0;
+        return S;
+    }
+};
+
+namespace
+{
+
+std::atomic<size_t> g_FrameArenaMaxSize{FrameArena::DefaultMaxSize};
+
+class FrameArenaRegistry
+{
+public:
+    static FrameArenaRegistry& Get()
+    {
+        static FrameArenaRegistry Registry;
+        return Registry;
+    }
+
+    void Add(std::shared_ptr<FrameArenaStatCounters> pCounters)
+    {
+        std::lock_guard<std::mutex> Lock{m_Mtx};
+        m_Counters.emplace_back(std::move(pCounters));
+    }
+
+    // Removes the counters of the arena whose thread is exiting.
+    // The counters are accumulated in the single entry shared by all exited threads.
+    void Remove(const FrameArenaStatCounters& Counters)
+    {
+        std::lock_guard<std::mutex> Lock{m_Mtx};
+
+        auto it = std::find_if(m_Counters.begin(), m_Counters.end(),
+                               [&Counters](const std::shared_ptr<FrameArenaStatCounters>& pCounters) {
+                                   return pCounters.get() == &Counters;
+                               });
+        if (it == m_Counters.end())
+        {
+            UNEXPECTED("Frame arena counters are not found in the registry");
+            return;
+        }
+        m_Counters.erase(it);
+
+        const auto Stats = Counters.Get();
+        m_ExitedCounters.PeakSize.store(std::max(m_ExitedCounters.PeakSize.load(std::memory_order_relaxed), Stats.PeakSize), std::memory_order_relaxed);
+        m_ExitedCounters.TotalSize.fetch_add(Counters.TotalSize.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        m_ExitedCounters.NumScopes.fetch_add(Stats.NumScopes, std::memory_order_relaxed);
+        m_ExitedCounters.NumOverflows.fetch_add(Stats.NumOverflows, std::memory_order_relaxed);
+        m_HasExitedThreads = true;
+    }
+
+    std::vector<FrameArena::Stats> GetStats()
+    {
+        std::lock_guard<std::mutex> Lock{m_Mtx};
+
+        std::vector<FrameArena::Stats> AllStats;
+        AllStats.reserve(m_Counters.size() + 1);
+        for (const auto& pCounters : m_Counters)
+            AllStats.emplace_back(pCounters->Get());
+        if (m_HasExitedThreads)
+            AllStats.emplace_back(m_ExitedCounters.Get());
+        return AllStats;
+    }
+
+private:
+    std::mutex m_Mtx;
+    // Counters of the arenas of the running threads
+    std::vector<std::shared_ptr<FrameArenaStatCounters>> m_Counters;
+    // Combined counters of the arenas of the threads that have exited
+    FrameArenaStatCounters m_ExitedCounters;
+    bool                   m_HasExitedThreads = false;
+};
+
+} // namespace
+
+FrameArena::FrameArena() :
+    m_Allocator{DefaultRawMemoryAllocator::GetAllocator(), 16 << 10},
+    m_pStats{std::make_shared<FrameArenaStatCounters>()}
+{
+    FrameArenaRegistry::Get().Add(m_pStats);
+}
+
+FrameArena::~FrameArena()
+{
+    VERIFY(m_ScopeDepth == 0, "Frame arena is destroyed while ", m_ScopeDepth, " scope(s) are active");
+    FrameArenaRegistry::Get().Remove(*m_pStats);
+}
+
+FrameArena& FrameArena::GetThreadArena()
+{
+    static thread_local FrameArena Arena;
+    return Arena;
+}
+
+void FrameArena::SetMaxSize(size_t MaxSize)
+{
+    g_FrameArenaMaxSize.store(MaxSize, std::memory_order_relaxed);
+}
+
+size_t FrameArena::GetMaxSize()
+{
+    return g_FrameArenaMaxSize.load(std::memory_order_relaxed);
+}
+
+FrameArena::Stats FrameArena::GetStats() const
+{
+    return m_pStats->Get();
+}
+
+std::vector<FrameArena::Stats> FrameArena::GetAllStats()
+{
+    return FrameArenaRegistry::Get().GetStats();
+}
+
+Uint32 FrameArena::BeginScope()
+{
+    return ++m_ScopeDepth;
+}
+
+void FrameArena::EndScope()
+{
+    VERIFY_EXPR(m_ScopeDepth > 0);
+    if (--m_ScopeDepth > 0)
+        return;
+
+    const size_t MaxSize  = GetMaxSize();
+    const size_t UsedSize = m_Allocator.GetPeakSize();
+
+    auto& Counters = *m_pStats;
+    // Counters are only written by the owning thread
+    Counters.PeakSize.store(std::max(Counters.PeakSize.load(std::memory_order_relaxed), UsedSize), std::memory_order_relaxed);
+    Counters.TotalSize.fetch_add(UsedSize, std::memory_order_relaxed);
+    Counters.NumScopes.fetch_add(1, std::memory_order_relaxed);
+    if (UsedSize > MaxSize)
+        Counters.NumOverflows.fetch_add(1, std::memory_order_relaxed);
+
+    VERIFY(m_Allocator.GetCurrentSize() == 0, "All allocations must be released when the outermost scope ends");
+    m_Allocator.ReleaseUnusedBlocks(MaxSize);
+    m_Allocator.ResetPeakSize();
+    Counters.ReservedSize.store(m_Allocator.GetReservedSize(), std::memory_order_relaxed);
+}
+
+FrameArena::Scope::Scope() :
+    m_Arena{FrameArena::GetThreadArena()},
+    m_Marker{m_Arena.m_Allocator.GetMarker()},
+    m_Depth{m_Arena.BeginScope()}
+{
+}
+
+FrameArena::Scope::~Scope()
+{
+    VERIFY(m_Depth == m_Arena.m_ScopeDepth, "Frame arena scopes must be destroyed in the reverse order of creation");
+    m_Arena.m_Allocator.Rewind(m_Marker);
+    m_Arena.EndScope();
+}
+
+DynamicLinearAllocator& FrameArena::Scope::GetAllocator()
+{
+    DEV_CHECK_ERR(m_Depth == m_Arena.m_ScopeDepth, "Only the innermost frame arena scope may be used to allocate memory");
+    return m_Arena.m_Allocator;
+}
+
+} // namespace Diligent
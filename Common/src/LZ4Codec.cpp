@@ -0,0 +1,309 @@
+/*
+ *  Copyright 2019-2024 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "LZ4Codec.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+#include "DebugUtilities.hpp"
+
+namespace Diligent
+{
+
+namespace
+{
+
+// Minimum match length
+constexpr size_t MinMatch = 4;
+
+// The last LastLiterals bytes of the block are always literals
+constexpr size_t LastLiterals = 5;
+
+// The last match must start at least MatchFindLimit bytes before the end of the block
+constexpr size_t MatchFindLimit = 12;
+
+constexpr size_t MaxOffset = 65535;
+
+constexpr Uint32 HashLog = 12;
+
+// The length that is encoded with the extra bytes
+constexpr size_t RunMask = 15;
+
+// The size of the fixed-size copy used for short literal runs
+constexpr size_t WildCopySize = 16;
+
+inline Uint32 Read32(const Uint8* pData)
+{
+    Uint32 Val;
+    memcpy(&Val, pData, sizeof(Val));
+    return Val;
+}
+
+inline Uint32 Hash32(Uint32 Val)
+{
+    return (Val * 2654435761u) >> (32 - HashLog);
+}
+
+// Returns the number of bytes required to encode the length that does not fit into the token
+inline size_t GetExtraLengthBytes(size_t Length)
+{
+    return Length >= RunMask ? (Length - RunMask) / 255 + 1 : 0;
+}
+
+inline Uint8* WriteExtraLength(Uint8* pDst, size_t Length)
+{
+    if (Length < RunMask)
+        return pDst;
+
+    Length -= RunMask;
+    for (; Length >= 255; Length -= 255)
+        *(pDst++) = 255;
+    *(pDst++) = static_cast<Uint8>(Length);
+    return pDst;
+}
+
+// Reads the length that does not fit into the token. Returns false if the data is truncated.
+inline bool ReadExtraLength(const Uint8*& pSrc, const Uint8* pSrcEnd, size_t& Length)
+{
+    if (Length != RunMask)
+        return true;
+
+    Uint8 Byte = 0;
+    do
+    {
+        if (pSrc >= pSrcEnd)
+            return false;
+        Byte = *(pSrc++);
+        Length += Byte;
+    } while (Byte == 255);
+
+    return true;
+}
+
+class BlockWriter
+{
+public:
+    BlockWriter(void* pDst, size_t DstCapacity) :
+        m_pDst{static_cast<Uint8*>(pDst)},
+        m_pDstEnd{static_cast<Uint8*>(pDst) + DstCapacity}
+    {}
+
+    // Writes the sequence of literals optionally followed by a match. The match is
+    // not written when MatchLength is zero, which is only allowed for the last sequence.
+    bool WriteSequence(const Uint8* pLiterals, size_t NumLiterals, size_t Offset, size_t MatchLength)
+    {
+        const size_t RequiredSize =
+            1 + GetExtraLengthBytes(NumLiterals) + NumLiterals +
+            (MatchLength != 0 ? 2 + GetExtraLengthBytes(MatchLength - MinMatch) : 0);
+        if (RequiredSize > static_cast<size_t>(m_pDstEnd - m_pDst))
+            return false;
+
+        Uint8* pToken = m_pDst++;
+
+        *pToken = static_cast<Uint8>(std::min(NumLiterals, RunMask) << 4);
+        m_pDst  = WriteExtraLength(m_pDst, NumLiterals);
+        if (NumLiterals > 0)
+            memcpy(m_pDst, pLiterals, NumLiterals);
+        m_pDst += NumLiterals;
+
+        if (MatchLength != 0)
+        {
+            VERIFY_EXPR(Offset > 0 && Offset <= MaxOffset && MatchLength >= MinMatch);
+            *(m_pDst++) = static_cast<Uint8>(Offset & 0xFF);
+            *(m_pDst++) = static_cast<Uint8>(Offset >> 8);
+
+            *pToken |= static_cast<Uint8>(std::min(MatchLength - MinMatch, RunMask));
+            m_pDst = WriteExtraLength(m_pDst, MatchLength - MinMatch);
+        }
+
+        return true;
+    }
+
+    Uint8* GetPosition() const { return m_pDst; }
+
+private:
+    Uint8*       m_pDst;
+    Uint8* const m_pDstEnd;
+};
+
+} // namespace
+
+size_t GetLZ4CompressBound(size_t SrcSize)
+{
+    return SrcSize + SrcSize / 255 + 16;
+}
+
+size_t LZ4CompressBlock(const void* pSrc, size_t SrcSize, void* pDst, size_t DstCapacity)
+{
+    if ((pSrc == nullptr && SrcSize != 0) || pDst == nullptr)
+    {
+        DEV_ERROR("Source data and destination buffer must not be null");
+        return 0;
+    }
+
+    const Uint8* const pSrcStart = static_cast<const Uint8*>(pSrc);
+    const Uint8* const pSrcEnd   = pSrcStart + SrcSize;
+
+    BlockWriter Writer{pDst, DstCapacity};
+
+    const Uint8* pAnchor = pSrcStart;
+    if (SrcSize > MatchFindLimit)
+    {
+        // Positions of the last occurrences of 4-byte sequences
+        Uint32 HashTable[1u << HashLog] = {};
+
+        const Uint8* const pMatchFindLimit = pSrcEnd - MatchFindLimit;
+        const Uint8* const pMatchLimit     = pSrcEnd - LastLiterals;
+
+        const Uint8* pCurr = pSrcStart + 1;
+        // Increase the search step in incompressible data
+        Uint32 NumFailedSearches = 0;
+        while (pCurr < pMatchFindLimit)
+        {
+            const Uint32 Val   = Read32(pCurr);
+            auto&        Entry = HashTable[Hash32(Val)];
+
+            const Uint8* pRef = pSrcStart + Entry;
+            Entry             = static_cast<Uint32>(pCurr - pSrcStart);
+
+            if (pRef >= pCurr || static_cast<size_t>(pCurr - pRef) > MaxOffset || Read32(pRef) != Val)
+            {
+                pCurr += 1 + (NumFailedSearches++ >> 6);
+                continue;
+            }
+            NumFailedSearches = 0;
+
+            // Extend the match backwards
+            while (pCurr > pAnchor && pRef > pSrcStart && pCurr[-1] == pRef[-1])
+            {
+                --pCurr;
+                --pRef;
+            }
+
+            // Extend the match forward
+            size_t MatchLength = MinMatch;
+            while (pCurr + MatchLength < pMatchLimit && pCurr[MatchLength] == pRef[MatchLength])
+                ++MatchLength;
+
+            if (!Writer.WriteSequence(pAnchor, pCurr - pAnchor, pCurr - pRef, MatchLength))
+                return 0;
+
+            pCurr += MatchLength;
+            pAnchor = pCurr;
+
+            // Index the position inside the match to improve the ratio for repetitive data
+            if (pCurr < pMatchFindLimit)
+                HashTable[Hash32(Read32(pCurr - 2))] = static_cast<Uint32>(pCurr - 2 - pSrcStart);
+        }
+    }
+
+    if (!Writer.WriteSequence(pAnchor, pSrcEnd - pAnchor, 0, 0))
+        return 0;
+
+    return Writer.GetPosition() - static_cast<Uint8*>(pDst);
+}
+
+size_t LZ4DecompressBlock(const void* pSrc, size_t SrcSize, void* pDst, size_t DstCapacity)
+{
+    if (pSrc == nullptr || pDst == nullptr || SrcSize == 0)
+        return 0;
+
+    const Uint8*       pIn     = static_cast<const Uint8*>(pSrc);
+    const Uint8* const pInEnd  = pIn + SrcSize;
+    Uint8* const       pOutBeg = static_cast<Uint8*>(pDst);
+    Uint8*             pOut    = pOutBeg;
+    Uint8* const       pOutEnd = pOutBeg + DstCapacity;
+
+    while (true)
+    {
+        if (pIn >= pInEnd)
+            return 0;
+
+        const Uint8 Token = *(pIn++);
+
+        size_t NumLiterals = Token >> 4;
+        if (!ReadExtraLength(pIn, pInEnd, NumLiterals))
+            return 0;
+        if (NumLiterals <= WildCopySize && static_cast<size_t>(pInEnd - pIn) >= WildCopySize && static_cast<size_t>(pOutEnd - pOut) >= WildCopySize)
+        {
+            // Short literal runs are copied with a single fixed-size copy
+            memcpy(pOut, pIn, WildCopySize);
+        }
+        else
+        {
+            if (NumLiterals > static_cast<size_t>(pInEnd - pIn) || NumLiterals > static_cast<size_t>(pOutEnd - pOut))
+                return 0;
+            memcpy(pOut, pIn, NumLiterals);
+        }
+        pIn += NumLiterals;
+        pOut += NumLiterals;
+
+        // The last sequence contains only literals
+        if (pIn == pInEnd)
+            break;
+
+        if (pInEnd - pIn < 2)
+            return 0;
+        const size_t Offset = size_t{pIn[0]} | (size_t{pIn[1]} << 8);
+        pIn += 2;
+        if (Offset == 0 || Offset > static_cast<size_t>(pOut - pOutBeg))
+            return 0;
+
+        size_t MatchLength = Token & RunMask;
+        if (!ReadExtraLength(pIn, pInEnd, MatchLength))
+            return 0;
+        MatchLength += MinMatch;
+        if (MatchLength > static_cast<size_t>(pOutEnd - pOut))
+            return 0;
+
+        const Uint8* pMatch    = pOut - Offset;
+        Uint8* const pMatchEnd = pOut + MatchLength;
+        if (Offset >= 8 && static_cast<size_t>(pOutEnd - pMatchEnd) >= 8)
+        {
+            // Copy 8-byte chunks that may write past the end of the match. Since the offset
+            // is at least 8, every chunk only reads the data that has already been written.
+            for (; pOut < pMatchEnd; pOut += 8, pMatch += 8)
+                memcpy(pOut, pMatch, 8);
+        }
+        else if (Offset >= MatchLength)
+        {
+            memcpy(pOut, pMatch, MatchLength);
+        }
+        else
+        {
+            // Overlapping match, e.g. a short repeating pattern
+            for (Uint8* pDst = pOut; pDst < pMatchEnd; ++pDst, ++pMatch)
+                *pDst = *pMatch;
+        }
+        pOut = pMatchEnd;
+    }
+
+    return pOut - pOutBeg;
+}
+
+} // namespace Diligent
@@ -0,0 +1,91 @@
+/*
+ *  Copyright 2019-2024 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "pch.h"
+#include "MappedFileDataBlob.hpp"
+
+#include "DataBlobImpl.hpp"
+#include "FileWrapper.hpp"
+
+namespace Diligent
+{
+
+RefCntAutoPtr<IDataBlob> MappedFileDataBlob::Create(const Char* FilePath)
+{
+    if (FilePath == nullptr || FilePath[0] == '\0')
+    {
+        DEV_ERROR("File path must not be null or empty");
+        return {};
+    }
+
+    size_t Size  = 0;
+    void*  pData = FileSystem::MapFile(FilePath, Size);
+    if (pData != nullptr)
+        return RefCntAutoPtr<IDataBlob>{MakeNewRCObj<MappedFileDataBlob>()(pData, Size)};
+
+    // Memory mapping is not supported or failed - read the entire file
+    FileWrapper File{FilePath, EFileAccessMode::Read};
+    if (!File)
+    {
+        LOG_ERROR_MESSAGE("Failed to open file ", FilePath);
+        return {};
+    }
+
+    auto pDataBlob = DataBlobImpl::Create();
+    if (!File->Read(pDataBlob))
+    {
+        LOG_ERROR_MESSAGE("Failed to read file ", FilePath);
+        return {};
+    }
+
+    return RefCntAutoPtr<IDataBlob>{pDataBlob};
+}
+
+MappedFileDataBlob::MappedFileDataBlob(IReferenceCounters* pRefCounters, void* pData, size_t Size) noexcept :
+    TBase{pRefCounters},
+    m_pData{pData},
+    m_MappedSize{Size},
+    m_Size{Size}
+{
+}
+
+MappedFileDataBlob::~MappedFileDataBlob()
+{
+    FileSystem::UnmapFile(m_pData, m_MappedSize);
+}
+
+void MappedFileDataBlob::Resize(size_t NewSize)
+{
+    if (NewSize > m_MappedSize)
+    {
+        LOG_ERROR_MESSAGE("Memory-mapped data blob can't be enlarged beyond the size of the mapped file (", m_MappedSize, " bytes)");
+        return;
+    }
+    m_Size = NewSize;
+}
+
+} // namespace Diligent
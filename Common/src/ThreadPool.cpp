@@ -29,7 +29,12 @@
 #include <mutex>
 #include <thread>
 #include <map>
+#include <deque>
 #include <vector>
+#include <array>
+#include <memory>
+#include <unordered_map>
+#include <algorithm>
 #include <condition_variable>
 #include <cfloat>
 
@@ -40,32 +45,495 @@ AsyncTaskBase::~AsyncTaskBase()
 {
 }
 
-class ThreadPoolImpl final : public ObjectBase<IThreadPool>
+namespace
+{
+
+struct QueuedTaskInfo
+{
+    RefCntAutoPtr<IAsyncTask>              pTask;
+    std::vector<RefCntWeakPtr<IAsyncTask>> Prerequisites;
+};
+
+// Initializes the task info and adjusts the task priority so that it does not
+// exceed the priority of any of its prerequisites.
+QueuedTaskInfo PrepareTaskInfo(IAsyncTask*  pTask,
+                               IAsyncTask** ppPrerequisites,
+                               Uint32       NumPrerequisites)
+{
+    QueuedTaskInfo TaskInfo;
+    TaskInfo.pTask = pTask;
+    if (ppPrerequisites != nullptr && NumPrerequisites > 0)
+    {
+        TaskInfo.Prerequisites.reserve(NumPrerequisites);
+        float MinPrereqPriority = +FLT_MAX;
+        for (Uint32 i = 0; i < NumPrerequisites; ++i)
+        {
+            if (ppPrerequisites[i] != nullptr)
+            {
+                TaskInfo.Prerequisites.emplace_back(ppPrerequisites[i]);
+                MinPrereqPriority = std::min(MinPrereqPriority, ppPrerequisites[i]->GetPriority());
+            }
+        }
+        if (pTask->GetPriority() > MinPrereqPriority)
+        {
+            TaskInfo.pTask->SetPriority(MinPrereqPriority);
+        }
+    }
+    return TaskInfo;
+}
+
+// Checks if all task prerequisites are finished. If not, returns the minimum priority
+// of the unfinished prerequisites in MinPrereqPriority.
+bool CheckPrerequisites(QueuedTaskInfo& TaskInfo, float& MinPrereqPriority)
+{
+    bool PrerequisitesMet = true;
+    MinPrereqPriority     = +FLT_MAX;
+    for (auto& pPrereq : TaskInfo.Prerequisites)
+    {
+        if (auto pPrereqTask = pPrereq.Lock())
+        {
+            if (!pPrereqTask->IsFinished())
+            {
+                PrerequisitesMet  = false;
+                MinPrereqPriority = std::min(MinPrereqPriority, pPrereqTask->GetPriority());
+            }
+        }
+    }
+    return PrerequisitesMet;
+}
+
+void RunTask(IAsyncTask* pTask, Uint32 ThreadId)
+{
+    pTask->SetStatus(ASYNC_TASK_STATUS_RUNNING);
+    pTask->Run(ThreadId);
+    DEV_CHECK_ERR((pTask->GetStatus() == ASYNC_TASK_STATUS_COMPLETE ||
+                   pTask->GetStatus() == ASYNC_TASK_STATUS_CANCELLED),
+                  "Finished tasks must be in COMPLETE or CANCELLED state");
+}
+
+std::vector<std::thread> StartWorkerThreads(IThreadPool* pThreadPool, const ThreadPoolCreateInfo& PoolCI)
+{
+    std::vector<std::thread> WorkerThreads;
+    WorkerThreads.reserve(PoolCI.NumThreads);
+    for (Uint32 i = 0; i < PoolCI.NumThreads; ++i)
+    {
+        WorkerThreads.emplace_back(
+            [pThreadPool, PoolCI, i] //
+            {
+                if (PoolCI.OnThreadStarted)
+                    PoolCI.OnThreadStarted(i);
+
+                while (pThreadPool->ProcessTask(i, /*WaitForTask =*/true))
+                {
+                }
+
+                if (PoolCI.OnThreadExiting)
+                    PoolCI.OnThreadExiting(i);
+            });
+    }
+    return WorkerThreads;
+}
+
+// Tracks the dependencies between the tasks enqueued into the thread pool.
+//
+// Every task enqueued into the pool is tagged with the address of the graph until it is finished or removed.
+// Only the tasks that have prerequisites or are used as prerequisites are registered in the graph, which
+// is indicated by the lowest bit of the tag. This way, the tasks that have no dependencies are enqueued
+// and finished without taking any locks.
+// When a task is enqueued with prerequisites, it is added to the successor list of every
+// unfinished prerequisite enqueued into the same pool and counts the number of prerequisites it waits for.
+// When a task finishes, the counters of its successors are decremented, and the tasks whose
+// counter reaches zero are passed to the ready handler to be placed into the queue.
+//
+// The registered tasks are distributed between several stripes by their address to reduce
+// the contention when many threads enqueue and finish tasks simultaneously.
+class TaskDependencyGraph
 {
 public:
-    using TBase = ObjectBase<IThreadPool>;
+    using ReadyHandlerType = std::function<void(QueuedTaskInfo&&)>;
 
-    ThreadPoolImpl(IReferenceCounters*         pRefCounters,
-                   const ThreadPoolCreateInfo& PoolCI) :
-        TBase{pRefCounters}
+    explicit TaskDependencyGraph(ReadyHandlerType ReadyHandler) :
+        m_ReadyHandler{std::move(ReadyHandler)},
+        m_Tag{reinterpret_cast<uintptr_t>(this)}
     {
-        m_WorkerThreads.reserve(PoolCI.NumThreads);
-        for (Uint32 i = 0; i < PoolCI.NumThreads; ++i)
+        VERIFY((m_Tag & RegisteredTaskBit) == 0, "The graph address must be aligned");
+    }
+
+    // clang-format off
+    TaskDependencyGraph           (const TaskDependencyGraph&)  = delete;
+    TaskDependencyGraph           (      TaskDependencyGraph&&) = delete;
+    TaskDependencyGraph& operator=(const TaskDependencyGraph&)  = delete;
+    TaskDependencyGraph& operator=(      TaskDependencyGraph&&) = delete;
+    // clang-format on
+
+    ~TaskDependencyGraph()
+    {
+        VERIFY(m_NumPendingTasks.load() == 0, "There are tasks that still wait for their prerequisites");
+    }
+
+    // Adds the task to the graph. If the task does not need to wait for any
+    // prerequisites, it is immediately passed to the ready handler.
+    // On return, TaskInfo.Prerequisites only contains the unfinished prerequisites that
+    // were not enqueued into this graph (e.g. were enqueued into a different thread pool).
+    void AddTask(QueuedTaskInfo&& TaskInfo)
+    {
+        IAsyncTask* pTask = TaskInfo.pTask;
+
+        if (TaskInfo.Prerequisites.empty())
+        {
+            // The task will only be registered in the graph if it is used as a prerequisite
+            Uint64 TaskTag = 0;
+            if (!TaskTagRef{*this, pTask}.CompareExchange(TaskTag, m_Tag))
+                DEV_ERROR("The task has already been enqueued into a thread pool");
+
+            m_ReadyHandler(std::move(TaskInfo));
+            return;
+        }
+
+        auto pPending = std::make_shared<PendingTask>();
         {
-            m_WorkerThreads.emplace_back(
-                [this, PoolCI, i] //
+            auto&                       Stripe = GetStripe(pTask);
+            std::lock_guard<std::mutex> Lock{Stripe.Mtx};
+
+            Uint64 TaskTag = 0;
+            if (!TaskTagRef{*this, pTask}.CompareExchange(TaskTag, m_Tag | RegisteredTaskBit))
+                DEV_ERROR("The task has already been enqueued into a thread pool");
+            Stripe.Nodes[pTask].pPending = pPending;
+        }
+
+        std::vector<RefCntWeakPtr<IAsyncTask>> ExternalPrerequisites;
+        for (auto& wpPrereq : TaskInfo.Prerequisites)
+        {
+            auto pPrereq = wpPrereq.Lock();
+            if (!pPrereq)
+                continue;
+
+            bool IsSuccessor = false;
+            {
+                auto&                       Stripe = GetStripe(pPrereq);
+                std::lock_guard<std::mutex> Lock{Stripe.Mtx};
+
+                if (TaskNode* pNode = RegisterTask(Stripe, pPrereq))
                 {
-                    if (PoolCI.OnThreadStarted)
-                        PoolCI.OnThreadStarted(i);
+                    pPending->NumUnfinishedPrerequisites.fetch_add(1);
+                    pNode->Successors.emplace_back(pPending);
+                    IsSuccessor = true;
+                }
+            }
 
-                    while (ProcessTask(i, /*WaitForTask =*/true))
-                    {
-                    }
+            // If the prerequisite could not be registered in the graph, it has either already
+            // finished, or was not enqueued into this thread pool.
+            if (!IsSuccessor && !pPrereq->IsFinished())
+                ExternalPrerequisites.emplace_back(std::move(wpPrereq));
+        }
+        TaskInfo.Prerequisites = std::move(ExternalPrerequisites);
+
+        // Nobody can access the task info until the counter, which
+        // was initialized to one, is decremented below.
+        pPending->TaskInfo = std::move(TaskInfo);
+        m_NumPendingTasks.fetch_add(1);
+
+        ReleasePrerequisite(*pPending);
+    }
+
+    // Removes the finished task from the graph and releases its successors.
+    void OnTaskFinished(IAsyncTask* pTask)
+    {
+        // Reset the tag first so that the task can no longer be registered as a prerequisite
+        TaskTagRef Tag{*this, pTask};
+        Uint64     TaskTag = Tag.Load();
+        do
+        {
+            if ((TaskTag & ~RegisteredTaskBit) != m_Tag)
+                return;
+        } while (!Tag.CompareExchange(TaskTag, 0));
 
-                    if (PoolCI.OnThreadExiting)
-                        PoolCI.OnThreadExiting(i);
-                });
+        // Tasks that have not been registered have no successors
+        if ((TaskTag & RegisteredTaskBit) == 0)
+            return;
+
+        std::vector<std::shared_ptr<PendingTask>> Successors;
+        {
+            auto&                       Stripe = GetStripe(pTask);
+            std::lock_guard<std::mutex> Lock{Stripe.Mtx};
+
+            auto it = Stripe.Nodes.find(pTask);
+            if (it == Stripe.Nodes.end())
+            {
+                UNEXPECTED("Registered task is not found in the graph");
+                return;
+            }
+
+            Successors = std::move(it->second.Successors);
+            Stripe.Nodes.erase(it);
         }
+
+        for (auto& pSuccessor : Successors)
+            ReleasePrerequisite(*pSuccessor);
+    }
+
+    // Removes the task that waits for its prerequisites from the graph.
+    // The successors of the removed task are released.
+    bool RemovePendingTask(IAsyncTask* pTask)
+    {
+        auto pPending = FindPendingTask(pTask);
+        if (!pPending)
+            return false;
+
+        PENDING_TASK_STATE ExpectedState = PENDING_TASK_STATE_WAITING;
+        if (!pPending->State.compare_exchange_strong(ExpectedState, PENDING_TASK_STATE_REMOVED))
+        {
+            // The task has just become ready
+            return false;
+        }
+        m_NumPendingTasks.fetch_add(-1);
+
+        OnTaskFinished(pTask);
+        return true;
+    }
+
+    // Checks if the task waits for its prerequisites.
+    bool IsPending(IAsyncTask* pTask) const
+    {
+        auto pPending = FindPendingTask(pTask);
+        return pPending && pPending->State.load() == PENDING_TASK_STATE_WAITING;
+    }
+
+    // Checks if the task was enqueued into this graph and is not finished or removed.
+    bool HasTask(IAsyncTask* pTask) const
+    {
+        return (TaskTagRef{*this, pTask}.Load() & ~RegisteredTaskBit) == m_Tag;
+    }
+
+    int GetNumPendingTasks() const
+    {
+        return m_NumPendingTasks.load();
+    }
+
+private:
+    enum PENDING_TASK_STATE : Uint8
+    {
+        PENDING_TASK_STATE_WAITING,
+        PENDING_TASK_STATE_READY,
+        PENDING_TASK_STATE_REMOVED
+    };
+
+    struct PendingTask
+    {
+        QueuedTaskInfo TaskInfo;
+
+        // The counter is initialized to one to prevent the task from being released
+        // while AddTask() is still registering it with its prerequisites.
+        std::atomic<int> NumUnfinishedPrerequisites{1};
+
+        std::atomic<PENDING_TASK_STATE> State{PENDING_TASK_STATE_WAITING};
+    };
+
+    struct TaskNode
+    {
+        // Tasks that wait for this task to finish
+        std::vector<std::shared_ptr<PendingTask>> Successors;
+
+        // Non-null if the task was enqueued with prerequisites
+        std::shared_ptr<PendingTask> pPending;
+    };
+
+    struct alignas(64) Stripe
+    {
+        mutable std::mutex                        Mtx;
+        std::unordered_map<IAsyncTask*, TaskNode> Nodes;
+    };
+
+    static constexpr size_t NumStripes = 64;
+
+    // The lowest bit of the task tag indicates that the task is registered in the graph
+    static constexpr Uint64 RegisteredTaskBit = 1;
+
+    // Provides access to the thread pool tag of the task.
+    // The tags of the tasks derived from AsyncTaskBase are stored in the task objects, so that
+    // the tasks that have no dependencies never take a lock. The tags of other IAsyncTask
+    // implementations are kept in the side table of the graph.
+    class TaskTagRef
+    {
+    public:
+        TaskTagRef(const TaskDependencyGraph& Graph, IAsyncTask* pTask) :
+            m_Graph{Graph},
+            m_pTask{pTask},
+            // The caller keeps a strong reference to the task, so the raw pointer remains valid
+            m_pTaskBase{RefCntAutoPtr<AsyncTaskBase>{pTask, AsyncTaskBase::IID_InternalImpl}}
+        {}
+
+        Uint64 Load() const
+        {
+            if (m_pTaskBase != nullptr)
+                return m_pTaskBase->GetThreadPoolTag().load();
+
+            std::lock_guard<std::mutex> Lock{m_Graph.m_ExternalTagsMtx};
+
+            auto it = m_Graph.m_ExternalTags.find(m_pTask);
+            return it != m_Graph.m_ExternalTags.end() ? it->second : 0;
+        }
+
+        // Replaces the tag with Desired if it is equal to Expected.
+        // Otherwise, writes the current tag to Expected.
+        bool CompareExchange(Uint64& Expected, Uint64 Desired)
+        {
+            if (m_pTaskBase != nullptr)
+                return m_pTaskBase->GetThreadPoolTag().compare_exchange_strong(Expected, Desired);
+
+            std::lock_guard<std::mutex> Lock{m_Graph.m_ExternalTagsMtx};
+
+            auto         it  = m_Graph.m_ExternalTags.find(m_pTask);
+            const Uint64 Tag = it != m_Graph.m_ExternalTags.end() ? it->second : 0;
+            if (Tag != Expected)
+            {
+                Expected = Tag;
+                return false;
+            }
+
+            if (Desired != 0)
+                m_Graph.m_ExternalTags[m_pTask] = Desired;
+            else if (it != m_Graph.m_ExternalTags.end())
+                m_Graph.m_ExternalTags.erase(it);
+            return true;
+        }
+
+    private:
+        const TaskDependencyGraph& m_Graph;
+        IAsyncTask* const          m_pTask;
+        AsyncTaskBase* const       m_pTaskBase;
+    };
+
+    static size_t GetStripeIndex(IAsyncTask* pTask)
+    {
+        // Task objects are allocated on the heap and are at least 16-byte aligned,
+        // so the low bits of the address carry no information.
+        return (reinterpret_cast<size_t>(pTask) >> 6) % NumStripes;
+    }
+    Stripe& GetStripe(IAsyncTask* pTask)
+    {
+        return m_Stripes[GetStripeIndex(pTask)];
+    }
+    const Stripe& GetStripe(IAsyncTask* pTask) const
+    {
+        return m_Stripes[GetStripeIndex(pTask)];
+    }
+
+    // Returns the node of the task that was enqueued into this graph and is not finished, registering
+    // the task if necessary. Returns null if the task has finished or was not enqueued into this graph.
+    // Must be called while holding the stripe mutex.
+    TaskNode* RegisterTask(Stripe& TaskStripe, IAsyncTask* pTask)
+    {
+        TaskTagRef Tag{*this, pTask};
+        Uint64     TaskTag = Tag.Load();
+        if (TaskTag == (m_Tag | RegisteredTaskBit))
+        {
+            // The node is erased under the stripe mutex, so it must exist even if the task has just finished
+            auto it = TaskStripe.Nodes.find(pTask);
+            VERIFY_EXPR(it != TaskStripe.Nodes.end());
+            return it != TaskStripe.Nodes.end() ? &it->second : nullptr;
+        }
+
+        // If the tag has been reset by OnTaskFinished(), the task has finished
+        if (TaskTag == m_Tag && Tag.CompareExchange(TaskTag, m_Tag | RegisteredTaskBit))
+            return &TaskStripe.Nodes[pTask];
+
+        return nullptr;
+    }
+
+    std::shared_ptr<PendingTask> FindPendingTask(IAsyncTask* pTask) const
+    {
+        // Only the registered tasks may wait for their prerequisites
+        if (TaskTagRef{*this, pTask}.Load() != (m_Tag | RegisteredTaskBit))
+            return nullptr;
+
+        const auto&                 Stripe = GetStripe(pTask);
+        std::lock_guard<std::mutex> Lock{Stripe.Mtx};
+
+        auto it = Stripe.Nodes.find(pTask);
+        return it != Stripe.Nodes.end() ? it->second.pPending : nullptr;
+    }
+
+    void ReleasePrerequisite(PendingTask& Pending)
+    {
+        if (Pending.NumUnfinishedPrerequisites.fetch_add(-1) != 1)
+            return;
+
+        PENDING_TASK_STATE ExpectedState = PENDING_TASK_STATE_WAITING;
+        if (Pending.State.compare_exchange_strong(ExpectedState, PENDING_TASK_STATE_READY))
+        {
+            m_ReadyHandler(std::move(Pending.TaskInfo));
+            // NB: the pending task counter must be decremented after the task is enqueued,
+            //     otherwise WaitForAllTasks() may miss the task.
+            m_NumPendingTasks.fetch_add(-1);
+        }
+    }
+
+private:
+    const ReadyHandlerType m_ReadyHandler;
+
+    // The tag of the tasks enqueued into this graph
+    const Uint64 m_Tag;
+
+    std::array<Stripe, NumStripes> m_Stripes;
+
+    // Tags of the tasks that are not derived from AsyncTaskBase
+    mutable std::mutex                              m_ExternalTagsMtx;
+    mutable std::unordered_map<IAsyncTask*, Uint64> m_ExternalTags;
+
+    std::atomic<int> m_NumPendingTasks{0};
+};
+
+// Allows threads to block until a task is finished.
+class TaskWaitSignal
+{
+public:
+    template <typename PredicateType>
+    void Wait(PredicateType&& Predicate)
+    {
+        if (Predicate())
+            return;
+
+        std::unique_lock<std::mutex> Lock{m_Mtx};
+        m_NumWaitingThreads.fetch_add(1);
+        m_Cond.wait(Lock, Predicate);
+        m_NumWaitingThreads.fetch_add(-1);
+    }
+
+    void Notify()
+    {
+        // The waiting thread increments the counter before checking the predicate,
+        // so it either sees the change or we see the thread and notify it under the mutex.
+        if (m_NumWaitingThreads.load() > 0)
+        {
+            {
+                std::lock_guard<std::mutex> Lock{m_Mtx};
+            }
+            m_Cond.notify_all();
+        }
+    }
+
+private:
+    std::mutex              m_Mtx;
+    std::condition_variable m_Cond;
+    std::atomic<int>        m_NumWaitingThreads{0};
+};
+
+} // namespace
+
+class ThreadPoolImpl final : public ObjectBase<IThreadPool>
+{
+public:
+    using TBase = ObjectBase<IThreadPool>;
+
+    ThreadPoolImpl(IReferenceCounters*         pRefCounters,
+                   const ThreadPoolCreateInfo& PoolCI) :
+        TBase{pRefCounters},
+        m_TaskGraph{[this](QueuedTaskInfo&& TaskInfo) {
+            PushReadyTask(std::move(TaskInfo));
+        }}
+    {
+        m_WorkerThreads = StartWorkerThreads(this, PoolCI);
     }
 
     IMPLEMENT_QUERY_INTERFACE_IN_PLACE(IID_ThreadPool, TBase)
@@ -109,28 +577,17 @@ public:
 
         if (TaskInfo.pTask)
         {
-            // Check prerequisites
-            bool  PrerequisitesMet  = true;
-            float MinPrereqPriority = +FLT_MAX;
-            for (auto& pPrereq : TaskInfo.Prerequisites)
-            {
-                if (auto pPrereqTask = pPrereq.Lock())
-                {
-                    if (!pPrereqTask->IsFinished())
-                    {
-                        PrerequisitesMet  = false;
-                        MinPrereqPriority = std::min(MinPrereqPriority, pPrereqTask->GetPriority());
-                    }
-                }
-            }
-
+            // Prerequisites enqueued into this thread pool are tracked by the task graph.
+            // Only the prerequisites that were not enqueued into this pool need to be checked here.
+            float      MinPrereqPriority = +FLT_MAX;
+            const bool PrerequisitesMet  = CheckPrerequisites(TaskInfo, MinPrereqPriority);
             if (PrerequisitesMet)
             {
-                TaskInfo.pTask->SetStatus(ASYNC_TASK_STATUS_RUNNING);
-                TaskInfo.pTask->Run(ThreadId);
-                DEV_CHECK_ERR((TaskInfo.pTask->GetStatus() == ASYNC_TASK_STATUS_COMPLETE ||
-                               TaskInfo.pTask->GetStatus() == ASYNC_TASK_STATUS_CANCELLED),
-                              "Finished tasks must be in COMPLETE or CANCELLED state");
+                RunTask(TaskInfo.pTask, ThreadId);
+                // Enqueue the successors before decrementing the running task counter
+                // so that WaitForAllTasks() does not miss them.
+                m_TaskGraph.OnTaskFinished(TaskInfo.pTask);
+                m_TaskWaitSignal.Notify();
             }
 
             {
@@ -140,9 +597,9 @@ public:
 
                 if (PrerequisitesMet)
                 {
-                    if (m_TasksQueue.empty() && NumRunningTasks == 0)
+                    if (m_TasksQueue.empty() && NumRunningTasks == 0 && m_TaskGraph.GetNumPendingTasks() == 0)
                     {
-                        m_TasksFinishedCond.notify_one();
+                        m_TasksFinishedCond.notify_all();
                     }
                 }
                 else
@@ -171,47 +628,35 @@ public:
         if (pTask == nullptr)
             return;
 
-        {
-            std::unique_lock<std::mutex> lock{m_TasksQueueMtx};
-            DEV_CHECK_ERR(!m_Stop, "Enqueue on a stopped ThreadPool");
-
-            QueuedTaskInfo TaskInfo;
-            TaskInfo.pTask = pTask;
-            if (ppPrerequisites != nullptr && NumPrerequisites > 0)
-            {
-                TaskInfo.Prerequisites.reserve(NumPrerequisites);
-                float MinPrereqPriority = +FLT_MAX;
-                for (Uint32 i = 0; i < NumPrerequisites; ++i)
-                {
-                    if (ppPrerequisites[i] != nullptr)
-                    {
-                        TaskInfo.Prerequisites.emplace_back(ppPrerequisites[i]);
-                        MinPrereqPriority = std::min(MinPrereqPriority, ppPrerequisites[i]->GetPriority());
-                    }
-                }
-                if (pTask->GetPriority() > MinPrereqPriority)
-                {
-                    TaskInfo.pTask->SetPriority(MinPrereqPriority);
-                }
-            }
+        DEV_CHECK_ERR(!m_Stop, "Enqueue on a stopped ThreadPool");
 
-            m_TasksQueue.emplace(pTask->GetPriority(), std::move(TaskInfo));
-        }
-        m_NextTaskCond.notify_one();
+        // The task will be placed into the queue by PushReadyTask() when all its prerequisites are finished
+        m_TaskGraph.AddTask(PrepareTaskInfo(pTask, ppPrerequisites, NumPrerequisites));
     }
 
     virtual void DILIGENT_CALL_TYPE WaitForAllTasks() override final
     {
         std::unique_lock<std::mutex> lock{m_TasksQueueMtx};
-        if (!m_TasksQueue.empty() || m_NumRunningTasks.load() > 0)
-        {
-            m_TasksFinishedCond.wait(lock,
-                                     [this] //
-                                     {
-                                         return m_TasksQueue.empty() && m_NumRunningTasks.load() == 0;
-                                     } //
-            );
-        }
+        m_TasksFinishedCond.wait(lock,
+                                 [this] //
+                                 {
+                                     return IsIdle();
+                                 } //
+        );
+    }
+
+    virtual void DILIGENT_CALL_TYPE WaitForTask(IAsyncTask* pTask) override final
+    {
+        VERIFY_EXPR(pTask != nullptr);
+        if (pTask == nullptr)
+            return;
+
+        m_TaskWaitSignal.Wait(
+            [&]() //
+            {
+                // The task tag is reset when the task is finished or removed from the pool
+                return pTask->IsFinished() || !m_TaskGraph.HasTask(pTask);
+            });
     }
 
     virtual void DILIGENT_CALL_TYPE StopThreads() override final
@@ -234,18 +679,41 @@ public:
 
     virtual bool DILIGENT_CALL_TYPE RemoveTask(IAsyncTask* pTask) override final
     {
-        std::unique_lock<std::mutex> lock{m_TasksQueueMtx};
+        bool Removed = false;
+        {
+            std::unique_lock<std::mutex> lock{m_TasksQueueMtx};
 
-        auto it = m_TasksQueue.begin();
-        while (it != m_TasksQueue.end() && it->second.pTask != pTask)
-            ++it;
-        if (it != m_TasksQueue.end())
+            auto it = m_TasksQueue.begin();
+            while (it != m_TasksQueue.end() && it->second.pTask != pTask)
+                ++it;
+            if (it != m_TasksQueue.end())
+            {
+                m_TasksQueue.erase(it);
+                Removed = true;
+            }
+        }
+
+        if (Removed)
         {
-            m_TasksQueue.erase(it);
-            return true;
+            // Release the successors of the removed task.
+            // NB: this may enqueue new tasks, so the queue mutex must not be held.
+            m_TaskGraph.OnTaskFinished(pTask);
+        }
+        else
+        {
+            Removed = m_TaskGraph.RemovePendingTask(pTask);
         }
 
-        return false;
+        if (Removed)
+        {
+            m_TaskWaitSignal.Notify();
+
+            std::unique_lock<std::mutex> lock{m_TasksQueueMtx};
+            if (IsIdle())
+                m_TasksFinishedCond.notify_all();
+        }
+
+        return Removed;
     }
 
     virtual bool DILIGENT_CALL_TYPE ReprioritizeTask(IAsyncTask* pTask) override final
@@ -268,7 +736,10 @@ public:
 
             return true;
         }
-        return false;
+
+        // The priority of the task that waits for its prerequisites
+        // will be used when the task is placed into the queue.
+        return m_TaskGraph.IsPending(pTask);
     }
 
     virtual void DILIGENT_CALL_TYPE ReprioritizeAllTasks() override final
@@ -302,7 +773,7 @@ public:
     Uint32 DILIGENT_CALL_TYPE GetQueueSize() override final
     {
         std::unique_lock<std::mutex> lock{m_TasksQueueMtx};
-        return StaticCast<Uint32>(m_TasksQueue.size());
+        return StaticCast<Uint32>(m_TasksQueue.size() + m_TaskGraph.GetNumPendingTasks());
     }
 
     virtual Uint32 DILIGENT_CALL_TYPE GetRunningTaskCount() const override final
@@ -318,13 +789,25 @@ public:
     }
 
 private:
-    std::vector<std::thread> m_WorkerThreads;
+    void PushReadyTask(QueuedTaskInfo&& TaskInfo)
+    {
+        {
+            std::unique_lock<std::mutex> lock{m_TasksQueueMtx};
+            const auto                   Priority = TaskInfo.pTask->GetPriority();
+            m_TasksQueue.emplace(Priority, std::move(TaskInfo));
+        }
+        m_NextTaskCond.notify_one();
+    }
 
-    struct QueuedTaskInfo
+    // Must be called while holding m_TasksQueueMtx
+    bool IsIdle() const
     {
-        RefCntAutoPtr<IAsyncTask>              pTask;
-        std::vector<RefCntWeakPtr<IAsyncTask>> Prerequisites;
-    };
+        return m_TasksQueue.empty() && m_NumRunningTasks.load() == 0 && m_TaskGraph.GetNumPendingTasks() == 0;
+    }
+
+private:
+    std::vector<std::thread> m_WorkerThreads;
+
     // Priority queue
     std::mutex                                                m_TasksQueueMtx;
     std::multimap<float, QueuedTaskInfo, std::greater<float>> m_TasksQueue;
@@ -336,11 +819,412 @@ private:
     std::atomic<bool>       m_Stop{false};
 
     std::atomic<int> m_NumRunningTasks{0};
+
+    TaskDependencyGraph m_TaskGraph;
+    TaskWaitSignal      m_TaskWaitSignal;
+};
+
+class WorkStealingThreadPoolImpl final : public ObjectBase<IThreadPool>
+{
+public:
+    using TBase = ObjectBase<IThreadPool>;
+
+    WorkStealingThreadPoolImpl(IReferenceCounters*         pRefCounters,
+                               const ThreadPoolCreateInfo& PoolCI) :
+        TBase{pRefCounters},
+        // When the pool is created with zero threads, the application processes
+        // the tasks manually, so we still need at least one queue.
+        m_Queues(std::max(PoolCI.NumThreads, size_t{1})),
+        m_TaskGraph{[this](QueuedTaskInfo&& TaskInfo) {
+            PushTask(GetTargetQueueIndex(), std::move(TaskInfo), /*AllowFront = */ true);
+        }}
+    {
+        m_WorkerThreads = StartWorkerThreads(this, PoolCI);
+    }
+
+    IMPLEMENT_QUERY_INTERFACE_IN_PLACE(IID_ThreadPool, TBase)
+
+    virtual bool DILIGENT_CALL_TYPE ProcessTask(Uint32 ThreadId, bool WaitForTask) override final
+    {
+        const size_t QueueIdx = ThreadId % m_Queues.size();
+        // Tasks enqueued from within the task will be placed into the queue of this thread.
+        const CurrentWorkerScope WorkerScope{this, QueueIdx};
+
+        QueuedTaskInfo TaskInfo;
+        while (!PopTask(QueueIdx, TaskInfo))
+        {
+            if (!WaitForTask)
+                return !(m_Stop.load() && m_NumQueuedTasks.load() == 0);
+
+            std::unique_lock<std::mutex> lock{m_WakeMtx};
+            // NB: the number of sleeping threads must be incremented before the predicate
+            //     is checked. EnqueueTask() increments the number of queued tasks and then
+            //     checks the number of sleeping threads, so it either sees this thread as
+            //     sleeping and notifies the condition variable under the mutex, or the predicate
+            //     sees the new task.
+            m_NumSleepingThreads.fetch_add(1);
+            m_NextTaskCond.wait(lock,
+                                [this] //
+                                {
+                                    return m_Stop.load() || m_NumQueuedTasks.load() > 0;
+                                } //
+            );
+            m_NumSleepingThreads.fetch_add(-1);
+
+            if (m_Stop.load() && m_NumQueuedTasks.load() == 0)
+                return false;
+        }
+
+        // m_NumRunningTasks has been incremented by PopTask()
+
+        // Prerequisites enqueued into this thread pool are tracked by the task graph.
+        // Only the prerequisites that were not enqueued into this pool need to be checked here.
+        float      MinPrereqPriority = +FLT_MAX;
+        const bool PrerequisitesMet  = CheckPrerequisites(TaskInfo, MinPrereqPriority);
+        if (PrerequisitesMet)
+        {
+            RunTask(TaskInfo.pTask, ThreadId);
+            // Enqueue the successors into this thread's queue before decrementing
+            // the running task counter so that WaitForAllTasks() does not miss them.
+            m_TaskGraph.OnTaskFinished(TaskInfo.pTask);
+            m_TaskWaitSignal.Notify();
+        }
+        else
+        {
+            // Put the task to the back of this thread's queue so that other tasks can run first.
+            // NB: the task must be pushed before the running task counter is decremented,
+            //     otherwise WaitForAllTasks() may return prematurely.
+            if (TaskInfo.pTask->GetPriority() > MinPrereqPriority)
+                TaskInfo.pTask->SetPriority(MinPrereqPriority);
+            PushTask(QueueIdx, std::move(TaskInfo), /*AllowFront = */ false);
+        }
+
+        const auto NumRunningTasks = m_NumRunningTasks.fetch_add(-1) - 1;
+        if (NumRunningTasks == 0)
+        {
+            NotifyIfIdle();
+        }
+
+        return true;
+    }
+
+    virtual void DILIGENT_CALL_TYPE EnqueueTask(IAsyncTask*  pTask,
+                                                IAsyncTask** ppPrerequisites,
+                                                Uint32       NumPrerequisites) override final
+    {
+        VERIFY_EXPR(pTask != nullptr);
+        if (pTask == nullptr)
+            return;
+
+        DEV_CHECK_ERR(!m_Stop, "Enqueue on a stopped ThreadPool");
+
+        // The task will be placed into the queue when all its prerequisites are finished
+        m_TaskGraph.AddTask(PrepareTaskInfo(pTask, ppPrerequisites, NumPrerequisites));
+    }
+
+    virtual void DILIGENT_CALL_TYPE WaitForAllTasks() override final
+    {
+        std::unique_lock<std::mutex> lock{m_WakeMtx};
+        m_TasksFinishedCond.wait(lock,
+                                 [this] //
+                                 {
+                                     return IsIdle();
+                                 } //
+        );
+    }
+
+    virtual void DILIGENT_CALL_TYPE WaitForTask(IAsyncTask* pTask) override final
+    {
+        VERIFY_EXPR(pTask != nullptr);
+        if (pTask == nullptr)
+            return;
+
+        m_TaskWaitSignal.Wait(
+            [&]() //
+            {
+                // The task tag is reset when the task is finished or removed from the pool
+                return pTask->IsFinished() || !m_TaskGraph.HasTask(pTask);
+            });
+    }
+
+    virtual void DILIGENT_CALL_TYPE StopThreads() override final
+    {
+        {
+            std::unique_lock<std::mutex> lock{m_WakeMtx};
+            // NB: even if the shared variable is atomic, it must be modified under the mutex
+            //     in order to correctly publish the modification to the waiting thread.
+            m_Stop.store(true);
+        }
+        m_NextTaskCond.notify_all();
+        for (std::thread& worker : m_WorkerThreads)
+            worker.join();
+
+        m_WorkerThreads.clear();
+    }
+
+    virtual bool DILIGENT_CALL_TYPE RemoveTask(IAsyncTask* pTask) override final
+    {
+        for (auto& Queue : m_Queues)
+        {
+            if (Queue.NumTasks.load() == 0)
+                continue;
+
+            std::unique_lock<std::mutex> lock{Queue.Mtx};
+
+            auto it = FindTask(Queue, pTask);
+            if (it != Queue.Tasks.end())
+            {
+                Queue.Tasks.erase(it);
+                Queue.NumTasks.fetch_add(-1);
+                m_NumQueuedTasks.fetch_add(-1);
+                lock.unlock();
+
+                // Release the successors of the removed task.
+                // NB: this may enqueue new tasks, so the queue mutex must not be held.
+                m_TaskGraph.OnTaskFinished(pTask);
+                m_TaskWaitSignal.Notify();
+                NotifyIfIdle();
+
+                return true;
+            }
+        }
+
+        if (m_TaskGraph.RemovePendingTask(pTask))
+        {
+            m_TaskWaitSignal.Notify();
+            NotifyIfIdle();
+            return true;
+        }
+
+        return false;
+    }
+
+    virtual bool DILIGENT_CALL_TYPE ReprioritizeTask(IAsyncTask* pTask) override final
+    {
+        for (auto& Queue : m_Queues)
+        {
+            if (Queue.NumTasks.load() == 0)
+                continue;
+
+            std::unique_lock<std::mutex> lock{Queue.Mtx};
+
+            auto it = FindTask(Queue, pTask);
+            if (it != Queue.Tasks.end())
+            {
+                auto TaskInfo = std::move(*it);
+                Queue.Tasks.erase(it);
+                // Reprioritization is rare, so we can afford placing the task
+                // before the first task with lower priority.
+                const auto Priority = TaskInfo.pTask->GetPriority();
+                auto       pos      = std::find_if(Queue.Tasks.begin(), Queue.Tasks.end(),
+                                        [Priority](const QueuedTaskInfo& Task) {
+                                            return Task.pTask->GetPriority() < Priority;
+                                        });
+                Queue.Tasks.emplace(pos, std::move(TaskInfo));
+                return true;
+            }
+        }
+
+        // The priority of the task that waits for its prerequisites
+        // will be used when the task is placed into the queue.
+        return m_TaskGraph.IsPending(pTask);
+    }
+
+    virtual void DILIGENT_CALL_TYPE ReprioritizeAllTasks() override final
+    {
+        for (auto& Queue : m_Queues)
+        {
+            std::unique_lock<std::mutex> lock{Queue.Mtx};
+            std::stable_sort(Queue.Tasks.begin(), Queue.Tasks.end(),
+                             [](const QueuedTaskInfo& Task1, const QueuedTaskInfo& Task2) {
+                                 return Task1.pTask->GetPriority() > Task2.pTask->GetPriority();
+                             });
+        }
+    }
+
+    Uint32 DILIGENT_CALL_TYPE GetQueueSize() override final
+    {
+        return StaticCast<Uint32>(m_NumQueuedTasks.load() + m_TaskGraph.GetNumPendingTasks());
+    }
+
+    virtual Uint32 DILIGENT_CALL_TYPE GetRunningTaskCount() const override final
+    {
+        return m_NumRunningTasks.load();
+    }
+
+    ~WorkStealingThreadPoolImpl()
+    {
+        StopThreads();
+        VERIFY_EXPR(m_NumQueuedTasks.load() == 0);
+        VERIFY_EXPR(m_NumRunningTasks.load() == 0);
+        VERIFY_EXPR(m_TaskGraph.GetNumPendingTasks() == 0);
+    }
+
+private:
+    // Align the queues to the cache line size to avoid false sharing
+    struct alignas(64) WorkerQueue
+    {
+        std::mutex                 Mtx;
+        std::deque<QueuedTaskInfo> Tasks;
+        // Allows skipping empty queues without taking the lock
+        std::atomic<int> NumTasks{0};
+    };
+
+    static std::deque<QueuedTaskInfo>::iterator FindTask(WorkerQueue& Queue, IAsyncTask* pTask)
+    {
+        return std::find_if(Queue.Tasks.begin(), Queue.Tasks.end(),
+                            [pTask](const QueuedTaskInfo& TaskInfo) {
+                                return TaskInfo.pTask == pTask;
+                            });
+    }
+
+    // Must be called while holding the queue mutex
+    static void InsertTask(WorkerQueue& Queue, QueuedTaskInfo&& TaskInfo, bool AllowFront)
+    {
+        // Priority is only a hint: higher-priority tasks go to the front of the queue
+        if (AllowFront && !Queue.Tasks.empty() && TaskInfo.pTask->GetPriority() > Queue.Tasks.front().pTask->GetPriority())
+            Queue.Tasks.emplace_front(std::move(TaskInfo));
+        else
+            Queue.Tasks.emplace_back(std::move(TaskInfo));
+    }
+
+    void PushTask(size_t QueueIdx, QueuedTaskInfo&& TaskInfo, bool AllowFront)
+    {
+        {
+            auto&                       Queue = m_Queues[QueueIdx];
+            std::lock_guard<std::mutex> lock{Queue.Mtx};
+            InsertTask(Queue, std::move(TaskInfo), AllowFront);
+            Queue.NumTasks.fetch_add(1);
+            m_NumQueuedTasks.fetch_add(1);
+        }
+
+        if (m_NumSleepingThreads.load() > 0)
+        {
+            {
+                // The sleeping thread may be between the predicate check and the wait.
+                // Acquiring the mutex guarantees that the notification will not be lost.
+                std::lock_guard<std::mutex> lock{m_WakeMtx};
+            }
+            m_NextTaskCond.notify_one();
+        }
+    }
+
+    // Pops the task from the front of the thread's own queue. If the queue is empty,
+    // tries to steal the task from other queues.
+    bool PopTask(size_t QueueIdx, QueuedTaskInfo& TaskInfo)
+    {
+        const size_t NumQueues = m_Queues.size();
+        for (size_t i = 0; i < NumQueues; ++i)
+        {
+            auto& Queue = m_Queues[(QueueIdx + i) % NumQueues];
+            if (Queue.NumTasks.load() == 0)
+                continue;
+
+            std::lock_guard<std::mutex> lock{Queue.Mtx};
+            if (Queue.Tasks.empty())
+                continue;
+
+            TaskInfo = std::move(Queue.Tasks.front());
+            Queue.Tasks.pop_front();
+            Queue.NumTasks.fetch_add(-1);
+            // NB: we must increment the running task counter before decrementing the
+            //     queued task counter, otherwise WaitForAllTasks() may miss the task.
+            m_NumRunningTasks.fetch_add(1);
+            m_NumQueuedTasks.fetch_add(-1);
+            return true;
+        }
+
+        return false;
+    }
+
+    size_t GetTargetQueueIndex()
+    {
+        if (tl_CurrentWorker.pPool == this)
+        {
+            // Keep the tasks enqueued by a worker in its own queue for better locality
+            return tl_CurrentWorker.QueueIdx;
+        }
+        else
+        {
+            return m_NextQueueIdx.fetch_add(1) % m_Queues.size();
+        }
+    }
+
+    bool IsIdle() const
+    {
+        return m_NumQueuedTasks.load() == 0 && m_NumRunningTasks.load() == 0 && m_TaskGraph.GetNumPendingTasks() == 0;
+    }
+
+    void NotifyIfIdle()
+    {
+        if (!IsIdle())
+            return;
+
+        {
+            // Acquire the mutex to make sure that the waiting thread either has not checked
+            // the predicate yet or is already waiting for the notification.
+            std::lock_guard<std::mutex> lock{m_WakeMtx};
+        }
+        m_TasksFinishedCond.notify_all();
+    }
+
+    struct CurrentWorkerScope
+    {
+        CurrentWorkerScope(const WorkStealingThreadPoolImpl* pPool, size_t QueueIdx) :
+            PrevWorker{tl_CurrentWorker}
+        {
+            tl_CurrentWorker = {pPool, QueueIdx};
+        }
+        ~CurrentWorkerScope()
+        {
+            tl_CurrentWorker = PrevWorker;
+        }
+
+        struct WorkerInfo
+        {
+            const WorkStealingThreadPoolImpl* pPool    = nullptr;
+            size_t                            QueueIdx = 0;
+        };
+        const WorkerInfo PrevWorker;
+    };
+    static thread_local CurrentWorkerScope::WorkerInfo tl_CurrentWorker;
+
+private:
+    std::vector<std::thread> m_WorkerThreads;
+
+    std::vector<WorkerQueue> m_Queues;
+    std::atomic<size_t>      m_NextQueueIdx{0};
+
+    // Protects the condition variables
+    std::mutex              m_WakeMtx;
+    std::condition_variable m_NextTaskCond{};
+    std::condition_variable m_TasksFinishedCond{};
+    std::atomic<bool>       m_Stop{false};
+
+    std::atomic<int> m_NumQueuedTasks{0};
+    std::atomic<int> m_NumRunningTasks{0};
+    std::atomic<int> m_NumSleepingThreads{0};
+
+    TaskDependencyGraph m_TaskGraph;
+    TaskWaitSignal      m_TaskWaitSignal;
 };
 
+thread_local WorkStealingThreadPoolImpl::CurrentWorkerScope::WorkerInfo WorkStealingThreadPoolImpl::tl_CurrentWorker;
+
 RefCntAutoPtr<IThreadPool> CreateThreadPool(const ThreadPoolCreateInfo& ThreadPoolCI)
 {
-    return RefCntAutoPtr<ThreadPoolImpl>{MakeNewRCObj<ThreadPoolImpl>()(ThreadPoolCI)};
+    switch (ThreadPoolCI.SchedulingMode)
+    {
+        case THREAD_POOL_SCHEDULING_MODE_PRIORITY_QUEUE:
+            return RefCntAutoPtr<ThreadPoolImpl>{MakeNewRCObj<ThreadPoolImpl>()(ThreadPoolCI)};
+
+        case THREAD_POOL_SCHEDULING_MODE_WORK_STEALING:
+            return RefCntAutoPtr<WorkStealingThreadPoolImpl>{MakeNewRCObj<WorkStealingThreadPoolImpl>()(ThreadPoolCI)};
+
+        default:
+            UNEXPECTED("Unexpected thread pool scheduling mode");
+            return {};
+    }
 }
 
 } // namespace Diligent
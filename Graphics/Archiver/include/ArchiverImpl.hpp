@@ -90,6 +90,9 @@ public:
     /// Implementation of IArchiver::GetPipelineResourceSignature().
     virtual IPipelineResourceSignature* DILIGENT_CALL_TYPE GetPipelineResourceSignature(const char* PRSName) override final;
 
+    /// Implementation of IArchiver::SetShaderCompression().
+    virtual void DILIGENT_CALL_TYPE SetShaderCompression(ARCHIVE_SHADER_COMPRESSION Compression) override final;
+
 private:
     bool AddRenderPass(IRenderPass* pRP);
 
@@ -116,6 +119,8 @@ private:
 
     std::mutex     m_PipelinesMtx;
     PSOHashMapType m_Pipelines;
+
+    ARCHIVE_SHADER_COMPRESSION m_ShaderCompression = ARCHIVE_SHADER_COMPRESSION_NONE;
 };
 
 } // namespace Diligent
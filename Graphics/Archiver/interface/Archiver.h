@@ -192,6 +192,17 @@ DILIGENT_BEGIN_INTERFACE(IArchiver, IObject)
     ///             so the application must not call Release() unless it also explicitly calls AddRef().
     VIRTUAL IPipelineResourceSignature* METHOD(GetPipelineResourceSignature)(THIS_
                                                                              const char* PRSName) PURE;
+
+    /// Sets the compression mode for the shaders in the archive.
+
+    /// \param [in] Compression - Shader compression mode, see Diligent::ARCHIVE_SHADER_COMPRESSION.
+    ///
+    /// \remarks    Every shader is compressed individually, so that it can be decompressed
+    ///             without touching other shaders in the archive.
+    ///             The mode is applied by SerializeToBlob() and SerializeToStream().
+    ///             Default mode is ARCHIVE_SHADER_COMPRESSION_NONE.
+    VIRTUAL void METHOD(SetShaderCompression)(THIS_
+                                              ARCHIVE_SHADER_COMPRESSION Compression) PURE;
 };
 DILIGENT_END_INTERFACE
 
@@ -207,6 +218,7 @@ DILIGENT_END_INTERFACE
 #    define IArchiver_GetShader(This, ...)                    CALL_IFACE_METHOD(Archiver, GetShader,                    This, __VA_ARGS__)
 #    define IArchiver_GetPipelineState(This, ...)             CALL_IFACE_METHOD(Archiver, GetPipelineState,             This, __VA_ARGS__)
 #    define IArchiver_GetPipelineResourceSignature(This, ...) CALL_IFACE_METHOD(Archiver, GetPipelineResourceSignature, This, __VA_ARGS__)
+#    define IArchiver_SetShaderCompression(This, ...)         CALL_IFACE_METHOD(Archiver, SetShaderCompression,         This, __VA_ARGS__)
 
 #endif
 
@@ -235,6 +235,7 @@ Bool ArchiverImpl::SerializeToBlob(Uint32 ContentVersion, IDataBlob** ppBlob)
         }
     }
 
+    Archive.SetShaderCompression(m_ShaderCompression);
     Archive.Serialize(ppBlob);
 
     return *ppBlob != nullptr;
@@ -431,4 +432,10 @@ IPipelineResourceSignature* ArchiverImpl::GetPipelineResourceSignature(const cha
     return it != m_Signatures.end() ? it->second.RawPtr() : nullptr;
 }
 
+void ArchiverImpl::SetShaderCompression(ARCHIVE_SHADER_COMPRESSION Compression)
+{
+    DEV_CHECK_ERR(Compression < ARCHIVE_SHADER_COMPRESSION_COUNT, "Invalid shader compression mode");
+    m_ShaderCompression = Compression;
+}
+
 } // namespace Diligent
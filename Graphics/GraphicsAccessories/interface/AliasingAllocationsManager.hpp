@@ -0,0 +1,227 @@
+/*
+ *  Copyright 2019-2024 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+#include <vector>
+#include <algorithm>
+
+#include "../../../Primitives/interface/BasicTypes.h"
+#include "../../../Primitives/interface/MemoryAllocator.h"
+#include "../../../Platforms/Basic/interface/DebugUtilities.hpp"
+#include "../../../Common/interface/Align.hpp"
+#include "../../../Common/interface/STDAllocator.hpp"
+
+namespace Diligent
+{
+
+// The class places allocations with known lifetimes into a memory block of fixed size.
+// Every allocation is given an inclusive range of abstract time points (e.g. render pass
+// indices within a frame) in which it is used. Allocations whose ranges do not overlap are
+// allowed to share the same memory (alias), so that the total size of all allocations may
+// considerably exceed the size of the block.
+//
+//   Offset    0           32          64          96         128
+//             |<--- A: [0, 1] --->|<--- C: [0, 3] --->|
+//             |<-- B: [2, 3] -->|
+//
+// Allocations are kept sorted by their offsets. New allocation is placed at the lowest
+// aligned offset where it does not intersect any existing allocation with overlapping lifetime.
+class AliasingAllocationsManager
+{
+public:
+    using OffsetType = size_t;
+
+    static constexpr OffsetType InvalidOffset = ~OffsetType{0};
+
+    struct Allocation
+    {
+        Allocation() noexcept {}
+
+        Allocation(OffsetType _Offset, OffsetType _Size, Uint32 _FirstUse, Uint32 _LastUse) noexcept :
+            Offset{_Offset},
+            Size{_Size},
+            FirstUse{_FirstUse},
+            LastUse{_LastUse}
+        {}
+
+        bool IsValid() const
+        {
+            return Offset != InvalidOffset;
+        }
+
+        bool OverlapsInTime(Uint32 _FirstUse, Uint32 _LastUse) const
+        {
+            return FirstUse <= _LastUse && _FirstUse <= LastUse;
+        }
+
+        bool operator==(const Allocation& rhs) const
+        {
+            return Offset == rhs.Offset &&
+                Size == rhs.Size &&
+                FirstUse == rhs.FirstUse &&
+                LastUse == rhs.LastUse;
+        }
+
+        OffsetType Offset   = InvalidOffset;
+        OffsetType Size     = 0;
+        Uint32     FirstUse = 0;
+        Uint32     LastUse  = 0;
+    };
+
+    AliasingAllocationsManager(OffsetType MaxSize, IMemoryAllocator& Allocator) :
+        m_Allocations{STD_ALLOCATOR_RAW_MEM(Allocation, Allocator, "Allocator for vector<Allocation>")},
+        m_MaxSize{MaxSize}
+    {}
+
+    ~AliasingAllocationsManager()
+    {
+        VERIFY(m_Allocations.empty(), "Not all allocations have been released");
+    }
+
+    // clang-format off
+    AliasingAllocationsManager(AliasingAllocationsManager&& rhs) = default;
+
+    AliasingAllocationsManager& operator = (AliasingAllocationsManager&& rhs) = delete;
+    AliasingAllocationsManager             (const AliasingAllocationsManager&) = delete;
+    AliasingAllocationsManager& operator = (const AliasingAllocationsManager&) = delete;
+    // clang-format on
+
+    // Allocates Size bytes that will be used in the range [FirstUse, LastUse].
+    // Returns invalid allocation if there is no space.
+    Allocation Allocate(OffsetType Size, OffsetType Alignment, Uint32 FirstUse, Uint32 LastUse)
+    {
+        VERIFY_EXPR(Size > 0);
+        VERIFY(IsPowerOfTwo(Alignment), "Alignment (", Alignment, ") must be a power of 2");
+        VERIFY(FirstUse <= LastUse, "First use (", FirstUse, ") must not be greater than the last use (", LastUse, ")");
+
+        if (Size > m_MaxSize)
+            return Allocation{};
+
+        // Allocations are sorted by offset, so every allocation that starts at or after the
+        // end of the candidate range can't intersect it, and neither can any allocation after it.
+        OffsetType Offset = 0;
+        auto       it     = m_Allocations.begin();
+        for (; it != m_Allocations.end(); ++it)
+        {
+            if (!it->OverlapsInTime(FirstUse, LastUse))
+                continue;
+
+            if (it->Offset >= Offset + Size)
+                break;
+
+            Offset = std::max(Offset, AlignUp(it->Offset + it->Size, Alignment));
+            if (Offset + Size > m_MaxSize)
+                return Allocation{};
+        }
+
+        Allocation NewAlloc{Offset, Size, FirstUse, LastUse};
+
+        // Keep the list sorted by offset
+        auto insert_it = std::upper_bound(m_Allocations.begin(), m_Allocations.end(), NewAlloc,
+                                          [](const Allocation& lhs, const Allocation& rhs) {
+                                              return lhs.Offset < rhs.Offset;
+                                          });
+        m_Allocations.insert(insert_it, NewAlloc);
+        m_TotalAllocatedSize += Size;
+
+        return NewAlloc;
+    }
+
+    void Free(const Allocation& Alloc)
+    {
+        auto it = FindAllocation(Alloc);
+        if (it == m_Allocations.end())
+            return;
+
+        VERIFY_EXPR(m_TotalAllocatedSize >= Alloc.Size);
+        m_TotalAllocatedSize -= Alloc.Size;
+        m_Allocations.erase(it);
+    }
+
+    // Extends the lifetime of the allocation to all time points, so that no new allocation
+    // may alias its memory until it is freed. This is used for allocations that are no longer
+    // used by the application, but may still be in use by the GPU.
+    // Returns the updated allocation that must be used to free the memory.
+    Allocation Retire(const Allocation& Alloc)
+    {
+        auto it = FindAllocation(Alloc);
+        if (it == m_Allocations.end())
+            return Alloc;
+
+        it->FirstUse = 0;
+        it->LastUse  = ~Uint32{0};
+        return *it;
+    }
+
+    // clang-format off
+    bool       IsEmpty()           const { return m_Allocations.empty(); }
+    OffsetType GetMaxSize()        const { return m_MaxSize; }
+    size_t     GetNumAllocations() const { return m_Allocations.size(); }
+
+    // Returns the total size of all allocations, i.e. the amount of memory
+    // that would be required if no aliasing was performed.
+    OffsetType GetTotalAllocatedSize() const { return m_TotalAllocatedSize; }
+    // clang-format on
+
+    // Returns the size of the memory range that is actually occupied by the allocations.
+    OffsetType GetUsedSize() const
+    {
+        OffsetType UsedSize = 0;
+        for (const auto& Alloc : m_Allocations)
+            UsedSize = std::max(UsedSize, Alloc.Offset + Alloc.Size);
+        return UsedSize;
+    }
+
+private:
+    using AllocationsVector = std::vector<Allocation, STDAllocatorRawMem<Allocation>>;
+
+    AllocationsVector::iterator FindAllocation(const Allocation& Alloc)
+    {
+        VERIFY_EXPR(Alloc.IsValid());
+        auto it = std::lower_bound(m_Allocations.begin(), m_Allocations.end(), Alloc,
+                                   [](const Allocation& lhs, const Allocation& rhs) {
+                                       return lhs.Offset < rhs.Offset;
+                                   });
+        while (it != m_Allocations.end() && it->Offset == Alloc.Offset && !(*it == Alloc))
+            ++it;
+
+        if (it == m_Allocations.end() || !(*it == Alloc))
+        {
+            UNEXPECTED("Allocation [", Alloc.Offset, ", ", Alloc.Offset + Alloc.Size, ") is not found");
+            return m_Allocations.end();
+        }
+        return it;
+    }
+
+    AllocationsVector m_Allocations;
+
+    OffsetType m_MaxSize            = 0;
+    OffsetType m_TotalAllocatedSize = 0;
+};
+
+} // namespace Diligent
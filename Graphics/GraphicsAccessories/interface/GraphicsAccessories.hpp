@@ -40,12 +40,15 @@
 #include "../../GraphicsEngine/interface/RenderDevice.h"
 #include "../../Archiver/interface/Archiver.h"
 #include "../../../Common/interface/BasicMath.hpp"
+#include "../../../Common/interface/HashUtils.hpp"
 #include "../../../Platforms/Basic/interface/DebugUtilities.hpp"
 #include "../../../Platforms/interface/PlatformMisc.hpp"
 
 namespace Diligent
 {
 
+struct IThreadPool;
+
 /// Template structure to convert VALUE_TYPE enumeration into C-type
 template <VALUE_TYPE ValType>
 struct VALUE_TYPE2CType
@@ -748,6 +751,161 @@ void CopyTextureSubresource(const TextureSubResData& SrcSubres,
                             Uint64                   DstDepthStride);
 
 
+/// ConvertTextureSubresource function attributes
+struct ConvertTextureSubresourceAttribs
+{
+    /// Source data format.
+    TEXTURE_FORMAT SrcFormat = TEX_FORMAT_UNKNOWN;
+
+    /// The number of components in the source data.
+
+    /// \remarks   If zero, the number of components of SrcFormat is used.
+    ///            Otherwise, every source texel contains SrcNumComponents components
+    ///            of the SrcFormat's component type. This allows converting the data
+    ///            that has no matching texture format, for instance 3-channel 8-bit data
+    ///            can be described as TEX_FORMAT_RGBA8_UNORM with SrcNumComponents = 3.
+    Uint32 SrcNumComponents = 0;
+
+    /// Destination data format.
+    TEXTURE_FORMAT DstFormat = TEX_FORMAT_UNKNOWN;
+
+    /// Subresource width, in texels.
+    Uint32 Width = 0;
+
+    /// Subresource height, in texels.
+    Uint32 Height = 0;
+
+    /// The number of depth slices.
+    Uint32 Depth = 1;
+
+    /// Pointer to the source data.
+    const void* pSrcData = nullptr;
+
+    /// Source data row stride, in bytes.
+    Uint64 SrcRowStride = 0;
+
+    /// Source data depth stride, in bytes.
+    Uint64 SrcDepthStride = 0;
+
+    /// Pointer to the destination data.
+    void* pDstData = nullptr;
+
+    /// Destination data row stride, in bytes.
+    Uint64 DstRowStride = 0;
+
+    /// Destination data depth stride, in bytes.
+    Uint64 DstDepthStride = 0;
+
+    /// An optional thread pool to convert the rows in parallel.
+    IThreadPool* pThreadPool = nullptr;
+};
+
+/// Converts texture subresource data between two uncompressed formats on the CPU.
+
+/// \remarks   Supported formats are the formats whose components have the same type and size,
+///            including BGRA/BGRX formats, as well as D16_UNORM and D32_FLOAT. Compressed, typeless,
+///            packed (e.g. R11G11B10_FLOAT) and depth-stencil formats are not supported.
+///
+///            Components are converted through their normalized or floating-point values.
+///            Color channels of sRGB formats are converted to/from linear space, while alpha
+///            is always linear. Missing color channels are set to 0, and missing alpha is set to 1.
+///
+///            Common conversions (swizzles, RGB to RGBA expansion, UNORM <-> sRGB, float <-> half)
+///            use dedicated vectorized paths.
+///
+///            The destination is written sequentially and is never read, so it may point to
+///            mapped write-combined memory (e.g. a staging buffer).
+///
+/// \return    true if the conversion is supported and false otherwise.
+bool ConvertTextureSubresource(const ConvertTextureSubresourceAttribs& Attribs);
+
+/// Returns true if ConvertTextureSubresource supports conversion between the given formats.
+bool IsTextureFormatConversionSupported(TEXTURE_FORMAT SrcFormat, TEXTURE_FORMAT DstFormat);
+
+
+/// Texture block compression quality
+enum TEXTURE_COMPRESSION_QUALITY : Uint8
+{
+    /// Fast compression suitable for the content generated at run time.
+    TEXTURE_COMPRESSION_QUALITY_FAST = 0,
+
+    /// Slower, higher-quality compression intended for offline processing.
+    TEXTURE_COMPRESSION_QUALITY_HIGH
+};
+
+/// CompressTextureSubresource function attributes
+struct CompressTextureSubresourceAttribs
+{
+    /// Source data format.
+
+    /// \remarks   Supported formats are TEX_FORMAT_R8_UNORM, TEX_FORMAT_RG8_UNORM,
+    ///            TEX_FORMAT_RGBA8_UNORM(_SRGB) and TEX_FORMAT_BGRA8_UNORM(_SRGB).
+    TEXTURE_FORMAT SrcFormat = TEX_FORMAT_UNKNOWN;
+
+    /// Destination block-compressed format.
+
+    /// \remarks   Supported formats are BC1, BC3 and BC7 UNORM and UNORM_SRGB formats,
+    ///            as well as TEX_FORMAT_BC4_UNORM and TEX_FORMAT_BC5_UNORM.
+    TEXTURE_FORMAT DstFormat = TEX_FORMAT_UNKNOWN;
+
+    /// Compression quality, see Diligent::TEXTURE_COMPRESSION_QUALITY.
+    TEXTURE_COMPRESSION_QUALITY Quality = TEXTURE_COMPRESSION_QUALITY_FAST;
+
+    /// Subresource width, in texels. Does not need to be a multiple of the block width.
+    Uint32 Width = 0;
+
+    /// Subresource height, in texels. Does not need to be a multiple of the block height.
+    Uint32 Height = 0;
+
+    /// The number of depth slices.
+    Uint32 Depth = 1;
+
+    /// Pointer to the source data.
+    const void* pSrcData = nullptr;
+
+    /// Source data row stride, in bytes.
+    Uint64 SrcRowStride = 0;
+
+    /// Source data depth stride, in bytes.
+    Uint64 SrcDepthStride = 0;
+
+    /// Pointer to the destination data.
+    void* pDstData = nullptr;
+
+    /// Destination data row stride, in bytes. For block-compressed formats, this is the
+    /// stride between rows of blocks.
+    Uint64 DstRowStride = 0;
+
+    /// Destination data depth stride, in bytes.
+    Uint64 DstDepthStride = 0;
+
+    /// An optional thread pool to compress the block rows in parallel.
+    IThreadPool* pThreadPool = nullptr;
+};
+
+/// Compresses texture subresource data into a BC format on the CPU.
+
+/// \remarks   The data is compressed as is, so sRGB textures are compressed in gamma space.
+///            Missing source channels are set to 0, and missing alpha is set to 1.
+///            BC4 uses the red channel, BC5 uses the red and green channels.
+///            BC1 uses 3-color mode with transparent texels for blocks that contain
+///            texels with alpha below 0.5.
+///
+///            Fast mode fits the endpoints along the principal axis of every block.
+///            High-quality mode additionally refines the endpoints with least squares,
+///            and for BC7 searches the p-bits and tries mode 5 with all channel rotations.
+///            Only single-subset BC7 modes (5 and 6) are used.
+///
+///            Every block is written to the destination with a single sequential store,
+///            so pDstData may point to mapped write-combined memory (e.g. an upload buffer).
+///
+/// \return    true if the compression is supported and false otherwise.
+bool CompressTextureSubresource(const CompressTextureSubresourceAttribs& Attribs);
+
+/// Returns true if CompressTextureSubresource supports compression from SrcFormat to DstFormat.
+bool IsTextureCompressionSupported(TEXTURE_FORMAT SrcFormat, TEXTURE_FORMAT DstFormat);
+
+
 inline String GetShaderResourcePrintName(const char* Name, Uint32 ArraySize, Uint32 ArrayIndex)
 {
     VERIFY(ArrayIndex < ArraySize, "Array index is out of range");
@@ -767,6 +925,16 @@ String GetShaderResourcePrintName(const DescType& ResDesc, Uint32 ArrayIndex = 0
     return GetShaderResourcePrintName(ResDesc.Name, ResDesc.ArraySize, ArrayIndex);
 }
 
+/// Computes the hash of a shader resource name that can be passed to IShaderResourceBinding::GetVariableByHash.
+
+/// \remarks    The hash is the 64-bit XXH3 hash (seed 0) of the name characters, excluding the terminating null.
+///             It does not depend on the platform or the backend, so it may be computed once offline.
+inline Uint64 ComputeShaderResourceNameHash(const char* Name)
+{
+    VERIFY_EXPR(Name != nullptr);
+    return ComputeHashRaw64(Name, strlen(Name));
+}
+
 TEXTURE_FORMAT UnormFormatToSRGB(TEXTURE_FORMAT Fmt);
 
 TEXTURE_FORMAT SRGBFormatToUnorm(TEXTURE_FORMAT Fmt);
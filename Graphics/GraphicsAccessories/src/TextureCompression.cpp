@@ -0,0 +1,1262 @@
+/*
+ *  Copyright 2019-2024 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <array>
+#include <cstring>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "GraphicsAccessories.hpp"
+#include "ThreadPool.hpp"
+#include "Intrinsics.hpp"
+#include "Cast.hpp"
+
+namespace Diligent
+{
+
+namespace
+{
+
+enum BC_FORMAT : Uint8
+{
+    BC_FORMAT_BC1,
+    BC_FORMAT_BC3,
+    BC_FORMAT_BC4,
+    BC_FORMAT_BC5,
+    BC_FORMAT_BC7
+};
+
+bool GetBCFormat(TEXTURE_FORMAT Format, BC_FORMAT& BCFormat)
+{
+    switch (Format)
+    {
+        case TEX_FORMAT_BC1_UNORM:
+        case TEX_FORMAT_BC1_UNORM_SRGB:
+            BCFormat = BC_FORMAT_BC1;
+            return true;
+
+        case TEX_FORMAT_BC3_UNORM:
+        case TEX_FORMAT_BC3_UNORM_SRGB:
+            BCFormat = BC_FORMAT_BC3;
+            return true;
+
+        case TEX_FORMAT_BC4_UNORM:
+            BCFormat = BC_FORMAT_BC4;
+            return true;
+
+        case TEX_FORMAT_BC5_UNORM:
+            BCFormat = BC_FORMAT_BC5;
+            return true;
+
+        case TEX_FORMAT_BC7_UNORM:
+        case TEX_FORMAT_BC7_UNORM_SRGB:
+            BCFormat = BC_FORMAT_BC7;
+            return true;
+
+        default:
+            return false;
+    }
+}
+
+struct SourceLayout
+{
+    Uint32 NumComponents = 0;
+    bool   IsBGRA        = false;
+};
+
+bool GetSourceLayout(TEXTURE_FORMAT Format, SourceLayout& Layout)
+{
+    switch (Format)
+    {
+        case TEX_FORMAT_R8_UNORM:
+            Layout = {1, false};
+            return true;
+
+        case TEX_FORMAT_RG8_UNORM:
+            Layout = {2, false};
+            return true;
+
+        case TEX_FORMAT_RGBA8_UNORM:
+        case TEX_FORMAT_RGBA8_UNORM_SRGB:
+            Layout = {4, false};
+            return true;
+
+        case TEX_FORMAT_BGRA8_UNORM:
+        case TEX_FORMAT_BGRA8_UNORM_SRGB:
+            Layout = {4, true};
+            return true;
+
+        default:
+            return false;
+    }
+}
+
+// 4x4 block of RGBA8 texels in row-major order
+struct alignas(16) TexelBlock
+{
+    Uint8 Texels[16][4];
+};
+
+void LoadBlock(const Uint8*        pSrcSlice,
+               Uint64              SrcRowStride,
+               const SourceLayout& Layout,
+               Uint32              Width,
+               Uint32              Height,
+               Uint32              BlockX,
+               Uint32              BlockY,
+               TexelBlock&         Block)
+{
+    const Uint32 NumComponents = Layout.NumComponents;
+    for (Uint32 y = 0; y < 4; ++y)
+    {
+        // Texels outside of the subresource replicate the last row/column
+        const Uint32 Row  = std::min(BlockY * 4 + y, Height - 1);
+        const auto*  pRow = pSrcSlice + StaticCast<size_t>(SrcRowStride * Row);
+
+        if (NumComponents == 4 && !Layout.IsBGRA && BlockX * 4 + 4 <= Width)
+        {
+            memcpy(Block.Texels[y * 4], pRow + size_t{BlockX} * 16, 16);
+            continue;
+        }
+
+        for (Uint32 x = 0; x < 4; ++x)
+        {
+            const Uint32 Col    = std::min(BlockX * 4 + x, Width - 1);
+            const auto*  pTexel = pRow + size_t{Col} * NumComponents;
+            auto&        Texel  = Block.Texels[y * 4 + x];
+
+            Texel[0] = pTexel[0];
+            Texel[1] = NumComponents > 1 ? pTexel[1] : 0;
+            Texel[2] = NumComponents > 2 ? pTexel[2] : 0;
+            Texel[3] = NumComponents > 3 ? pTexel[3] : 255;
+            if (Layout.IsBGRA)
+                std::swap(Texel[0], Texel[2]);
+        }
+    }
+}
+
+// Finds the closest palette color for every texel in the block.
+// Returns the squared error of every texel in Errors.
+void FindClosestColors(const TexelBlock& Block,
+                       const Uint8 (*Palette)[4],
+                       Uint32 NumColors,
+                       Uint8  Indices[16],
+                       Uint32 Errors[16])
+{
+    VERIFY_EXPR(NumColors > 0 && NumColors <= 16);
+
+#if DILIGENT_SSE2_ENABLED
+    const __m128i Zero = _mm_setzero_si128();
+
+    // Two texels per register, 16-bit components
+    __m128i Texels[8];
+    for (Uint32 i = 0; i < 4; ++i)
+    {
+        const __m128i Row = _mm_load_si128(reinterpret_cast<const __m128i*>(Block.Texels[i * 4]));
+        Texels[i * 2 + 0] = _mm_unpacklo_epi8(Row, Zero);
+        Texels[i * 2 + 1] = _mm_unpackhi_epi8(Row, Zero);
+    }
+
+    __m128i BestErr[4];
+    __m128i BestIdx[4];
+    for (Uint32 i = 0; i < 4; ++i)
+    {
+        BestErr[i] = _mm_set1_epi32(std::numeric_limits<Int32>::max());
+        BestIdx[i] = Zero;
+    }
+
+    for (Uint32 c = 0; c < NumColors; ++c)
+    {
+        Int32 PackedColor;
+        memcpy(&PackedColor, Palette[c], 4);
+        const __m128i Color = _mm_unpacklo_epi8(_mm_set1_epi32(PackedColor), Zero);
+        const __m128i Idx   = _mm_set1_epi32(static_cast<Int32>(c));
+        for (Uint32 i = 0; i < 4; ++i)
+        {
+            const __m128i Diff0 = _mm_sub_epi16(Texels[i * 2 + 0], Color);
+            const __m128i Diff1 = _mm_sub_epi16(Texels[i * 2 + 1], Color);
+            // {r^2 + g^2, b^2 + a^2} for every texel
+            const __m128 Sq0 = _mm_castsi128_ps(_mm_madd_epi16(Diff0, Diff0));
+            const __m128 Sq1 = _mm_castsi128_ps(_mm_madd_epi16(Diff1, Diff1));
+
+            const __m128i Err = _mm_add_epi32(_mm_castps_si128(_mm_shuffle_ps(Sq0, Sq1, _MM_SHUFFLE(2, 0, 2, 0))),
+                                              _mm_castps_si128(_mm_shuffle_ps(Sq0, Sq1, _MM_SHUFFLE(3, 1, 3, 1))));
+
+            const __m128i Less = _mm_cmplt_epi32(Err, BestErr[i]);
+            BestErr[i]         = _mm_or_si128(_mm_and_si128(Less, Err), _mm_andnot_si128(Less, BestErr[i]));
+            BestIdx[i]         = _mm_or_si128(_mm_and_si128(Less, Idx), _mm_andnot_si128(Less, BestIdx[i]));
+        }
+    }
+
+    alignas(16) Int32 Idx[16];
+    for (Uint32 i = 0; i < 4; ++i)
+    {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(Errors + i * 4), BestErr[i]);
+        _mm_store_si128(reinterpret_cast<__m128i*>(Idx + i * 4), BestIdx[i]);
+    }
+    for (Uint32 i = 0; i < 16; ++i)
+        Indices[i] = static_cast<Uint8>(Idx[i]);
+#elif DILIGENT_NEON_ENABLED
+    int16x8_t Texels[8];
+    for (Uint32 i = 0; i < 4; ++i)
+    {
+        const uint8x16_t Row = vld1q_u8(Block.Texels[i * 4]);
+        Texels[i * 2 + 0]    = vreinterpretq_s16_u16(vmovl_u8(vget_low_u8(Row)));
+        Texels[i * 2 + 1]    = vreinterpretq_s16_u16(vmovl_u8(vget_high_u8(Row)));
+    }
+
+    int32x4_t  BestErr[4];
+    uint32x4_t BestIdx[4];
+    for (Uint32 i = 0; i < 4; ++i)
+    {
+        BestErr[i] = vdupq_n_s32(std::numeric_limits<Int32>::max());
+        BestIdx[i] = vdupq_n_u32(0);
+    }
+
+    for (Uint32 c = 0; c < NumColors; ++c)
+    {
+        Uint32 PackedColor;
+        memcpy(&PackedColor, Palette[c], 4);
+        const int16x8_t  Color = vreinterpretq_s16_u16(vmovl_u8(vreinterpret_u8_u32(vdup_n_u32(PackedColor))));
+        const uint32x4_t Idx   = vdupq_n_u32(c);
+        for (Uint32 i = 0; i < 4; ++i)
+        {
+            const int16x8_t Diff0 = vsubq_s16(Texels[i * 2 + 0], Color);
+            const int16x8_t Diff1 = vsubq_s16(Texels[i * 2 + 1], Color);
+
+            const int32x4_t Sq01 = vpaddq_s32(vmull_s16(vget_low_s16(Diff0), vget_low_s16(Diff0)),
+                                              vmull_s16(vget_high_s16(Diff0), vget_high_s16(Diff0)));
+            const int32x4_t Sq23 = vpaddq_s32(vmull_s16(vget_low_s16(Diff1), vget_low_s16(Diff1)),
+                                              vmull_s16(vget_high_s16(Diff1), vget_high_s16(Diff1)));
+            const int32x4_t Err  = vpaddq_s32(Sq01, Sq23);
+
+            const uint32x4_t Less = vcltq_s32(Err, BestErr[i]);
+            BestErr[i]            = vbslq_s32(Less, Err, BestErr[i]);
+            BestIdx[i]            = vbslq_u32(Less, Idx, BestIdx[i]);
+        }
+    }
+
+    Uint32 Idx[16];
+    for (Uint32 i = 0; i < 4; ++i)
+    {
+        vst1q_u32(Errors + i * 4, vreinterpretq_u32_s32(BestErr[i]));
+        vst1q_u32(Idx + i * 4, BestIdx[i]);
+    }
+    for (Uint32 i = 0; i < 16; ++i)
+        Indices[i] = static_cast<Uint8>(Idx[i]);
+#else
+    for (Uint32 i = 0; i < 16; ++i)
+    {
+        const auto& Texel   = Block.Texels[i];
+        Uint32      BestErr = std::numeric_limits<Uint32>::max();
+        Uint8       BestIdx = 0;
+        for (Uint32 c = 0; c < NumColors; ++c)
+        {
+            Uint32 Err = 0;
+            for (Uint32 ch = 0; ch < 4; ++ch)
+            {
+                const Int32 Diff = Int32{Texel[ch]} - Int32{Palette[c][ch]};
+                Err += static_cast<Uint32>(Diff * Diff);
+            }
+            if (Err < BestErr)
+            {
+                BestErr = Err;
+                BestIdx = static_cast<Uint8>(c);
+            }
+        }
+        Indices[i] = BestIdx;
+        Errors[i]  = BestErr;
+    }
+#endif
+}
+
+// Finds the closest palette value for every value in the block and returns the total squared error.
+Uint32 FindClosestValues(const Uint8 Values[16], const Uint8* Palette, Uint32 NumValues, Uint8 Indices[16])
+{
+    VERIFY_EXPR(NumValues > 0 && NumValues <= 16);
+
+    alignas(16) Uint8 Diffs[16];
+#if DILIGENT_SSE2_ENABLED
+    const __m128i Vals     = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Values));
+    __m128i       BestDiff = _mm_set1_epi8(static_cast<char>(0xFF));
+    __m128i       BestIdx  = _mm_setzero_si128();
+    for (Uint32 c = 0; c < NumValues; ++c)
+    {
+        const __m128i Val  = _mm_set1_epi8(static_cast<char>(Palette[c]));
+        const __m128i Diff = _mm_or_si128(_mm_subs_epu8(Vals, Val), _mm_subs_epu8(Val, Vals));
+        // Diff < BestDiff <=> max(Diff, BestDiff) != Diff
+        const __m128i Less = _mm_xor_si128(_mm_cmpeq_epi8(_mm_max_epu8(Diff, BestDiff), Diff), _mm_set1_epi8(static_cast<char>(0xFF)));
+
+        BestDiff = _mm_min_epu8(Diff, BestDiff);
+        BestIdx  = _mm_or_si128(_mm_and_si128(Less, _mm_set1_epi8(static_cast<char>(c))), _mm_andnot_si128(Less, BestIdx));
+    }
+    _mm_store_si128(reinterpret_cast<__m128i*>(Diffs), BestDiff);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(Indices), BestIdx);
+#elif DILIGENT_NEON_ENABLED
+    const uint8x16_t Vals     = vld1q_u8(Values);
+    uint8x16_t       BestDiff = vdupq_n_u8(0xFF);
+    uint8x16_t       BestIdx  = vdupq_n_u8(0);
+    for (Uint32 c = 0; c < NumValues; ++c)
+    {
+        const uint8x16_t Diff = vabdq_u8(Vals, vdupq_n_u8(Palette[c]));
+        const uint8x16_t Less = vcltq_u8(Diff, BestDiff);
+
+        BestDiff = vminq_u8(Diff, BestDiff);
+        BestIdx  = vbslq_u8(Less, vdupq_n_u8(static_cast<Uint8>(c)), BestIdx);
+    }
+    vst1q_u8(Diffs, BestDiff);
+    vst1q_u8(Indices, BestIdx);
+#else
+    for (Uint32 i = 0; i < 16; ++i)
+    {
+        Uint8 BestDiff = 0xFF;
+        Uint8 BestIdx  = 0;
+        for (Uint32 c = 0; c < NumValues; ++c)
+        {
+            const Uint8 Diff = static_cast<Uint8>(std::abs(Int32{Values[i]} - Int32{Palette[c]}));
+            if (Diff < BestDiff)
+            {
+                BestDiff = Diff;
+                BestIdx  = static_cast<Uint8>(c);
+            }
+        }
+        Diffs[i]   = BestDiff;
+        Indices[i] = BestIdx;
+    }
+#endif
+
+    Uint32 Error = 0;
+    for (Uint32 i = 0; i < 16; ++i)
+        Error += Uint32{Diffs[i]} * Uint32{Diffs[i]};
+    return Error;
+}
+
+inline float ClampEndpoint(float Value)
+{
+    return std::min(std::max(Value, 0.f), 255.f);
+}
+
+// Fits a line through the texels selected by the mask and returns the extreme points of the
+// texel projections onto the line.
+template <Uint32 NumChannels>
+void FitEndpoints(const TexelBlock& Block, Uint32 TexelMask, float Endpoints[2][4])
+{
+    float  Mean[4]   = {};
+    Uint32 NumTexels = 0;
+    for (Uint32 i = 0; i < 16; ++i)
+    {
+        if ((TexelMask & (1u << i)) == 0)
+            continue;
+        for (Uint32 c = 0; c < NumChannels; ++c)
+            Mean[c] += Block.Texels[i][c];
+        ++NumTexels;
+    }
+    VERIFY_EXPR(NumTexels > 0);
+    for (Uint32 c = 0; c < NumChannels; ++c)
+        Mean[c] /= static_cast<float>(NumTexels);
+
+    float Cov[4][4] = {};
+    for (Uint32 i = 0; i < 16; ++i)
+    {
+        if ((TexelMask & (1u << i)) == 0)
+            continue;
+        float Diff[4];
+        for (Uint32 c = 0; c < NumChannels; ++c)
+            Diff[c] = Block.Texels[i][c] - Mean[c];
+        for (Uint32 r = 0; r < NumChannels; ++r)
+        {
+            for (Uint32 c = r; c < NumChannels; ++c)
+                Cov[r][c] += Diff[r] * Diff[c];
+        }
+    }
+
+    // Start the power iteration from the covariance matrix row with the largest diagonal element
+    Uint32 MaxRow = 0;
+    for (Uint32 r = 0; r < NumChannels; ++r)
+    {
+        for (Uint32 c = 0; c < r; ++c)
+            Cov[r][c] = Cov[c][r];
+        if (Cov[r][r] > Cov[MaxRow][MaxRow])
+            MaxRow = r;
+    }
+
+    float Axis[4] = {};
+    for (Uint32 c = 0; c < NumChannels; ++c)
+        Axis[c] = Cov[MaxRow][c];
+
+    float AxisLen = 0;
+    for (Uint32 Iter = 0; Iter < 8; ++Iter)
+    {
+        float NewAxis[4] = {};
+        for (Uint32 r = 0; r < NumChannels; ++r)
+        {
+            for (Uint32 c = 0; c < NumChannels; ++c)
+                NewAxis[r] += Cov[r][c] * Axis[c];
+        }
+
+        AxisLen = 0;
+        for (Uint32 c = 0; c < NumChannels; ++c)
+            AxisLen = std::max(AxisLen, std::abs(NewAxis[c]));
+        if (AxisLen < 1e-6f)
+            break;
+        for (Uint32 c = 0; c < NumChannels; ++c)
+            Axis[c] = NewAxis[c] / AxisLen;
+    }
+
+    if (AxisLen < 1e-6f)
+    {
+        // All texels are the same
+        for (Uint32 c = 0; c < NumChannels; ++c)
+            Endpoints[0][c] = Endpoints[1][c] = Mean[c];
+        return;
+    }
+
+    float AxisLenSq = 0;
+    for (Uint32 c = 0; c < NumChannels; ++c)
+        AxisLenSq += Axis[c] * Axis[c];
+
+    float MinT = +std::numeric_limits<float>::max();
+    float MaxT = -std::numeric_limits<float>::max();
+    for (Uint32 i = 0; i < 16; ++i)
+    {
+        if ((TexelMask & (1u << i)) == 0)
+            continue;
+        float T = 0;
+        for (Uint32 c = 0; c < NumChannels; ++c)
+            T += (Block.Texels[i][c] - Mean[c]) * Axis[c];
+        MinT = std::min(MinT, T);
+        MaxT = std::max(MaxT, T);
+    }
+    MinT /= AxisLenSq;
+    MaxT /= AxisLenSq;
+
+    for (Uint32 c = 0; c < NumChannels; ++c)
+    {
+        Endpoints[0][c] = ClampEndpoint(Mean[c] + Axis[c] * MinT);
+        Endpoints[1][c] = ClampEndpoint(Mean[c] + Axis[c] * MaxT);
+    }
+}
+
+// Computes the least-squares endpoints for the given indices, where Weights
+// define the interpolation weight of the second endpoint for every index.
+template <Uint32 NumChannels>
+bool RefineEndpoints(const TexelBlock& Block, Uint32 TexelMask, const Uint8 Indices[16], const float* Weights, float Endpoints[2][4])
+{
+    float A = 0, B = 0, C = 0;
+    float X0[4] = {};
+    float X1[4] = {};
+    for (Uint32 i = 0; i < 16; ++i)
+    {
+        if ((TexelMask & (1u << i)) == 0)
+            continue;
+        const float T1 = Weights[Indices[i]];
+        const float T0 = 1.f - T1;
+        A += T0 * T0;
+        B += T0 * T1;
+        C += T1 * T1;
+        for (Uint32 c = 0; c < NumChannels; ++c)
+        {
+            X0[c] += T0 * Block.Texels[i][c];
+            X1[c] += T1 * Block.Texels[i][c];
+        }
+    }
+
+    const float Det = A * C - B * B;
+    if (std::abs(Det) < 1e-6f)
+        return false;
+
+    for (Uint32 c = 0; c < NumChannels; ++c)
+    {
+        Endpoints[0][c] = ClampEndpoint((C * X0[c] - B * X1[c]) / Det);
+        Endpoints[1][c] = ClampEndpoint((A * X1[c] - B * X0[c]) / Det);
+    }
+    return true;
+}
+
+// Scalar version of RefineEndpoints
+bool RefineValueEndpoints(const Uint8 Values[16], const Uint8 Indices[16], const float* Weights, float& E0, float& E1)
+{
+    float A = 0, B = 0, C = 0, X0 = 0, X1 = 0;
+    for (Uint32 i = 0; i < 16; ++i)
+    {
+        const float T1 = Weights[Indices[i]];
+        const float T0 = 1.f - T1;
+        A += T0 * T0;
+        B += T0 * T1;
+        C += T1 * T1;
+        X0 += T0 * Values[i];
+        X1 += T1 * Values[i];
+    }
+
+    const float Det = A * C - B * B;
+    if (std::abs(Det) < 1e-6f)
+        return false;
+
+    E0 = ClampEndpoint((C * X0 - B * X1) / Det);
+    E1 = ClampEndpoint((A * X1 - B * X0) / Det);
+    return true;
+}
+
+inline Uint32 QuantizeEndpoint(float Value, Uint32 MaxValue)
+{
+    return static_cast<Uint32>(std::min(std::max(Value * static_cast<float>(MaxValue) / 255.f + 0.5f, 0.f), static_cast<float>(MaxValue)));
+}
+
+
+// BC1 color block
+
+struct BC1Result
+{
+    Uint16 Color0      = 0;
+    Uint16 Color1      = 0;
+    Uint8  Indices[16] = {};
+    Uint32 Error       = std::numeric_limits<Uint32>::max();
+};
+
+inline Uint16 PackRGB565(const float Color[4])
+{
+    return static_cast<Uint16>((QuantizeEndpoint(Color[0], 31) << 11) |
+                               (QuantizeEndpoint(Color[1], 63) << 5) |
+                               (QuantizeEndpoint(Color[2], 31) << 0));
+}
+
+inline void UnpackRGB565(Uint16 Color, Uint8 RGBA[4])
+{
+    const Uint32 R = (Color >> 11) & 0x1F;
+    const Uint32 G = (Color >> 5) & 0x3F;
+    const Uint32 B = (Color >> 0) & 0x1F;
+
+    RGBA[0] = static_cast<Uint8>((R << 3) | (R >> 2));
+    RGBA[1] = static_cast<Uint8>((G << 2) | (G >> 4));
+    RGBA[2] = static_cast<Uint8>((B << 3) | (B >> 2));
+    RGBA[3] = 0;
+}
+
+// Interpolation weights of the second endpoint in 4- and 3-color modes
+static constexpr float BC1Weights4[] = {0.f, 1.f, 1.f / 3.f, 2.f / 3.f};
+static constexpr float BC1Weights3[] = {0.f, 1.f, 0.5f, 0.f};
+
+// Colors block must have zero alpha. Texels in TransparentMask are encoded with index 3
+// in 3-color mode and do not contribute to the error.
+void EncodeBC1Colors(const TexelBlock& Colors, const float Endpoints[2][4], bool ThreeColorMode, Uint32 TransparentMask, BC1Result& Res)
+{
+    Uint16 Color0 = PackRGB565(Endpoints[1]);
+    Uint16 Color1 = PackRGB565(Endpoints[0]);
+    // 4-color mode requires Color0 > Color1, 3-color mode requires Color0 <= Color1
+    if (ThreeColorMode ? Color0 > Color1 : Color0 < Color1)
+        std::swap(Color0, Color1);
+
+    Uint8 Palette[4][4];
+    UnpackRGB565(Color0, Palette[0]);
+    UnpackRGB565(Color1, Palette[1]);
+    for (Uint32 c = 0; c < 4; ++c)
+    {
+        const Uint32 C0 = Palette[0][c];
+        const Uint32 C1 = Palette[1][c];
+        if (ThreeColorMode)
+        {
+            Palette[2][c] = static_cast<Uint8>((C0 + C1 + 1) / 2);
+            Palette[3][c] = 0;
+        }
+        else
+        {
+            Palette[2][c] = static_cast<Uint8>((2 * C0 + C1 + 1) / 3);
+            Palette[3][c] = static_cast<Uint8>((C0 + 2 * C1 + 1) / 3);
+        }
+    }
+
+    Uint8  Indices[16];
+    Uint32 Errors[16];
+    // Index 3 in 3-color mode is transparent black and is only used for transparent texels
+    FindClosestColors(Colors, Palette, ThreeColorMode ? 3 : 4, Indices, Errors);
+
+    Uint32 Error = 0;
+    for (Uint32 i = 0; i < 16; ++i)
+    {
+        if (TransparentMask & (1u << i))
+            Indices[i] = 3;
+        else
+            Error += Errors[i];
+    }
+
+    if (Error < Res.Error)
+    {
+        Res.Color0 = Color0;
+        Res.Color1 = Color1;
+        memcpy(Res.Indices, Indices, sizeof(Indices));
+        Res.Error = Error;
+    }
+}
+
+void CompressBC1Block(const TexelBlock& Block, bool AllowTransparency, TEXTURE_COMPRESSION_QUALITY Quality, Uint8* pDst)
+{
+    TexelBlock Colors     = Block;
+    Uint32     OpaqueMask = 0;
+    for (Uint32 i = 0; i < 16; ++i)
+    {
+        if (!AllowTransparency || Block.Texels[i][3] >= 128)
+            OpaqueMask |= 1u << i;
+        Colors.Texels[i][3] = 0;
+    }
+    const Uint32 TransparentMask = ~OpaqueMask & 0xFFFFu;
+
+    BC1Result Res;
+    if (OpaqueMask != 0)
+    {
+        const bool ThreeColorMode = TransparentMask != 0;
+
+        float Endpoints[2][4];
+        FitEndpoints<3>(Colors, OpaqueMask, Endpoints);
+        EncodeBC1Colors(Colors, Endpoints, ThreeColorMode, TransparentMask, Res);
+
+        if (Quality == TEXTURE_COMPRESSION_QUALITY_HIGH)
+        {
+            // Opaque blocks may be better represented in 3-color mode
+            if (AllowTransparency && !ThreeColorMode)
+                EncodeBC1Colors(Colors, Endpoints, true, 0, Res);
+
+            for (Uint32 Iter = 0; Iter < 3 && Res.Error > 0; ++Iter)
+            {
+                const bool IsThreeColor = Res.Color0 <= Res.Color1;
+
+                float RefinedEndpoints[2][4];
+                if (!RefineEndpoints<3>(Colors, OpaqueMask, Res.Indices, IsThreeColor ? BC1Weights3 : BC1Weights4, RefinedEndpoints))
+                    break;
+
+                const Uint32 PrevError = Res.Error;
+                EncodeBC1Colors(Colors, RefinedEndpoints, IsThreeColor, TransparentMask, Res);
+                if (Res.Error >= PrevError)
+                    break;
+            }
+        }
+    }
+    else
+    {
+        // Fully transparent block
+        for (auto& Idx : Res.Indices)
+            Idx = 3;
+    }
+
+    Uint32 Indices = 0;
+    for (Uint32 i = 0; i < 16; ++i)
+        Indices |= Uint32{Res.Indices[i]} << (i * 2);
+
+    memcpy(pDst + 0, &Res.Color0, 2);
+    memcpy(pDst + 2, &Res.Color1, 2);
+    memcpy(pDst + 4, &Indices, 4);
+}
+
+
+// BC4 block
+
+struct BC4Result
+{
+    Uint8  Value0      = 0;
+    Uint8  Value1      = 0;
+    Uint8  Indices[16] = {};
+    Uint32 Error       = std::numeric_limits<Uint32>::max();
+};
+
+// Interpolation weights of the second endpoint in 8-value mode
+static constexpr float BC4Weights8[] = {0.f, 1.f, 1.f / 7.f, 2.f / 7.f, 3.f / 7.f, 4.f / 7.f, 5.f / 7.f, 6.f / 7.f};
+
+void EncodeBC4Values(const Uint8 Values[16], Uint32 Value0, Uint32 Value1, BC4Result& Res)
+{
+    Uint8 Palette[8];
+    Palette[0] = static_cast<Uint8>(Value0);
+    Palette[1] = static_cast<Uint8>(Value1);
+    if (Value0 > Value1)
+    {
+        for (Uint32 i = 1; i < 7; ++i)
+            Palette[i + 1] = static_cast<Uint8>(((7 - i) * Value0 + i * Value1 + 3) / 7);
+    }
+    else
+    {
+        for (Uint32 i = 1; i < 5; ++i)
+            Palette[i + 1] = static_cast<Uint8>(((5 - i) * Value0 + i * Value1 + 2) / 5);
+        Palette[6] = 0;
+        Palette[7] = 255;
+    }
+
+    Uint8        Indices[16];
+    const Uint32 Error = FindClosestValues(Values, Palette, 8, Indices);
+    if (Error < Res.Error)
+    {
+        Res.Value0 = static_cast<Uint8>(Value0);
+        Res.Value1 = static_cast<Uint8>(Value1);
+        memcpy(Res.Indices, Indices, sizeof(Indices));
+        Res.Error = Error;
+    }
+}
+
+void CompressBC4Block(const Uint8 Values[16], TEXTURE_COMPRESSION_QUALITY Quality, Uint8* pDst)
+{
+    Uint32 MinVal = 255, MaxVal = 0;
+    for (Uint32 i = 0; i < 16; ++i)
+    {
+        MinVal = std::min(MinVal, Uint32{Values[i]});
+        MaxVal = std::max(MaxVal, Uint32{Values[i]});
+    }
+
+    BC4Result Res;
+    EncodeBC4Values(Values, MaxVal, MinVal, Res);
+
+    if (Quality == TEXTURE_COMPRESSION_QUALITY_HIGH && Res.Error > 0)
+    {
+        // 6-value mode represents 0 and 255 exactly and fits the remaining values
+        Uint32 MinInner = 255, MaxInner = 0;
+        for (Uint32 i = 0; i < 16; ++i)
+        {
+            if (Values[i] != 0 && Values[i] != 255)
+            {
+                MinInner = std::min(MinInner, Uint32{Values[i]});
+                MaxInner = std::max(MaxInner, Uint32{Values[i]});
+            }
+        }
+        if (MinInner <= MaxInner && (MinVal == 0 || MaxVal == 255))
+            EncodeBC4Values(Values, MinInner, MaxInner, Res);
+
+        // Refine 8-value mode endpoints
+        for (Uint32 Iter = 0; Iter < 3 && Res.Error > 0 && Res.Value0 > Res.Value1; ++Iter)
+        {
+            float E0, E1;
+            if (!RefineValueEndpoints(Values, Res.Indices, BC4Weights8, E0, E1))
+                break;
+
+            const Uint32 Value0 = QuantizeEndpoint(E0, 255);
+            const Uint32 Value1 = QuantizeEndpoint(E1, 255);
+            if (Value0 <= Value1)
+                break;
+
+            const Uint32 PrevError = Res.Error;
+            EncodeBC4Values(Values, Value0, Value1, Res);
+            if (Res.Error >= PrevError)
+                break;
+        }
+
+        // Search the neighborhood of the best endpoints
+        const Uint32 BestValue0 = Res.Value0;
+        const Uint32 BestValue1 = Res.Value1;
+        if (BestValue0 > BestValue1)
+        {
+            for (Int32 d0 = -1; d0 <= 1; ++d0)
+            {
+                for (Int32 d1 = -1; d1 <= 1; ++d1)
+                {
+                    const Int32 Value0 = static_cast<Int32>(BestValue0) + d0;
+                    const Int32 Value1 = static_cast<Int32>(BestValue1) + d1;
+                    if ((d0 != 0 || d1 != 0) && Value0 <= 255 && Value1 >= 0 && Value0 > Value1)
+                        EncodeBC4Values(Values, static_cast<Uint32>(Value0), static_cast<Uint32>(Value1), Res);
+                }
+            }
+        }
+    }
+
+    Uint64 Indices = 0;
+    for (Uint32 i = 0; i < 16; ++i)
+        Indices |= Uint64{Res.Indices[i]} << (i * 3);
+
+    pDst[0] = Res.Value0;
+    pDst[1] = Res.Value1;
+    for (Uint32 i = 0; i < 6; ++i)
+        pDst[2 + i] = static_cast<Uint8>(Indices >> (i * 8));
+}
+
+void CompressBC4Channel(const TexelBlock& Block, Uint32 Channel, TEXTURE_COMPRESSION_QUALITY Quality, Uint8* pDst)
+{
+    Uint8 Values[16];
+    for (Uint32 i = 0; i < 16; ++i)
+        Values[i] = Block.Texels[i][Channel];
+    CompressBC4Block(Values, Quality, pDst);
+}
+
+
+// BC7 block
+
+class BC7BlockWriter
+{
+public:
+    void Write(Uint32 Value, Uint32 NumBits)
+    {
+        VERIFY_EXPR(NumBits <= 32 && m_Pos + NumBits <= 128);
+        const Uint64 Bits = Uint64{Value} & ((Uint64{1} << NumBits) - 1);
+        if (m_Pos < 64)
+        {
+            m_Lo |= Bits << m_Pos;
+            if (m_Pos + NumBits > 64)
+                m_Hi |= Bits >> (64 - m_Pos);
+        }
+        else
+        {
+            m_Hi |= Bits << (m_Pos - 64);
+        }
+        m_Pos += NumBits;
+    }
+
+    void Store(Uint8* pDst) const
+    {
+        VERIFY(m_Pos == 128, "BC7 block must contain exactly 128 bits");
+        for (Uint32 i = 0; i < 8; ++i)
+        {
+            pDst[i]     = static_cast<Uint8>(m_Lo >> (i * 8));
+            pDst[i + 8] = static_cast<Uint8>(m_Hi >> (i * 8));
+        }
+    }
+
+private:
+    Uint64 m_Lo  = 0;
+    Uint64 m_Hi  = 0;
+    Uint32 m_Pos = 0;
+};
+
+static constexpr Uint8 BC7Weights2[] = {0, 21, 43, 64};
+static constexpr Uint8 BC7Weights4[] = {0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64};
+
+static constexpr float BC7Weights2f[] = {0.f, 21.f / 64.f, 43.f / 64.f, 1.f};
+static constexpr float BC7Weights4f[] = {
+    0.f / 64.f, 4.f / 64.f, 9.f / 64.f, 13.f / 64.f, 17.f / 64.f, 21.f / 64.f, 26.f / 64.f, 30.f / 64.f,
+    34.f / 64.f, 38.f / 64.f, 43.f / 64.f, 47.f / 64.f, 51.f / 64.f, 55.f / 64.f, 60.f / 64.f, 64.f / 64.f};
+
+inline Uint8 BC7Interpolate(Uint32 E0, Uint32 E1, Uint32 Weight)
+{
+    return static_cast<Uint8>(((64 - Weight) * E0 + Weight * E1 + 32) >> 6);
+}
+
+// Mode 6: single subset, 7-bit RGBA endpoints with unique p-bits, 4-bit indices
+struct BC7Mode6Result
+{
+    Uint8  Endpoints[2][4] = {};
+    Uint8  PBits[2]        = {};
+    Uint8  Indices[16]     = {};
+    Uint32 Error           = std::numeric_limits<Uint32>::max();
+};
+
+void EncodeBC7Mode6(const TexelBlock& Block, const float Endpoints[2][4], const Uint8 PBits[2], BC7Mode6Result& Res)
+{
+    Uint8 QuantEndpoints[2][4];
+    Uint8 Colors[2][4];
+    for (Uint32 e = 0; e < 2; ++e)
+    {
+        for (Uint32 c = 0; c < 4; ++c)
+        {
+            const float Q = std::min(std::max((Endpoints[e][c] - PBits[e]) * 0.5f + 0.5f, 0.f), 127.f);
+
+            QuantEndpoints[e][c] = static_cast<Uint8>(Q);
+            Colors[e][c]         = static_cast<Uint8>((QuantEndpoints[e][c] << 1) | PBits[e]);
+        }
+    }
+
+    Uint8 Palette[16][4];
+    for (Uint32 i = 0; i < 16; ++i)
+    {
+        for (Uint32 c = 0; c < 4; ++c)
+            Palette[i][c] = BC7Interpolate(Colors[0][c], Colors[1][c], BC7Weights4[i]);
+    }
+
+    Uint8  Indices[16];
+    Uint32 Errors[16];
+    FindClosestColors(Block, Palette, 16, Indices, Errors);
+
+    Uint32 Error = 0;
+    for (Uint32 i = 0; i < 16; ++i)
+        Error += Errors[i];
+
+    if (Error < Res.Error)
+    {
+        memcpy(Res.Endpoints, QuantEndpoints, sizeof(QuantEndpoints));
+        Res.PBits[0] = PBits[0];
+        Res.PBits[1] = PBits[1];
+        memcpy(Res.Indices, Indices, sizeof(Indices));
+        Res.Error = Error;
+    }
+}
+
+// Selects the p-bit that minimizes the quantization error of the endpoint
+Uint8 SelectPBit(const float Endpoint[4])
+{
+    float Errors[2] = {};
+    for (Uint8 p = 0; p < 2; ++p)
+    {
+        for (Uint32 c = 0; c < 4; ++c)
+        {
+            const float Q   = std::floor(std::min(std::max((Endpoint[c] - p) * 0.5f + 0.5f, 0.f), 127.f));
+            const float Err = Q * 2 + p - Endpoint[c];
+            Errors[p] += Err * Err;
+        }
+    }
+    return Errors[1] < Errors[0] ? 1 : 0;
+}
+
+void TryBC7Mode6PBits(const TexelBlock& Block, const float Endpoints[2][4], bool SearchPBits, BC7Mode6Result& Res)
+{
+    if (SearchPBits)
+    {
+        for (Uint8 p = 0; p < 4; ++p)
+        {
+            const Uint8 PBits[] = {static_cast<Uint8>(p & 1), static_cast<Uint8>(p >> 1)};
+            EncodeBC7Mode6(Block, Endpoints, PBits, Res);
+        }
+    }
+    else
+    {
+        const Uint8 PBits[] = {SelectPBit(Endpoints[0]), SelectPBit(Endpoints[1])};
+        EncodeBC7Mode6(Block, Endpoints, PBits, Res);
+    }
+}
+
+void WriteBC7Mode6(BC7Mode6Result& Res, Uint8* pDst)
+{
+    // The most significant bit of the anchor index is implicitly zero
+    if (Res.Indices[0] & 0x8)
+    {
+        for (Uint32 c = 0; c < 4; ++c)
+            std::swap(Res.Endpoints[0][c], Res.Endpoints[1][c]);
+        std::swap(Res.PBits[0], Res.PBits[1]);
+        for (auto& Idx : Res.Indices)
+            Idx = static_cast<Uint8>(15 - Idx);
+    }
+
+    BC7BlockWriter Writer;
+    Writer.Write(1u << 6, 7);
+    for (Uint32 c = 0; c < 4; ++c)
+    {
+        Writer.Write(Res.Endpoints[0][c], 7);
+        Writer.Write(Res.Endpoints[1][c], 7);
+    }
+    Writer.Write(Res.PBits[0], 1);
+    Writer.Write(Res.PBits[1], 1);
+    Writer.Write(Res.Indices[0], 3);
+    for (Uint32 i = 1; i < 16; ++i)
+        Writer.Write(Res.Indices[i], 4);
+    Writer.Store(pDst);
+}
+
+// Mode 5: single subset, 7-bit RGB and 8-bit alpha endpoints, separate 2-bit color and alpha indices,
+// the alpha channel may be swapped with one of the color channels.
+struct BC7Mode5Result
+{
+    Uint8  Rotation             = 0;
+    Uint8  ColorEndpoints[2][3] = {};
+    Uint8  AlphaEndpoints[2]    = {};
+    Uint8  ColorIndices[16]     = {};
+    Uint8  AlphaIndices[16]     = {};
+    Uint32 Error                = std::numeric_limits<Uint32>::max();
+};
+
+Uint32 EncodeBC7Mode5Color(const TexelBlock& Colors, const float Endpoints[2][4], Uint8 QuantEndpoints[2][3], Uint8 Indices[16])
+{
+    Uint8 Palette[4][4];
+    Uint8 EndpointColors[2][3];
+    for (Uint32 e = 0; e < 2; ++e)
+    {
+        for (Uint32 c = 0; c < 3; ++c)
+        {
+            const Uint32 Q       = QuantizeEndpoint(Endpoints[e][c], 127);
+            QuantEndpoints[e][c] = static_cast<Uint8>(Q);
+            EndpointColors[e][c] = static_cast<Uint8>((Q << 1) | (Q >> 6));
+        }
+    }
+    for (Uint32 i = 0; i < 4; ++i)
+    {
+        for (Uint32 c = 0; c < 3; ++c)
+            Palette[i][c] = BC7Interpolate(EndpointColors[0][c], EndpointColors[1][c], BC7Weights2[i]);
+        Palette[i][3] = 0;
+    }
+
+    Uint32 Errors[16];
+    FindClosestColors(Colors, Palette, 4, Indices, Errors);
+
+    Uint32 Error = 0;
+    for (Uint32 i = 0; i < 16; ++i)
+        Error += Errors[i];
+    return Error;
+}
+
+Uint32 EncodeBC7Mode5Alpha(const Uint8 Values[16], Uint32 Alpha0, Uint32 Alpha1, Uint8 Indices[16])
+{
+    Uint8 Palette[4];
+    for (Uint32 i = 0; i < 4; ++i)
+        Palette[i] = BC7Interpolate(Alpha0, Alpha1, BC7Weights2[i]);
+    return FindClosestValues(Values, Palette, 4, Indices);
+}
+
+void EncodeBC7Mode5(const TexelBlock& Block, Uint8 Rotation, BC7Mode5Result& Res)
+{
+    // Rotation 1, 2, 3 swaps alpha with red, green, blue respectively
+    TexelBlock Colors = Block;
+    Uint8      Alphas[16];
+    for (Uint32 i = 0; i < 16; ++i)
+    {
+        auto& Texel = Colors.Texels[i];
+        if (Rotation != 0)
+            std::swap(Texel[Rotation - 1], Texel[3]);
+        Alphas[i] = Texel[3];
+        Texel[3]  = 0;
+    }
+
+    BC7Mode5Result Candidate;
+    Candidate.Rotation = Rotation;
+
+    // Color
+    {
+        float Endpoints[2][4];
+        FitEndpoints<3>(Colors, 0xFFFFu, Endpoints);
+        Uint32 ColorError = EncodeBC7Mode5Color(Colors, Endpoints, Candidate.ColorEndpoints, Candidate.ColorIndices);
+        for (Uint32 Iter = 0; Iter < 2 && ColorError > 0; ++Iter)
+        {
+            if (!RefineEndpoints<3>(Colors, 0xFFFFu, Candidate.ColorIndices, BC7Weights2f, Endpoints))
+                break;
+
+            Uint8        QuantEndpoints[2][3];
+            Uint8        Indices[16];
+            const Uint32 Error = EncodeBC7Mode5Color(Colors, Endpoints, QuantEndpoints, Indices);
+            if (Error >= ColorError)
+                break;
+
+            memcpy(Candidate.ColorEndpoints, QuantEndpoints, sizeof(QuantEndpoints));
+            memcpy(Candidate.ColorIndices, Indices, sizeof(Indices));
+            ColorError = Error;
+        }
+        Candidate.Error = ColorError;
+    }
+
+    // Alpha
+    {
+        Uint32 MinAlpha = 255, MaxAlpha = 0;
+        for (Uint32 i = 0; i < 16; ++i)
+        {
+            MinAlpha = std::min(MinAlpha, Uint32{Alphas[i]});
+            MaxAlpha = std::max(MaxAlpha, Uint32{Alphas[i]});
+        }
+        Candidate.AlphaEndpoints[0] = static_cast<Uint8>(MinAlpha);
+        Candidate.AlphaEndpoints[1] = static_cast<Uint8>(MaxAlpha);
+
+        Uint32 AlphaError = EncodeBC7Mode5Alpha(Alphas, MinAlpha, MaxAlpha, Candidate.AlphaIndices);
+        for (Uint32 Iter = 0; Iter < 2 && AlphaError > 0; ++Iter)
+        {
+            float E0, E1;
+            if (!RefineValueEndpoints(Alphas, Candidate.AlphaIndices, BC7Weights2f, E0, E1))
+                break;
+
+            const Uint32 Alpha0 = QuantizeEndpoint(E0, 255);
+            const Uint32 Alpha1 = QuantizeEndpoint(E1, 255);
+
+            Uint8        Indices[16];
+            const Uint32 Error = EncodeBC7Mode5Alpha(Alphas, Alpha0, Alpha1, Indices);
+            if (Error >= AlphaError)
+                break;
+
+            Candidate.AlphaEndpoints[0] = static_cast<Uint8>(Alpha0);
+            Candidate.AlphaEndpoints[1] = static_cast<Uint8>(Alpha1);
+            memcpy(Candidate.AlphaIndices, Indices, sizeof(Indices));
+            AlphaError = Error;
+        }
+        Candidate.Error += AlphaError;
+    }
+
+    if (Candidate.Error < Res.Error)
+        Res = Candidate;
+}
+
+void WriteBC7Mode5(BC7Mode5Result& Res, Uint8* pDst)
+{
+    // The most significant bits of the anchor indices are implicitly zero
+    if (Res.ColorIndices[0] & 0x2)
+    {
+        for (Uint32 c = 0; c < 3; ++c)
+            std::swap(Res.ColorEndpoints[0][c], Res.ColorEndpoints[1][c]);
+        for (auto& Idx : Res.ColorIndices)
+            Idx = static_cast<Uint8>(3 - Idx);
+    }
+    if (Res.AlphaIndices[0] & 0x2)
+    {
+        std::swap(Res.AlphaEndpoints[0], Res.AlphaEndpoints[1]);
+        for (auto& Idx : Res.AlphaIndices)
+            Idx = static_cast<Uint8>(3 - Idx);
+    }
+
+    BC7BlockWriter Writer;
+    Writer.Write(1u << 5, 6);
+    Writer.Write(Res.Rotation, 2);
+    for (Uint32 c = 0; c < 3; ++c)
+    {
+        Writer.Write(Res.ColorEndpoints[0][c], 7);
+        Writer.Write(Res.ColorEndpoints[1][c], 7);
+    }
+    Writer.Write(Res.AlphaEndpoints[0], 8);
+    Writer.Write(Res.AlphaEndpoints[1], 8);
+    Writer.Write(Res.ColorIndices[0], 1);
+    for (Uint32 i = 1; i < 16; ++i)
+        Writer.Write(Res.ColorIndices[i], 2);
+    Writer.Write(Res.AlphaIndices[0], 1);
+    for (Uint32 i = 1; i < 16; ++i)
+        Writer.Write(Res.AlphaIndices[i], 2);
+    Writer.Store(pDst);
+}
+
+void CompressBC7Block(const TexelBlock& Block, TEXTURE_COMPRESSION_QUALITY Quality, Uint8* pDst)
+{
+    const bool IsHighQuality = Quality == TEXTURE_COMPRESSION_QUALITY_HIGH;
+
+    float Endpoints[2][4];
+    FitEndpoints<4>(Block, 0xFFFFu, Endpoints);
+
+    BC7Mode6Result Mode6;
+    TryBC7Mode6PBits(Block, Endpoints, IsHighQuality, Mode6);
+    if (!IsHighQuality || Mode6.Error == 0)
+    {
+        WriteBC7Mode6(Mode6, pDst);
+        return;
+    }
+
+    for (Uint32 Iter = 0; Iter < 3; ++Iter)
+    {
+        if (!RefineEndpoints<4>(Block, 0xFFFFu, Mode6.Indices, BC7Weights4f, Endpoints))
+            break;
+
+        const Uint32 PrevError = Mode6.Error;
+        TryBC7Mode6PBits(Block, Endpoints, true, Mode6);
+        if (Mode6.Error >= PrevError)
+            break;
+    }
+
+    BC7Mode5Result Mode5;
+    for (Uint8 Rotation = 0; Rotation < 4 && Mode5.Error > 0; ++Rotation)
+        EncodeBC7Mode5(Block, Rotation, Mode5);
+
+    if (Mode5.Error < Mode6.Error)
+        WriteBC7Mode5(Mode5, pDst);
+    else
+        WriteBC7Mode6(Mode6, pDst);
+}
+
+Uint32 GetBCBlockSize(BC_FORMAT Format)
+{
+    return (Format == BC_FORMAT_BC1 || Format == BC_FORMAT_BC4) ? 8 : 16;
+}
+
+void CompressBlock(BC_FORMAT Format, TEXTURE_COMPRESSION_QUALITY Quality, const TexelBlock& Block, Uint8* pDst)
+{
+    switch (Format)
+    {
+        case BC_FORMAT_BC1:
+            CompressBC1Block(Block, /*AllowTransparency = */ true, Quality, pDst);
+            break;
+
+        case BC_FORMAT_BC3:
+            CompressBC4Channel(Block, 3, Quality, pDst);
+            CompressBC1Block(Block, /*AllowTransparency = */ false, Quality, pDst + 8);
+            break;
+
+        case BC_FORMAT_BC4:
+            CompressBC4Channel(Block, 0, Quality, pDst);
+            break;
+
+        case BC_FORMAT_BC5:
+            CompressBC4Channel(Block, 0, Quality, pDst);
+            CompressBC4Channel(Block, 1, Quality, pDst + 8);
+            break;
+
+        case BC_FORMAT_BC7:
+            CompressBC7Block(Block, Quality, pDst);
+            break;
+
+        default:
+            UNEXPECTED("Unexpected BC format");
+    }
+}
+
+} // namespace
+
+bool IsTextureCompressionSupported(TEXTURE_FORMAT SrcFormat, TEXTURE_FORMAT DstFormat)
+{
+    SourceLayout SrcLayout;
+    BC_FORMAT    BCFormat;
+    return GetSourceLayout(SrcFormat, SrcLayout) && GetBCFormat(DstFormat, BCFormat);
+}
+
+bool CompressTextureSubresource(const CompressTextureSubresourceAttribs& Attribs)
+{
+    DEV_CHECK_ERR(Attribs.pSrcData != nullptr, "Source data must not be null");
+    DEV_CHECK_ERR(Attribs.pDstData != nullptr, "Destination data must not be null");
+
+    SourceLayout SrcLayout;
+    if (!GetSourceLayout(Attribs.SrcFormat, SrcLayout))
+    {
+        LOG_ERROR_MESSAGE("Compression from format ", GetTextureFormatAttribs(Attribs.SrcFormat).Name, " is not supported");
+        return false;
+    }
+    BC_FORMAT BCFormat;
+    if (!GetBCFormat(Attribs.DstFormat, BCFormat))
+    {
+        LOG_ERROR_MESSAGE("Compression to format ", GetTextureFormatAttribs(Attribs.DstFormat).Name, " is not supported");
+        return false;
+    }
+
+    const Uint32 Width  = Attribs.Width;
+    const Uint32 Height = Attribs.Height;
+    const Uint32 Depth  = std::max(Attribs.Depth, 1u);
+    if (Width == 0 || Height == 0)
+        return true;
+
+    const Uint32 BlockSize    = GetBCBlockSize(BCFormat);
+    const Uint32 NumBlocksX   = (Width + 3) / 4;
+    const Uint32 NumBlocksY   = (Height + 3) / 4;
+    const Uint32 DstRowSize   = NumBlocksX * BlockSize;
+    const auto   Quality      = Attribs.Quality;
+    const auto   SrcRowStride = Attribs.SrcRowStride;
+    const auto   DstRowStride = Attribs.DstRowStride;
+
+    DEV_CHECK_ERR(Height <= 1 || SrcRowStride >= Uint64{Width} * SrcLayout.NumComponents, "Source row stride is too small");
+    DEV_CHECK_ERR(NumBlocksY <= 1 || DstRowStride >= DstRowSize, "Destination row stride is too small");
+    DEV_CHECK_ERR(Depth <= 1 || Attribs.SrcDepthStride >= SrcRowStride * Height, "Source depth stride is too small");
+    DEV_CHECK_ERR(Depth <= 1 || Attribs.DstDepthStride >= DstRowStride * NumBlocksY, "Destination depth stride is too small");
+
+    // Every work item compresses one row of blocks
+    ProcessInParallel(Attribs.pThreadPool, NumBlocksY * Depth,
+                      [&](Uint32 Item) {
+                          const Uint32 Slice  = Item / NumBlocksY;
+                          const Uint32 BlockY = Item % NumBlocksY;
+
+                          const auto* pSrcSlice = static_cast<const Uint8*>(Attribs.pSrcData) + StaticCast<size_t>(Attribs.SrcDepthStride * Slice);
+                          auto*       pDstRow   = static_cast<Uint8*>(Attribs.pDstData) + StaticCast<size_t>(Attribs.DstDepthStride * Slice + DstRowStride * BlockY);
+
+                          TexelBlock Block;
+                          Uint8      CompressedBlock[16];
+                          for (Uint32 BlockX = 0; BlockX < NumBlocksX; ++BlockX)
+                          {
+                              LoadBlock(pSrcSlice, SrcRowStride, SrcLayout, Width, Height, BlockX, BlockY, Block);
+                              CompressBlock(BCFormat, Quality, Block, CompressedBlock);
+                              memcpy(pDstRow + size_t{BlockX} * BlockSize, CompressedBlock, BlockSize);
+                          }
+                      });
+
+    return true;
+}
+
+} // namespace Diligent
@@ -0,0 +1,840 @@
+/*
+ *  Copyright 2019-2024 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <array>
+#include <vector>
+#include <cstring>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "GraphicsAccessories.hpp"
+#include "ColorConversion.h"
+#include "ThreadPool.hpp"
+#include "Intrinsics.hpp"
+#include "Cast.hpp"
+
+namespace Diligent
+{
+
+namespace
+{
+
+// Index of the channel that is not present in the texel (e.g. X in BGRX)
+static constexpr Uint8 PaddingChannel = 4;
+
+struct TexelLayout
+{
+    COMPONENT_TYPE ComponentType = COMPONENT_TYPE_UNDEFINED;
+    Uint32         ComponentSize = 0;
+    Uint32         NumComponents = 0;
+
+    // RGBA channel that every component stores
+    std::array<Uint8, 4> Channels = {0, 1, 2, 3};
+
+    Uint32 GetTexelSize() const
+    {
+        return ComponentSize * NumComponents;
+    }
+
+    bool operator==(const TexelLayout& Other) const
+    {
+        return ComponentType == Other.ComponentType &&
+            ComponentSize == Other.ComponentSize &&
+            NumComponents == Other.NumComponents &&
+            std::equal(Channels.begin(), Channels.begin() + NumComponents, Other.Channels.begin());
+    }
+};
+
+bool GetTexelLayout(TEXTURE_FORMAT Format, Uint32 NumComponentsOverride, TexelLayout& Layout)
+{
+    const auto& FmtAttribs = GetTextureFormatAttribs(Format);
+
+    Layout.ComponentType = FmtAttribs.ComponentType;
+    Layout.ComponentSize = FmtAttribs.ComponentSize;
+    Layout.NumComponents = NumComponentsOverride != 0 ? NumComponentsOverride : FmtAttribs.NumComponents;
+    if (Layout.NumComponents == 0 || Layout.NumComponents > 4)
+        return false;
+
+    switch (FmtAttribs.ComponentType)
+    {
+        case COMPONENT_TYPE_FLOAT:
+            if (Layout.ComponentSize != 2 && Layout.ComponentSize != 4)
+                return false;
+            break;
+
+        case COMPONENT_TYPE_UNORM:
+        case COMPONENT_TYPE_SNORM:
+            if (Layout.ComponentSize != 1 && Layout.ComponentSize != 2)
+                return false;
+            break;
+
+        case COMPONENT_TYPE_UNORM_SRGB:
+            if (Layout.ComponentSize != 1)
+                return false;
+            break;
+
+        case COMPONENT_TYPE_UINT:
+        case COMPONENT_TYPE_SINT:
+            if (Layout.ComponentSize != 1 && Layout.ComponentSize != 2 && Layout.ComponentSize != 4)
+                return false;
+            break;
+
+        case COMPONENT_TYPE_DEPTH:
+            // D16_UNORM and D32_FLOAT
+            if (Layout.ComponentSize == 2)
+                Layout.ComponentType = COMPONENT_TYPE_UNORM;
+            else if (Layout.ComponentSize == 4)
+                Layout.ComponentType = COMPONENT_TYPE_FLOAT;
+            else
+                return false;
+            break;
+
+        default:
+            // Typeless, compressed, compound and depth-stencil formats are not supported
+            return false;
+    }
+
+    switch (Format)
+    {
+        case TEX_FORMAT_BGRA8_UNORM:
+        case TEX_FORMAT_BGRA8_UNORM_SRGB:
+            Layout.Channels = {2, 1, 0, 3};
+            break;
+
+        case TEX_FORMAT_BGRX8_UNORM:
+        case TEX_FORMAT_BGRX8_UNORM_SRGB:
+            Layout.Channels = {2, 1, 0, PaddingChannel};
+            break;
+
+        case TEX_FORMAT_A8_UNORM:
+            Layout.Channels = {3, PaddingChannel, PaddingChannel, PaddingChannel};
+            break;
+
+        default:
+            break;
+    }
+
+    return true;
+}
+
+// Returns the bit pattern of the value 1 for the component type
+Uint32 GetComponentOne(COMPONENT_TYPE ComponentType, Uint32 ComponentSize)
+{
+    switch (ComponentType)
+    {
+        case COMPONENT_TYPE_UNORM:
+        case COMPONENT_TYPE_UNORM_SRGB:
+            return ComponentSize == 1 ? 0xFFu : 0xFFFFu;
+
+        case COMPONENT_TYPE_SNORM:
+            return ComponentSize == 1 ? 0x7Fu : 0x7FFFu;
+
+        case COMPONENT_TYPE_FLOAT:
+            return ComponentSize == 2 ? 0x3C00u : 0x3F800000u;
+
+        default:
+            return 1;
+    }
+}
+
+// Conversion of the float to half with round-to-nearest-even.
+// https://gist.github.com/rygorous/2156668
+Uint16 FloatToHalf(float f)
+{
+    constexpr Uint32 F32Infinity = 255u << 23;
+    constexpr Uint32 F16Max      = (127u + 16u) << 23;
+    constexpr Uint32 DenormMagic = ((127u - 15u) + (23u - 10u) + 1u) << 23;
+
+    Uint32 Bits;
+    memcpy(&Bits, &f, sizeof(Bits));
+
+    const Uint32 Sign = Bits & 0x80000000u;
+    Bits ^= Sign;
+
+    Uint16 Half = 0;
+    if (Bits >= F16Max)
+    {
+        // Inf or NaN (all exponent bits set): NaN -> qNaN and Inf -> Inf
+        Half = Bits > F32Infinity ? 0x7E00 : 0x7C00;
+    }
+    else if (Bits < (113u << 23))
+    {
+        // Denormalized half: use the FPU to do the rounding
+        float Val, Magic;
+        memcpy(&Val, &Bits, sizeof(Val));
+        memcpy(&Magic, &DenormMagic, sizeof(Magic));
+        Val += Magic;
+        memcpy(&Bits, &Val, sizeof(Bits));
+        Half = static_cast<Uint16>(Bits - DenormMagic);
+    }
+    else
+    {
+        const Uint32 MantOdd = (Bits >> 13) & 1u;
+        // Update exponent and apply the rounding bias
+        Bits += ((15u - 127u) << 23) + 0xFFFu;
+        Bits += MantOdd;
+        Half = static_cast<Uint16>(Bits >> 13);
+    }
+
+    return static_cast<Uint16>(Half | (Sign >> 16));
+}
+
+float HalfToFloat(Uint16 Half)
+{
+    constexpr Uint32 ShiftedExp = 0x7C00u << 13;
+
+    Uint32 Bits = (Half & 0x7FFFu) << 13;
+
+    const Uint32 Exp = ShiftedExp & Bits;
+    Bits += (127u - 15u) << 23;
+    if (Exp == ShiftedExp)
+    {
+        // Inf/NaN
+        Bits += (128u - 16u) << 23;
+    }
+    else if (Exp == 0)
+    {
+        // Zero/denormal: renormalize
+        constexpr Uint32 MagicBits = 113u << 23;
+
+        float Val, Magic;
+        Bits += 1u << 23;
+        memcpy(&Val, &Bits, sizeof(Val));
+        memcpy(&Magic, &MagicBits, sizeof(Magic));
+        Val -= Magic;
+        memcpy(&Bits, &Val, sizeof(Bits));
+    }
+    Bits |= (Half & 0x8000u) << 16;
+
+    float f;
+    memcpy(&f, &Bits, sizeof(f));
+    return f;
+}
+
+void ConvertFloatToHalf(const float* pSrc, Uint16* pDst, size_t Count)
+{
+    size_t i = 0;
+#if DILIGENT_F16C_ENABLED
+    for (; i + 4 <= Count; i += 4)
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(pDst + i), _mm_cvtps_ph(_mm_loadu_ps(pSrc + i), _MM_FROUND_TO_NEAREST_INT));
+#elif DILIGENT_NEON_ENABLED
+    for (; i + 4 <= Count; i += 4)
+        vst1_u16(pDst + i, vreinterpret_u16_f16(vcvt_f16_f32(vld1q_f32(pSrc + i))));
+#endif
+    for (; i < Count; ++i)
+        pDst[i] = FloatToHalf(pSrc[i]);
+}
+
+void ConvertHalfToFloat(const Uint16* pSrc, float* pDst, size_t Count)
+{
+    size_t i = 0;
+#if DILIGENT_F16C_ENABLED
+    for (; i + 4 <= Count; i += 4)
+        _mm_storeu_ps(pDst + i, _mm_cvtph_ps(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(pSrc + i))));
+#elif DILIGENT_NEON_ENABLED
+    for (; i + 4 <= Count; i += 4)
+        vst1q_f32(pDst + i, vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(pSrc + i))));
+#endif
+    for (; i < Count; ++i)
+        pDst[i] = HalfToFloat(pSrc[i]);
+}
+
+
+// Converts one row of texels
+class RowConverter
+{
+public:
+    RowConverter(const TexelLayout& SrcLayout, const TexelLayout& DstLayout, Uint32 Width) :
+        m_SrcLayout{SrcLayout},
+        m_DstLayout{DstLayout},
+        m_Width{Width}
+    {
+        // For every destination component, find the source component that stores the same channel
+        for (Uint32 dc = 0; dc < m_DstLayout.NumComponents; ++dc)
+        {
+            const Uint8 Channel = m_DstLayout.Channels[dc];
+            for (Uint32 sc = 0; sc < m_SrcLayout.NumComponents && Channel != PaddingChannel; ++sc)
+            {
+                if (m_SrcLayout.Channels[sc] == Channel)
+                    m_SrcComponent[dc] = static_cast<int>(sc);
+            }
+            // Missing color channels are set to 0, and missing alpha is set to 1
+            m_FillOne[dc] = Channel == 3 || Channel == PaddingChannel;
+        }
+
+        if (m_SrcLayout == m_DstLayout)
+        {
+            m_Mode = MODE_COPY;
+        }
+        else if (m_SrcLayout.ComponentType == m_DstLayout.ComponentType && m_SrcLayout.ComponentSize == m_DstLayout.ComponentSize)
+        {
+            m_Mode = MODE_REORDER;
+        }
+        else if (m_SrcLayout.ComponentSize == 1 && m_DstLayout.ComponentSize == 1 &&
+                 (m_SrcLayout.ComponentType == COMPONENT_TYPE_UNORM || m_SrcLayout.ComponentType == COMPONENT_TYPE_UNORM_SRGB) &&
+                 (m_DstLayout.ComponentType == COMPONENT_TYPE_UNORM || m_DstLayout.ComponentType == COMPONENT_TYPE_UNORM_SRGB))
+        {
+            // UNORM <-> UNORM_SRGB
+            m_Mode = MODE_BYTE_LUT;
+            InitByteLUTs();
+        }
+        else if (m_SrcLayout.ComponentType == COMPONENT_TYPE_FLOAT && m_DstLayout.ComponentType == COMPONENT_TYPE_FLOAT &&
+                 m_SrcLayout.NumComponents == m_DstLayout.NumComponents &&
+                 std::equal(m_SrcLayout.Channels.begin(), m_SrcLayout.Channels.begin() + m_SrcLayout.NumComponents, m_DstLayout.Channels.begin()))
+        {
+            m_Mode = MODE_FLOAT_HALF;
+        }
+        else if (IsIntegerType(m_SrcLayout.ComponentType) && IsIntegerType(m_DstLayout.ComponentType))
+        {
+            // 32-bit integers are not exactly representable as float, so they are converted directly
+            m_Mode = MODE_INTEGER;
+        }
+        else
+        {
+            m_Mode = MODE_GENERIC;
+            m_Texels.resize(size_t{m_Width} * 4);
+        }
+    }
+
+    void operator()(const Uint8* pSrc, Uint8* pDst)
+    {
+        switch (m_Mode)
+        {
+            case MODE_COPY:
+                memcpy(pDst, pSrc, size_t{m_Width} * m_SrcLayout.GetTexelSize());
+                break;
+
+            case MODE_REORDER:
+                switch (m_SrcLayout.ComponentSize)
+                {
+                    case 1: ReorderComponents<Uint8>(pSrc, pDst); break;
+                    case 2: ReorderComponents<Uint16>(pSrc, pDst); break;
+                    case 4: ReorderComponents<Uint32>(pSrc, pDst); break;
+                    default: UNEXPECTED("Unexpected component size");
+                }
+                break;
+
+            case MODE_BYTE_LUT:
+                ConvertBytes(pSrc, pDst);
+                break;
+
+            case MODE_FLOAT_HALF:
+            {
+                const size_t Count = size_t{m_Width} * m_SrcLayout.NumComponents;
+                if (m_SrcLayout.ComponentSize == 4)
+                    ConvertFloatToHalf(reinterpret_cast<const float*>(pSrc), reinterpret_cast<Uint16*>(pDst), Count);
+                else
+                    ConvertHalfToFloat(reinterpret_cast<const Uint16*>(pSrc), reinterpret_cast<float*>(pDst), Count);
+                break;
+            }
+
+            case MODE_INTEGER:
+                ConvertIntegers(pSrc, pDst);
+                break;
+
+            case MODE_GENERIC:
+                DecodeRow(pSrc);
+                EncodeRow(pDst);
+                break;
+        }
+    }
+
+private:
+    template <typename ComponentType>
+    void ReorderComponents(const Uint8* pSrcBytes, Uint8* pDstBytes) const
+    {
+        const auto* pSrc = reinterpret_cast<const ComponentType*>(pSrcBytes);
+        auto*       pDst = reinterpret_cast<ComponentType*>(pDstBytes);
+
+        const Uint32 SrcNumComponents = m_SrcLayout.NumComponents;
+        const Uint32 DstNumComponents = m_DstLayout.NumComponents;
+
+        Uint32 x = 0;
+        if (std::is_same<ComponentType, Uint8>::value)
+            x = ReorderBytesSIMD(pSrcBytes, pDstBytes);
+
+        const auto One = static_cast<ComponentType>(GetComponentOne(m_DstLayout.ComponentType, m_DstLayout.ComponentSize));
+        for (; x < m_Width; ++x)
+        {
+            for (Uint32 dc = 0; dc < DstNumComponents; ++dc)
+            {
+                const int sc = m_SrcComponent[dc];
+
+                pDst[x * DstNumComponents + dc] = sc >= 0 ?
+                    pSrc[x * SrcNumComponents + sc] :
+                    (m_FillOne[dc] ? One : ComponentType{0});
+            }
+        }
+    }
+
+    // Handles the common 8-bit cases: RGBA <-> BGRA and RGB -> RGBA/BGRA.
+    // Returns the number of texels processed.
+    Uint32 ReorderBytesSIMD(const Uint8* pSrc, Uint8* pDst) const
+    {
+        const Uint32 SrcNumComponents = m_SrcLayout.NumComponents;
+        const Uint32 DstNumComponents = m_DstLayout.NumComponents;
+        if (DstNumComponents != 4 || (SrcNumComponents != 3 && SrcNumComponents != 4))
+            return 0;
+
+        const bool SwapRB   = m_SrcComponent[0] == 2 && m_SrcComponent[1] == 1 && m_SrcComponent[2] == 0;
+        const bool Identity = m_SrcComponent[0] == 0 && m_SrcComponent[1] == 1 && m_SrcComponent[2] == 2;
+        if (!SwapRB && !Identity)
+            return 0;
+
+        Uint32 x = 0;
+        if (SrcNumComponents == 4)
+        {
+            if (!SwapRB || m_SrcComponent[3] != 3)
+                return 0;
+
+#if DILIGENT_SSE2_ENABLED
+            const __m128i MaskAG = _mm_set1_epi32(static_cast<int>(0xFF00FF00u));
+            const __m128i MaskR  = _mm_set1_epi32(0x000000FF);
+            for (; x + 4 <= m_Width; x += 4)
+            {
+                const __m128i Texels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSrc + x * 4));
+                // Swap bytes 0 and 2 of every 32-bit texel
+                const __m128i Res = _mm_or_si128(_mm_and_si128(Texels, MaskAG),
+                                                 _mm_or_si128(_mm_and_si128(_mm_srli_epi32(Texels, 16), MaskR),
+                                                              _mm_slli_epi32(_mm_and_si128(Texels, MaskR), 16)));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(pDst + x * 4), Res);
+            }
+#elif DILIGENT_NEON_ENABLED
+            for (; x + 16 <= m_Width; x += 16)
+            {
+                uint8x16x4_t Texels = vld4q_u8(pSrc + x * 4);
+                std::swap(Texels.val[0], Texels.val[2]);
+                vst4q_u8(pDst + x * 4, Texels);
+            }
+#endif
+        }
+        else
+        {
+            // RGB -> RGBA, alpha is set to 1
+            if (!m_FillOne[3])
+                return 0;
+
+#if DILIGENT_NEON_ENABLED
+            for (; x + 16 <= m_Width; x += 16)
+            {
+                const uint8x16x3_t Src = vld3q_u8(pSrc + x * 3);
+                uint8x16x4_t       Dst;
+                Dst.val[0] = Src.val[SwapRB ? 2 : 0];
+                Dst.val[1] = Src.val[1];
+                Dst.val[2] = Src.val[SwapRB ? 0 : 2];
+                Dst.val[3] = vdupq_n_u8(0xFF);
+                vst4q_u8(pDst + x * 4, Dst);
+            }
+#else
+            // Process 4 texels (three 32-bit source words) at a time using integer operations
+            for (; x + 4 <= m_Width; x += 4)
+            {
+                Uint32 Src[3];
+                memcpy(Src, pSrc + x * 3, sizeof(Src));
+
+                Uint32 Dst[4] = {
+                    Src[0],
+                    (Src[0] >> 24) | (Src[1] << 8),
+                    (Src[1] >> 16) | (Src[2] << 16),
+                    Src[2] >> 8,
+                };
+                for (auto& Texel : Dst)
+                {
+                    // Little-endian: R is in the lowest byte
+                    if (SwapRB)
+                        Texel = (Texel & 0x0000FF00u) | ((Texel >> 16) & 0xFFu) | ((Texel & 0xFFu) << 16);
+                    Texel |= 0xFF000000u;
+                }
+                memcpy(pDst + x * 4, Dst, sizeof(Dst));
+            }
+#endif
+        }
+
+        return x;
+    }
+
+    void InitByteLUTs()
+    {
+        // Linear-to-sRGB and sRGB-to-linear conversion tables for 8-bit values
+        static const auto ToSRGB = []() {
+            std::array<Uint8, 256> Table;
+            for (Uint32 i = 0; i < Table.size(); ++i)
+                Table[i] = static_cast<Uint8>(LinearToGamma(static_cast<Uint8>(i)) * 255.f + 0.5f);
+            return Table;
+        }();
+        static const auto ToLinear = []() {
+            std::array<Uint8, 256> Table;
+            for (Uint32 i = 0; i < Table.size(); ++i)
+                Table[i] = static_cast<Uint8>(GammaToLinear(static_cast<Uint8>(i)) * 255.f + 0.5f);
+            return Table;
+        }();
+
+        const bool SrcIsSRGB = m_SrcLayout.ComponentType == COMPONENT_TYPE_UNORM_SRGB;
+        const bool DstIsSRGB = m_DstLayout.ComponentType == COMPONENT_TYPE_UNORM_SRGB;
+        for (Uint32 dc = 0; dc < m_DstLayout.NumComponents; ++dc)
+        {
+            // Alpha is never gamma-encoded
+            const bool IsColor = m_DstLayout.Channels[dc] < 3;
+            if (IsColor && SrcIsSRGB && !DstIsSRGB)
+                m_ByteLUTs[dc] = ToLinear.data();
+            else if (IsColor && !SrcIsSRGB && DstIsSRGB)
+                m_ByteLUTs[dc] = ToSRGB.data();
+        }
+    }
+
+    void ConvertBytes(const Uint8* pSrc, Uint8* pDst) const
+    {
+        const Uint32 SrcNumComponents = m_SrcLayout.NumComponents;
+        const Uint32 DstNumComponents = m_DstLayout.NumComponents;
+        for (Uint32 x = 0; x < m_Width; ++x)
+        {
+            for (Uint32 dc = 0; dc < DstNumComponents; ++dc)
+            {
+                const int sc = m_SrcComponent[dc];
+
+                Uint8 Val = m_FillOne[dc] ? 0xFF : 0;
+                if (sc >= 0)
+                {
+                    Val = pSrc[x * SrcNumComponents + sc];
+                    if (m_ByteLUTs[dc] != nullptr)
+                        Val = m_ByteLUTs[dc][Val];
+                }
+                pDst[x * DstNumComponents + dc] = Val;
+            }
+        }
+    }
+
+    static bool IsIntegerType(COMPONENT_TYPE Type)
+    {
+        return Type == COMPONENT_TYPE_UINT || Type == COMPONENT_TYPE_SINT;
+    }
+
+    template <typename ComponentType>
+    static Int64 LoadInt64(const Uint8* pSrc)
+    {
+        ComponentType Val;
+        memcpy(&Val, pSrc, sizeof(Val));
+        return static_cast<Int64>(Val);
+    }
+
+    static Int64 LoadIntegerComponent(const Uint8* pSrc, COMPONENT_TYPE Type, Uint32 Size)
+    {
+        if (Type == COMPONENT_TYPE_UINT)
+            return Size == 1 ? LoadInt64<Uint8>(pSrc) : (Size == 2 ? LoadInt64<Uint16>(pSrc) : LoadInt64<Uint32>(pSrc));
+        else
+            return Size == 1 ? LoadInt64<Int8>(pSrc) : (Size == 2 ? LoadInt64<Int16>(pSrc) : LoadInt64<Int32>(pSrc));
+    }
+
+    template <typename ComponentType>
+    static void StoreInt64(Int64 Val, Uint8* pDst)
+    {
+        constexpr Int64 MinVal = static_cast<Int64>(std::numeric_limits<ComponentType>::min());
+        constexpr Int64 MaxVal = static_cast<Int64>(std::numeric_limits<ComponentType>::max());
+
+        const auto Res = static_cast<ComponentType>(clamp(Val, MinVal, MaxVal));
+        memcpy(pDst, &Res, sizeof(Res));
+    }
+
+    static void StoreIntegerComponent(Int64 Val, Uint8* pDst, COMPONENT_TYPE Type, Uint32 Size)
+    {
+        if (Type == COMPONENT_TYPE_UINT)
+            Size == 1 ? StoreInt64<Uint8>(Val, pDst) : (Size == 2 ? StoreInt64<Uint16>(Val, pDst) : StoreInt64<Uint32>(Val, pDst));
+        else
+            Size == 1 ? StoreInt64<Int8>(Val, pDst) : (Size == 2 ? StoreInt64<Int16>(Val, pDst) : StoreInt64<Int32>(Val, pDst));
+    }
+
+    // Converts between integer formats of different types, clamping the values to the destination range
+    void ConvertIntegers(const Uint8* pSrc, Uint8* pDst) const
+    {
+        const auto   SrcType          = m_SrcLayout.ComponentType;
+        const Uint32 SrcSize          = m_SrcLayout.ComponentSize;
+        const Uint32 SrcNumComponents = m_SrcLayout.NumComponents;
+        const auto   DstType          = m_DstLayout.ComponentType;
+        const Uint32 DstSize          = m_DstLayout.ComponentSize;
+        const Uint32 DstNumComponents = m_DstLayout.NumComponents;
+        for (Uint32 x = 0; x < m_Width; ++x)
+        {
+            for (Uint32 dc = 0; dc < DstNumComponents; ++dc)
+            {
+                const int sc = m_SrcComponent[dc];
+
+                const Int64 Val = sc >= 0 ?
+                    LoadIntegerComponent(pSrc + (size_t{x} * SrcNumComponents + sc) * SrcSize, SrcType, SrcSize) :
+                    (m_FillOne[dc] ? 1 : 0);
+                StoreIntegerComponent(Val, pDst + (size_t{x} * DstNumComponents + dc) * DstSize, DstType, DstSize);
+            }
+        }
+    }
+
+    template <typename ComponentType>
+    static float LoadNormalized(const Uint8* pSrc)
+    {
+        ComponentType Val;
+        memcpy(&Val, pSrc, sizeof(Val));
+        return std::max(static_cast<float>(Val) / static_cast<float>(std::numeric_limits<ComponentType>::max()), -1.f);
+    }
+
+    template <typename ComponentType>
+    static float LoadInteger(const Uint8* pSrc)
+    {
+        ComponentType Val;
+        memcpy(&Val, pSrc, sizeof(Val));
+        return static_cast<float>(Val);
+    }
+
+    static float LoadComponent(const Uint8* pSrc, COMPONENT_TYPE Type, Uint32 Size)
+    {
+        switch (Type)
+        {
+            case COMPONENT_TYPE_FLOAT:
+                if (Size == 4)
+                {
+                    float Val;
+                    memcpy(&Val, pSrc, sizeof(Val));
+                    return Val;
+                }
+                else
+                {
+                    Uint16 Val;
+                    memcpy(&Val, pSrc, sizeof(Val));
+                    return HalfToFloat(Val);
+                }
+
+            case COMPONENT_TYPE_UNORM:
+            case COMPONENT_TYPE_UNORM_SRGB:
+                return Size == 1 ? LoadNormalized<Uint8>(pSrc) : LoadNormalized<Uint16>(pSrc);
+
+            case COMPONENT_TYPE_SNORM:
+                return Size == 1 ? LoadNormalized<Int8>(pSrc) : LoadNormalized<Int16>(pSrc);
+
+            case COMPONENT_TYPE_UINT:
+                return Size == 1 ? LoadInteger<Uint8>(pSrc) : (Size == 2 ? LoadInteger<Uint16>(pSrc) : LoadInteger<Uint32>(pSrc));
+
+            case COMPONENT_TYPE_SINT:
+                return Size == 1 ? LoadInteger<Int8>(pSrc) : (Size == 2 ? LoadInteger<Int16>(pSrc) : LoadInteger<Int32>(pSrc));
+
+            default:
+                UNEXPECTED("Unexpected component type");
+                return 0;
+        }
+    }
+
+    template <typename ComponentType>
+    static void StoreNormalized(float Val, Uint8* pDst)
+    {
+        constexpr float MaxVal = static_cast<float>(std::numeric_limits<ComponentType>::max());
+        constexpr float MinVal = std::is_signed<ComponentType>::value ? -1.f : 0.f;
+
+        const ComponentType Res = static_cast<ComponentType>(std::floor(clamp(Val, MinVal, 1.f) * MaxVal + 0.5f));
+        memcpy(pDst, &Res, sizeof(Res));
+    }
+
+    template <typename ComponentType>
+    static void StoreInteger(float Val, Uint8* pDst)
+    {
+        // Use double as 32-bit integer limits are not representable as float
+        constexpr double MinVal = static_cast<double>(std::numeric_limits<ComponentType>::min());
+        constexpr double MaxVal = static_cast<double>(std::numeric_limits<ComponentType>::max());
+
+        const auto Res = static_cast<ComponentType>(clamp(std::floor(static_cast<double>(Val) + 0.5), MinVal, MaxVal));
+        memcpy(pDst, &Res, sizeof(Res));
+    }
+
+    static void StoreComponent(float Val, Uint8* pDst, COMPONENT_TYPE Type, Uint32 Size)
+    {
+        switch (Type)
+        {
+            case COMPONENT_TYPE_FLOAT:
+                if (Size == 4)
+                {
+                    memcpy(pDst, &Val, sizeof(Val));
+                }
+                else
+                {
+                    const Uint16 Half = FloatToHalf(Val);
+                    memcpy(pDst, &Half, sizeof(Half));
+                }
+                break;
+
+            case COMPONENT_TYPE_UNORM:
+            case COMPONENT_TYPE_UNORM_SRGB:
+                Size == 1 ? StoreNormalized<Uint8>(Val, pDst) : StoreNormalized<Uint16>(Val, pDst);
+                break;
+
+            case COMPONENT_TYPE_SNORM:
+                Size == 1 ? StoreNormalized<Int8>(Val, pDst) : StoreNormalized<Int16>(Val, pDst);
+                break;
+
+            case COMPONENT_TYPE_UINT:
+                Size == 1 ? StoreInteger<Uint8>(Val, pDst) : (Size == 2 ? StoreInteger<Uint16>(Val, pDst) : StoreInteger<Uint32>(Val, pDst));
+                break;
+
+            case COMPONENT_TYPE_SINT:
+                Size == 1 ? StoreInteger<Int8>(Val, pDst) : (Size == 2 ? StoreInteger<Int16>(Val, pDst) : StoreInteger<Int32>(Val, pDst));
+                break;
+
+            default:
+                UNEXPECTED("Unexpected component type");
+        }
+    }
+
+    // Decodes the source row into RGBA float texels
+    void DecodeRow(const Uint8* pSrc)
+    {
+        const auto   Type          = m_SrcLayout.ComponentType;
+        const Uint32 Size          = m_SrcLayout.ComponentSize;
+        const Uint32 NumComponents = m_SrcLayout.NumComponents;
+        const bool   IsSRGB        = Type == COMPONENT_TYPE_UNORM_SRGB;
+        for (Uint32 x = 0; x < m_Width; ++x)
+        {
+            float* pTexel = &m_Texels[size_t{x} * 4];
+            pTexel[0] = pTexel[1] = pTexel[2] = 0;
+            pTexel[3]                         = 1;
+            for (Uint32 c = 0; c < NumComponents; ++c)
+            {
+                const Uint8 Channel = m_SrcLayout.Channels[c];
+                if (Channel == PaddingChannel)
+                    continue;
+
+                const Uint8* pComp = pSrc + (size_t{x} * NumComponents + c) * Size;
+                pTexel[Channel]    = IsSRGB && Channel < 3 ?
+                    GammaToLinear(*pComp) :
+                    LoadComponent(pComp, Type, Size);
+            }
+        }
+    }
+
+    // Encodes RGBA float texels into the destination row
+    void EncodeRow(Uint8* pDst) const
+    {
+        const auto   Type          = m_DstLayout.ComponentType;
+        const Uint32 Size          = m_DstLayout.ComponentSize;
+        const Uint32 NumComponents = m_DstLayout.NumComponents;
+        const bool   IsSRGB        = Type == COMPONENT_TYPE_UNORM_SRGB;
+        for (Uint32 x = 0; x < m_Width; ++x)
+        {
+            const float* pTexel = &m_Texels[size_t{x} * 4];
+            for (Uint32 c = 0; c < NumComponents; ++c)
+            {
+                const Uint8 Channel = m_DstLayout.Channels[c];
+
+                float Val = Channel != PaddingChannel ? pTexel[Channel] : 1.f;
+                if (IsSRGB && Channel < 3)
+                    Val = LinearToGamma(clamp(Val, 0.f, 1.f));
+
+                StoreComponent(Val, pDst + (size_t{x} * NumComponents + c) * Size, Type, Size);
+            }
+        }
+    }
+
+private:
+    enum MODE : Uint8
+    {
+        MODE_COPY,
+        MODE_REORDER,
+        MODE_BYTE_LUT,
+        MODE_FLOAT_HALF,
+        MODE_INTEGER,
+        MODE_GENERIC
+    };
+
+    const TexelLayout& m_SrcLayout;
+    const TexelLayout& m_DstLayout;
+    const Uint32       m_Width;
+
+    MODE m_Mode = MODE_GENERIC;
+
+    // Source component index for every destination component, or -1 if the channel is missing
+    std::array<int, 4> m_SrcComponent = {-1, -1, -1, -1};
+    // Whether the missing destination component is filled with 1 rather than 0
+    std::array<bool, 4> m_FillOne = {};
+    // Byte conversion tables for MODE_BYTE_LUT
+    std::array<const Uint8*, 4> m_ByteLUTs = {};
+    // RGBA float texels for MODE_GENERIC
+    std::vector<float> m_Texels;
+};
+
+} // namespace
+
+bool IsTextureFormatConversionSupported(TEXTURE_FORMAT SrcFormat, TEXTURE_FORMAT DstFormat)
+{
+    TexelLayout SrcLayout, DstLayout;
+    return GetTexelLayout(SrcFormat, 0, SrcLayout) && GetTexelLayout(DstFormat, 0, DstLayout);
+}
+
+bool ConvertTextureSubresource(const ConvertTextureSubresourceAttribs& Attribs)
+{
+    DEV_CHECK_ERR(Attribs.pSrcData != nullptr, "Source data must not be null");
+    DEV_CHECK_ERR(Attribs.pDstData != nullptr, "Destination data must not be null");
+
+    TexelLayout SrcLayout, DstLayout;
+    if (!GetTexelLayout(Attribs.SrcFormat, Attribs.SrcNumComponents, SrcLayout))
+    {
+        LOG_ERROR_MESSAGE("Conversion from format ", GetTextureFormatAttribs(Attribs.SrcFormat).Name, " is not supported");
+        return false;
+    }
+    if (!GetTexelLayout(Attribs.DstFormat, 0, DstLayout))
+    {
+        LOG_ERROR_MESSAGE("Conversion to format ", GetTextureFormatAttribs(Attribs.DstFormat).Name, " is not supported");
+        return false;
+    }
+
+    const Uint32 Width  = Attribs.Width;
+    const Uint32 Height = Attribs.Height;
+    const Uint32 Depth  = std::max(Attribs.Depth, 1u);
+
+    DEV_CHECK_ERR(Height <= 1 || Attribs.SrcRowStride >= Uint64{Width} * SrcLayout.GetTexelSize(), "Source row stride is too small");
+    DEV_CHECK_ERR(Height <= 1 || Attribs.DstRowStride >= Uint64{Width} * DstLayout.GetTexelSize(), "Destination row stride is too small");
+    DEV_CHECK_ERR(Depth <= 1 || Attribs.SrcDepthStride >= Attribs.SrcRowStride * Height, "Source depth stride is too small");
+    DEV_CHECK_ERR(Depth <= 1 || Attribs.DstDepthStride >= Attribs.DstRowStride * Height, "Destination depth stride is too small");
+
+    // Rows are processed in blocks, every block uses its own converter
+    constexpr Uint32 RowsPerBlock = 64;
+
+    const Uint32 NumBlocksPerSlice = (Height + RowsPerBlock - 1) / RowsPerBlock;
+    ProcessInParallel(Attribs.pThreadPool, NumBlocksPerSlice * Depth,
+                      [&](Uint32 Block) {
+                          const Uint32 Slice    = Block / NumBlocksPerSlice;
+                          const Uint32 StartRow = (Block % NumBlocksPerSlice) * RowsPerBlock;
+                          const Uint32 EndRow   = std::min(StartRow + RowsPerBlock, Height);
+
+                          const auto* pSrcSlice = static_cast<const Uint8*>(Attribs.pSrcData) + StaticCast<size_t>(Attribs.SrcDepthStride * Slice);
+                          auto*       pDstSlice = static_cast<Uint8*>(Attribs.pDstData) + StaticCast<size_t>(Attribs.DstDepthStride * Slice);
+
+                          RowConverter ConvertRow{SrcLayout, DstLayout, Width};
+                          for (Uint32 Row = StartRow; Row < EndRow; ++Row)
+                          {
+                              ConvertRow(pSrcSlice + StaticCast<size_t>(Attribs.SrcRowStride * Row),
+                                         pDstSlice + StaticCast<size_t>(Attribs.DstRowStride * Row));
+                          }
+                      });
+
+    return true;
+}
+
+} // namespace Diligent
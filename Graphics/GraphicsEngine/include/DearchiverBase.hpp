@@ -73,6 +73,11 @@ public:
     virtual void DILIGENT_CALL_TYPE UnpackPipelineState(const PipelineStateUnpackInfo& DeArchiveInfo,
                                                         IPipelineState**               ppPSO) override final;
 
+    /// Implementation of IDearchiver::UnpackPipelineStates().
+    virtual void DILIGENT_CALL_TYPE UnpackPipelineStates(const PipelineStateUnpackInfo* pUnpackInfos,
+                                                         Uint32                         NumPSOs,
+                                                         IPipelineState**               ppPSOs) override final;
+
     /// Implementation of IDearchiver::UnpackResourceSignature().
     virtual void DILIGENT_CALL_TYPE UnpackResourceSignature(const ResourceSignatureUnpackInfo& DeArchiveInfo,
                                                             IPipelineResourceSignature**       ppSignature) override final;
@@ -207,17 +212,51 @@ private:
                           PSOData<CreateInfoType>& PSO,
                           IRenderDevice*           pDevice);
 
+    static bool ReadPSOShaderIndices(const DeviceObjectArchive&             Archive,
+                                     ResourceType                           ResType,
+                                     const char*                            PSOName,
+                                     DeviceType                             DevType,
+                                     DeviceObjectArchive::ShaderIndexArray& ShaderIndices,
+                                     DynamicLinearAllocator&                Allocator);
+
+    // Returns the shader from the archive shader cache, or null if the shader has not been unpacked yet.
+    static RefCntAutoPtr<IShader> GetCachedShader(ArchiveData& Archive, DeviceType DevType, Uint32 Idx);
+
+    // Unpacks the shader with the given index and adds it to the archive shader cache.
+    RefCntAutoPtr<IShader> UnpackArchivedShader(ArchiveData&   Archive,
+                                                DeviceType     DevType,
+                                                Uint32         Idx,
+                                                IRenderDevice* pDevice,
+                                                bool           SkipReflection);
+
+    // Loads the PSO data and unpacks its render pass and resource signatures.
+    template <typename CreateInfoType>
+    bool LoadPSOData(const PipelineStateUnpackInfo& UnpackInfo,
+                     PSOData<CreateInfoType>&       PSO,
+                     ArchiveData*&                  pArchiveData);
+
+    // Creates the pipeline state once all PSO objects have been unpacked.
+    template <typename CreateInfoType>
+    void CreatePipelineState(PSOData<CreateInfoType>&       PSO,
+                             const PipelineStateUnpackInfo& UnpackInfo,
+                             IPipelineState**               ppPSO);
+
     template <typename CreateInfoType>
     void UnpackPipelineStateImpl(const PipelineStateUnpackInfo& UnpackInfo, IPipelineState** ppPSO);
 
+    struct PSOBatch;
+
+    template <typename CreateInfoType>
+    void AddPipelineStateToBatch(PSOBatch& Batch, Uint32 Idx);
+
+    template <typename CreateInfoType>
+    void CreateBatchPipelineStates(PSOBatch& Batch);
+
     ArchiveData* FindArchive(ResourceType ResType, const char* ResName);
 
 private:
-    // Resource type and name -> archive index that contains this resource.
-    // Names must be unique for each resource type.
-    using NamedResourceKey = DeviceObjectArchive::NamedResourceKey;
-    std::unordered_map<NamedResourceKey, size_t, NamedResourceKey::Hasher> m_ResNameToArchiveIdx;
-
+    // Loaded archives. Names must be unique for each resource type; if several archives
+    // contain the resource with the same name, the archive that was loaded first is used.
     std::vector<ArchiveData> m_Archives;
 };
 
@@ -238,16 +277,11 @@ RefCntAutoPtr<IPipelineResourceSignature> DearchiverBase::UnpackResourceSignatur
     }
 
     // Find the archive that contains this signature
-    auto archive_idx_it = m_ResNameToArchiveIdx.find(NamedResourceKey{PRSData::ArchiveResType, DeArchiveInfo.Name});
-    if (archive_idx_it == m_ResNameToArchiveIdx.end())
+    const auto* pArchiveData = FindArchive(PRSData::ArchiveResType, DeArchiveInfo.Name);
+    if (pArchiveData == nullptr)
         return {};
 
-    const auto& pObjArchive = m_Archives[archive_idx_it->second].pObjArchive;
-    if (!pObjArchive)
-    {
-        UNEXPECTED("Null object archives should never be added to the list. This is a bug.");
-        return {};
-    }
+    const auto& pObjArchive = pArchiveData->pObjArchive;
 
     PRSData PRS{GetRawAllocator()};
     if (!pObjArchive->LoadResourceCommonData(PRSData::ArchiveResType, DeArchiveInfo.Name, PRS))
@@ -35,6 +35,7 @@
 
 #include "GraphicsTypes.h"
 #include "FileStream.h"
+#include "Dearchiver.h"
 
 #include "HashUtils.hpp"
 #include "RefCntAutoPtr.hpp"
@@ -44,11 +45,19 @@
 
 // Device object archive structure:
 //
-// | Header |  Resource Data  |  Shader Data  |
+// | Header | Resource Names | Resource Data | Shader Data | Resource Index | Shader Index | Footer |
+//
+//     | Resource Index | = | Entry1 | Entry2 | ... | EntryN |
+//
+//         | EntryI | = | Type | Name Length | Name Offset | Data Offset | Data Size |
+//
+//     | Shader Index | = | OpenGL shaders | D3D11 shaders | ... | Metal-iOS shaders |
+//
+//         | Device shaders | = | {Offset, Size, Uncompressed Size} | ... | {Offset, Size, Uncompressed Size} |
 //
 //     |  Resource Data  | = | Res1 | Res2 | ... | ResN |
 //
-//         | ResI | = | Type | Name | Common Data |  OpenGL data | D3D11 data | ...  | Metal-iOS data |
+//         | ResI | = | Common Data |  OpenGL data | D3D11 data | ...  | Metal-iOS data |
 //
 //     |  Shader Data  | =  |  OpenGL shaders | D3D11 shaders | ...  | Metal-iOS shaders |
 //
@@ -56,24 +65,43 @@
 // - Magic number
 // - Archive version
 // - API version
-
-// Resource data contains an array of resources. Each resource contains:
-// - Type (Signature, Graphics Pipeline, Render Pass, etc.)
-// - Name
+//
+// The footer is stored at the end of the archive and contains the offset of the index
+// and the size of the dead data (see below).
+//
+// The resource index is an array of entries sorted by resource type and name.
+// Each entry contains the offsets of the resource name and data from the beginning
+// of the archive. This allows finding a resource with a binary search and decoding
+// only the resources that are actually used directly from the archive memory
+// (e.g. a memory-mapped file) without deserializing the entire archive.
+//
+// Resource data contains:
 // - Common data (e.g. a resource description)
 // - Device-specific data (e.g. shader indices)
 //
-// Shader data contains an array of shaders for each device type
+// The shader index contains the offsets and sizes of serialized shaders for each device type.
+// Every shader may be compressed individually, so that it can be decoded without touching
+// other shaders. The uncompressed size is zero for shaders that are stored uncompressed.
+//
+//
+// An archive may be updated without rewriting it. The update is appended to the end of
+// the archive data and contains new and changed resources and shaders followed by the
+// new index and footer:
+//
+// | Original archive | Update Names | Update Resource Data | Update Shader Data | Resource Index | Shader Index | Footer |
+//
+// The new index references unchanged entries in the original data, while superseded
+// entries as well as the old index become dead. Dead data is reclaimed by Compact().
 //
 //
 // For pipelines, device-specific data is the array of shader indices in the
 // archive's shader array, e.g.:
 //
-// | PsoX | = |   Type   |   Name   |   Common Data   |   OpenGL data   |    D3D11 data   | ...
-//              Graphics   "My PSO"    <Description>        {0, 1}             {1, 2}
-//                                                                  ____________|  |
-//                                                                 |               |
-//                                                                 V               V
+// | PsoX | = |   Common Data   |   OpenGL data   |    D3D11 data   | ...
+//               <Description>        {0, 1}             {1, 2}
+//                                        ____________|  |
+//                                       |               |
+//                                       V               V
 // | GL Shader 0 | GL Shader 1 |  ... | D3D11 Shader 0 | D3D11 Shader 1 | D3D11 Shader 2 | ...
 
 namespace Diligent
@@ -128,7 +156,8 @@ public:
     };
 
     static constexpr Uint32 HeaderMagicNumber = 0xDE00000A;
-    static constexpr Uint32 ArchiveVersion    = 8;
+    static constexpr Uint32 ArchiveVersion    = 11;
+    static constexpr Uint32 FooterMagicNumber = 0xDE0000FF;
 
     struct ArchiveHeader
     {
@@ -141,6 +170,33 @@ public:
         const char* GitHash        = nullptr;
     };
 
+    // Archive footer that is stored at the end of the archive data.
+    struct ArchiveFooter
+    {
+        Uint64 IndexOffset  = 0; // Offset of the resource index from the beginning of the archive
+        Uint64 DeadDataSize = 0; // Size of the data that is not referenced by the index
+        Uint32 MagicNumber  = FooterMagicNumber;
+        Uint32 Padding      = 0;
+    };
+
+    // Resource index entry that identifies the location of the resource name and data in the archive.
+    struct ResourceIndexEntry
+    {
+        ResourceType Type       = ResourceType::Undefined;
+        Uint32       NameLength = 0; // Name length, not including the null terminator
+        Uint64       NameOffset = 0; // Offset of the null-terminated name from the beginning of the archive
+        Uint64       DataOffset = 0; // Offset of the resource data from the beginning of the archive
+        Uint64       DataSize   = 0;
+    };
+
+    // Shader index entry that identifies the location of the serialized shader in the archive.
+    struct ShaderIndexEntry
+    {
+        Uint64 Offset           = 0; // Offset from the beginning of the archive
+        Uint64 Size             = 0; // Size of the data stored in the archive
+        Uint64 UncompressedSize = 0; // Size of the uncompressed shader, or 0 if the shader is not compressed
+    };
+
     struct ResourceData
     {
         // Device-agnostic data (e.g. description)
@@ -149,6 +205,16 @@ public:
         // Device-specific data (e.g. device-specific resource signature data, PSO shader index array, etc.)
         std::array<SerializedData, static_cast<size_t>(DeviceType::Count)> DeviceSpecific;
 
+        // Makes a copy that references the same memory as the original data.
+        ResourceData MakeView() const
+        {
+            ResourceData View;
+            View.Common = SerializedData{Common.Ptr(), Common.Size()};
+            for (size_t i = 0; i < DeviceSpecific.size(); ++i)
+                View.DeviceSpecific[i] = SerializedData{DeviceSpecific[i].Ptr(), DeviceSpecific[i].Size()};
+            return View;
+        }
+
         ResourceData MakeCopy(IMemoryAllocator& Allocator) const
         {
             ResourceData DataCopy;
@@ -225,6 +291,19 @@ public:
         return m_ContentVersion;
     }
 
+    /// Sets the compression mode for the shaders written by Serialize().
+    void SetShaderCompression(ARCHIVE_SHADER_COMPRESSION Compression)
+    {
+        m_ShaderCompression = Compression;
+    }
+
+    /// Returns the shader compression mode.
+    /// When the archive is loaded, the mode is set if any shader in the archive is compressed.
+    ARCHIVE_SHADER_COMPRESSION GetShaderCompression() const
+    {
+        return m_ShaderCompression;
+    }
+
 public:
     struct CreateInfo
     {
@@ -240,12 +319,38 @@ public:
 
     void RemoveDeviceData(DeviceType Dev) noexcept(false);
     void AppendDeviceData(const DeviceObjectArchive& Src, DeviceType Dev) noexcept(false);
-    void Merge(const DeviceObjectArchive& Src) noexcept(false);
+
+    /// Merges the resources and shaders of Src into this archive.
+    ///
+    /// \remarks   If ReplaceExisting is false, resources that already exist in this archive are skipped.
+    ///            Otherwise, they are replaced with the resources from Src.
+    void Merge(const DeviceObjectArchive& Src, bool ReplaceExisting = false) noexcept(false);
 
     void Deserialize(const CreateInfo& CI) noexcept(false);
     void Serialize(IFileStream* pStream) const;
     void Serialize(IDataBlob** ppDataBlob) const;
 
+    /// Writes the update of the archive data this archive was loaded from.
+    ///
+    /// \remarks   Only new and changed resources and shaders are written, followed by the new index.
+    ///            The data must be appended to the end of the original archive data, e.g. by writing it
+    ///            to a file opened in the append mode. Entries of the original data superseded by the update
+    ///            become dead, see GetDeadDataSize().
+    ///            If the archive was not loaded from the data, the entire archive is written.
+    void SerializeAppend(IFileStream* pStream) const;
+    void SerializeAppend(IDataBlob** ppDataBlob) const;
+
+    /// Removes shaders that are not referenced by any resource and rewrites the archive data
+    /// without the dead data. GetData() returns the new archive data.
+    void Compact() noexcept(false);
+
+    /// Returns the size of the archive data that is not referenced by the index,
+    /// e.g. the entries superseded by append-only updates.
+    Uint64 GetDeadDataSize() const
+    {
+        return m_DeadDataSize;
+    }
+
     std::string ToString() const;
 
     template <typename ReourceDataType>
@@ -253,53 +358,111 @@ public:
                                 const char*      Name,
                                 ReourceDataType& ResData) const
     {
-        auto it = m_NamedResources.find(NamedResourceKey{Type, Name});
-        if (it == m_NamedResources.end())
+        ResourceData Data;
+
+        const char* StoredName = FindResource(Type, Name, Data);
+        if (StoredName == nullptr)
         {
             LOG_ERROR_MESSAGE("Resource '", Name, "' is not present in the archive");
             return false;
         }
-        VERIFY_EXPR(SafeStrEqual(Name, it->first.GetName()));
-        // Use string copy from the map
-        Name = it->first.GetName();
+        VERIFY_EXPR(SafeStrEqual(Name, StoredName));
 
-        Serializer<SerializerMode::Read> Ser{it->second.Common};
+        Serializer<SerializerMode::Read> Ser{Data.Common};
 
-        auto Res = ResData.Deserialize(Name, Ser);
+        // Use string copy from the archive
+        auto Res = ResData.Deserialize(StoredName, Ser);
         VERIFY_EXPR(Ser.IsEnded());
         return Res;
     }
 
-    const SerializedData& GetDeviceSpecificData(ResourceType Type,
-                                                const char*  Name,
-                                                DeviceType   DevType) const noexcept;
+    /// Returns true if the archive contains the resource with the given type and name.
+    bool HasResource(ResourceType Type, const char* Name) const noexcept;
+
+    /// Returns device-specific data of the resource.
+    /// The returned object references the archive memory.
+    SerializedData GetDeviceSpecificData(ResourceType Type,
+                                         const char*  Name,
+                                         DeviceType   DevType) const noexcept;
 
-    ResourceData& GetResourceData(ResourceType Type, const char* Name) noexcept
+    /// Returns resource data that can be modified.
+    ResourceData& GetResourceData(ResourceType Type, const char* Name) noexcept(false)
     {
+        LoadAllResources();
         constexpr auto MakeCopy = true;
         return m_NamedResources[NamedResourceKey{Type, Name, MakeCopy}];
     }
 
-    auto& GetDeviceShaders(DeviceType Type) noexcept
+    /// Returns serialized shaders that can be modified.
+    auto& GetDeviceShaders(DeviceType Type) noexcept(false)
     {
+        LoadAllResources();
         return m_DeviceShaders[static_cast<size_t>(Type)];
     }
 
-    const auto& GetSerializedShader(DeviceType Type, size_t Idx) const noexcept
+    /// Returns the number of serialized shaders for the given device type.
+    size_t GetNumShaders(DeviceType Type) const noexcept
     {
-        const auto& DeviceShaders = m_DeviceShaders[static_cast<size_t>(Type)];
-        if (Idx < DeviceShaders.size())
-            return DeviceShaders[Idx];
-
-        static const SerializedData NullData;
-        return NullData;
+        return m_IsIndexed ?
+            m_ShaderIndices[static_cast<size_t>(Type)].Count :
+            m_DeviceShaders[static_cast<size_t>(Type)].size();
     }
 
-    const auto& GetNamedResources() const
+    /// Returns serialized shader data.
+    ///
+    /// \remarks   If the shader is not compressed, the returned object references the archive memory.
+    ///            A compressed shader is decompressed into the memory allocated from pScratchAllocator,
+    ///            and the returned object references that memory. If pScratchAllocator is null, the
+    ///            returned object owns the decompressed data.
+    SerializedData GetSerializedShader(DeviceType              Type,
+                                       size_t                  Idx,
+                                       DynamicLinearAllocator* pScratchAllocator = nullptr) const noexcept;
+
+    /// Calls Handler(ResourceType Type, const char* Name, const ResourceData& Data) for every resource in the archive.
+    ///
+    /// \remarks   Resources that have not been loaded yet are decoded from the archive data,
+    ///            but the decoded data is not kept in the archive.
+    template <typename HandlerType>
+    void ProcessResources(HandlerType&& Handler) const noexcept(false)
     {
-        return m_NamedResources;
+        for (const auto& it : m_NamedResources)
+            Handler(it.first.GetType(), it.first.GetName(), it.second);
+
+        if (m_IsIndexed)
+        {
+            for (Uint32 i = 0; i < m_ResourceIndex.Count; ++i)
+            {
+                ResourceData Data;
+                const char*  Name = DecodeResource(m_ResourceIndex.pEntries[i], Data);
+                if (Name == nullptr)
+                    LOG_ERROR_AND_THROW("Failed to decode resource ", i, " from the archive. Archive file may be corrupted or invalid.");
+                Handler(m_ResourceIndex.pEntries[i].Type, Name, Data);
+            }
+        }
     }
 
+private:
+    // Finds the resource in the archive and returns the resource name string owned by the archive,
+    // or null if the resource is not found. Data references the archive memory.
+    const char* FindResource(ResourceType Type, const char* Name, ResourceData& Data) const noexcept;
+
+    // Returns the index entry of the resource, or null if the resource is not found in the index.
+    const ResourceIndexEntry* FindIndexEntry(ResourceType Type, const char* Name) const noexcept;
+
+    // Returns the name of the indexed resource, or null if the entry is invalid.
+    const char* GetIndexedName(const ResourceIndexEntry& Entry) const noexcept;
+
+    // Decodes indexed resource data. Returns the resource name, or null if the entry is invalid.
+    const char* DecodeResource(const ResourceIndexEntry& Entry, ResourceData& Data) const noexcept;
+
+    // Returns the serialized shader from the archive data, see GetSerializedShader().
+    SerializedData GetIndexedShader(DeviceType Type, size_t Idx, DynamicLinearAllocator* pScratchAllocator) const noexcept;
+
+    // Decodes all indexed resources and shaders into m_NamedResources and m_DeviceShaders.
+    void LoadAllResources() noexcept(false);
+
+    void SerializeImpl(IDataBlob** ppDataBlob, bool Append) const;
+
 private:
     // Named resources
     std::unordered_map<NamedResourceKey, ResourceData, NamedResourceKey::Hasher> m_NamedResources;
@@ -307,11 +470,34 @@ private:
     // Shaders
     std::array<std::vector<SerializedData>, static_cast<size_t>(DeviceType::Count)> m_DeviceShaders;
 
+    template <typename EntryType>
+    struct IndexRange
+    {
+        const EntryType* pEntries = nullptr;
+        Uint32           Count    = 0;
+    };
+
+    // Resource and shader indices that reference the archive data.
+    // When the archive is loaded from the data blob, resources are looked up
+    // in the index and decoded on demand rather than deserialized up front.
+    // After all resources are loaded, the index is used to find the entries
+    // that are not changed when the archive update is written.
+    IndexRange<ResourceIndexEntry>                                                   m_ResourceIndex;
+    std::array<IndexRange<ShaderIndexEntry>, static_cast<size_t>(DeviceType::Count)> m_ShaderIndices;
+
+    bool m_IsIndexed = false;
+
+    // Footer data of the archive
+    Uint64 m_IndexOffset  = 0;
+    Uint64 m_DeadDataSize = 0;
+
     // Strong reference to the original data blob.
     // Resources will not make copies and reference this data.
     RefCntAutoPtr<IDataBlob> m_pArchiveData;
 
     Uint32 m_ContentVersion = 0;
+
+    ARCHIVE_SHADER_COMPRESSION m_ShaderCompression = ARCHIVE_SHADER_COMPRESSION_NONE;
 };
 
 DeviceObjectArchive::DeviceType RenderDeviceTypeToArchiveDeviceType(RENDER_DEVICE_TYPE Type);
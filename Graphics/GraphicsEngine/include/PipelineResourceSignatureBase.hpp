@@ -49,6 +49,7 @@
 #include "SRBMemoryAllocator.hpp"
 #include "ShaderResourceCacheCommon.hpp"
 #include "HashUtils.hpp"
+#include "GraphicsAccessories.hpp"
 
 #if defined(_MSC_VER) && defined(FindResource)
 #    error One of Windows headers leaks FindResource macro, which may result in odd errors. You need to undef the macro.
@@ -100,6 +101,18 @@ void CopyPipelineResourceSignatureDesc(FixedLinearAllocator&
                                        PipelineResourceSignatureDesc&                                   DstDesc,
                                        std::array<Uint16, SHADER_RESOURCE_VARIABLE_TYPE_NUM_TYPES + 1>& ResourceOffsets);
 
+/// Hash of a pipeline resource name and the index of the resource in PipelineResourceSignatureDesc::Resources[].
+struct PipelineResourceNameHash
+{
+    Uint64 NameHash = 0;
+    Uint32 ResIndex = 0;
+
+    constexpr bool operator<(const PipelineResourceNameHash& Rhs) const
+    {
+        return NameHash < Rhs.NameHash || (NameHash == Rhs.NameHash && ResIndex < Rhs.ResIndex);
+    }
+};
+
 /// Pipeline resource signature internal data required for serialization/deserialization.
 template <typename PipelineResourceAttribsType, typename ImmutableSamplerAttribsType>
 struct PipelineResourceSignatureInternalData
@@ -597,6 +610,25 @@ public:
         const auto& This  = *static_cast<const PipelineResourceSignatureImplType*>(this);
         const auto& Other = *ClassPtrCast<const PipelineResourceSignatureImplType>(pPRS);
 
+        if (This.HasCompatibilityID(Other))
+        {
+            const bool IsCompatible = This.m_CompatibilityID == Other.m_CompatibilityID;
+            DEV_CHECK_ERR(IsCompatible == This.IsLayoutCompatibleWith(Other),
+                          "Compatibility IDs of signatures '", This.m_Desc.Name, "' and '", Other.m_Desc.Name,
+                          "' are inconsistent with their layouts. This is a bug.");
+            return IsCompatible;
+        }
+
+        return This.IsLayoutCompatibleWith(Other);
+    }
+
+    // Compares the descriptions and resource attributes of two signatures.
+    // This is the slow path used when the signatures have not been registered
+    // in the same device (e.g. serialized signatures that have no device).
+    bool IsLayoutCompatibleWith(const PipelineResourceSignatureImplType& Other) const
+    {
+        const auto& This = *static_cast<const PipelineResourceSignatureImplType*>(this);
+
         if (This.GetHash() != Other.GetHash())
             return false;
 
@@ -618,9 +650,16 @@ public:
 
     bool IsIncompatibleWith(const PipelineResourceSignatureImplType& Other) const
     {
+        if (HasCompatibilityID(Other))
+            return m_CompatibilityID != Other.m_CompatibilityID;
+
         return GetHash() != Other.GetHash();
     }
 
+    // Returns the ID shared by all compatible signatures registered in the device,
+    // or zero if the signature has not been registered.
+    Uint32 GetCompatibilityID() const { return m_CompatibilityID; }
+
     size_t GetHash() const { return m_Hash; }
 
     PIPELINE_TYPE GetPipelineType() const { return m_PipelineType; }
@@ -695,6 +734,21 @@ public:
         return this->m_Desc.ImmutableSamplers[SampIndex];
     }
 
+    /// Returns the range of entries in the resource name index whose name hash is equal to NameHash.
+    /// The entries are sorted by the resource index.
+    std::pair<const PipelineResourceNameHash*, const PipelineResourceNameHash*> GetResourcesByNameHash(Uint64 NameHash) const
+    {
+        const auto* const pBegin = m_pResourceNameHashes;
+        const auto* const pEnd   = m_pResourceNameHashes + this->m_Desc.NumResources;
+
+        const auto* pLower = std::lower_bound(pBegin, pEnd, NameHash,
+                                              [](const PipelineResourceNameHash& Entry, Uint64 Hash) { return Entry.NameHash < Hash; });
+        const auto* pUpper = pLower;
+        while (pUpper != pEnd && pUpper->NameHash == NameHash)
+            ++pUpper;
+        return {pLower, pUpper};
+    }
+
     const PipelineResourceAttribsType& GetResourceAttribs(Uint32 ResIndex) const
     {
         VERIFY_EXPR(ResIndex < this->m_Desc.NumResources);
@@ -798,6 +852,7 @@ protected:
         ReserveSpaceForPipelineResourceSignatureDesc(Allocator, Desc);
 
         Allocator.AddSpace<PipelineResourceAttribsType>(Desc.NumResources);
+        Allocator.AddSpace<PipelineResourceNameHash>(Desc.NumResources);
 
         const auto NumStaticResStages = GetNumStaticResStages();
         if (NumStaticResStages > 0)
@@ -835,6 +890,8 @@ protected:
             AllocResourceAttribs(Allocator) :
             Allocator.Allocate<PipelineResourceAttribsType>(Desc.NumResources);
 
+        InitResourceNameIndex(Allocator);
+
         if (NumStaticResStages > 0)
         {
             m_pStaticResCache = Allocator.Construct<ShaderResourceCacheImplType>(ResourceCacheContentType::Signature);
@@ -896,6 +953,12 @@ protected:
         }
 
         pThisImpl->CalculateHash();
+
+        if (this->HasDevice())
+        {
+            m_CompatibilityID = this->GetDevice()->GetPipelineResourceSignatureRegistry().Register(*pThisImpl);
+            VERIFY_EXPR(m_CompatibilityID != 0);
+        }
     }
 
 protected:
@@ -968,6 +1031,13 @@ protected:
     {
         VERIFY(!m_IsDestructed, "This object has already been destructed");
 
+        if (m_CompatibilityID != 0)
+        {
+            // Unregister the signature before its resource attributes are released
+            this->GetDevice()->GetPipelineResourceSignatureRegistry().Unregister(*static_cast<const PipelineResourceSignatureImplType*>(this));
+            m_CompatibilityID = 0;
+        }
+
         this->m_Desc.Resources             = nullptr;
         this->m_Desc.ImmutableSamplers     = nullptr;
         this->m_Desc.CombinedSamplerSuffix = nullptr;
@@ -997,6 +1067,8 @@ protected:
 
         static_assert(std::is_trivially_destructible<PipelineResourceAttribsType>::value, "Destructors for m_pResourceAttribs[] are required");
         m_pResourceAttribs = nullptr;
+        static_assert(std::is_trivially_destructible<PipelineResourceNameHash>::value, "Destructors for m_pResourceNameHashes[] are required");
+        m_pResourceNameHashes = nullptr;
         static_assert(std::is_trivially_destructible<ImmutableSamplerAttribsType>::value, "Destructors for m_pImmutableSamplerAttribs[] are required");
         m_pImmutableSamplerAttribs = nullptr;
 
@@ -1042,6 +1114,47 @@ protected:
         return SamplerInd;
     }
 
+    // Builds the index of resource names sorted by the name hash. The index is shared by
+    // all variable managers of this signature and all SRBs created from it, so that
+    // variable lookups by name do not need to compare strings.
+    void InitResourceNameIndex(FixedLinearAllocator& Allocator)
+    {
+        const auto NumResources = this->m_Desc.NumResources;
+
+        m_pResourceNameHashes = Allocator.ConstructArray<PipelineResourceNameHash>(NumResources);
+        for (Uint32 i = 0; i < NumResources; ++i)
+        {
+            m_pResourceNameHashes[i].NameHash = ComputeShaderResourceNameHash(this->m_Desc.Resources[i].Name);
+            m_pResourceNameHashes[i].ResIndex = i;
+        }
+        std::sort(m_pResourceNameHashes, m_pResourceNameHashes + NumResources);
+
+#ifdef DILIGENT_DEVELOPMENT
+        for (Uint32 i = 1; i < NumResources; ++i)
+        {
+            const auto& Prev = m_pResourceNameHashes[i - 1];
+            const auto& Curr = m_pResourceNameHashes[i];
+            if (Prev.NameHash == Curr.NameHash)
+            {
+                const char* PrevName = this->m_Desc.Resources[Prev.ResIndex].Name;
+                const char* CurrName = this->m_Desc.Resources[Curr.ResIndex].Name;
+                if (strcmp(PrevName, CurrName) != 0)
+                {
+                    LOG_WARNING_MESSAGE("Names of resources '", PrevName, "' and '", CurrName, "' in pipeline resource signature '", this->m_Desc.Name,
+                                        "' have the same hash. IShaderResourceBinding::GetVariableByHash() will not be able to distinguish them.");
+                }
+            }
+        }
+#endif
+    }
+
+    // Returns true if both signatures have been registered in the same device,
+    // so that their compatibility IDs can be compared.
+    bool HasCompatibilityID(const PipelineResourceSignatureBase& Other) const
+    {
+        return m_CompatibilityID != 0 && Other.m_CompatibilityID != 0 && this->m_pDevice == Other.m_pDevice;
+    }
+
     void CalculateHash()
     {
         const auto* const pThisImpl = static_cast<const PipelineResourceSignatureImplType*>(this);
@@ -1060,6 +1173,9 @@ protected:
     // Pipeline resource attributes
     PipelineResourceAttribsType* m_pResourceAttribs = nullptr; // [m_Desc.NumResources]
 
+    // Resource name hashes, sorted by the hash
+    PipelineResourceNameHash* m_pResourceNameHashes = nullptr; // [m_Desc.NumResources]
+
     // Immutable sampler attributes
     ImmutableSamplerAttribsType* m_pImmutableSamplerAttribs = nullptr; // [m_Desc.NumImmutableSamplers]
 
@@ -1074,6 +1190,10 @@ protected:
 
     size_t m_Hash = 0;
 
+    // Compatibility ID assigned by the device's pipeline resource signature registry.
+    // Compatible signatures created by the same device share the same ID.
+    Uint32 m_CompatibilityID = 0;
+
     // Resource offsets (e.g. index of the first resource), for each variable type.
     std::array<Uint16, SHADER_RESOURCE_VARIABLE_TYPE_NUM_TYPES + 1> m_ResourceOffsets = {};
 
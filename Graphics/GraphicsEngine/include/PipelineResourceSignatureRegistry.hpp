@@ -0,0 +1,148 @@
+/*
+ *  Copyright 2019-2024 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Implementation of the Diligent::PipelineResourceSignatureRegistry template class
+
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "BasicTypes.h"
+#include "DebugUtilities.hpp"
+
+namespace Diligent
+{
+
+/// A thread-safe registry that interns pipeline resource signatures of a render device.
+
+/// All live signatures that are compatible with each other share the same compatibility ID,
+/// so that the compatibility of two signatures can be tested by comparing their IDs.
+/// The registry keeps raw pointers to the signatures. This is safe because every signature
+/// unregisters itself when it is destructed.
+///
+/// \tparam PipelineResourceSignatureImplType - Pipeline resource signature implementation type.
+///                                             The type must implement GetHash() and
+///                                             IsLayoutCompatibleWith() methods.
+template <typename PipelineResourceSignatureImplType>
+class PipelineResourceSignatureRegistry
+{
+public:
+    /// Compatibility ID of a signature that is not registered.
+    static constexpr Uint32 InvalidCompatibilityID = 0;
+
+    PipelineResourceSignatureRegistry() = default;
+
+    // clang-format off
+    PipelineResourceSignatureRegistry           (const PipelineResourceSignatureRegistry&)  = delete;
+    PipelineResourceSignatureRegistry           (      PipelineResourceSignatureRegistry&&) = delete;
+    PipelineResourceSignatureRegistry& operator=(const PipelineResourceSignatureRegistry&)  = delete;
+    PipelineResourceSignatureRegistry& operator=(      PipelineResourceSignatureRegistry&&) = delete;
+    // clang-format on
+
+    ~PipelineResourceSignatureRegistry()
+    {
+        VERIFY(m_Signatures.empty(), "Not all pipeline resource signatures have been unregistered");
+    }
+
+    /// Adds the signature to the registry and returns its compatibility ID.
+
+    /// If there is a registered signature that is compatible with Signature,
+    /// its ID is returned. Otherwise, a new ID is assigned.
+    Uint32 Register(const PipelineResourceSignatureImplType& Signature)
+    {
+        std::lock_guard<std::mutex> Lock{m_Mtx};
+
+        auto& Bucket = m_Signatures[Signature.GetHash()];
+
+        Uint32 CompatibilityID = InvalidCompatibilityID;
+        for (const auto& Entry : Bucket)
+        {
+            VERIFY(Entry.pSignature != &Signature, "This signature has already been registered");
+            if (Signature.IsLayoutCompatibleWith(*Entry.pSignature))
+            {
+                CompatibilityID = Entry.CompatibilityID;
+                break;
+            }
+        }
+
+        if (CompatibilityID == InvalidCompatibilityID)
+        {
+            CompatibilityID = m_NextCompatibilityID++;
+            VERIFY(CompatibilityID != InvalidCompatibilityID, "Compatibility ID counter has overflown");
+        }
+
+        Bucket.push_back({&Signature, CompatibilityID});
+
+        return CompatibilityID;
+    }
+
+    /// Removes the signature from the registry.
+    void Unregister(const PipelineResourceSignatureImplType& Signature)
+    {
+        std::lock_guard<std::mutex> Lock{m_Mtx};
+
+        auto bucket_it = m_Signatures.find(Signature.GetHash());
+        if (bucket_it == m_Signatures.end())
+        {
+            UNEXPECTED("Signature is not found in the registry");
+            return;
+        }
+
+        auto& Bucket = bucket_it->second;
+        for (auto it = Bucket.begin(); it != Bucket.end(); ++it)
+        {
+            if (it->pSignature == &Signature)
+            {
+                Bucket.erase(it);
+                if (Bucket.empty())
+                    m_Signatures.erase(bucket_it);
+                return;
+            }
+        }
+
+        UNEXPECTED("Signature is not found in the registry");
+    }
+
+private:
+    struct SignatureEntry
+    {
+        const PipelineResourceSignatureImplType* pSignature;
+        Uint32                                   CompatibilityID;
+    };
+
+    std::mutex m_Mtx;
+
+    // Registered signatures, grouped by the signature hash.
+    std::unordered_map<size_t, std::vector<SignatureEntry>> m_Signatures;
+
+    Uint32 m_NextCompatibilityID = InvalidCompatibilityID + 1;
+};
+
+} // namespace Diligent
@@ -48,6 +48,7 @@
 #include "STDAllocator.hpp"
 #include "IndexWrapper.hpp"
 #include "ThreadPool.hpp"
+#include "PipelineResourceSignatureRegistry.hpp"
 
 namespace Diligent
 {
@@ -338,6 +339,12 @@ public:
         return m_UniqueId.fetch_add(1) + 1;
     }
 
+    using PipelineResourceSignatureRegistryType = PipelineResourceSignatureRegistry<PipelineResourceSignatureImplType>;
+    PipelineResourceSignatureRegistryType& GetPipelineResourceSignatureRegistry()
+    {
+        return m_PRSRegistry;
+    }
+
     virtual IThreadPool* DILIGENT_CALL_TYPE GetShaderCompilationThreadPool() const override final
     {
         return m_pShaderCompilationThreadPool;
@@ -607,6 +614,7 @@ protected:
     // This is safe because every object unregisters itself
     // when it is deleted.
     ObjectsRegistry<SamplerDesc, RefCntAutoPtr<ISampler>>                       m_SamplersRegistry; ///< Sampler state registry
+    PipelineResourceSignatureRegistryType                                       m_PRSRegistry;      ///< Pipeline resource signature compatibility registry
     std::vector<TextureFormatInfoExt, STDAllocatorRawMem<TextureFormatInfoExt>> m_TextureFormatsInfo;
     std::vector<bool, STDAllocatorRawMem<bool>>                                 m_TexFmtInfoInitFlags;
 
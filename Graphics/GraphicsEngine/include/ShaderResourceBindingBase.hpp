@@ -235,6 +235,60 @@ public:
         return m_pShaderVarMgrs[MgrInd].GetVariable(Index);
     }
 
+    /// Implementation of IShaderResourceBinding::GetVariableByHash().
+    virtual IShaderResourceVariable* DILIGENT_CALL_TYPE GetVariableByHash(SHADER_TYPE ShaderType, Uint64 NameHash) override final
+    {
+        const auto PipelineType = GetPipelineType();
+        if (!IsConsistentShaderType(ShaderType, PipelineType))
+        {
+            LOG_WARNING_MESSAGE("Unable to find mutable/dynamic variable with name hash ", NameHash, " in shader stage ", GetShaderTypeLiteralName(ShaderType),
+                                " as the stage is invalid for ", GetPipelineTypeString(PipelineType), " pipeline resource signature '", m_pPRS->GetDesc().Name, "'.");
+            return nullptr;
+        }
+
+        const auto ShaderInd = GetShaderTypePipelineIndex(ShaderType, PipelineType);
+        const auto MgrInd    = m_ActiveShaderStageIndex[ShaderInd];
+        if (MgrInd < 0)
+            return nullptr;
+
+        VERIFY_EXPR(static_cast<Uint32>(MgrInd) < GetNumShaders());
+        return m_pShaderVarMgrs[MgrInd].GetVariableByHash(NameHash);
+    }
+
+    /// Implementation of IShaderResourceBinding::SetResources().
+    virtual void DILIGENT_CALL_TYPE SetResources(const ResourceBindDesc* pDescs, Uint32 NumDescs) override final
+    {
+        DEV_CHECK_ERR(pDescs != nullptr || NumDescs == 0, "pDescs must not be null when NumDescs is not zero");
+
+        const auto PipelineType = GetPipelineType();
+
+        Uint32 FirstDesc = 0;
+        while (FirstDesc < NumDescs)
+        {
+            // Process all consecutive descriptions for the same shader stage as one batch
+            const SHADER_TYPE ShaderType = pDescs[FirstDesc].ShaderType;
+
+            Uint32 EndDesc = FirstDesc + 1;
+            while (EndDesc < NumDescs && pDescs[EndDesc].ShaderType == ShaderType)
+                ++EndDesc;
+
+            DEV_CHECK_ERR(IsConsistentShaderType(ShaderType, PipelineType), "Unable to set resources in shader stage ", GetShaderTypeLiteralName(ShaderType),
+                          " as the stage is invalid for ", GetPipelineTypeString(PipelineType), " pipeline resource signature '", m_pPRS->GetDesc().Name, "'.");
+
+            const Int32 ShaderInd = GetShaderTypePipelineIndex(ShaderType, PipelineType);
+            const Int8  MgrInd    = ShaderInd >= 0 ? m_ActiveShaderStageIndex[ShaderInd] : Int8{-1};
+            DEV_CHECK_ERR(MgrInd >= 0, "Unable to set resources in shader stage ", GetShaderTypeLiteralName(ShaderType),
+                          " as pipeline resource signature '", m_pPRS->GetDesc().Name, "' has no mutable or dynamic variables in this stage.");
+            if (MgrInd >= 0)
+            {
+                VERIFY_EXPR(static_cast<Uint32>(MgrInd) < GetNumShaders());
+                m_pShaderVarMgrs[MgrInd].SetResources(pDescs + FirstDesc, EndDesc - FirstDesc);
+            }
+
+            FirstDesc = EndDesc;
+        }
+    }
+
     /// Implementation of IShaderResourceBinding::BindResources().
     virtual void DILIGENT_CALL_TYPE BindResources(SHADER_TYPE                 ShaderStages,
                                                   IResourceMapping*           pResMapping,
@@ -31,8 +31,11 @@
 /// Implementation of the Diligent::ShaderBase template class
 
 #include <vector>
+#include <algorithm>
+#include <cstring>
 
 #include "ShaderResourceVariable.h"
+#include "ShaderResourceBinding.h"
 #include "PipelineState.h"
 #include "StringTools.hpp"
 #include "GraphicsAccessories.hpp"
@@ -804,6 +807,8 @@ struct ShaderVariableBase : public ResourceVariableBaseInterface
 
     const PipelineResourceDesc& GetDesc() const { return m_ParentManager.GetResourceDesc(m_ResIndex); }
 
+    Uint32 GetResIndex() const { return m_ResIndex; }
+
 protected:
     // Variable manager that owns this variable
     VarManagerType& m_ParentManager;
@@ -890,6 +895,60 @@ protected:
         }
     }
 
+    // Binds resources to the variables of this manager, see IShaderResourceBinding::SetResources().
+    // All variables must be of VariableType.
+    void SetResources(const ResourceBindDesc* pDescs, Uint32 NumDescs)
+    {
+        for (Uint32 i = 0; i < NumDescs; ++i)
+        {
+            const ResourceBindDesc& Desc         = pDescs[i];
+            const Uint32            NumVariables = static_cast<const ThisImplType*>(this)->m_NumVariables;
+            if (Desc.VariableIndex >= NumVariables)
+            {
+                DEV_ERROR("Variable index (", Desc.VariableIndex, ") is out of range. The number of variables is ", NumVariables);
+                continue;
+            }
+
+            VariableType& Var = m_pVariables[Desc.VariableIndex];
+            if (Desc.ArrayIndex >= Var.GetDesc().ArraySize)
+            {
+                DEV_ERROR("Array index (", Desc.ArrayIndex, ") is out of range for variable '", Var.GetDesc().Name, "' of size ", Var.GetDesc().ArraySize);
+                continue;
+            }
+            Var.BindResource(BindResourceInfo{Desc.ArrayIndex, Desc.pObject, Desc.Flags});
+        }
+    }
+
+protected:
+    // Finds the variable that references the resource with index ResIndex in the range [pVars, pVars + NumVars).
+    // The variables in the range must be sorted by the resource index.
+    template <typename VarType>
+    static VarType* FindVariableByResIndex(VarType* pVars, Uint32 NumVars, Uint32 ResIndex)
+    {
+        auto* pVar = std::lower_bound(pVars, pVars + NumVars, ResIndex,
+                                      [](const VarType& Var, Uint32 Idx) { return Var.GetResIndex() < Idx; });
+        return (pVar != pVars + NumVars && pVar->GetResIndex() == ResIndex) ? pVar : nullptr;
+    }
+
+    // Finds the variable using the resource name index of the signature.
+    // If Name is not null, it is compared with the resource name to resolve hash collisions.
+    // FindByResIndex is called for every resource whose name matches and must return the
+    // manager's variable that references this resource, or null if there is no such variable.
+    template <typename ResultType, typename FindByResIndexType>
+    ResultType* FindVariableByNameHash(Uint64 NameHash, const Char* Name, FindByResIndexType&& FindByResIndex) const
+    {
+        VERIFY_EXPR(m_pSignature != nullptr);
+        const auto Range = m_pSignature->GetResourcesByNameHash(NameHash);
+        for (const auto* pEntry = Range.first; pEntry != Range.second; ++pEntry)
+        {
+            if (Name != nullptr && strcmp(m_pSignature->GetResourceDesc(pEntry->ResIndex).Name, Name) != 0)
+                continue;
+
+            if (ResultType* pVar = FindByResIndex(pEntry->ResIndex))
+                return pVar;
+        }
+        return nullptr;
+    }
 
 protected:
     IObject& m_Owner;
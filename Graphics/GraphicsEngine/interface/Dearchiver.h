@@ -98,6 +98,22 @@ DILIGENT_TYPED_ENUM(PSO_ARCHIVE_FLAGS, Uint32)
 DEFINE_FLAG_ENUM_OPERATORS(PSO_ARCHIVE_FLAGS)
 
 
+/// Shader compression mode used by the device object archive
+DILIGENT_TYPED_ENUM(ARCHIVE_SHADER_COMPRESSION, Uint8)
+{
+    /// Shaders are stored uncompressed.
+    ARCHIVE_SHADER_COMPRESSION_NONE = 0u,
+
+    /// Every shader is compressed individually using the LZ4 block format.
+    ///
+    /// \remarks   Shaders are decompressed when they are unpacked from the archive for
+    ///            the first time. Shaders that can't be compressed are stored uncompressed.
+    ARCHIVE_SHADER_COMPRESSION_LZ4,
+
+    ARCHIVE_SHADER_COMPRESSION_COUNT
+};
+
+
 /// Pipeline state unpack flags
 DILIGENT_TYPED_ENUM(PSO_UNPACK_FLAGS, Uint32)
 {
@@ -271,6 +287,38 @@ DILIGENT_BEGIN_INTERFACE(IDearchiver, IObject)
                                              const PipelineStateUnpackInfo REF UnpackInfo,
                                              IPipelineState**                  ppPSO) PURE;
 
+    /// Unpacks multiple pipeline state objects from the device object archive.
+
+    /// \param [in]  pUnpackInfos - A pointer to the array of NumPSOs pipeline state unpack infos,
+    ///                             see Diligent::PipelineStateUnpackInfo.
+    /// \param [in]  NumPSOs      - The number of pipeline states to unpack.
+    /// \param [out] ppPSOs       - A pointer to the array of NumPSOs memory locations where pointers
+    ///                             to the unpacked pipeline state objects will be stored.
+    ///                             The function calls AddRef() for every unpacked PSO.
+    ///                             If a pipeline state could not be unpacked, the corresponding
+    ///                             element is set to null.
+    ///
+    /// \remarks    Resource signatures, render passes and shaders that are shared by several
+    ///             pipeline states in the batch are unpacked only once. Shaders are created
+    ///             in parallel by the device's shader compilation thread pool (see
+    ///             IRenderDevice::GetShaderCompilationThreadPool()), and pipeline states are
+    ///             created with the PSO_CREATE_FLAG_ASYNCHRONOUS flag. As a result, the method may
+    ///             return before the pipelines are ready, and an application must check the
+    ///             status of every pipeline state with IPipelineState::GetStatus() before using it.
+    ///
+    ///             If the device does not have the shader compilation thread pool, all objects
+    ///             are created by the calling thread.
+    ///
+    ///             ModifyPipelineStateCreateInfo callbacks are always called by the calling thread.
+    ///
+    /// \note   Resource signatures used by the PSOs will be unpacked from the same archive.
+    ///
+    ///         This method is thread-safe.
+    VIRTUAL void METHOD(UnpackPipelineStates)(THIS_
+                                              const PipelineStateUnpackInfo* pUnpackInfos,
+                                              Uint32                         NumPSOs,
+                                              IPipelineState**               ppPSOs) PURE;
+
     /// Unpacks resource signature from the device object archive.
 
     /// \param [in]  UnpackInfo  - Resource signature unpack info, see Diligent::ResourceSignatureUnpackInfo.
@@ -328,6 +376,7 @@ DILIGENT_END_INTERFACE
 #    define IDearchiver_LoadArchive(This, ...)             CALL_IFACE_METHOD(Dearchiver, LoadArchive,             This, __VA_ARGS__)
 #    define IDearchiver_UnpackShader(This, ...)            CALL_IFACE_METHOD(Dearchiver, UnpackShader,            This, __VA_ARGS__)
 #    define IDearchiver_UnpackPipelineState(This, ...)     CALL_IFACE_METHOD(Dearchiver, UnpackPipelineState,     This, __VA_ARGS__)
+#    define IDearchiver_UnpackPipelineStates(This, ...)    CALL_IFACE_METHOD(Dearchiver, UnpackPipelineStates,    This, __VA_ARGS__)
 #    define IDearchiver_UnpackResourceSignature(This, ...) CALL_IFACE_METHOD(Dearchiver, UnpackResourceSignature, This, __VA_ARGS__)
 #    define IDearchiver_UnpackRenderPass(This, ...)        CALL_IFACE_METHOD(Dearchiver, UnpackRenderPass,        This, __VA_ARGS__)
 #    define IDearchiver_Store(This, ...)                   CALL_IFACE_METHOD(Dearchiver, Store,                   This, __VA_ARGS__)
@@ -2076,7 +2076,8 @@ DILIGENT_TYPED_ENUM(STATE_TRANSITION_FLAGS, Uint8)
     STATE_TRANSITION_FLAG_DISCARD_CONTENT = 1u << 1,
 
     /// Indicates state transition between aliased resources that share the same memory.
-    /// Currently it is only supported for sparse resources that were created with aliasing flag.
+    /// Currently it is only supported for sparse resources that were created with aliasing flag
+    /// and for transient textures (see Diligent::MISC_TEXTURE_FLAG_TRANSIENT).
     STATE_TRANSITION_FLAG_ALIASING        = 1u << 2
 };
 DEFINE_FLAG_ENUM_OPERATORS(STATE_TRANSITION_FLAGS);
@@ -2345,6 +2346,25 @@ struct DeviceContextCommandCounters
 };
 typedef struct DeviceContextCommandCounters DeviceContextCommandCounters;
 
+/// Device context pipeline barrier counters.
+
+/// \remarks Barrier counters are currently only collected by the Vulkan backend.
+///          Comparing the number of pipeline barriers with the number of individual
+///          memory and image barriers shows how well the barriers are batched.
+struct DeviceContextBarrierCounters
+{
+    /// The total number of pipeline barrier commands recorded into command buffers
+    /// (vkCmdPipelineBarrier or vkCmdPipelineBarrier2 in Vulkan).
+    Uint32 PipelineBarriers DEFAULT_INITIALIZER(0);
+
+    /// The total number of global memory barriers issued by all pipeline barrier commands.
+    Uint32 MemoryBarriers DEFAULT_INITIALIZER(0);
+
+    /// The total number of image memory barriers issued by all pipeline barrier commands.
+    Uint32 ImageBarriers DEFAULT_INITIALIZER(0);
+};
+typedef struct DeviceContextBarrierCounters DeviceContextBarrierCounters;
+
 /// Device context statistics.
 struct DeviceContextStats
 {
@@ -2354,6 +2374,9 @@ struct DeviceContextStats
     /// Command counters, see Diligent::DeviceContextCommandCounters.
     DeviceContextCommandCounters CommandCounters DEFAULT_INITIALIZER({});
 
+    /// Pipeline barrier counters, see Diligent::DeviceContextBarrierCounters.
+    DeviceContextBarrierCounters BarrierCounters DEFAULT_INITIALIZER({});
+
 #if DILIGENT_CPP_INTERFACE
     constexpr Uint32 GetTotalTriangleCount() const noexcept
     {
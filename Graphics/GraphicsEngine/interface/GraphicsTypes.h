@@ -3576,6 +3576,19 @@ struct EngineGLCreateInfo DILIGENT_DERIVE(EngineCreateInfo)
     /// * On Linux this affects the `DRI_PRIME` environment variable that is used by Mesa drivers that support PRIME.
     ADAPTER_TYPE PreferredAdapterType DEFAULT_INITIALIZER(ADAPTER_TYPE_UNKNOWN);
 
+    /// Size of the persistently-mapped ring buffer that USAGE_DYNAMIC uniform buffers suballocate their memory from.
+    ///
+    /// \remarks    When this member is not zero and the device supports persistent buffer mapping
+    ///             (OpenGL 4.4 or GL_ARB_buffer_storage), memory for a dynamic uniform buffer is allocated
+    ///             from the ring buffer every time the buffer is mapped with MAP_FLAG_DISCARD, and the buffer is
+    ///             bound as a range of the ring. This avoids driver synchronization on every map.
+    ///             Similar to Direct3D12 and Vulkan, the contents of such buffers are discarded at the end of
+    ///             every frame (see IDeviceContext::FinishFrame()), so a buffer must be mapped before its
+    ///             first use in every frame.
+    ///
+    ///             When this member is zero, dynamic buffers are mapped with glMapBufferRange().
+    Uint32 DynamicHeapSize DEFAULT_INITIALIZER(0);
+
 #if PLATFORM_EMSCRIPTEN
     /// WebGL context attributes.
     WebGLContextAttribs WebGLAttribs;
@@ -3918,6 +3931,13 @@ struct EngineVkCreateInfo DILIGENT_DERIVE(EngineCreateInfo)
     /// Size of the main descriptor pool that is used to allocate descriptor sets
     /// for static and mutable variables. If allocation from the current pool fails,
     /// the engine creates another one.
+    ///
+    /// \remarks    To avoid contention, threads that allocate descriptor sets are assigned
+    ///             to one of 16 thread slots, and every slot allocates from its own pool.
+    ///             Pools are created on demand, so in the worst case, when 16 or more threads
+    ///             allocate descriptor sets, up to 16 pools of this size may be alive at the same
+    ///             time (e.g. 131072 descriptor sets and 131072 combined image samplers with the
+    ///             default sizes).
     VulkanDescriptorPoolSize MainDescriptorPoolSize
 #if DILIGENT_CPP_INTERFACE
         //Max  SepSm  CmbSm  SmpImg StrImg   UB     SB    UTxB   StTxB  InptAtt  AccelSt
@@ -4057,6 +4077,16 @@ struct EngineVkCreateInfo DILIGENT_DERIVE(EngineCreateInfo)
     /// features when compiling shaders from HLSL.
     const Char* pDxCompilerPath DEFAULT_INITIALIZER(nullptr);
 
+    /// Whether to bind shader resources through descriptor buffers (VK_EXT_descriptor_buffer)
+    /// instead of descriptor sets.
+    ///
+    /// \remarks    When enabled, descriptors are written directly into the dynamic heap,
+    ///             and committing shader resources only updates descriptor buffer offsets.
+    ///             If the extension or buffer device address feature is not supported by the device,
+    ///             the engine falls back to descriptor sets.
+    ///             Descriptor buffers are only available when the Vulkan library is loaded through Volk.
+    Bool EnableDescriptorBuffer DEFAULT_INITIALIZER(False);
+
 #if DILIGENT_CPP_INTERFACE
     EngineVkCreateInfo() noexcept :
         EngineVkCreateInfo{EngineCreateInfo{}}
@@ -44,6 +44,46 @@ struct IPipelineResourceSignature;
 static DILIGENT_CONSTEXPR INTERFACE_ID IID_ShaderResourceBinding =
     {0x61f8774, 0x9a09, 0x48e8, {0x84, 0x11, 0xb5, 0xbd, 0x20, 0x56, 0x1, 0x4}};
 
+/// Describes a resource to bind to a shader variable with IShaderResourceBinding::SetResources().
+struct ResourceBindDesc
+{
+    // clang-format off
+    /// Shader stage of the variable. Must be one of Diligent::SHADER_TYPE.
+    SHADER_TYPE               ShaderType    DEFAULT_INITIALIZER(SHADER_TYPE_UNKNOWN);
+
+    /// Variable index in the shader stage, the same as used by IShaderResourceBinding::GetVariableByIndex().
+    Uint32                    VariableIndex DEFAULT_INITIALIZER(0);
+
+    /// Array element to bind the resource to.
+    Uint32                    ArrayIndex    DEFAULT_INITIALIZER(0);
+
+    /// Resource to bind. May be null to reset the binding.
+    IDeviceObject*            pObject       DEFAULT_INITIALIZER(nullptr);
+
+    /// Flags, see Diligent::SET_SHADER_RESOURCE_FLAGS.
+    SET_SHADER_RESOURCE_FLAGS Flags         DEFAULT_INITIALIZER(SET_SHADER_RESOURCE_FLAG_NONE);
+    // clang-format on
+
+#if DILIGENT_CPP_INTERFACE
+    constexpr ResourceBindDesc() noexcept
+    {}
+
+    constexpr ResourceBindDesc(SHADER_TYPE               _ShaderType,
+                               Uint32                    _VariableIndex,
+                               IDeviceObject*            _pObject,
+                               Uint32                    _ArrayIndex = ResourceBindDesc{}.ArrayIndex,
+                               SET_SHADER_RESOURCE_FLAGS _Flags      = ResourceBindDesc{}.Flags) noexcept :
+        ShaderType{_ShaderType},
+        VariableIndex{_VariableIndex},
+        ArrayIndex{_ArrayIndex},
+        pObject{_pObject},
+        Flags{_Flags}
+    {}
+#endif
+};
+typedef struct ResourceBindDesc ResourceBindDesc;
+
+
 
 #define DILIGENT_INTERFACE_NAME IShaderResourceBinding
 #include "../../../Primitives/interface/DefineInterfaceHelperMacros.h"
@@ -149,6 +189,38 @@ DILIGENT_BEGIN_INTERFACE(IShaderResourceBinding, IObject)
                                                                 SHADER_TYPE ShaderType,
                                                                 Uint32      Index) PURE;
 
+    /// Returns the variable by the hash of its name.
+
+    /// \param [in] ShaderType - Type of the shader to look up the variable.
+    ///                          Must be one of Diligent::SHADER_TYPE.
+    /// \param [in] NameHash   - Hash of the variable name computed by
+    ///                          Diligent::ComputeShaderResourceNameHash(), which is the
+    ///                          64-bit XXH3 hash (seed 0) of the name characters.
+    ///
+    /// \remark Unlike GetVariableByName(), this method does not perform any string operations
+    ///         and is intended for hot loops where the hash is computed once in advance.
+    ///         Only mutable and dynamic variables can be accessed through this method.
+    ///
+    /// \note   If names of two resources in the same shader stage have the same hash, the method
+    ///         returns the first one. Such collisions are reported when the signature is created.
+    VIRTUAL IShaderResourceVariable* METHOD(GetVariableByHash)(THIS_
+                                                               SHADER_TYPE ShaderType,
+                                                               Uint64      NameHash) PURE;
+
+    /// Binds multiple resources to mutable and dynamic variables in one call.
+
+    /// \param [in] pDescs   - Array of NumDescs resource bind descriptions, see Diligent::ResourceBindDesc.
+    /// \param [in] NumDescs - Number of elements in the pDescs array.
+    ///
+    /// \remark The method is equivalent to calling IShaderResourceVariable::Set() for every element of
+    ///         the array, but avoids per-resource virtual calls, validates the arguments in development
+    ///         builds only, and coalesces backend descriptor updates.
+    ///         Consecutive descriptions that target the same shader stage are processed as one batch,
+    ///         so for best performance the descriptions should be grouped by the shader stage.
+    VIRTUAL void METHOD(SetResources)(THIS_
+                                      const ResourceBindDesc* pDescs,
+                                      Uint32                  NumDescs) PURE;
+
     /// Returns true if static resources have been initialized in this SRB.
     VIRTUAL Bool METHOD(StaticResourcesInitialized)(THIS) CONST PURE;
 };
@@ -166,6 +238,8 @@ DILIGENT_END_INTERFACE
 #    define IShaderResourceBinding_GetVariableByName(This, ...)       CALL_IFACE_METHOD(ShaderResourceBinding, GetVariableByName,            This, __VA_ARGS__)
 #    define IShaderResourceBinding_GetVariableCount(This, ...)        CALL_IFACE_METHOD(ShaderResourceBinding, GetVariableCount,             This, __VA_ARGS__)
 #    define IShaderResourceBinding_GetVariableByIndex(This, ...)      CALL_IFACE_METHOD(ShaderResourceBinding, GetVariableByIndex,           This, __VA_ARGS__)
+#    define IShaderResourceBinding_GetVariableByHash(This, ...)       CALL_IFACE_METHOD(ShaderResourceBinding, GetVariableByHash,            This, __VA_ARGS__)
+#    define IShaderResourceBinding_SetResources(This, ...)            CALL_IFACE_METHOD(ShaderResourceBinding, SetResources,                 This, __VA_ARGS__)
 #    define IShaderResourceBinding_StaticResourcesInitialized(This)   CALL_IFACE_METHOD(ShaderResourceBinding, StaticResourcesInitialized,   This)
 
 // clang-format on
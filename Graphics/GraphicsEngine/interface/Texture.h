@@ -72,7 +72,16 @@ DILIGENT_TYPED_ENUM(MISC_TEXTURE_FLAGS, Uint8)
     /// Requires SHADING_RATE_CAP_FLAG_SUBSAMPLED_RENDER_TARGET capability.
     /// 
     /// \note  Copy operations are not supported for subsampled textures.
-    MISC_TEXTURE_FLAG_SUBSAMPLED      = 1u << 3
+    MISC_TEXTURE_FLAG_SUBSAMPLED      = 1u << 3,
+
+    /// The texture is a transient resource whose memory may alias the memory of other
+    /// transient textures with non-overlapping lifetimes.
+
+    /// \remarks Transient textures can only be created by IRenderDeviceVk::CreateTransientTexture().
+    ///          The contents of a transient texture are undefined when it is first used,
+    ///          and an aliasing barrier must be issued before switching between textures
+    ///          that share the same memory.
+    MISC_TEXTURE_FLAG_TRANSIENT       = 1u << 4
 };
 DEFINE_FLAG_ENUM_OPERATORS(MISC_TEXTURE_FLAGS)
 
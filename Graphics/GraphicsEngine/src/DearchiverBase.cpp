@@ -27,6 +27,12 @@
 #include "DearchiverBase.hpp"
 #include "PipelineStateBase.hpp"
 #include "PSOSerializer.hpp"
+#include "FrameArena.hpp"
+#include "ThreadPool.hpp"
+#include "HashUtils.hpp"
+
+#include <tuple>
+#include <unordered_set>
 
 namespace Diligent
 {
@@ -154,7 +160,7 @@ bool DearchiverBase::NamedResourceCache<ResType>::Get(ResourceType Type, const c
 
     std::unique_lock<std::mutex> Lock{m_Mtx};
 
-    auto it = m_Map.find(NamedResourceKey{Type, Name});
+    auto it = m_Map.find(ResourceKey{Type, Name});
     if (it == m_Map.end())
         return false;
 
@@ -173,7 +179,7 @@ void DearchiverBase::NamedResourceCache<ResType>::Set(ResourceType Type, const c
     VERIFY_EXPR(pResource != nullptr);
 
     std::unique_lock<std::mutex> Lock{m_Mtx};
-    m_Map.emplace(NamedResourceKey{Type, Name, /*CopyName = */ true}, pResource);
+    m_Map.emplace(ResourceKey{Type, Name, /*CopyName = */ true}, pResource);
 }
 
 // Instantiation is required by UnpackResourceSignatureImpl
@@ -404,32 +410,98 @@ void DearchiverBase::PSOData<RayTracingPipelineStateCreateInfo>::CreatePipeline(
     pDevice->CreateRayTracingPipelineState(CreateInfo, ppPSO);
 }
 
-template <typename CreateInfoType>
-bool DearchiverBase::UnpackPSOShaders(ArchiveData&             Archive,
-                                      PSOData<CreateInfoType>& PSO,
-                                      IRenderDevice*           pDevice)
+bool DearchiverBase::ReadPSOShaderIndices(const DeviceObjectArchive&             Archive,
+                                          ResourceType                           ResType,
+                                          const char*                            PSOName,
+                                          DeviceType                             DevType,
+                                          DeviceObjectArchive::ShaderIndexArray& ShaderIndices,
+                                          DynamicLinearAllocator&                Allocator)
 {
-    const auto& pObjArchive = Archive.pObjArchive;
-    VERIFY_EXPR(pObjArchive);
-    const auto  DevType       = GetArchiveDeviceType(pDevice);
-    const auto& ShaderIdxData = pObjArchive->GetDeviceSpecificData(PSO.ArchiveResType, PSO.CreateInfo.PSODesc.Name, DevType);
+    const auto& ShaderIdxData = Archive.GetDeviceSpecificData(ResType, PSOName, DevType);
     if (!ShaderIdxData)
         return false;
 
-    DynamicLinearAllocator Allocator{GetRawAllocator()};
+    Serializer<SerializerMode::Read> Ser{ShaderIdxData};
+    if (!PSOSerializer<SerializerMode::Read>::SerializeShaderIndices(Ser, ShaderIndices, &Allocator))
+    {
+        LOG_ERROR_MESSAGE("Failed to deserialize PSO shader indices. Archive file may be corrupted or invalid.");
+        return false;
+    }
+    VERIFY(Ser.IsEnded(), "No other data besides shader indices is expected");
 
-    DeviceObjectArchive::ShaderIndexArray ShaderIndices;
+    return true;
+}
+
+RefCntAutoPtr<IShader> DearchiverBase::GetCachedShader(ArchiveData& Archive, DeviceType DevType, Uint32 Idx)
+{
+    auto& ShaderCache = Archive.CachedShaders[static_cast<size_t>(DevType)];
+
+    std::unique_lock<std::mutex> ReadLock{ShaderCache.Mtx};
+    return Idx < ShaderCache.Shaders.size() ? ShaderCache.Shaders[Idx] : RefCntAutoPtr<IShader>{};
+}
+
+RefCntAutoPtr<IShader> DearchiverBase::UnpackArchivedShader(ArchiveData&   Archive,
+                                                            DeviceType     DevType,
+                                                            Uint32         Idx,
+                                                            IRenderDevice* pDevice,
+                                                            bool           SkipReflection)
+{
+    const auto& pObjArchive = Archive.pObjArchive;
+    VERIFY_EXPR(pObjArchive);
+
+    // Compressed shaders are decoded into the thread-local scratch memory
+    FrameArena::Scope ScratchScope;
+
+    const auto& SerializedShader = pObjArchive->GetSerializedShader(DevType, Idx, &ScratchScope.GetAllocator());
+    if (!SerializedShader)
+        return {};
+
+    ShaderCreateInfo ShaderCI;
     {
-        Serializer<SerializerMode::Read> Ser{ShaderIdxData};
-        if (!PSOSerializer<SerializerMode::Read>::SerializeShaderIndices(Ser, ShaderIndices, &Allocator))
+        Serializer<SerializerMode::Read> ShaderSer{SerializedShader};
+        if (!ShaderSerializer<SerializerMode::Read>::SerializeCI(ShaderSer, ShaderCI))
         {
-            LOG_ERROR_MESSAGE("Failed to deserialize PSO shader indices. Archive file may be corrupted or invalid.");
-            return false;
+            LOG_ERROR_MESSAGE("Failed to deserialize shader create info. Archive file may be corrupted or invalid.");
+            return {};
         }
-        VERIFY(Ser.IsEnded(), "No other data besides shader indices is expected");
+        VERIFY_EXPR(ShaderSer.IsEnded());
     }
 
-    auto& ShaderCache = Archive.CachedShaders[static_cast<size_t>(DevType)];
+    if (SkipReflection)
+        ShaderCI.CompileFlags |= SHADER_COMPILE_FLAG_SKIP_REFLECTION;
+
+    auto pShader = UnpackShader(ShaderCI, pDevice);
+    if (!pShader)
+        return {};
+
+    // Add to the cache
+    {
+        auto& ShaderCache = Archive.CachedShaders[static_cast<size_t>(DevType)];
+
+        std::unique_lock<std::mutex> WriteLock{ShaderCache.Mtx};
+        if (Idx >= ShaderCache.Shaders.size())
+            ShaderCache.Shaders.resize(size_t{Idx} + 1);
+        ShaderCache.Shaders[Idx] = pShader;
+    }
+
+    return pShader;
+}
+
+template <typename CreateInfoType>
+bool DearchiverBase::UnpackPSOShaders(ArchiveData&             Archive,
+                                      PSOData<CreateInfoType>& PSO,
+                                      IRenderDevice*           pDevice)
+{
+    VERIFY_EXPR(Archive.pObjArchive);
+    const auto DevType = GetArchiveDeviceType(pDevice);
+
+    FrameArena::Scope ScratchScope;
+
+    DeviceObjectArchive::ShaderIndexArray ShaderIndices;
+    if (!ReadPSOShaderIndices(*Archive.pObjArchive, PSO.ArchiveResType, PSO.CreateInfo.PSODesc.Name, DevType, ShaderIndices, ScratchScope.GetAllocator()))
+        return false;
+
+    const bool SkipReflection = (PSO.InternalCI.Flags & PSO_CREATE_INTERNAL_FLAG_NO_SHADER_REFLECTION) != 0;
 
     PSO.Shaders.resize(ShaderIndices.Count);
     for (Uint32 i = 0; i < ShaderIndices.Count; ++i)
@@ -438,48 +510,14 @@ bool DearchiverBase::UnpackPSOShaders(ArchiveData&             Archive,
 
         const Uint32 Idx = ShaderIndices.pIndices[i];
 
-        {
-            std::unique_lock<std::mutex> ReadLock{ShaderCache.Mtx};
-            if (Idx < ShaderCache.Shaders.size())
-            {
-                // Try to get cached shader
-                pShader = ShaderCache.Shaders[Idx];
-                if (pShader)
-                    continue;
-            }
-        }
+        // Try to get cached shader
+        pShader = GetCachedShader(Archive, DevType, Idx);
+        if (pShader)
+            continue;
 
-        const auto& SerializedShader = pObjArchive->GetSerializedShader(DevType, Idx);
-        if (!SerializedShader)
+        pShader = UnpackArchivedShader(Archive, DevType, Idx, pDevice, SkipReflection);
+        if (!pShader)
             return false;
-
-        {
-            ShaderCreateInfo ShaderCI;
-            {
-                Serializer<SerializerMode::Read> ShaderSer{SerializedShader};
-                if (!ShaderSerializer<SerializerMode::Read>::SerializeCI(ShaderSer, ShaderCI))
-                {
-                    LOG_ERROR_MESSAGE("Failed to deserialize shader create info. Archive file may be corrupted or invalid.");
-                    return false;
-                }
-                VERIFY_EXPR(ShaderSer.IsEnded());
-            }
-
-            if ((PSO.InternalCI.Flags & PSO_CREATE_INTERNAL_FLAG_NO_SHADER_REFLECTION) != 0)
-                ShaderCI.CompileFlags |= SHADER_COMPILE_FLAG_SKIP_REFLECTION;
-
-            pShader = UnpackShader(ShaderCI, pDevice);
-            if (!pShader)
-                return false;
-        }
-
-        // Add to the cache
-        {
-            std::unique_lock<std::mutex> WriteLock{ShaderCache.Mtx};
-            if (Idx >= ShaderCache.Shaders.size())
-                ShaderCache.Shaders.resize(size_t{Idx} + 1);
-            ShaderCache.Shaders[Idx] = pShader;
-        }
     }
 
     return true;
@@ -490,18 +528,21 @@ DearchiverBase::ArchiveData* DearchiverBase::FindArchive(ResourceType ResType, c
     VERIFY_EXPR(ResType != ResourceType::Undefined);
     VERIFY_EXPR(ResName != nullptr);
 
-    const auto archive_idx_it = m_ResNameToArchiveIdx.find(NamedResourceKey{ResType, ResName});
-    if (archive_idx_it == m_ResNameToArchiveIdx.end())
-        return nullptr;
-
-    auto& Archive = m_Archives[archive_idx_it->second];
-    if (!Archive.pObjArchive)
+    // Every archive keeps a sorted resource index, so the lookup does not require
+    // building a combined name map when archives are loaded.
+    for (auto& Archive : m_Archives)
     {
-        UNEXPECTED("Null object archives should never be added to the list. This is a bug.");
-        return nullptr;
+        if (!Archive.pObjArchive)
+        {
+            UNEXPECTED("Null object archives should never be added to the list. This is a bug.");
+            continue;
+        }
+
+        if (Archive.pObjArchive->HasResource(ResType, ResName))
+            return &Archive;
     }
 
-    return &Archive;
+    return nullptr;
 }
 
 template <typename PSOCreateInfoType>
@@ -590,30 +631,19 @@ static bool ModifyPipelineStateCreateInfo(PSOCreateInfoType&             CreateI
 }
 
 template <typename CreateInfoType>
-void DearchiverBase::UnpackPipelineStateImpl(const PipelineStateUnpackInfo& UnpackInfo,
-                                             IPipelineState**               ppPSO)
+bool DearchiverBase::LoadPSOData(const PipelineStateUnpackInfo& UnpackInfo,
+                                 PSOData<CreateInfoType>&       PSO,
+                                 ArchiveData*&                  pArchiveData)
 {
-    VERIFY_EXPR(UnpackInfo.pDevice != nullptr);
-
     constexpr auto ResType = PSOData<CreateInfoType>::ArchiveResType;
 
-    // Do not cache modified PSOs
-    if (UnpackInfo.ModifyPipelineStateCreateInfo == nullptr)
-    {
-        // Since PSO names must be unique (for each PSO type), we use a single cache for all
-        // loaded archives.
-        if (m_Cache.PSO.Get(ResType, UnpackInfo.Name, ppPSO))
-            return;
-    }
-
     // Find the archive that contains this PSO
-    auto* pArchiveData = FindArchive(ResType, UnpackInfo.Name);
+    pArchiveData = FindArchive(ResType, UnpackInfo.Name);
     if (pArchiveData == nullptr)
-        return;
+        return false;
 
-    PSOData<CreateInfoType> PSO{GetRawAllocator()};
     if (!pArchiveData->pObjArchive->LoadResourceCommonData(ResType, UnpackInfo.Name, PSO))
-        return;
+        return false;
 
 #ifdef DILIGENT_DEVELOPMENT
     if (UnpackInfo.pDevice->GetDeviceInfo().IsD3DDevice())
@@ -625,14 +655,19 @@ void DearchiverBase::UnpackPipelineStateImpl(const PipelineStateUnpackInfo& Unpa
 #endif
 
     if (!UnpackPSORenderPass(PSO, UnpackInfo.pDevice))
-        return;
+        return false;
 
     if (!UnpackPSOSignatures(PSO, UnpackInfo.pDevice))
-        return;
+        return false;
 
-    if (!UnpackPSOShaders(*pArchiveData, PSO, UnpackInfo.pDevice))
-        return;
+    return true;
+}
 
+template <typename CreateInfoType>
+void DearchiverBase::CreatePipelineState(PSOData<CreateInfoType>&       PSO,
+                                         const PipelineStateUnpackInfo& UnpackInfo,
+                                         IPipelineState**               ppPSO)
+{
     PSO.AssignShaders();
 
     PSO.CreateInfo.PSODesc.SRBAllocationGranularity = UnpackInfo.SRBAllocationGranularity;
@@ -644,8 +679,197 @@ void DearchiverBase::UnpackPipelineStateImpl(const PipelineStateUnpackInfo& Unpa
 
     PSO.CreatePipeline(UnpackInfo.pDevice, ppPSO);
 
+    if (UnpackInfo.ModifyPipelineStateCreateInfo == nullptr && *ppPSO != nullptr)
+        m_Cache.PSO.Set(PSO.ArchiveResType, UnpackInfo.Name, *ppPSO);
+}
+
+template <typename CreateInfoType>
+void DearchiverBase::UnpackPipelineStateImpl(const PipelineStateUnpackInfo& UnpackInfo,
+                                             IPipelineState**               ppPSO)
+{
+    VERIFY_EXPR(UnpackInfo.pDevice != nullptr);
+
+    constexpr auto ResType = PSOData<CreateInfoType>::ArchiveResType;
+
+    // Do not cache modified PSOs
     if (UnpackInfo.ModifyPipelineStateCreateInfo == nullptr)
-        m_Cache.PSO.Set(ResType, UnpackInfo.Name, *ppPSO);
+    {
+        // Since PSO names must be unique (for each PSO type), we use a single cache for all
+        // loaded archives.
+        if (m_Cache.PSO.Get(ResType, UnpackInfo.Name, ppPSO))
+            return;
+    }
+
+    ArchiveData*            pArchiveData = nullptr;
+    PSOData<CreateInfoType> PSO{GetRawAllocator()};
+    if (!LoadPSOData(UnpackInfo, PSO, pArchiveData))
+        return;
+
+    if (!UnpackPSOShaders(*pArchiveData, PSO, UnpackInfo.pDevice))
+        return;
+
+    CreatePipelineState(PSO, UnpackInfo, ppPSO);
+}
+
+
+struct DearchiverBase::PSOBatch
+{
+    template <typename CreateInfoType>
+    struct PendingPSO
+    {
+        PendingPSO(IMemoryAllocator& Allocator, Uint32 _Idx) :
+            Data{Allocator},
+            Idx{_Idx}
+        {}
+
+        PSOData<CreateInfoType> Data;
+
+        // Index of the PSO in the batch
+        const Uint32 Idx;
+
+        ArchiveData* pArchive = nullptr;
+        DeviceType   DevType  = DeviceType::Count;
+
+        DeviceObjectArchive::ShaderIndexArray ShaderIndices;
+    };
+
+    template <typename CreateInfoType>
+    using PendingPSOList = std::vector<std::unique_ptr<PendingPSO<CreateInfoType>>>;
+
+    struct ShaderKey
+    {
+        const ArchiveData* pArchive;
+        DeviceType         DevType;
+        Uint32             Idx;
+
+        bool operator==(const ShaderKey& rhs) const
+        {
+            return pArchive == rhs.pArchive && DevType == rhs.DevType && Idx == rhs.Idx;
+        }
+
+        struct Hasher
+        {
+            size_t operator()(const ShaderKey& Key) const
+            {
+                return ComputeHash(Key.pArchive, static_cast<Uint32>(Key.DevType), Key.Idx);
+            }
+        };
+    };
+
+    struct ShaderTask
+    {
+        ArchiveData*   pArchive;
+        DeviceType     DevType;
+        Uint32         Idx;
+        IRenderDevice* pDevice;
+        bool           SkipReflection;
+    };
+
+    PSOBatch(const PipelineStateUnpackInfo* _pUnpackInfos, IPipelineState** _ppPSOs) :
+        pUnpackInfos{_pUnpackInfos},
+        ppPSOs{_ppPSOs}
+    {}
+
+    template <typename CreateInfoType>
+    PendingPSOList<CreateInfoType>& GetPSOs()
+    {
+        return std::get<PendingPSOList<CreateInfoType>>(PSOs);
+    }
+
+    void AddShader(ArchiveData* pArchive, DeviceType DevType, Uint32 Idx, IRenderDevice* pDevice, bool SkipReflection)
+    {
+        if (UniqueShaders.emplace(ShaderKey{pArchive, DevType, Idx}).second)
+            Shaders.emplace_back(ShaderTask{pArchive, DevType, Idx, pDevice, SkipReflection});
+    }
+
+    const PipelineStateUnpackInfo* const pUnpackInfos;
+    IPipelineState** const               ppPSOs;
+
+    std::tuple<PendingPSOList<GraphicsPipelineStateCreateInfo>,
+               PendingPSOList<ComputePipelineStateCreateInfo>,
+               PendingPSOList<TilePipelineStateCreateInfo>,
+               PendingPSOList<RayTracingPipelineStateCreateInfo>>
+        PSOs;
+
+    // Shaders that are not in the cache and need to be unpacked
+    std::vector<ShaderTask>                                      Shaders;
+    std::unordered_set<ShaderKey, ShaderKey::Hasher>             UniqueShaders;
+    std::unordered_map<ResourceKey, Uint32, ResourceKey::Hasher> UniquePSOs;
+
+    // PSOs that are requested multiple times: {Index, Index of the first occurrence}
+    std::vector<std::pair<Uint32, Uint32>> Duplicates;
+};
+
+template <typename CreateInfoType>
+void DearchiverBase::AddPipelineStateToBatch(PSOBatch& Batch, Uint32 Idx)
+{
+    const auto& UnpackInfo = Batch.pUnpackInfos[Idx];
+    VERIFY_EXPR(UnpackInfo.pDevice != nullptr);
+
+    constexpr auto ResType = PSOData<CreateInfoType>::ArchiveResType;
+
+    if (UnpackInfo.ModifyPipelineStateCreateInfo == nullptr)
+    {
+        if (m_Cache.PSO.Get(ResType, UnpackInfo.Name, &Batch.ppPSOs[Idx]))
+            return;
+
+        // Unpack every unmodified PSO only once
+        auto it_inserted = Batch.UniquePSOs.emplace(ResourceKey{ResType, UnpackInfo.Name}, Idx);
+        if (!it_inserted.second)
+        {
+            Batch.Duplicates.emplace_back(Idx, it_inserted.first->second);
+            return;
+        }
+    }
+
+    // Render passes and signatures are unpacked by the calling thread, so that
+    // all PSOs in the batch share the same objects.
+    auto  pPendingPSO = std::make_unique<PSOBatch::PendingPSO<CreateInfoType>>(GetRawAllocator(), Idx);
+    auto& PSO         = pPendingPSO->Data;
+    if (!LoadPSOData(UnpackInfo, PSO, pPendingPSO->pArchive))
+        return;
+
+    pPendingPSO->DevType = GetArchiveDeviceType(UnpackInfo.pDevice);
+    if (!ReadPSOShaderIndices(*pPendingPSO->pArchive->pObjArchive, ResType, UnpackInfo.Name, pPendingPSO->DevType, pPendingPSO->ShaderIndices, PSO.Allocator))
+        return;
+
+    const bool SkipReflection = (PSO.InternalCI.Flags & PSO_CREATE_INTERNAL_FLAG_NO_SHADER_REFLECTION) != 0;
+    for (Uint32 i = 0; i < pPendingPSO->ShaderIndices.Count; ++i)
+    {
+        const Uint32 ShaderIdx = pPendingPSO->ShaderIndices.pIndices[i];
+        if (!GetCachedShader(*pPendingPSO->pArchive, pPendingPSO->DevType, ShaderIdx))
+            Batch.AddShader(pPendingPSO->pArchive, pPendingPSO->DevType, ShaderIdx, UnpackInfo.pDevice, SkipReflection);
+    }
+
+    Batch.GetPSOs<CreateInfoType>().emplace_back(std::move(pPendingPSO));
+}
+
+template <typename CreateInfoType>
+void DearchiverBase::CreateBatchPipelineStates(PSOBatch& Batch)
+{
+    for (auto& pPendingPSO : Batch.GetPSOs<CreateInfoType>())
+    {
+        auto& PSO = pPendingPSO->Data;
+
+        const auto& ShaderIndices = pPendingPSO->ShaderIndices;
+        PSO.Shaders.resize(ShaderIndices.Count);
+
+        bool AllShadersUnpacked = true;
+        for (Uint32 i = 0; i < ShaderIndices.Count && AllShadersUnpacked; ++i)
+        {
+            // All shaders have been added to the cache by now
+            PSO.Shaders[i]     = GetCachedShader(*pPendingPSO->pArchive, pPendingPSO->DevType, ShaderIndices.pIndices[i]);
+            AllShadersUnpacked = PSO.Shaders[i] != nullptr;
+        }
+        if (!AllShadersUnpacked)
+            continue;
+
+        // Pipeline initialization will be performed by the shader compilation thread pool
+        PSO.CreateInfo.Flags |= PSO_CREATE_FLAG_ASYNCHRONOUS;
+
+        const auto& UnpackInfo = Batch.pUnpackInfos[pPendingPSO->Idx];
+        CreatePipelineState(PSO, UnpackInfo, &Batch.ppPSOs[pPendingPSO->Idx]);
+    }
 }
 
 bool DearchiverBase::LoadArchive(const IDataBlob* pArchiveData, Uint32 ContentVersion, bool MakeCopy)
@@ -664,31 +888,9 @@ bool DearchiverBase::LoadArchive(const IDataBlob* pArchiveData, Uint32 ContentVe
             }
         }
 
-        auto       pObjArchive = std::make_unique<DeviceObjectArchive>(DeviceObjectArchive::CreateInfo{pArchiveData, ContentVersion, MakeCopy});
-        const auto ArchiveIdx  = m_Archives.size();
-
-        const auto& ArchiveResources = pObjArchive->GetNamedResources();
-        for (const auto& it : ArchiveResources)
-        {
-            const auto     ResType      = it.first.GetType();
-            const auto*    ResName      = it.first.GetName();
-            constexpr auto MakeNameCopy = true;
-
-            const auto it_inserted = m_ResNameToArchiveIdx.emplace(NamedResourceKey{ResType, ResName, MakeNameCopy}, ArchiveIdx);
-            if (!it_inserted.second)
-            {
-                const auto& OtherArchiveResources = m_Archives[it_inserted.first->second].pObjArchive->GetNamedResources();
-                const auto  it_other              = OtherArchiveResources.find(NamedResourceKey{ResType, ResName});
-
-                const auto IsDuplicate =
-                    (it_other != OtherArchiveResources.end()) &&
-                    (it.second == it_other->second);
-                if (!IsDuplicate)
-                {
-                    LOG_ERROR_MESSAGE("Resource with name '", ResName, "' already exists in the archive.");
-                }
-            }
-        }
+        // Only the archive header and index are read here. Resources are decoded from
+        // the archive data when they are unpacked.
+        auto pObjArchive = std::make_unique<DeviceObjectArchive>(DeviceObjectArchive::CreateInfo{pArchiveData, ContentVersion, MakeCopy});
 
         m_Archives.emplace_back(std::move(pObjArchive));
 
@@ -734,6 +936,77 @@ void DearchiverBase::UnpackPipelineState(const PipelineStateUnpackInfo& UnpackIn
     }
 }
 
+void DearchiverBase::UnpackPipelineStates(const PipelineStateUnpackInfo* pUnpackInfos,
+                                          Uint32                         NumPSOs,
+                                          IPipelineState**               ppPSOs)
+{
+    if (NumPSOs == 0)
+        return;
+
+    DEV_CHECK_ERR(pUnpackInfos != nullptr, "pUnpackInfos must not be null");
+    DEV_CHECK_ERR(ppPSOs != nullptr, "ppPSOs must not be null");
+    if (pUnpackInfos == nullptr || ppPSOs == nullptr)
+        return;
+
+    PSOBatch Batch{pUnpackInfos, ppPSOs};
+
+    // Load PSO data and unpack render passes and resource signatures.
+    // Objects shared by multiple PSOs are unpacked once and are then found in the cache.
+    for (Uint32 i = 0; i < NumPSOs; ++i)
+    {
+        const auto& UnpackInfo = pUnpackInfos[i];
+        if (!VerifyPipelineStateUnpackInfo(UnpackInfo, &ppPSOs[i]))
+            continue;
+
+        ppPSOs[i] = nullptr;
+
+        switch (UnpackInfo.PipelineType)
+        {
+            case PIPELINE_TYPE_GRAPHICS:
+            case PIPELINE_TYPE_MESH:
+                AddPipelineStateToBatch<GraphicsPipelineStateCreateInfo>(Batch, i);
+                break;
+
+            case PIPELINE_TYPE_COMPUTE:
+                AddPipelineStateToBatch<ComputePipelineStateCreateInfo>(Batch, i);
+                break;
+
+            case PIPELINE_TYPE_RAY_TRACING:
+                AddPipelineStateToBatch<RayTracingPipelineStateCreateInfo>(Batch, i);
+                break;
+
+            case PIPELINE_TYPE_TILE:
+                AddPipelineStateToBatch<TilePipelineStateCreateInfo>(Batch, i);
+                break;
+
+            case PIPELINE_TYPE_INVALID:
+            default:
+                LOG_ERROR_MESSAGE("Unsupported pipeline type");
+        }
+    }
+
+    // Unpack all unique shaders in parallel
+    IThreadPool* pThreadPool = pUnpackInfos[0].pDevice != nullptr ? pUnpackInfos[0].pDevice->GetShaderCompilationThreadPool() : nullptr;
+    ProcessInParallel(pThreadPool, static_cast<Uint32>(Batch.Shaders.size()),
+                      [&](Uint32 Item) {
+                          const auto& Task = Batch.Shaders[Item];
+                          UnpackArchivedShader(*Task.pArchive, Task.DevType, Task.Idx, Task.pDevice, Task.SkipReflection);
+                      });
+
+    CreateBatchPipelineStates<GraphicsPipelineStateCreateInfo>(Batch);
+    CreateBatchPipelineStates<ComputePipelineStateCreateInfo>(Batch);
+    CreateBatchPipelineStates<TilePipelineStateCreateInfo>(Batch);
+    CreateBatchPipelineStates<RayTracingPipelineStateCreateInfo>(Batch);
+
+    for (const auto& Duplicate : Batch.Duplicates)
+    {
+        IPipelineState* pPSO = ppPSOs[Duplicate.second];
+        if (pPSO != nullptr)
+            pPSO->AddRef();
+        ppPSOs[Duplicate.first] = pPSO;
+    }
+}
+
 static bool ModifyShaderDesc(ShaderDesc&             Desc,
                              const ShaderUnpackInfo& UnpackInfo)
 {
@@ -787,7 +1060,9 @@ void DearchiverBase::UnpackShader(const ShaderUnpackInfo& UnpackInfo,
         VERIFY_EXPR(Ser.IsEnded());
     }
 
-    const auto& SerializedShader = pObjArchive->GetSerializedShader(DevType, Idx);
+    FrameArena::Scope ScratchScope;
+
+    const auto& SerializedShader = pObjArchive->GetSerializedShader(DevType, Idx, &ScratchScope.GetAllocator());
     if (!SerializedShader)
         return;
 
@@ -429,10 +429,13 @@ static bool VerifyAliasingBarrierDesc(const StateTransitionDesc& Barrier)
         if (RefCntAutoPtr<ITexture> pTexture{pResource, IID_Texture})
         {
             const auto& TexDesc = pTexture->GetDesc();
-            DEV_CHECK_ERR(TexDesc.Usage == USAGE_SPARSE,
-                          "Texture '", TexDesc.Name, "' used in an aliasing barrier is not a sparse resource");
-            DEV_CHECK_ERR((TexDesc.MiscFlags & MISC_TEXTURE_FLAG_SPARSE_ALIASING) != 0,
-                          "Texture '", TexDesc.Name, "' used in an aliasing barrier was not created with MISC_TEXTURE_FLAG_SPARSE_ALIASING flag");
+            if ((TexDesc.MiscFlags & MISC_TEXTURE_FLAG_TRANSIENT) == 0)
+            {
+                DEV_CHECK_ERR(TexDesc.Usage == USAGE_SPARSE,
+                              "Texture '", TexDesc.Name, "' used in an aliasing barrier is neither a sparse nor a transient resource");
+                DEV_CHECK_ERR((TexDesc.MiscFlags & MISC_TEXTURE_FLAG_SPARSE_ALIASING) != 0,
+                              "Texture '", TexDesc.Name, "' used in an aliasing barrier was not created with MISC_TEXTURE_FLAG_SPARSE_ALIASING flag");
+            }
 
             return TexDesc.Type;
         }
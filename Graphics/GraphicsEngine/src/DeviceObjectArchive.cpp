@@ -27,12 +27,14 @@
 #include "DeviceObjectArchive.hpp"
 
 #include <algorithm>
+#include <cstring>
 #include <sstream>
 
 #include "Shader.h"
 #include "EngineMemory.h"
 #include "DataBlobImpl.hpp"
 #include "PSOSerializer.hpp"
+#include "LZ4Codec.hpp"
 
 namespace Diligent
 {
@@ -83,7 +85,6 @@ struct ArchiveSerializer
 
     using ArchiveHeader = DeviceObjectArchive::ArchiveHeader;
     using ResourceData  = DeviceObjectArchive::ResourceData;
-    using ShadersVector = std::vector<SerializedData>;
 
     bool SerializeHeader(ConstQual<ArchiveHeader>& Header) const
     {
@@ -105,45 +106,95 @@ struct ArchiveSerializer
 
         return true;
     }
-
-    bool SerializeShaders(ConstQual<ShadersVector>& Shaders) const;
 };
 
-template <SerializerMode Mode>
-bool ArchiveSerializer<Mode>::SerializeShaders(ConstQual<ShadersVector>& Shaders) const
-{
-    static_assert(Mode == SerializerMode::Measure || Mode == SerializerMode::Write, "Measure or Write mode is expected.");
+// Alignment of resource and shader data in the archive
+constexpr size_t ArchiveDataAlignment = 8;
 
-    Uint32 NumShaders = static_cast<Uint32>(Shaders.size());
-    if (!Ser(NumShaders))
+template <typename EntryType>
+bool ReadIndex(Serializer<SerializerMode::Read>& Reader, const EntryType*& pEntries, Uint32& Count)
+{
+    const void* pData = nullptr;
+    size_t      Size  = 0;
+    if (!Reader.SerializeBytes(pData, Size, alignof(EntryType)))
         return false;
 
-    for (const auto& Shader : Shaders)
-    {
-        if (!Ser.Serialize(Shader))
-            return false;
-    }
+    if (Size % sizeof(EntryType) != 0)
+        return false;
 
+    pEntries = static_cast<const EntryType*>(pData);
+    Count    = static_cast<Uint32>(Size / sizeof(EntryType));
     return true;
 }
 
-template <>
-bool ArchiveSerializer<SerializerMode::Read>::SerializeShaders(ShadersVector& Shaders) const
+bool IsValidRange(Uint64 Offset, Uint64 Size, size_t ArchiveSize)
+{
+    return Offset <= ArchiveSize && Size <= ArchiveSize - Offset;
+}
+
+// Reads the shader indices from the device-specific data of the resource.
+// Returns false if the resource does not reference shaders.
+bool ReadShaderIndices(DeviceObjectArchive::ResourceType Type, const SerializedData& DeviceData, std::vector<Uint32>& Indices) noexcept(false)
 {
-    Uint32 NumShaders = 0;
-    if (!Ser(NumShaders))
+    using ResourceType = DeviceObjectArchive::ResourceType;
+    static_assert(static_cast<size_t>(ResourceType::Count) == 8, "Did you add a new resource type? You may need to handle it here.");
+
+    Indices.clear();
+    if (!DeviceData)
         return false;
 
-    Shaders.resize(NumShaders);
-    for (auto& Shader : Shaders)
+    const auto IsStandaloneShader = (Type == ResourceType::StandaloneShader);
+    const auto IsPipeline =
+        (Type == ResourceType::GraphicsPipeline ||
+         Type == ResourceType::ComputePipeline ||
+         Type == ResourceType::RayTracingPipeline ||
+         Type == ResourceType::TilePipeline);
+
+    Serializer<SerializerMode::Read> Ser{DeviceData};
+    if (IsStandaloneShader)
     {
-        if (!Ser.Serialize(Shader))
-            return false;
+        // For shaders, device-specific data is the serialized shader bytecode index
+        Uint32 ShaderIndex = 0;
+        if (!Ser(ShaderIndex))
+            LOG_ERROR_AND_THROW("Failed to deserialize standalone shader index. Archive file may be corrupted or invalid.");
+        VERIFY(Ser.IsEnded(), "No other data besides the shader index is expected");
+        Indices.push_back(ShaderIndex);
+    }
+    else if (IsPipeline)
+    {
+        // For pipelines, device-specific data is the shader index array
+        DynamicLinearAllocator                Allocator{GetRawAllocator()};
+        DeviceObjectArchive::ShaderIndexArray ShaderIndices;
+        if (!PSOSerializer<SerializerMode::Read>::SerializeShaderIndices(Ser, ShaderIndices, &Allocator))
+            LOG_ERROR_AND_THROW("Failed to deserialize PSO shader indices. Archive file may be corrupted or invalid.");
+        VERIFY(Ser.IsEnded(), "No other data besides shader indices is expected");
+        Indices.assign(ShaderIndices.pIndices, ShaderIndices.pIndices + ShaderIndices.Count);
+    }
+    else
+    {
+        return false;
     }
 
     return true;
 }
 
+// Writes the shader indices read by ReadShaderIndices() back to the device-specific data.
+void WriteShaderIndices(DeviceObjectArchive::ResourceType Type, SerializedData& DeviceData, const std::vector<Uint32>& Indices)
+{
+    Serializer<SerializerMode::Write> Ser{DeviceData};
+    if (Type == DeviceObjectArchive::ResourceType::StandaloneShader)
+    {
+        VERIFY_EXPR(Indices.size() == 1);
+        Ser(Indices[0]);
+    }
+    else
+    {
+        const DeviceObjectArchive::ShaderIndexArray ShaderIndices{Indices.data(), static_cast<Uint32>(Indices.size())};
+        PSOSerializer<SerializerMode::Write>::SerializeShaderIndices(Ser, ShaderIndices, nullptr);
+    }
+    VERIFY_EXPR(Ser.IsEnded());
+}
+
 } // namespace
 
 DeviceObjectArchive::DeviceObjectArchive(Uint32 ContentVersion) noexcept :
@@ -153,10 +204,13 @@ DeviceObjectArchive::DeviceObjectArchive(Uint32 ContentVersion) noexcept :
 
 void DeviceObjectArchive::Deserialize(const CreateInfo& CI) noexcept(false)
 {
+    VERIFY(m_pArchiveData, "Archive data must be initialized by the constructor");
+    // The index and resources reference the archive data that we keep alive,
+    // so always use m_pArchiveData, which may be a copy of CI.pData.
     Serializer<SerializerMode::Read> Reader{
         SerializedData{
-            const_cast<void*>(CI.pData->GetConstDataPtr()),
-            CI.pData->GetSize(),
+            const_cast<void*>(m_pArchiveData->GetConstDataPtr()),
+            m_pArchiveData->GetSize(),
         },
     };
     ArchiveSerializer<SerializerMode::Read> ArchiveReader{Reader};
@@ -189,34 +243,61 @@ void DeviceObjectArchive::Deserialize(const CreateInfo& CI) noexcept(false)
     if (!ArchiveReader.Ser(Header.GitHash))
         LOG_ERROR_AND_THROW("Failed to read Git Hash.");
 
-    Uint32 NumResources = 0;
-    if (!Reader(NumResources))
-        LOG_ERROR_AND_THROW("Failed to read the number of named resources in the device object archive.");
+    const auto* pArchiveData = static_cast<const Uint8*>(m_pArchiveData->GetConstDataPtr());
+    const auto  ArchiveSize  = m_pArchiveData->GetSize();
 
-    for (Uint32 res = 0; res < NumResources; ++res)
-    {
-        const char*  Name    = nullptr;
-        ResourceType ResType = ResourceType::Undefined;
-        if (!Reader(ResType, Name))
-            LOG_ERROR_AND_THROW("Failed to read the type and name of resource ", res, "/", NumResources, '.');
-        VERIFY_EXPR(Name != nullptr);
+    ArchiveFooter Footer;
+    if (ArchiveSize < Reader.GetSize() + sizeof(Footer))
+        LOG_ERROR_AND_THROW("Failed to read device object archive footer.");
+    memcpy(&Footer, pArchiveData + ArchiveSize - sizeof(Footer), sizeof(Footer));
 
-        // No need to make the name copy as we keep the source data blob alive.
-        constexpr auto MakeNameCopy = false;
-        auto&          ResData      = m_NamedResources[NamedResourceKey{ResType, Name, MakeNameCopy}];
+    if (Footer.MagicNumber != FooterMagicNumber)
+        LOG_ERROR_AND_THROW("Invalid device object archive footer.");
 
-        if (!ArchiveReader.SerializeResourceData(ResData))
-            LOG_ERROR_AND_THROW("Failed to read data of resource '", Name, "'.");
-    }
+    const auto IndexEnd = ArchiveSize - sizeof(Footer);
+    if (Footer.IndexOffset < Reader.GetSize() || Footer.IndexOffset > IndexEnd || Footer.IndexOffset % ArchiveDataAlignment != 0)
+        LOG_ERROR_AND_THROW("Invalid index offset in the device object archive footer.");
 
-    for (auto& Shaders : m_DeviceShaders)
+    m_IndexOffset  = Footer.IndexOffset;
+    m_DeadDataSize = Footer.DeadDataSize;
+
+    // The index is not copied and references the archive data.
+    // Resources are decoded on demand when they are requested.
+    Serializer<SerializerMode::Read> IndexReader{
+        SerializedData{
+            const_cast<Uint8*>(pArchiveData + Footer.IndexOffset),
+            static_cast<size_t>(IndexEnd - Footer.IndexOffset),
+        },
+    };
+    if (!ReadIndex(IndexReader, m_ResourceIndex.pEntries, m_ResourceIndex.Count))
+        LOG_ERROR_AND_THROW("Failed to read the resource index from the device object archive.");
+
+    for (auto& ShaderIndex : m_ShaderIndices)
     {
-        if (!ArchiveReader.SerializeShaders(Shaders))
-            LOG_ERROR_AND_THROW("Failed to read shader data from the device object archive.");
+        if (!ReadIndex(IndexReader, ShaderIndex.pEntries, ShaderIndex.Count))
+            LOG_ERROR_AND_THROW("Failed to read the shader index from the device object archive.");
+
+        for (Uint32 i = 0; i < ShaderIndex.Count; ++i)
+        {
+            if (ShaderIndex.pEntries[i].UncompressedSize != 0)
+                m_ShaderCompression = ARCHIVE_SHADER_COMPRESSION_LZ4;
+        }
     }
+
+    m_IsIndexed = true;
 }
 
 void DeviceObjectArchive::Serialize(IDataBlob** ppDataBlob) const
+{
+    SerializeImpl(ppDataBlob, /*Append = */ false);
+}
+
+void DeviceObjectArchive::SerializeAppend(IDataBlob** ppDataBlob) const
+{
+    SerializeImpl(ppDataBlob, /*Append = */ true);
+}
+
+void DeviceObjectArchive::SerializeImpl(IDataBlob** ppDataBlob, bool Append) const
 {
     if (ppDataBlob == nullptr)
     {
@@ -225,37 +306,246 @@ void DeviceObjectArchive::Serialize(IDataBlob** ppDataBlob) const
     }
     DEV_CHECK_ERR(*ppDataBlob == nullptr, "Data blob object must be null");
 
-    auto SerializeThis = [this](auto& Ser) {
+    // If the archive was not loaded from the data, there is nothing to append to
+    if (!m_pArchiveData)
+        Append = false;
+
+    // Offset of the data written by this method from the beginning of the archive
+    const size_t BaseOffset = Append ? m_pArchiveData->GetSize() : 0;
+    VERIFY(BaseOffset % ArchiveDataAlignment == 0, "Archive data size must be aligned. This may only happen if the archive data is corrupted.");
+
+    // Old index and footer become dead when the update is appended
+    Uint64 DeadDataSize = Append ? m_DeadDataSize + (BaseOffset - m_IndexOffset) : 0;
+
+    struct NamedResource
+    {
+        ResourceType Type;
+        const char*  Name;
+        ResourceData Data;
+
+        // Entry of the resource in the original archive data, when the update is written
+        const ResourceIndexEntry* pBaseEntry = nullptr;
+
+        // Whether the resource data in the original archive data is up to date
+        bool IsDataUpToDate = false;
+    };
+    std::vector<NamedResource> Resources;
+    ProcessResources([&Resources](ResourceType Type, const char* Name, const ResourceData& Data) {
+        Resources.push_back(NamedResource{Type, Name, Data.MakeView()});
+    });
+
+    // NB: the order must match the comparison in FindIndexEntry
+    std::sort(Resources.begin(), Resources.end(),
+              [](const NamedResource& lhs, const NamedResource& rhs) {
+                  if (lhs.Type != rhs.Type)
+                      return lhs.Type < rhs.Type;
+                  return strcmp(lhs.Name, rhs.Name) < 0;
+              });
+
+    if (Append)
+    {
+        // All resources of the original data are dead unless they are referenced by the new index
+        for (Uint32 i = 0; i < m_ResourceIndex.Count; ++i)
+            DeadDataSize += Uint64{m_ResourceIndex.pEntries[i].NameLength} + 1 + m_ResourceIndex.pEntries[i].DataSize;
+
+        for (auto& Res : Resources)
+        {
+            Res.pBaseEntry = FindIndexEntry(Res.Type, Res.Name);
+            if (Res.pBaseEntry == nullptr)
+                continue;
+            DeadDataSize -= Uint64{Res.pBaseEntry->NameLength} + 1;
+
+            // Resources of the indexed archive are decoded from the original data
+            ResourceData BaseData;
+            Res.IsDataUpToDate = m_IsIndexed || (DecodeResource(*Res.pBaseEntry, BaseData) != nullptr && BaseData == Res.Data);
+            if (Res.IsDataUpToDate)
+                DeadDataSize -= Res.pBaseEntry->DataSize;
+        }
+    }
+
+    // Index entries are initialized during the measure pass and written during the write pass
+    std::vector<ResourceIndexEntry> ResourceIndex(Resources.size());
+
+    struct ShaderBlob
+    {
+        // Uncompressed shader data
+        SerializedData Data;
+
+        // Compressed shader data, empty if the shader is stored uncompressed
+        std::vector<Uint8> Compressed;
+
+        // Entry of the shader in the original archive data if it is up to date
+        const ShaderIndexEntry* pBaseEntry = nullptr;
+    };
+    std::array<std::vector<ShaderBlob>, static_cast<size_t>(DeviceType::Count)>       Shaders;
+    std::array<std::vector<ShaderIndexEntry>, static_cast<size_t>(DeviceType::Count)> ShaderIndices;
+    for (size_t dev = 0; dev < ShaderIndices.size(); ++dev)
+    {
+        const auto DevType    = static_cast<DeviceType>(dev);
+        const auto NumShaders = GetNumShaders(DevType);
+        ShaderIndices[dev].resize(NumShaders);
+        Shaders[dev].resize(NumShaders);
+
+        const auto& BaseIndex = m_ShaderIndices[dev];
+        if (Append)
+        {
+            for (Uint32 i = 0; i < BaseIndex.Count; ++i)
+                DeadDataSize += BaseIndex.pEntries[i].Size;
+        }
+
+        DynamicLinearAllocator ScratchAllocator{GetRawAllocator()};
+        for (size_t i = 0; i < NumShaders; ++i)
+        {
+            auto& Shader = Shaders[dev][i];
+            Shader.Data  = GetSerializedShader(DevType, i);
+
+            if (Append && i < BaseIndex.Count)
+            {
+                bool IsUpToDate = m_IsIndexed;
+                if (!IsUpToDate)
+                {
+                    const auto BaseShader = GetIndexedShader(DevType, i, &ScratchAllocator);
+                    // Uncompressed shaders that have not been changed reference the original data
+                    IsUpToDate = (BaseShader.Ptr() == Shader.Data.Ptr() && BaseShader.Size() == Shader.Data.Size()) || BaseShader == Shader.Data;
+                    ScratchAllocator.Discard();
+                }
+                if (IsUpToDate)
+                {
+                    Shader.pBaseEntry = &BaseIndex.pEntries[i];
+                    DeadDataSize -= Shader.pBaseEntry->Size;
+                    continue;
+                }
+            }
+
+            if (m_ShaderCompression == ARCHIVE_SHADER_COMPRESSION_LZ4 && Shader.Data)
+            {
+                Shader.Compressed.resize(Shader.Data.Size());
+                // Only keep the compressed data if it is smaller than the original
+                const auto CompressedSize = LZ4CompressBlock(Shader.Data.Ptr(), Shader.Data.Size(), Shader.Compressed.data(), Shader.Data.Size() - 1);
+                Shader.Compressed.resize(CompressedSize);
+            }
+        }
+    }
+
+    // Footer is initialized during the measure pass and written during the write pass
+    ArchiveFooter Footer;
+    Footer.DeadDataSize = DeadDataSize;
+
+    auto SerializeThis = [&](auto& Ser) {
         constexpr auto SerMode    = std::remove_reference<decltype(Ser)>::type::GetMode();
         const auto     ArchiveSer = ArchiveSerializer<SerMode>{Ser};
 
-        ArchiveHeader Header;
-        Header.ContentVersion = m_ContentVersion;
+        auto SetOffset = [&Ser, BaseOffset](Uint64& Offset) {
+            if (SerMode == SerializerMode::Measure)
+                Offset = BaseOffset + Ser.GetSize();
+            else
+                VERIFY(Offset == BaseOffset + Ser.GetSize(), "Offset computed in the measure pass does not match the actual offset. This is a bug.");
+        };
 
-        auto res = ArchiveSer.SerializeHeader(Header);
-        VERIFY(res, "Failed to serialize header");
+        // NB: the base offset is aligned, so aligning the serializer size aligns the offset in the archive
+        auto AlignData = [&Ser]() {
+            static constexpr Uint8 Padding[ArchiveDataAlignment] = {};
 
-        Uint32 NumResources = StaticCast<Uint32>(m_NamedResources.size());
-        res                 = Ser(NumResources);
-        VERIFY(res, "Failed to serialize the number of resources");
+            const auto Offset = Ser.GetSize();
+            Ser.CopyBytes(Padding, AlignUp(Offset, ArchiveDataAlignment) - Offset);
+        };
 
-        for (const auto& res_it : m_NamedResources)
+        bool res = true;
+        if (!Append)
         {
-            const auto* Name    = res_it.first.GetName();
-            const auto  ResType = res_it.first.GetType();
+            ArchiveHeader Header;
+            Header.ContentVersion = m_ContentVersion;
 
-            res = Ser(ResType, Name);
-            VERIFY(res, "Failed to serialize resource type and name");
+            res = ArchiveSer.SerializeHeader(Header);
+            VERIFY(res, "Failed to serialize header");
+        }
+
+        // Keep all names together so that looking up a resource only touches the index and names
+        for (size_t i = 0; i < Resources.size(); ++i)
+        {
+            const auto& Res   = Resources[i];
+            auto&       Entry = ResourceIndex[i];
+
+            Entry.Type       = Res.Type;
+            Entry.NameLength = StaticCast<Uint32>(strlen(Res.Name));
+            if (Res.pBaseEntry != nullptr)
+            {
+                // Use the name from the original data
+                Entry.NameOffset = Res.pBaseEntry->NameOffset;
+                continue;
+            }
+
+            SetOffset(Entry.NameOffset);
+            res = Ser.CopyBytes(Res.Name, size_t{Entry.NameLength} + 1);
+            VERIFY(res, "Failed to serialize resource name");
+        }
 
-            res = ArchiveSer.SerializeResourceData(res_it.second);
+        for (size_t i = 0; i < Resources.size(); ++i)
+        {
+            auto& Entry = ResourceIndex[i];
+            if (Resources[i].IsDataUpToDate)
+            {
+                Entry.DataOffset = Resources[i].pBaseEntry->DataOffset;
+                Entry.DataSize   = Resources[i].pBaseEntry->DataSize;
+                continue;
+            }
+
+            // Resource data is deserialized with a separate serializer, so it must
+            // start at the aligned offset to preserve the alignment of its elements.
+            AlignData();
+            SetOffset(Entry.DataOffset);
+            res = ArchiveSer.SerializeResourceData(Resources[i].Data);
             VERIFY(res, "Failed to serialize resource data");
+            Entry.DataSize = BaseOffset + Ser.GetSize() - Entry.DataOffset;
+        }
+
+        for (size_t dev = 0; dev < ShaderIndices.size(); ++dev)
+        {
+            auto& ShaderIndex = ShaderIndices[dev];
+            for (size_t i = 0; i < ShaderIndex.size(); ++i)
+            {
+                const auto& Shader = Shaders[dev][i];
+                auto&       Entry  = ShaderIndex[i];
+                if (Shader.pBaseEntry != nullptr)
+                {
+                    Entry = *Shader.pBaseEntry;
+                    continue;
+                }
+
+                AlignData();
+                SetOffset(Entry.Offset);
+                if (!Shader.Compressed.empty())
+                {
+                    Entry.Size             = Shader.Compressed.size();
+                    Entry.UncompressedSize = Shader.Data.Size();
+                    res                    = Ser.CopyBytes(Shader.Compressed.data(), Shader.Compressed.size());
+                }
+                else
+                {
+                    Entry.Size = Shader.Data.Size();
+                    res        = Ser.CopyBytes(Shader.Data.Ptr(), Shader.Data.Size());
+                }
+                VERIFY(res, "Failed to serialize shader");
+            }
         }
 
-        for (auto& Shaders : m_DeviceShaders)
+        AlignData();
+        SetOffset(Footer.IndexOffset);
+
+        res = Ser.SerializeBytes(ResourceIndex.data(), ResourceIndex.size() * sizeof(ResourceIndexEntry), alignof(ResourceIndexEntry));
+        VERIFY(res, "Failed to serialize resource index");
+
+        for (const auto& ShaderIndex : ShaderIndices)
         {
-            res = ArchiveSer.SerializeShaders(Shaders);
-            VERIFY(res, "Failed to serialize shaders");
+            res = Ser.SerializeBytes(ShaderIndex.data(), ShaderIndex.size() * sizeof(ShaderIndexEntry), alignof(ShaderIndexEntry));
+            VERIFY(res, "Failed to serialize shader index");
         }
+
+        // Footer is read from the end of the archive, so the archive size remains aligned
+        AlignData();
+        static_assert(sizeof(Footer) % ArchiveDataAlignment == 0, "Footer size must be aligned");
+        res = Ser.CopyBytes(&Footer, sizeof(Footer));
+        VERIFY(res, "Failed to serialize footer");
     };
 
     Serializer<SerializerMode::Measure> Measurer;
@@ -320,12 +610,22 @@ const char* ResourceTypeToString(DeviceObjectArchive::ResourceType Type)
 } // namespace
 
 
+static RefCntAutoPtr<IDataBlob> GetArchiveData(const DeviceObjectArchive::CreateInfo& CI)
+{
+    if (CI.pData == nullptr)
+        return {};
+
+    // Index entries are accessed directly in the archive memory, so the data must be properly aligned.
+    const bool IsAligned = (reinterpret_cast<size_t>(CI.pData->GetConstDataPtr()) % ArchiveDataAlignment) == 0;
+    if (CI.MakeCopy || !IsAligned)
+        return RefCntAutoPtr<IDataBlob>{DataBlobImpl::MakeCopy(CI.pData)};
+
+    // Need to remove const for AddRef/Release
+    return RefCntAutoPtr<IDataBlob>{const_cast<IDataBlob*>(CI.pData)};
+}
+
 DeviceObjectArchive::DeviceObjectArchive(const CreateInfo& CI) noexcept(false) :
-    m_pArchiveData{
-        CI.MakeCopy ?
-            DataBlobImpl::MakeCopy(CI.pData) :
-            const_cast<IDataBlob*>(CI.pData) // Need to remove const for AddRef/Release
-    }
+    m_pArchiveData{GetArchiveData(CI)}
 {
     if (!m_pArchiveData)
         LOG_ERROR_AND_THROW("pData must not be null");
@@ -333,19 +633,214 @@ DeviceObjectArchive::DeviceObjectArchive(const CreateInfo& CI) noexcept(false) :
     Deserialize(CI);
 }
 
-const SerializedData& DeviceObjectArchive::GetDeviceSpecificData(ResourceType Type,
-                                                                 const char*  Name,
-                                                                 DeviceType   DevType) const noexcept
+const DeviceObjectArchive::ResourceIndexEntry* DeviceObjectArchive::FindIndexEntry(ResourceType Type, const char* Name) const noexcept
+{
+    if (Name == nullptr)
+        return nullptr;
+
+    // Binary search in the index sorted by resource type and name.
+    // NB: the order must match the sorting in Serialize()
+    Uint32 First = 0;
+    Uint32 Last  = m_ResourceIndex.Count;
+    while (First < Last)
+    {
+        const Uint32 Mid   = First + (Last - First) / 2;
+        const auto&  Entry = m_ResourceIndex.pEntries[Mid];
+
+        int Cmp = 0;
+        if (Entry.Type != Type)
+        {
+            Cmp = Entry.Type < Type ? -1 : +1;
+        }
+        else
+        {
+            const char* EntryName = GetIndexedName(Entry);
+            if (EntryName == nullptr)
+                return nullptr;
+            Cmp = strcmp(EntryName, Name);
+        }
+
+        if (Cmp == 0)
+            return &Entry;
+        else if (Cmp < 0)
+            First = Mid + 1;
+        else
+            Last = Mid;
+    }
+
+    return nullptr;
+}
+
+const char* DeviceObjectArchive::GetIndexedName(const ResourceIndexEntry& Entry) const noexcept
+{
+    const auto* pArchiveData = static_cast<const char*>(m_pArchiveData->GetConstDataPtr());
+    const auto  ArchiveSize  = m_pArchiveData->GetSize();
+    if (!IsValidRange(Entry.NameOffset, Uint64{Entry.NameLength} + 1, ArchiveSize) ||
+        pArchiveData[Entry.NameOffset + Entry.NameLength] != '\0')
+    {
+        LOG_ERROR_MESSAGE("Invalid resource name in the device object archive index. Archive file may be corrupted or invalid.");
+        return nullptr;
+    }
+    return pArchiveData + Entry.NameOffset;
+}
+
+const char* DeviceObjectArchive::DecodeResource(const ResourceIndexEntry& Entry, ResourceData& Data) const noexcept
+{
+    const char* Name = GetIndexedName(Entry);
+    if (Name == nullptr)
+        return nullptr;
+
+    if (!IsValidRange(Entry.DataOffset, Entry.DataSize, m_pArchiveData->GetSize()) ||
+        Entry.DataOffset % ArchiveDataAlignment != 0)
+    {
+        LOG_ERROR_MESSAGE("Invalid data location of resource '", Name, "'. Archive file may be corrupted or invalid.");
+        return nullptr;
+    }
+
+    auto* pResData = const_cast<Uint8*>(static_cast<const Uint8*>(m_pArchiveData->GetConstDataPtr()) + Entry.DataOffset);
+
+    Serializer<SerializerMode::Read>        Reader{SerializedData{pResData, static_cast<size_t>(Entry.DataSize)}};
+    ArchiveSerializer<SerializerMode::Read> ArchiveReader{Reader};
+    if (!ArchiveReader.SerializeResourceData(Data))
+    {
+        LOG_ERROR_MESSAGE("Failed to read data of resource '", Name, "'. Archive file may be corrupted or invalid.");
+        return nullptr;
+    }
+    VERIFY_EXPR(Reader.IsEnded());
+
+    return Name;
+}
+
+const char* DeviceObjectArchive::FindResource(ResourceType Type, const char* Name, ResourceData& Data) const noexcept
 {
     auto it = m_NamedResources.find(NamedResourceKey{Type, Name});
-    if (it == m_NamedResources.end())
+    if (it != m_NamedResources.end())
+    {
+        Data = it->second.MakeView();
+        return it->first.GetName();
+    }
+
+    if (!m_IsIndexed)
+        return nullptr;
+
+    if (const auto* pEntry = FindIndexEntry(Type, Name))
+        return DecodeResource(*pEntry, Data);
+
+    return nullptr;
+}
+
+bool DeviceObjectArchive::HasResource(ResourceType Type, const char* Name) const noexcept
+{
+    return m_NamedResources.find(NamedResourceKey{Type, Name}) != m_NamedResources.end() || (m_IsIndexed && FindIndexEntry(Type, Name) != nullptr);
+}
+
+SerializedData DeviceObjectArchive::GetDeviceSpecificData(ResourceType Type,
+                                                          const char*  Name,
+                                                          DeviceType   DevType) const noexcept
+{
+    ResourceData Data;
+    if (FindResource(Type, Name, Data) == nullptr)
     {
         LOG_ERROR_MESSAGE("Resource '", Name, "' is not present in the archive");
-        static const SerializedData NullData;
-        return NullData;
+        return {};
+    }
+    return std::move(Data.DeviceSpecific[static_cast<size_t>(DevType)]);
+}
+
+SerializedData DeviceObjectArchive::GetSerializedShader(DeviceType              Type,
+                                                        size_t                  Idx,
+                                                        DynamicLinearAllocator* pScratchAllocator) const noexcept
+{
+    if (!m_IsIndexed)
+    {
+        const auto& DeviceShaders = m_DeviceShaders[static_cast<size_t>(Type)];
+        if (Idx < DeviceShaders.size())
+            return SerializedData{DeviceShaders[Idx].Ptr(), DeviceShaders[Idx].Size()};
+        return {};
+    }
+
+    return GetIndexedShader(Type, Idx, pScratchAllocator);
+}
+
+SerializedData DeviceObjectArchive::GetIndexedShader(DeviceType              Type,
+                                                     size_t                  Idx,
+                                                     DynamicLinearAllocator* pScratchAllocator) const noexcept
+{
+    const auto& ShaderIndex = m_ShaderIndices[static_cast<size_t>(Type)];
+    if (Idx >= ShaderIndex.Count)
+        return {};
+
+    const auto& Entry = ShaderIndex.pEntries[Idx];
+    if (!IsValidRange(Entry.Offset, Entry.Size, m_pArchiveData->GetSize()))
+    {
+        LOG_ERROR_MESSAGE("Invalid location of shader ", Idx, ". Archive file may be corrupted or invalid.");
+        return {};
+    }
+    if (Entry.Size == 0)
+        return {};
+
+    const auto* pStoredData = static_cast<const Uint8*>(m_pArchiveData->GetConstDataPtr()) + Entry.Offset;
+    if (Entry.UncompressedSize == 0)
+        return SerializedData{const_cast<Uint8*>(pStoredData), static_cast<size_t>(Entry.Size)};
+
+    // LZ4 can't expand the data by more than 255 times
+    if (Entry.UncompressedSize > Entry.Size * 255 + 16)
+    {
+        LOG_ERROR_MESSAGE("Invalid uncompressed size of shader ", Idx, ". Archive file may be corrupted or invalid.");
+        return {};
+    }
+
+    const auto     UncompressedSize = static_cast<size_t>(Entry.UncompressedSize);
+    SerializedData Shader;
+    if (pScratchAllocator != nullptr)
+    {
+        // Alignment must be the same as the alignment of the shader data in the archive
+        Shader = SerializedData{pScratchAllocator->Allocate(UncompressedSize, ArchiveDataAlignment), UncompressedSize};
     }
-    VERIFY_EXPR(SafeStrEqual(Name, it->first.GetName()));
-    return it->second.DeviceSpecific[static_cast<size_t>(DevType)];
+    else
+    {
+        Shader = SerializedData{UncompressedSize, GetRawAllocator()};
+    }
+
+    if (LZ4DecompressBlock(pStoredData, static_cast<size_t>(Entry.Size), Shader.Ptr(), UncompressedSize) != UncompressedSize)
+    {
+        LOG_ERROR_MESSAGE("Failed to decompress shader ", Idx, ". Archive file may be corrupted or invalid.");
+        return {};
+    }
+
+    return Shader;
+}
+
+void DeviceObjectArchive::LoadAllResources() noexcept(false)
+{
+    if (!m_IsIndexed)
+        return;
+
+    VERIFY(m_NamedResources.empty(), "Named resources are not expected when the archive is indexed");
+    for (Uint32 i = 0; i < m_ResourceIndex.Count; ++i)
+    {
+        const auto&  Entry = m_ResourceIndex.pEntries[i];
+        ResourceData Data;
+        const char*  Name = DecodeResource(Entry, Data);
+        if (Name == nullptr)
+            LOG_ERROR_AND_THROW("Failed to decode resource ", i, " from the device object archive.");
+
+        // No need to make the name copy as we keep the source data blob alive.
+        constexpr auto MakeNameCopy = false;
+        m_NamedResources.emplace(NamedResourceKey{Entry.Type, Name, MakeNameCopy}, std::move(Data));
+    }
+
+    for (size_t dev = 0; dev < m_DeviceShaders.size(); ++dev)
+    {
+        auto& Shaders = m_DeviceShaders[dev];
+        VERIFY(Shaders.empty(), "Shaders are not expected when the archive is indexed");
+        Shaders.reserve(m_ShaderIndices[dev].Count);
+        for (Uint32 i = 0; i < m_ShaderIndices[dev].Count; ++i)
+            Shaders.emplace_back(GetIndexedShader(static_cast<DeviceType>(dev), i, nullptr));
+    }
+
+    // Keep the index to find unchanged entries when the archive update is written
+    m_IsIndexed = false;
 }
 
 std::string DeviceObjectArchive::ToString() const
@@ -361,7 +856,8 @@ std::string DeviceObjectArchive::ToString() const
     {
         Output << "Header\n"
                << Ident1 << "Archive version: " << ArchiveVersion << '\n'
-               << Ident1 << "Content version: " << m_ContentVersion << '\n';
+               << Ident1 << "Content version: " << m_ContentVersion << '\n'
+               << Ident1 << "Shader compression: " << (m_ShaderCompression == ARCHIVE_SHADER_COMPRESSION_LZ4 ? "LZ4" : "none") << '\n';
     }
 
     constexpr char CommonDataName[] = "Common";
@@ -385,36 +881,42 @@ std::string DeviceObjectArchive::ToString() const
     //       Direct3D12  504 bytes
     //       Vulkan      881 bytes
     {
-        std::array<std::vector<std::reference_wrapper<const decltype(m_NamedResources)::value_type>>, static_cast<size_t>(ResourceType::Count)> ResourcesByType;
-        for (const auto& it : m_NamedResources)
+        struct ResourceInfo
         {
-            ResourcesByType[static_cast<size_t>(it.first.GetType())].emplace_back(it);
-        }
-
-        for (const auto& Resources : ResourcesByType)
+            const char* Name;
+            size_t      CommonSize;
+
+            std::array<size_t, static_cast<size_t>(DeviceType::Count)> DeviceSpecificSizes;
+        };
+        std::array<std::vector<ResourceInfo>, static_cast<size_t>(ResourceType::Count)> ResourcesByType;
+        ProcessResources([&ResourcesByType](ResourceType Type, const char* Name, const ResourceData& Data) {
+            ResourceInfo Info{Name, Data.Common.Size(), {}};
+            for (size_t i = 0; i < Data.DeviceSpecific.size(); ++i)
+                Info.DeviceSpecificSizes[i] = Data.DeviceSpecific[i].Size();
+            ResourcesByType[static_cast<size_t>(Type)].emplace_back(Info);
+        });
+
+        for (size_t res_type = 0; res_type < ResourcesByType.size(); ++res_type)
         {
+            const auto& Resources = ResourcesByType[res_type];
             if (Resources.empty())
                 continue;
 
-            const auto ResType = Resources.front().get().first.GetType();
             Output << SeparatorLine
-                   << ResourceTypeToString(ResType) << " (" << Resources.size() << ")\n";
+                   << ResourceTypeToString(static_cast<ResourceType>(res_type)) << " (" << Resources.size() << ")\n";
             // ------------------
             // Resource Signatures (1)
 
-            for (const auto& res_ref : Resources)
+            for (const auto& Res : Resources)
             {
-                const auto& it = res_ref.get();
-                Output << Ident1 << it.first.GetName() << '\n';
+                Output << Ident1 << Res.Name << '\n';
                 // ..Test PRS
 
-                const auto& Res = it.second;
-
-                auto   MaxSize       = Res.Common.Size();
+                auto   MaxSize       = Res.CommonSize;
                 size_t MaxDevNameLen = strlen(CommonDataName);
-                for (Uint32 i = 0; i < Res.DeviceSpecific.size(); ++i)
+                for (Uint32 i = 0; i < Res.DeviceSpecificSizes.size(); ++i)
                 {
-                    const auto DevDataSize = Res.DeviceSpecific[i].Size();
+                    const auto DevDataSize = Res.DeviceSpecificSizes[i];
 
                     MaxSize = std::max(MaxSize, DevDataSize);
                     if (DevDataSize != 0)
@@ -423,12 +925,12 @@ std::string DeviceObjectArchive::ToString() const
                 const auto SizeFieldW = GetNumFieldWidth(MaxSize);
 
                 Output << Ident2 << std::setw(static_cast<int>(MaxDevNameLen)) << std::left << CommonDataName << ' '
-                       << std::setw(static_cast<int>(SizeFieldW)) << std::right << Res.Common.Size() << " bytes\n";
+                       << std::setw(static_cast<int>(SizeFieldW)) << std::right << Res.CommonSize << " bytes\n";
                 // ....Common     1015 bytes
 
-                for (Uint32 i = 0; i < Res.DeviceSpecific.size(); ++i)
+                for (Uint32 i = 0; i < Res.DeviceSpecificSizes.size(); ++i)
                 {
-                    const auto DevDataSize = Res.DeviceSpecific[i].Size();
+                    const auto DevDataSize = Res.DeviceSpecificSizes[i];
                     if (DevDataSize > 0)
                     {
                         Output << Ident2 << std::setw(static_cast<int>(MaxDevNameLen)) << std::left << ArchiveDeviceTypeToString(i) << ' '
@@ -452,9 +954,9 @@ std::string DeviceObjectArchive::ToString() const
     //       [1] 'Test PS' 7380 bytes
     {
         bool HasShaders = false;
-        for (const auto& Shaders : m_DeviceShaders)
+        for (Uint32 dev = 0; dev < static_cast<Uint32>(DeviceType::Count); ++dev)
         {
-            if (!Shaders.empty())
+            if (GetNumShaders(static_cast<DeviceType>(dev)) != 0)
                 HasShaders = true;
         }
 
@@ -465,21 +967,25 @@ std::string DeviceObjectArchive::ToString() const
             // ------------------
             // Compiled Shaders
 
-            for (Uint32 dev = 0; dev < m_DeviceShaders.size(); ++dev)
+            for (Uint32 dev = 0; dev < static_cast<Uint32>(DeviceType::Count); ++dev)
             {
-                const auto& Shaders = m_DeviceShaders[dev];
-                if (Shaders.empty())
+                const auto NumShaders = GetNumShaders(static_cast<DeviceType>(dev));
+                if (NumShaders == 0)
                     continue;
-                Output << Ident1 << ArchiveDeviceTypeToString(dev) << '(' << Shaders.size() << ")\n";
+                Output << Ident1 << ArchiveDeviceTypeToString(dev) << '(' << NumShaders << ")\n";
                 // ..OpenGL(2)
 
                 std::vector<std::string> ShaderNames;
-                ShaderNames.reserve(Shaders.size());
+                std::vector<size_t>      ShaderSizes;
+                ShaderNames.reserve(NumShaders);
+                ShaderSizes.reserve(NumShaders);
 
                 size_t MaxSize    = 0;
                 size_t MaxNameLen = 0;
-                for (const auto& ShaderData : Shaders)
+                for (size_t idx = 0; idx < NumShaders; ++idx)
                 {
+                    const auto ShaderData = GetSerializedShader(static_cast<DeviceType>(dev), idx);
+                    ShaderSizes.push_back(ShaderData.Size());
                     MaxSize = std::max(MaxSize, ShaderData.Size());
 
                     ShaderCreateInfo                 ShaderCI;
@@ -491,13 +997,13 @@ std::string DeviceObjectArchive::ToString() const
                     MaxNameLen = std::max(MaxNameLen, ShaderNames.back().size());
                 }
 
-                const auto IdxFieldW  = GetNumFieldWidth(Shaders.size());
+                const auto IdxFieldW  = GetNumFieldWidth(NumShaders);
                 const auto SizeFieldW = GetNumFieldWidth(MaxSize);
-                for (Uint32 idx = 0; idx < Shaders.size(); ++idx)
+                for (Uint32 idx = 0; idx < NumShaders; ++idx)
                 {
                     Output << Ident2 << '[' << std::setw(static_cast<int>(IdxFieldW)) << std::right << idx << "] "
                            << std::setw(static_cast<int>(MaxNameLen)) << std::left << ShaderNames[idx] << ' '
-                           << std::setw(static_cast<int>(SizeFieldW)) << std::right << Shaders[idx].Size() << " bytes\n";
+                           << std::setw(static_cast<int>(SizeFieldW)) << std::right << ShaderSizes[idx] << " bytes\n";
                     // ....[0] 'Test VS' 4020 bytes
                 }
             }
@@ -510,6 +1016,8 @@ std::string DeviceObjectArchive::ToString() const
 
 void DeviceObjectArchive::RemoveDeviceData(DeviceType Dev) noexcept(false)
 {
+    LoadAllResources();
+
     for (auto& res_it : m_NamedResources)
         res_it.second.DeviceSpecific[static_cast<size_t>(Dev)] = {};
 
@@ -518,6 +1026,8 @@ void DeviceObjectArchive::RemoveDeviceData(DeviceType Dev) noexcept(false)
 
 void DeviceObjectArchive::AppendDeviceData(const DeviceObjectArchive& Src, DeviceType Dev) noexcept(false)
 {
+    LoadAllResources();
+
     auto& Allocator = GetRawAllocator();
     for (auto& dst_res_it : m_NamedResources)
     {
@@ -525,128 +1035,186 @@ void DeviceObjectArchive::AppendDeviceData(const DeviceObjectArchive& Src, Devic
         // Clear dst device data to make sure we don't have invalid shader indices
         DstData = {};
 
-        auto src_res_it = Src.m_NamedResources.find(dst_res_it.first);
-        if (src_res_it == Src.m_NamedResources.end())
+        ResourceData SrcResData;
+        if (Src.FindResource(dst_res_it.first.GetType(), dst_res_it.first.GetName(), SrcResData) == nullptr)
             continue;
 
-        const auto& SrcData{src_res_it->second.DeviceSpecific[static_cast<size_t>(Dev)]};
+        const auto& SrcData{SrcResData.DeviceSpecific[static_cast<size_t>(Dev)]};
         // Always copy src data even if it is empty
         DstData = SrcData.MakeCopy(Allocator);
     }
 
+    if (Src.m_ShaderCompression != ARCHIVE_SHADER_COMPRESSION_NONE)
+        m_ShaderCompression = Src.m_ShaderCompression;
+
     // Copy all shaders to make sure PSO shader indices are correct
-    const auto& SrcShaders = Src.m_DeviceShaders[static_cast<size_t>(Dev)];
-    auto&       DstShaders = m_DeviceShaders[static_cast<size_t>(Dev)];
+    const auto NumSrcShaders = Src.GetNumShaders(Dev);
+    auto&      DstShaders    = m_DeviceShaders[static_cast<size_t>(Dev)];
     DstShaders.clear();
-    for (const auto& SrcShader : SrcShaders)
-        DstShaders.emplace_back(SrcShader.MakeCopy(Allocator));
+    DstShaders.reserve(NumSrcShaders);
+    for (size_t i = 0; i < NumSrcShaders; ++i)
+        DstShaders.emplace_back(Src.GetSerializedShader(Dev, i).MakeCopy(Allocator));
 }
 
-void DeviceObjectArchive::Merge(const DeviceObjectArchive& Src) noexcept(false)
+void DeviceObjectArchive::Merge(const DeviceObjectArchive& Src, bool ReplaceExisting) noexcept(false)
 {
     if (m_ContentVersion != Src.m_ContentVersion)
         LOG_WARNING_MESSAGE("Merging archives with different content versions (", m_ContentVersion, " and ", Src.m_ContentVersion, ").");
 
     static_assert(static_cast<size_t>(ResourceType::Count) == 8, "Did you add a new resource type? You may need to handle it here.");
 
-    auto&                  Allocator = GetRawAllocator();
-    DynamicLinearAllocator DynAllocator{Allocator, 512};
+    LoadAllResources();
+
+    auto& Allocator = GetRawAllocator();
+
+    if (Src.m_ShaderCompression != ARCHIVE_SHADER_COMPRESSION_NONE)
+        m_ShaderCompression = Src.m_ShaderCompression;
 
     // Copy shaders
     std::array<Uint32, static_cast<size_t>(DeviceType::Count)> ShaderBaseIndices{};
     for (size_t i = 0; i < m_DeviceShaders.size(); ++i)
     {
-        const auto& SrcShaders = Src.m_DeviceShaders[i];
-        auto&       DstShaders = m_DeviceShaders[i];
-        ShaderBaseIndices[i]   = static_cast<Uint32>(DstShaders.size());
-        if (SrcShaders.empty())
+        const auto NumSrcShaders = Src.GetNumShaders(static_cast<DeviceType>(i));
+        auto&      DstShaders    = m_DeviceShaders[i];
+        ShaderBaseIndices[i]     = static_cast<Uint32>(DstShaders.size());
+        if (NumSrcShaders == 0)
             continue;
-        DstShaders.reserve(DstShaders.size() + SrcShaders.size());
-        for (const auto& SrcShader : SrcShaders)
-            DstShaders.emplace_back(SrcShader.MakeCopy(Allocator));
+        DstShaders.reserve(DstShaders.size() + NumSrcShaders);
+        for (size_t j = 0; j < NumSrcShaders; ++j)
+            DstShaders.emplace_back(Src.GetSerializedShader(static_cast<DeviceType>(i), j).MakeCopy(Allocator));
     }
 
     // Copy named resources
-    for (auto& src_res_it : Src.m_NamedResources)
-    {
-        const auto  ResType = src_res_it.first.GetType();
-        const auto* ResName = src_res_it.first.GetName();
-
-        auto it_inserted = m_NamedResources.emplace(NamedResourceKey{ResType, ResName, /*CopyName = */ true}, src_res_it.second.MakeCopy(Allocator));
+    Src.ProcessResources([&](ResourceType ResType, const char* ResName, const ResourceData& SrcResData) {
+        auto it_inserted = m_NamedResources.emplace(NamedResourceKey{ResType, ResName, /*CopyName = */ true}, SrcResData.MakeCopy(Allocator));
         if (!it_inserted.second)
         {
-            // Silently skip duplicate resources
-            if (it_inserted.first->second != src_res_it.second)
-                LOG_WARNING_MESSAGE("Failed to copy resource '", ResName, "': resource with the same name already exists.");
+            if (ReplaceExisting)
+            {
+                // Shaders of the replaced resource remain in the archive until it is compacted
+                it_inserted.first->second = SrcResData.MakeCopy(Allocator);
+            }
+            else
+            {
+                // Silently skip duplicate resources
+                if (it_inserted.first->second != SrcResData)
+                    LOG_WARNING_MESSAGE("Failed to copy resource '", ResName, "': resource with the same name already exists.");
 
-            continue;
+                return;
+            }
         }
 
-        const auto IsStandaloneShader = (ResType == ResourceType::StandaloneShader);
-        const auto IsPipeline =
-            (ResType == ResourceType::GraphicsPipeline ||
-             ResType == ResourceType::ComputePipeline ||
-             ResType == ResourceType::RayTracingPipeline ||
-             ResType == ResourceType::TilePipeline);
-
         // Update shader indices
-        if (IsStandaloneShader || IsPipeline)
+        for (size_t i = 0; i < static_cast<size_t>(DeviceType::Count); ++i)
         {
-            for (size_t i = 0; i < static_cast<size_t>(DeviceType::Count); ++i)
-            {
-                const auto BaseIdx = ShaderBaseIndices[i];
+            const auto BaseIdx = ShaderBaseIndices[i];
 
-                auto& DeviceData = it_inserted.first->second.DeviceSpecific[i];
-                if (!DeviceData)
-                    continue;
+            auto& DeviceData = it_inserted.first->second.DeviceSpecific[i];
+            if (!DeviceData)
+                continue;
 
-                if (IsStandaloneShader)
-                {
-                    // For shaders, device-specific data is the serialized shader bytecode index
-                    Uint32 ShaderIndex = 0;
-                    {
-                        Serializer<SerializerMode::Read> Ser{DeviceData};
-                        if (!Ser(ShaderIndex))
-                            LOG_ERROR_AND_THROW("Failed to deserialize standalone shader index. Archive file may be corrupted or invalid.");
-                        VERIFY(Ser.IsEnded(), "No other data besides the shader index is expected");
-                    }
+            std::vector<Uint32> ShaderIndices;
+            if (!ReadShaderIndices(ResType, DeviceData, ShaderIndices))
+                continue;
 
-                    ShaderIndex += BaseIdx;
+            for (auto& Idx : ShaderIndices)
+                Idx += BaseIdx;
+            WriteShaderIndices(ResType, DeviceData, ShaderIndices);
+        }
+    });
+}
 
-                    {
-                        Serializer<SerializerMode::Write> Ser{DeviceData};
-                        Ser(ShaderIndex);
-                        VERIFY_EXPR(Ser.IsEnded());
-                    }
-                }
-                else if (IsPipeline)
-                {
-                    // For pipelines, device-specific data is the shader index array
-                    ShaderIndexArray ShaderIndices;
-                    {
-                        Serializer<SerializerMode::Read> Ser{DeviceData};
-                        if (!PSOSerializer<SerializerMode::Read>::SerializeShaderIndices(Ser, ShaderIndices, &DynAllocator))
-                            LOG_ERROR_AND_THROW("Failed to deserialize PSO shader indices. Archive file may be corrupted or invalid.");
-                        VERIFY(Ser.IsEnded(), "No other data besides shader indices is expected");
-                    }
+void DeviceObjectArchive::Compact() noexcept(false)
+{
+    LoadAllResources();
 
-                    std::vector<Uint32> NewIndices{ShaderIndices.pIndices, ShaderIndices.pIndices + ShaderIndices.Count};
-                    for (auto& Idx : NewIndices)
-                        Idx += BaseIdx;
+    // Find shaders that are referenced by resources
+    std::array<std::vector<Uint32>, static_cast<size_t>(DeviceType::Count)> ShaderRemap;
+    for (size_t dev = 0; dev < ShaderRemap.size(); ++dev)
+        ShaderRemap[dev].resize(m_DeviceShaders[dev].size(), ~0u);
 
-                    {
-                        Serializer<SerializerMode::Write> Ser{DeviceData};
-                        PSOSerializer<SerializerMode::Write>::SerializeShaderIndices(Ser, ShaderIndexArray{NewIndices.data(), ShaderIndices.Count}, nullptr);
-                        VERIFY_EXPR(Ser.IsEnded());
-                    }
-                }
+    std::vector<Uint32> ShaderIndices;
+    for (const auto& res_it : m_NamedResources)
+    {
+        for (size_t dev = 0; dev < ShaderRemap.size(); ++dev)
+        {
+            if (!ReadShaderIndices(res_it.first.GetType(), res_it.second.DeviceSpecific[dev], ShaderIndices))
+                continue;
+
+            for (auto Idx : ShaderIndices)
+            {
+                if (Idx < ShaderRemap[dev].size())
+                    ShaderRemap[dev][Idx] = 0;
                 else
-                {
-                    UNEXPECTED("Unexpected resource type");
-                }
+                    LOG_ERROR_AND_THROW("Shader index ", Idx, " of resource '", res_it.first.GetName(), "' is out of range. Archive file may be corrupted or invalid.");
+            }
+        }
+    }
+
+    // Remove unreferenced shaders
+    for (size_t dev = 0; dev < ShaderRemap.size(); ++dev)
+    {
+        auto& Shaders = m_DeviceShaders[dev];
+        auto& Remap   = ShaderRemap[dev];
+
+        Uint32 NumShaders = 0;
+        for (size_t i = 0; i < Shaders.size(); ++i)
+        {
+            if (Remap[i] == ~0u)
+                continue;
+            Remap[i] = NumShaders;
+            if (i != NumShaders)
+                Shaders[NumShaders] = std::move(Shaders[i]);
+            ++NumShaders;
+        }
+        Shaders.resize(NumShaders);
+    }
+
+    auto& Allocator = GetRawAllocator();
+    for (auto& res_it : m_NamedResources)
+    {
+        for (size_t dev = 0; dev < ShaderRemap.size(); ++dev)
+        {
+            auto& DeviceData = res_it.second.DeviceSpecific[dev];
+            if (!ReadShaderIndices(res_it.first.GetType(), DeviceData, ShaderIndices))
+                continue;
+
+            bool IndicesChanged = false;
+            for (auto& Idx : ShaderIndices)
+            {
+                IndicesChanged = IndicesChanged || (Idx != ShaderRemap[dev][Idx]);
+                Idx            = ShaderRemap[dev][Idx];
+            }
+
+            if (IndicesChanged)
+            {
+                // Device data may reference the archive data, so make a copy
+                DeviceData = DeviceData.MakeCopy(Allocator);
+                WriteShaderIndices(res_it.first.GetType(), DeviceData, ShaderIndices);
             }
         }
     }
+
+    // Resources and shaders reference the current archive data, so keep it alive until the new data is loaded
+    RefCntAutoPtr<IDataBlob> pData;
+    Serialize(&pData);
+    VERIFY_EXPR(pData);
+
+    m_NamedResources.clear();
+    for (auto& Shaders : m_DeviceShaders)
+        Shaders.clear();
+
+    m_pArchiveData = pData;
+    Deserialize(CreateInfo{pData, m_ContentVersion});
+}
+
+void DeviceObjectArchive::SerializeAppend(IFileStream* pStream) const
+{
+    DEV_CHECK_ERR(pStream != nullptr, "File stream must not be null");
+    RefCntAutoPtr<IDataBlob> pDataBlob;
+    SerializeAppend(&pDataBlob);
+    VERIFY_EXPR(pDataBlob);
+    pStream->Write(pDataBlob->GetConstDataPtr(), pDataBlob->GetSize());
 }
 
 void DeviceObjectArchive::Serialize(IFileStream* pStream) const
@@ -167,6 +167,18 @@ void ValidateTextureDesc(const TextureDesc& Desc, const IRenderDevice* pDevice)
             LOG_TEXTURE_ERROR_AND_THROW("Memoryless attachment is not compatible with mipmap generation.");
     }
 
+    if (Desc.MiscFlags & MISC_TEXTURE_FLAG_TRANSIENT)
+    {
+        if (!pDevice->GetDeviceInfo().IsVulkanDevice())
+            LOG_TEXTURE_ERROR_AND_THROW("Transient textures are only supported in Vulkan.");
+
+        if (Desc.Usage != USAGE_DEFAULT)
+            LOG_TEXTURE_ERROR_AND_THROW("Transient textures require USAGE_DEFAULT.");
+
+        if (Desc.MiscFlags & MISC_TEXTURE_FLAG_MEMORYLESS)
+            LOG_TEXTURE_ERROR_AND_THROW("MISC_TEXTURE_FLAG_TRANSIENT is not compatible with MISC_TEXTURE_FLAG_MEMORYLESS.");
+    }
+
     if (Desc.Usage == USAGE_STAGING)
     {
         if (Desc.BindFlags != 0)
@@ -190,11 +190,14 @@ public:
 
     void BindResources(IResourceMapping* pResourceMapping, BIND_SHADER_RESOURCES_FLAGS Flags);
 
+    void SetResources(const ResourceBindDesc* pDescs, Uint32 NumDescs);
+
     void CheckResources(IResourceMapping*                    pResourceMapping,
                         BIND_SHADER_RESOURCES_FLAGS          Flags,
                         SHADER_RESOURCE_VARIABLE_TYPE_FLAGS& StaleVarTypes) const;
 
     IShaderResourceVariable* GetVariable(const Char* Name) const;
+    IShaderResourceVariable* GetVariableByHash(Uint64 NameHash, const Char* Name = nullptr) const;
     IShaderResourceVariable* GetVariable(Uint32 Index) const;
 
     IObject& GetOwner() { return m_Owner; }
@@ -255,7 +258,10 @@ private:
     }
 
     template <typename ResourceType>
-    IShaderResourceVariable* GetResourceByName(const Char* Name) const;
+    IShaderResourceVariable* GetResourceByResIndex(Uint32 ResIndex) const;
+
+    template <typename ResourceType>
+    void SetResource(Uint32 Index, const ResourceBindDesc& Desc);
 
     template <typename THandleCB,
               typename THandleTexSRV,
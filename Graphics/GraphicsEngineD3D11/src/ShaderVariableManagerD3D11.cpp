@@ -525,44 +525,121 @@ void ShaderVariableManagerD3D11::BindResources(IResourceMapping* pResourceMappin
 }
 
 template <typename ResourceType>
-IShaderResourceVariable* ShaderVariableManagerD3D11::GetResourceByName(const Char* Name) const
+IShaderResourceVariable* ShaderVariableManagerD3D11::GetResourceByResIndex(Uint32 ResIndex) const
 {
-    auto NumResources = GetNumResources<ResourceType>();
-    for (Uint32 res = 0; res < NumResources; ++res)
+    // Resources of every type are initialized in the order of the signature resources,
+    // so they are sorted by the resource index.
+    const auto NumResources = GetNumResources<ResourceType>();
+    return NumResources > 0 ?
+        FindVariableByResIndex(&GetResource<ResourceType>(0), NumResources, ResIndex) :
+        nullptr;
+}
+
+template <typename ResourceType>
+void ShaderVariableManagerD3D11::SetResource(Uint32 Index, const ResourceBindDesc& Desc)
+{
+    ResourceType& Res = GetResource<ResourceType>(Index);
+    if (Desc.ArrayIndex >= Res.GetDesc().ArraySize)
     {
-        auto& Resource = GetResource<ResourceType>(res);
-        if (strcmp(Resource.GetDesc().Name, Name) == 0)
-            return &Resource;
+        DEV_ERROR("Array index (", Desc.ArrayIndex, ") is out of range for variable '", Res.GetDesc().Name, "' of size ", Res.GetDesc().ArraySize);
+        return;
     }
+    Res.BindResource(BindResourceInfo{Desc.ArrayIndex, Desc.pObject, Desc.Flags});
+}
 
-    return nullptr;
+void ShaderVariableManagerD3D11::SetResources(const ResourceBindDesc* pDescs, Uint32 NumDescs)
+{
+    const Uint32 NumCBs     = GetNumCBs();
+    const Uint32 NumTexSRVs = GetNumTexSRVs();
+    const Uint32 NumTexUAVs = GetNumTexUAVs();
+    const Uint32 NumBufSRVs = GetNumBufSRVs();
+    const Uint32 NumBufUAVs = GetNumBufUAVs();
+
+    for (Uint32 i = 0; i < NumDescs; ++i)
+    {
+        const ResourceBindDesc& Desc = pDescs[i];
+        if (Desc.VariableIndex >= GetVariableCount())
+        {
+            DEV_ERROR("Variable index (", Desc.VariableIndex, ") is out of range. The number of variables is ", GetVariableCount());
+            continue;
+        }
+
+        // Variables are indexed in the same order as in GetVariable(Uint32 Index)
+        Uint32 Index = Desc.VariableIndex;
+        if (Index < NumCBs)
+        {
+            SetResource<ConstBuffBindInfo>(Index, Desc);
+            continue;
+        }
+        Index -= NumCBs;
+
+        if (Index < NumTexSRVs)
+        {
+            SetResource<TexSRVBindInfo>(Index, Desc);
+            continue;
+        }
+        Index -= NumTexSRVs;
+
+        if (Index < NumTexUAVs)
+        {
+            SetResource<TexUAVBindInfo>(Index, Desc);
+            continue;
+        }
+        Index -= NumTexUAVs;
+
+        if (Index < NumBufSRVs)
+        {
+            SetResource<BuffSRVBindInfo>(Index, Desc);
+            continue;
+        }
+        Index -= NumBufSRVs;
+
+        if (Index < NumBufUAVs)
+        {
+            SetResource<BuffUAVBindInfo>(Index, Desc);
+            continue;
+        }
+        Index -= NumBufUAVs;
+
+        SetResource<SamplerBindInfo>(Index, Desc);
+    }
 }
 
 IShaderResourceVariable* ShaderVariableManagerD3D11::GetVariable(const Char* Name) const
 {
-    if (auto* pCB = GetResourceByName<ConstBuffBindInfo>(Name))
-        return pCB;
+    return GetVariableByHash(ComputeShaderResourceNameHash(Name), Name);
+}
 
-    if (auto* pTexSRV = GetResourceByName<TexSRVBindInfo>(Name))
-        return pTexSRV;
+IShaderResourceVariable* ShaderVariableManagerD3D11::GetVariableByHash(Uint64 NameHash, const Char* Name) const
+{
+    return FindVariableByNameHash<IShaderResourceVariable>(
+        NameHash, Name,
+        [this](Uint32 ResIndex) -> IShaderResourceVariable* //
+        {
+            if (auto* pVar = GetResourceByResIndex<ConstBuffBindInfo>(ResIndex))
+                return pVar;
 
-    if (auto* pTexUAV = GetResourceByName<TexUAVBindInfo>(Name))
-        return pTexUAV;
+            if (auto* pVar = GetResourceByResIndex<TexSRVBindInfo>(ResIndex))
+                return pVar;
 
-    if (auto* pBuffSRV = GetResourceByName<BuffSRVBindInfo>(Name))
-        return pBuffSRV;
+            if (auto* pVar = GetResourceByResIndex<TexUAVBindInfo>(ResIndex))
+                return pVar;
 
-    if (auto* pBuffUAV = GetResourceByName<BuffUAVBindInfo>(Name))
-        return pBuffUAV;
+            if (auto* pVar = GetResourceByResIndex<BuffSRVBindInfo>(ResIndex))
+                return pVar;
 
-    if (!m_pSignature->IsUsingCombinedSamplers())
-    {
-        // Immutable samplers are never initialized as variables
-        if (auto* pSampler = GetResourceByName<SamplerBindInfo>(Name))
-            return pSampler;
-    }
+            if (auto* pVar = GetResourceByResIndex<BuffUAVBindInfo>(ResIndex))
+                return pVar;
 
-    return nullptr;
+            if (!m_pSignature->IsUsingCombinedSamplers())
+            {
+                // Immutable samplers are never initialized as variables
+                if (auto* pSampler = GetResourceByResIndex<SamplerBindInfo>(ResIndex))
+                    return pSampler;
+            }
+
+            return nullptr;
+        });
 }
 
 class ShaderVariableIndexLocator
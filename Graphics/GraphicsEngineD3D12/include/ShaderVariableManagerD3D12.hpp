@@ -96,6 +96,7 @@ public:
     void Destroy(IMemoryAllocator& Allocator);
 
     ShaderVariableD3D12Impl* GetVariable(const Char* Name) const;
+    ShaderVariableD3D12Impl* GetVariableByHash(Uint64 NameHash, const Char* Name = nullptr) const;
     ShaderVariableD3D12Impl* GetVariable(Uint32 Index) const;
 
     void BindResource(Uint32 ResIndex, const BindResourceInfo& BindInfo);
@@ -109,6 +110,8 @@ public:
 
     void BindResources(IResourceMapping* pResourceMapping, BIND_SHADER_RESOURCES_FLAGS Flags);
 
+    void SetResources(const ResourceBindDesc* pDescs, Uint32 NumDescs);
+
     void CheckResources(IResourceMapping*                    pResourceMapping,
                         BIND_SHADER_RESOURCES_FLAGS          Flags,
                         SHADER_RESOURCE_VARIABLE_TYPE_FLAGS& StaleVarTypes) const;
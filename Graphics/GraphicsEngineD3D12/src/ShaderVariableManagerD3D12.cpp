@@ -135,13 +135,16 @@ const ShaderVariableManagerD3D12::ResourceAttribs& ShaderVariableManagerD3D12::G
 
 ShaderVariableD3D12Impl* ShaderVariableManagerD3D12::GetVariable(const Char* Name) const
 {
-    for (Uint32 v = 0; v < m_NumVariables; ++v)
-    {
-        auto& Var = m_pVariables[v];
-        if (strcmp(Var.GetDesc().Name, Name) == 0)
-            return &Var;
-    }
-    return nullptr;
+    return GetVariableByHash(ComputeShaderResourceNameHash(Name), Name);
+}
+
+ShaderVariableD3D12Impl* ShaderVariableManagerD3D12::GetVariableByHash(Uint64 NameHash, const Char* Name) const
+{
+    // Variables are created in the order of resources in the signature, so they are sorted by the resource index
+    return FindVariableByNameHash<ShaderVariableD3D12Impl>(NameHash, Name,
+                                                           [this](Uint32 ResIndex) {
+                                                               return FindVariableByResIndex(m_pVariables, m_NumVariables, ResIndex);
+                                                           });
 }
 
 
@@ -181,6 +184,11 @@ void ShaderVariableManagerD3D12::BindResources(IResourceMapping* pResourceMappin
     TBase::BindResources(pResourceMapping, Flags);
 }
 
+void ShaderVariableManagerD3D12::SetResources(const ResourceBindDesc* pDescs, Uint32 NumDescs)
+{
+    TBase::SetResources(pDescs, NumDescs);
+}
+
 void ShaderVariableManagerD3D12::CheckResources(IResourceMapping*                    pResourceMapping,
                                                 BIND_SHADER_RESOURCES_FLAGS          Flags,
                                                 SHADER_RESOURCE_VARIABLE_TYPE_FLAGS& StaleVarTypes) const
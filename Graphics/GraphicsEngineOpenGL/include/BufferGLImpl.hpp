@@ -35,6 +35,7 @@
 #include "GLObjectWrapper.hpp"
 #include "AsyncWritableResource.hpp"
 #include "GLContextState.hpp"
+#include "GLDynamicRingBuffer.hpp"
 
 namespace Diligent
 {
@@ -74,7 +75,21 @@ public:
 
     __forceinline void BufferMemoryBarrier(MEMORY_BARRIER RequiredBarriers, GLContextState& GLContextState);
 
-    const GLObjectWrappers::GLBufferObj& GetGLHandle() const { return m_GlBuffer; }
+    const GLObjectWrappers::GLBufferObj& GetGLHandle() const
+    {
+        return m_pDynamicRing != nullptr ? m_pDynamicRing->GetGLBuffer() : m_GlBuffer;
+    }
+
+    /// Returns the offset of the buffer data in the GL buffer object returned by GetGLHandle().
+    /// The offset is non-zero only for dynamic buffers suballocated from the dynamic ring buffer.
+    Uint64 GetGLBufferOffset() const { return m_DynamicAllocation.Offset; }
+
+    /// Returns true if the buffer memory is suballocated from the dynamic ring buffer.
+    bool IsRingBacked() const { return m_pDynamicRing != nullptr; }
+
+#ifdef DILIGENT_DEVELOPMENT
+    void DvpVerifyDynamicAllocation() const;
+#endif
 
     /// Implementation of IBufferGL::GetGLBufferHandle().
     virtual GLuint DILIGENT_CALL_TYPE GetGLBufferHandle() const override final { return GetGLHandle(); }
@@ -91,10 +106,19 @@ private:
     friend class DeviceContextGLImpl;
     friend class VAOCache;
 
+    void MapDynamicRing(MAP_TYPE MapType, Uint32 MapFlags, PVoid& pMappedData);
+
+    // Must be declared before m_GlBuffer as the buffer object is not created when
+    // the buffer memory is suballocated from the dynamic ring buffer.
+    GLDynamicRingBuffer* const m_pDynamicRing;
+
     GLObjectWrappers::GLBufferObj m_GlBuffer;
     const Uint32                  m_BindTarget;
     const GLenum                  m_GLUsageHint;
 
+    // Current allocation in the dynamic ring buffer
+    GLDynamicRingBuffer::Allocation m_DynamicAllocation;
+
 #if PLATFORM_EMSCRIPTEN
     struct MappedData
     {
@@ -0,0 +1,106 @@
+/*
+ *  Copyright 2019-2024 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Declaration of Diligent::GLDynamicRingBuffer class
+
+#include <deque>
+#include <utility>
+
+#include "GLObjectWrapper.hpp"
+#include "RingBuffer.hpp"
+
+namespace Diligent
+{
+
+/// Persistently-mapped ring buffer that USAGE_DYNAMIC uniform buffers suballocate their memory from.
+
+/// The buffer storage is created with glBufferStorage() and is mapped once with
+/// GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT, so mapping a dynamic buffer does not require any
+/// driver synchronization. Space used by every frame is guarded by a fence and is reclaimed
+/// once the fence has been signaled by the GPU.
+class GLDynamicRingBuffer
+{
+public:
+    struct Allocation
+    {
+        Uint8* pData  = nullptr;
+        Uint64 Offset = 0;
+
+        // Frame number in which the allocation was made
+        Uint64 FrameNumber = 0;
+    };
+
+    GLDynamicRingBuffer(IMemoryAllocator& Allocator,
+                        Uint64            Size,
+                        Uint32            MinAlignment);
+    ~GLDynamicRingBuffer();
+
+    // clang-format off
+    GLDynamicRingBuffer             (const GLDynamicRingBuffer&) = delete;
+    GLDynamicRingBuffer             (GLDynamicRingBuffer&&)      = delete;
+    GLDynamicRingBuffer& operator = (const GLDynamicRingBuffer&) = delete;
+    GLDynamicRingBuffer& operator = (GLDynamicRingBuffer&&)      = delete;
+    // clang-format on
+
+    /// Suballocates Size bytes from the ring buffer.
+
+    /// If the buffer is full, the method waits for the oldest frames to complete.
+    /// If there is still not enough space, an empty allocation is returned.
+    Allocation Allocate(Uint64 Size);
+
+    /// Closes the current frame by inserting a fence into the command stream
+    /// and releases the space used by the frames that have been completed by the GPU.
+    void FinishFrame();
+
+    const GLObjectWrappers::GLBufferObj& GetGLBuffer() const { return m_GLBuffer; }
+
+    Uint64 GetSize() const { return m_RingBuffer.GetMaxSize(); }
+    Uint32 GetAlignment() const { return m_Alignment; }
+    Uint64 GetFrameNumber() const { return m_FrameNumber; }
+
+private:
+    void ReleaseCompletedFrames(bool WaitForOldestFrame);
+
+    GLObjectWrappers::GLBufferObj m_GLBuffer;
+
+    Uint8* m_pCPUAddress = nullptr;
+    Uint32 m_Alignment   = 0;
+
+    RingBuffer m_RingBuffer;
+
+    // Fences that guard the frames submitted to the ring buffer
+    std::deque<std::pair<Uint64, GLObjectWrappers::GLSyncObj>> m_PendingFences;
+
+    Uint64 m_FrameNumber             = 0;
+    Uint64 m_PeakUsedSize            = 0;
+    bool   m_CurrFrameHasAllocations = false;
+};
+
+} // namespace Diligent
@@ -36,6 +36,7 @@
 #include "BaseInterfacesGL.h"
 #include "FBOCache.hpp"
 #include "GLProgramCache.hpp"
+#include "GLDynamicRingBuffer.hpp"
 
 namespace Diligent
 {
@@ -199,6 +200,10 @@ public:
 
     GLProgramCache& GetProgramCache() { return m_ProgramCache; }
 
+    /// Returns the ring buffer that USAGE_DYNAMIC uniform buffers suballocate their memory from,
+    /// or null if persistently-mapped dynamic buffers are disabled or not supported.
+    GLDynamicRingBuffer* GetDynamicRingBuffer() const { return m_pDynamicRingBuffer.get(); }
+
     size_t GetCommandQueueCount() const { return 1; }
     Uint64 GetCommandQueueMask() const { return Uint64{1}; }
 
@@ -215,6 +220,7 @@ public:
     {
         bool FramebufferSRGB  = false;
         bool SemalessCubemaps = false;
+        bool BufferStorage    = false;
     };
     const GLDeviceCaps& GetGLCaps() const { return m_GLCaps; }
 
@@ -241,6 +247,9 @@ protected:
 
     GLProgramCache m_ProgramCache;
 
+    // Must be destroyed before the GL context
+    std::unique_ptr<GLDynamicRingBuffer> m_pDynamicRingBuffer;
+
 private:
     virtual void TestTextureFormat(TEXTURE_FORMAT TexFormat) override final;
     bool         CheckExtension(const Char* ExtensionString) const;
@@ -72,11 +72,17 @@ public:
         Uint32 DynamicOffset = 0;
 
         // In OpenGL dynamic buffers are only those that are not bound as a whole and
-        // can use a dynamic offset, irrespective of the variable type or whether the
-        // buffer is USAGE_DYNAMIC or not.
+        // can use a dynamic offset, irrespective of the variable type, as well as
+        // USAGE_DYNAMIC buffers suballocated from the dynamic ring buffer, whose
+        // offset changes every time the buffer is mapped.
         bool IsDynamic() const
         {
-            return pBuffer && RangeSize < pBuffer->GetDesc().Size;
+            return pBuffer && (RangeSize < pBuffer->GetDesc().Size || pBuffer->IsRingBacked());
+        }
+
+        GLintptr GetBindOffset() const
+        {
+            return static_cast<GLintptr>(pBuffer->GetGLBufferOffset() + BaseOffset + DynamicOffset);
         }
     };
 
@@ -49,6 +49,9 @@ static DILIGENT_CONSTEXPR INTERFACE_ID IID_BufferGL =
 DILIGENT_BEGIN_INTERFACE(IBufferGL, IBuffer)
 {
     /// Returns OpenGL buffer handle
+
+    /// \remarks    For dynamic uniform buffers that are suballocated from the dynamic ring buffer
+    ///             (see EngineGLCreateInfo::DynamicHeapSize), this is the handle of the ring buffer.
     VIRTUAL GLuint METHOD(GetGLBufferHandle)(THIS) CONST PURE;
 };
 DILIGENT_END_INTERFACE
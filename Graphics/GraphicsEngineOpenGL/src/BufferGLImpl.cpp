@@ -69,6 +69,21 @@ static GLenum GetBufferBindTarget(const BufferDesc& Desc)
 
     return Target;
 }
+
+static GLDynamicRingBuffer* GetDynamicRingBuffer(const RenderDeviceGLImpl* pDeviceGL, const BufferDesc& Desc)
+{
+    auto* pDynamicRing = pDeviceGL->GetDynamicRingBuffer();
+    if (pDynamicRing == nullptr || Desc.Usage != USAGE_DYNAMIC)
+        return nullptr;
+
+    // Only uniform buffers are suballocated from the ring buffer: other buffers may be
+    // referenced by VAOs and buffer views that require a dedicated GL buffer object.
+    if (Desc.BindFlags != BIND_UNIFORM_BUFFER || Desc.Size > pDynamicRing->GetSize())
+        return nullptr;
+
+    return pDynamicRing;
+}
+
 BufferGLImpl::BufferGLImpl(IReferenceCounters*        pRefCounters,
                            FixedBlockMemoryAllocator& BuffViewObjMemAllocator,
                            RenderDeviceGLImpl*        pDeviceGL,
@@ -85,7 +100,8 @@ BufferGLImpl::BufferGLImpl(IReferenceCounters*        pRefCounters,
         BuffDesc,
         bIsDeviceInternal
     },
-    m_GlBuffer    {true                          }, // Create buffer immediately
+    m_pDynamicRing{GetDynamicRingBuffer(pDeviceGL, BuffDesc)},
+    m_GlBuffer    {m_pDynamicRing == nullptr     }, // Create buffer immediately unless it is suballocated from the ring
     m_BindTarget  {GetBufferBindTarget(BuffDesc) },
     m_GLUsageHint {UsageToGLUsage(BuffDesc)}
 // clang-format on
@@ -97,6 +113,14 @@ BufferGLImpl::BufferGLImpl(IReferenceCounters*        pRefCounters,
         LOG_ERROR_AND_THROW("Unified resources are not supported in OpenGL/GLES");
     }
 
+    m_MemoryProperties = MEMORY_PROPERTY_HOST_COHERENT;
+
+    if (m_pDynamicRing != nullptr)
+    {
+        // Memory is allocated from the persistently-mapped ring buffer when the buffer is mapped
+        return;
+    }
+
     // TODO: find out if it affects performance if the buffer is originally bound to one target
     // and then bound to another (such as first to GL_ARRAY_BUFFER and then to GL_UNIFORM_BUFFER)
 
@@ -148,8 +172,6 @@ BufferGLImpl::BufferGLImpl(IReferenceCounters*        pRefCounters,
     DEV_CHECK_GL_ERROR("glBufferData() failed");
     GLState.BindBuffer(m_BindTarget, GLObjectWrappers::GLBufferObj::Null(), ResetVAO);
 
-    m_MemoryProperties = MEMORY_PROPERTY_HOST_COHERENT;
-
     m_GlBuffer.SetName(m_Desc.Name);
 }
 
@@ -198,6 +220,7 @@ BufferGLImpl::BufferGLImpl(IReferenceCounters*        pRefCounters,
         GetBufferDescFromGLHandle(CtxState, BuffDesc, GLHandle),
         bIsDeviceInternal
     },
+    m_pDynamicRing{nullptr},
     // Attach to external buffer handle
     m_GlBuffer    {true, GLObjectWrappers::GLBufferObjCreateReleaseHelper(GLHandle)},
     m_BindTarget  {GetBufferBindTarget(m_Desc)},
@@ -216,6 +239,8 @@ IMPLEMENT_QUERY_INTERFACE(BufferGLImpl, IID_BufferGL, TBufferBase)
 
 void BufferGLImpl::UpdateData(GLContextState& CtxState, Uint64 Offset, Uint64 Size, const void* pData)
 {
+    VERIFY(m_pDynamicRing == nullptr, "Dynamic buffers can't be updated with UpdateData()");
+
     BufferMemoryBarrier(
         MEMORY_BARRIER_BUFFER_UPDATE, // Reads or writes to buffer objects via any OpenGL API functions that allow
                                       // modifying their contents will reflect data written by shaders prior to the barrier.
@@ -252,8 +277,11 @@ void BufferGLImpl::CopyData(GLContextState& CtxState, BufferGLImpl& SrcBufferGL,
     // the purposes of copying or staging data without disturbing OpenGL state or needing to keep track of
     // what was bound to the target before your copy.
     constexpr bool ResetVAO = false; // No need to reset VAO for READ/WRITE targets
-    CtxState.BindBuffer(GL_COPY_WRITE_BUFFER, m_GlBuffer, ResetVAO);
-    CtxState.BindBuffer(GL_COPY_READ_BUFFER, SrcBufferGL.m_GlBuffer, ResetVAO);
+    CtxState.BindBuffer(GL_COPY_WRITE_BUFFER, GetGLHandle(), ResetVAO);
+    CtxState.BindBuffer(GL_COPY_READ_BUFFER, SrcBufferGL.GetGLHandle(), ResetVAO);
+    // Buffers suballocated from the dynamic ring buffer are located at non-zero offsets
+    SrcOffset += SrcBufferGL.GetGLBufferOffset();
+    DstOffset += GetGLBufferOffset();
     glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, StaticCast<GLintptr>(SrcOffset), StaticCast<GLintptr>(DstOffset), StaticCast<GLsizeiptr>(Size));
     DEV_CHECK_GL_ERROR("glCopyBufferSubData() failed");
     CtxState.BindBuffer(GL_COPY_READ_BUFFER, GLObjectWrappers::GLBufferObj::Null(), ResetVAO);
@@ -262,9 +290,43 @@ void BufferGLImpl::CopyData(GLContextState& CtxState, BufferGLImpl& SrcBufferGL,
 
 void BufferGLImpl::Map(GLContextState& CtxState, MAP_TYPE MapType, Uint32 MapFlags, PVoid& pMappedData)
 {
-    MapRange(CtxState, MapType, MapFlags, 0, m_Desc.Size, pMappedData);
+    if (m_pDynamicRing != nullptr)
+        MapDynamicRing(MapType, MapFlags, pMappedData);
+    else
+        MapRange(CtxState, MapType, MapFlags, 0, m_Desc.Size, pMappedData);
 }
 
+void BufferGLImpl::MapDynamicRing(MAP_TYPE MapType, Uint32 MapFlags, PVoid& pMappedData)
+{
+    VERIFY(MapType == MAP_WRITE, "Dynamic buffers can only be mapped for writing");
+
+    // The ring buffer is persistently mapped and coherent, so no synchronization or unmapping
+    // is required: the buffer is bound as a range of the ring at the allocation offset.
+    if ((MapFlags & MAP_FLAG_NO_OVERWRITE) != 0 &&
+        m_DynamicAllocation.pData != nullptr &&
+        m_DynamicAllocation.FrameNumber == m_pDynamicRing->GetFrameNumber())
+    {
+        // Reuse the allocation made by the previous map in the same frame
+        pMappedData = m_DynamicAllocation.pData;
+        return;
+    }
+
+    m_DynamicAllocation = m_pDynamicRing->Allocate(m_Desc.Size);
+    pMappedData         = m_DynamicAllocation.pData;
+}
+
+#ifdef DILIGENT_DEVELOPMENT
+void BufferGLImpl::DvpVerifyDynamicAllocation() const
+{
+    if (m_pDynamicRing == nullptr)
+        return;
+
+    const auto CurrentFrame = m_pDynamicRing->GetFrameNumber();
+    DEV_CHECK_ERR(m_DynamicAllocation.pData != nullptr, "Dynamic buffer '", m_Desc.Name, "' has not been mapped before its first use. Note: memory for dynamic buffers is allocated when a buffer is mapped.");
+    DEV_CHECK_ERR(m_DynamicAllocation.FrameNumber == CurrentFrame, "Dynamic allocation of dynamic buffer '", m_Desc.Name, "' in frame ", CurrentFrame, " is out-of-date. Note: contents of all dynamic resources is discarded at the end of every frame. A buffer must be mapped before its first use in any frame.");
+}
+#endif
+
 #if PLATFORM_EMSCRIPTEN
 
 void BufferGLImpl::MapRange(GLContextState& CtxState, MAP_TYPE MapType, Uint32 MapFlags, Uint64 Offset, Uint64 Length, PVoid& pMappedData)
@@ -299,6 +361,9 @@ void BufferGLImpl::MapRange(GLContextState& CtxState, MAP_TYPE MapType, Uint32 M
 
 void BufferGLImpl::Unmap(GLContextState& CtxState)
 {
+    if (m_pDynamicRing != nullptr)
+        return; // The ring buffer is persistently mapped
+
     if (m_Mapped.Type == MAP_WRITE)
     {
         constexpr bool ResetVAO = true;
@@ -377,6 +442,9 @@ void BufferGLImpl::MapRange(GLContextState& CtxState, MAP_TYPE MapType, Uint32 M
 
 void BufferGLImpl::Unmap(GLContextState& CtxState)
 {
+    if (m_pDynamicRing != nullptr)
+        return; // The ring buffer is persistently mapped
+
     constexpr bool ResetVAO = true;
     CtxState.BindBuffer(m_BindTarget, m_GlBuffer, ResetVAO);
     auto Result = glUnmapBuffer(m_BindTarget);
@@ -1510,6 +1510,9 @@ void DeviceContextGLImpl::Flush()
 
 void DeviceContextGLImpl::FinishFrame()
 {
+    if (auto* pDynamicRing = m_pDevice->GetDynamicRingBuffer())
+        pDynamicRing->FinishFrame();
+
     TDeviceContextBase::EndFrame();
 }
 
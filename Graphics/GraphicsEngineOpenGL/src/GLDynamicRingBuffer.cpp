@@ -0,0 +1,175 @@
+/*
+ *  Copyright 2019-2024 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "pch.h"
+
+#include "GLDynamicRingBuffer.hpp"
+
+#include <algorithm>
+#include <iomanip>
+
+#include "FormatString.hpp"
+
+namespace Diligent
+{
+
+GLDynamicRingBuffer::GLDynamicRingBuffer(IMemoryAllocator& Allocator,
+                                         Uint64            Size,
+                                         Uint32            MinAlignment) :
+    m_GLBuffer{true},
+    m_RingBuffer{StaticCast<RingBuffer::OffsetType>(Size), Allocator}
+{
+#if GL_ARB_buffer_storage
+    GLint UBOffsetAlignment = 0;
+    glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &UBOffsetAlignment);
+    CHECK_GL_ERROR("glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT) failed");
+    m_Alignment = std::max(MinAlignment, static_cast<Uint32>(UBOffsetAlignment));
+    VERIFY(IsPowerOfTwo(m_Alignment), "Alignment (", m_Alignment, ") must be a power of two");
+
+    // GL_COPY_WRITE_BUFFER target is not used for anything else by OpenGL and binding the buffer
+    // to it does not disturb the state tracked by GLContextState.
+    glBindBuffer(GL_COPY_WRITE_BUFFER, m_GLBuffer);
+    CHECK_GL_ERROR("Failed to bind dynamic ring buffer");
+
+    constexpr GLbitfield StorageFlags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+    glBufferStorage(GL_COPY_WRITE_BUFFER, StaticCast<GLsizeiptr>(Size), nullptr, StorageFlags);
+    CHECK_GL_ERROR_AND_THROW("glBufferStorage() failed");
+
+    // With GL_MAP_COHERENT_BIT, CPU writes to the mapped range become visible to the GPU
+    // without explicit flushes or memory barriers.
+    m_pCPUAddress = static_cast<Uint8*>(glMapBufferRange(GL_COPY_WRITE_BUFFER, 0, StaticCast<GLsizeiptr>(Size), StorageFlags));
+    CHECK_GL_ERROR_AND_THROW("glMapBufferRange() failed");
+    if (m_pCPUAddress == nullptr)
+        LOG_ERROR_AND_THROW("Failed to persistently map the dynamic ring buffer");
+
+    glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+
+    m_GLBuffer.SetName("Dynamic ring buffer");
+
+    LOG_INFO_MESSAGE("Created OpenGL dynamic ring buffer: ", FormatMemorySize(Size, 2), ", alignment: ", m_Alignment);
+#else
+    LOG_ERROR_AND_THROW("Persistently-mapped buffers are not supported by this build");
+#endif
+}
+
+GLDynamicRingBuffer::~GLDynamicRingBuffer()
+{
+    // Deleting the buffer is safe even if the GPU is still using it: OpenGL
+    // defers the actual release until all commands that reference it complete.
+    m_RingBuffer.FinishCurrentFrame(~Uint64{0});
+    m_RingBuffer.ReleaseCompletedFrames(~Uint64{0});
+    m_PendingFences.clear();
+
+    const Uint64 Size = m_RingBuffer.GetMaxSize();
+    LOG_INFO_MESSAGE("OpenGL dynamic ring buffer usage stats:\n"
+                     "                       Total size: ",
+                     FormatMemorySize(Size, 2),
+                     ". Peak used size: ", FormatMemorySize(m_PeakUsedSize, 2, Size),
+                     ". Peak utilization: ",
+                     std::fixed, std::setprecision(1), static_cast<double>(m_PeakUsedSize) / static_cast<double>(std::max(Size, Uint64{1})) * 100.0, '%');
+}
+
+GLDynamicRingBuffer::Allocation GLDynamicRingBuffer::Allocate(Uint64 Size)
+{
+    auto Offset = m_RingBuffer.Allocate(StaticCast<RingBuffer::OffsetType>(Size), m_Alignment);
+    while (Offset == RingBuffer::InvalidOffset && !m_PendingFences.empty())
+    {
+        // Space used by the current frame can't be reclaimed as it may be referenced by
+        // commands that have not been issued yet. Wait for the oldest previous frame instead.
+        ReleaseCompletedFrames(/*WaitForOldestFrame = */ true);
+        Offset = m_RingBuffer.Allocate(StaticCast<RingBuffer::OffsetType>(Size), m_Alignment);
+    }
+
+    if (Offset == RingBuffer::InvalidOffset)
+    {
+        LOG_ERROR_MESSAGE("Space in the OpenGL dynamic ring buffer is exhausted. Requested size: ", Size,
+                          " bytes. Increase the size of the ring buffer by setting EngineGLCreateInfo::DynamicHeapSize to a greater value.");
+        return {};
+    }
+
+    m_CurrFrameHasAllocations = true;
+    m_PeakUsedSize            = std::max(m_PeakUsedSize, Uint64{m_RingBuffer.GetUsedSize()});
+
+    Allocation Alloc;
+    Alloc.pData       = m_pCPUAddress + Offset;
+    Alloc.Offset      = Offset;
+    Alloc.FrameNumber = m_FrameNumber;
+    return Alloc;
+}
+
+void GLDynamicRingBuffer::FinishFrame()
+{
+    if (m_CurrFrameHasAllocations)
+    {
+        GLObjectWrappers::GLSyncObj Fence{glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0)};
+        DEV_CHECK_GL_ERROR("Failed to create gl fence");
+
+        m_RingBuffer.FinishCurrentFrame(m_FrameNumber);
+        m_PendingFences.emplace_back(m_FrameNumber, std::move(Fence));
+        m_CurrFrameHasAllocations = false;
+    }
+    ++m_FrameNumber;
+
+    ReleaseCompletedFrames(/*WaitForOldestFrame = */ false);
+}
+
+void GLDynamicRingBuffer::ReleaseCompletedFrames(bool WaitForOldestFrame)
+{
+    Uint64 CompletedFrame    = 0;
+    bool   AnyFrameCompleted = false;
+    while (!m_PendingFences.empty())
+    {
+        auto& FrameFence = m_PendingFences.front();
+
+        GLenum Res = GL_TIMEOUT_EXPIRED;
+        if (WaitForOldestFrame && !AnyFrameCompleted)
+        {
+            do
+            {
+                // Use GL_SYNC_FLUSH_COMMANDS_BIT to make sure the fence is actually submitted to the GPU
+                Res = glClientWaitSync(FrameFence.second, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000ull);
+            } while (Res == GL_TIMEOUT_EXPIRED);
+            DEV_CHECK_ERR(Res != GL_WAIT_FAILED, "glClientWaitSync() failed");
+        }
+        else
+        {
+            Res = glClientWaitSync(FrameFence.second, 0, 0);
+        }
+
+        if (Res != GL_ALREADY_SIGNALED && Res != GL_CONDITION_SATISFIED)
+            break;
+
+        CompletedFrame    = FrameFence.first;
+        AnyFrameCompleted = true;
+        m_PendingFences.pop_front();
+    }
+
+    if (AnyFrameCompleted)
+        m_RingBuffer.ReleaseCompletedFrames(CompletedFrame);
+}
+
+} // namespace Diligent
@@ -348,6 +348,25 @@ RenderDeviceGLImpl::RenderDeviceGLImpl(IReferenceCounters*       pRefCounters,
         glMaxShaderCompilerThreadsKHR(EngineCI.NumAsyncShaderCompilationThreads);
     }
 #endif
+
+    if (EngineCI.DynamicHeapSize != 0)
+    {
+        if (m_GLCaps.BufferStorage)
+        {
+            try
+            {
+                m_pDynamicRingBuffer = std::make_unique<GLDynamicRingBuffer>(GetRawAllocator(), EngineCI.DynamicHeapSize, m_AdapterInfo.Buffer.ConstantBufferOffsetAlignment);
+            }
+            catch (const std::runtime_error&)
+            {
+                LOG_WARNING_MESSAGE("Failed to create dynamic ring buffer. Dynamic buffers will be mapped with glMapBufferRange()");
+            }
+        }
+        else
+        {
+            LOG_INFO_MESSAGE("Persistently-mapped buffers are not supported by this device. Dynamic buffers will be mapped with glMapBufferRange()");
+        }
+    }
 }
 
 RenderDeviceGLImpl::~RenderDeviceGLImpl()
@@ -888,6 +907,7 @@ void RenderDeviceGLImpl::InitAdapterInfo()
 
             m_GLCaps.FramebufferSRGB  = IsGL40OrAbove || CheckExtension("GL_ARB_framebuffer_sRGB");
             m_GLCaps.SemalessCubemaps = IsGL40OrAbove || CheckExtension("GL_ARB_seamless_cube_map");
+            m_GLCaps.BufferStorage    = GLVersion >= Version{4, 4} || CheckExtension("GL_ARB_buffer_storage");
         }
         else
         {
@@ -968,6 +988,7 @@ void RenderDeviceGLImpl::InitAdapterInfo()
 
             m_GLCaps.FramebufferSRGB  = strstr(Extensions, "sRGB_write_control");
             m_GLCaps.SemalessCubemaps = false;
+            m_GLCaps.BufferStorage    = false;
         }
 
 #ifdef GL_KHR_shader_subgroup
@@ -136,7 +136,10 @@ void ShaderResourceCacheGL::BindResources(GLContextState&              GLState,
                                            // will reflect data written by shaders prior to the barrier
             GLState);
 
-        GLState.BindUniformBuffer(binding, UB.pBuffer->GetGLHandle(), static_cast<GLintptr>(UB.BaseOffset) + static_cast<GLintptr>(UB.DynamicOffset), UB.RangeSize);
+#ifdef DILIGENT_DEVELOPMENT
+        UB.pBuffer->DvpVerifyDynamicAllocation();
+#endif
+        GLState.BindUniformBuffer(binding, UB.pBuffer->GetGLHandle(), UB.GetBindOffset(), UB.RangeSize);
     }
 
     for (Uint32 s = 0, binding = BaseBindings[BINDING_RANGE_TEXTURE]; s < GetTextureCount(); ++s, ++binding)
@@ -311,9 +314,10 @@ void ShaderResourceCacheGL::BindDynamicBuffers(GLContextState&              GLSt
         const auto  UBOIdx = PlatformMisc::GetLSB(UBOBit);
         const auto& UB     = GetConstUB(UBOIdx);
         VERIFY_EXPR(UB.IsDynamic());
-        GLState.BindUniformBuffer(BaseUBOBinding + UBOIdx, UB.pBuffer->GetGLHandle(),
-                                  static_cast<GLintptr>(UB.BaseOffset) + static_cast<GLintptr>(UB.DynamicOffset),
-                                  UB.RangeSize);
+#ifdef DILIGENT_DEVELOPMENT
+        UB.pBuffer->DvpVerifyDynamicAllocation();
+#endif
+        GLState.BindUniformBuffer(BaseUBOBinding + UBOIdx, UB.pBuffer->GetGLHandle(), UB.GetBindOffset(), UB.RangeSize);
     }
 
 
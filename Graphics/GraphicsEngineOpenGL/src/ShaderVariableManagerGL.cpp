@@ -446,36 +446,96 @@ void ShaderVariableManagerGL::CheckResources(IResourceMapping*
 }
 
 template <typename ResourceType>
-IShaderResourceVariable* ShaderVariableManagerGL::GetResourceByName(const Char* Name) const
+IShaderResourceVariable* ShaderVariableManagerGL::GetResourceByResIndex(Uint32 ResIndex) const
 {
-    auto NumResources = GetNumResources<ResourceType>();
-    for (Uint32 res = 0; res < NumResources; ++res)
+    // Resources of every type are initialized in the order of the signature resources,
+    // so they are sorted by the resource index.
+    const auto NumResources = GetNumResources<ResourceType>();
+    return NumResources > 0 ?
+        FindVariableByResIndex(&GetResource<ResourceType>(0), NumResources, ResIndex) :
+        nullptr;
+}
+
+
+template <typename ResourceType>
+void ShaderVariableManagerGL::SetResource(Uint32 Index, const ResourceBindDesc& Desc)
+{
+    ResourceType& Res = GetResource<ResourceType>(Index);
+    if (Desc.ArrayIndex >= Res.GetDesc().ArraySize)
     {
-        auto&       Resource = GetResource<ResourceType>(res);
-        const auto& ResDesc  = Resource.GetDesc();
-        if (strcmp(ResDesc.Name, Name) == 0)
-            return &Resource;
+        DEV_ERROR("Array index (", Desc.ArrayIndex, ") is out of range for variable '", Res.GetDesc().Name, "' of size ", Res.GetDesc().ArraySize);
+        return;
     }
-
-    return nullptr;
+    Res.BindResource(BindResourceInfo{Desc.ArrayIndex, Desc.pObject, Desc.Flags});
 }
 
+void ShaderVariableManagerGL::SetResources(const ResourceBindDesc* pDescs, Uint32 NumDescs)
+{
+    const Uint32 NumUBs      = GetNumUBs();
+    const Uint32 NumTextures = GetNumTextures();
+    const Uint32 NumImages   = GetNumImages();
+
+    for (Uint32 i = 0; i < NumDescs; ++i)
+    {
+        const ResourceBindDesc& Desc = pDescs[i];
+        if (Desc.VariableIndex >= GetVariableCount())
+        {
+            DEV_ERROR("Variable index (", Desc.VariableIndex, ") is out of range. The number of variables is ", GetVariableCount());
+            continue;
+        }
+
+        // Variables are indexed in the same order as in GetVariable(Uint32 Index)
+        Uint32 Index = Desc.VariableIndex;
+        if (Index < NumUBs)
+        {
+            SetResource<UniformBuffBindInfo>(Index, Desc);
+            continue;
+        }
+        Index -= NumUBs;
+
+        if (Index < NumTextures)
+        {
+            SetResource<TextureBindInfo>(Index, Desc);
+            continue;
+        }
+        Index -= NumTextures;
+
+        if (Index < NumImages)
+        {
+            SetResource<ImageBindInfo>(Index, Desc);
+            continue;
+        }
+        Index -= NumImages;
+
+        SetResource<StorageBufferBindInfo>(Index, Desc);
+    }
+}
 
 IShaderResourceVariable* ShaderVariableManagerGL::GetVariable(const Char* Name) const
 {
-    if (auto* pUB = GetResourceByName<UniformBuffBindInfo>(Name))
-        return pUB;
+    return GetVariableByHash(ComputeShaderResourceNameHash(Name), Name);
+}
 
-    if (auto* pTexture = GetResourceByName<TextureBindInfo>(Name))
-        return pTexture;
+IShaderResourceVariable* ShaderVariableManagerGL::GetVariableByHash(Uint64 NameHash, const Char* Name) const
+{
+    return FindVariableByNameHash<IShaderResourceVariable>(
+        NameHash, Name,
+        [this](Uint32 ResIndex) -> IShaderResourceVariable* //
+        {
+            if (auto* pVar = GetResourceByResIndex<UniformBuffBindInfo>(ResIndex))
+                return pVar;
 
-    if (auto* pImage = GetResourceByName<ImageBindInfo>(Name))
-        return pImage;
+            if (auto* pVar = GetResourceByResIndex<TextureBindInfo>(ResIndex))
+                return pVar;
 
-    if (auto* pSSBO = GetResourceByName<StorageBufferBindInfo>(Name))
-        return pSSBO;
+            if (auto* pVar = GetResourceByResIndex<ImageBindInfo>(ResIndex))
+                return pVar;
 
-    return nullptr;
+            if (auto* pVar = GetResourceByResIndex<StorageBufferBindInfo>(ResIndex))
+                return pVar;
+
+            return nullptr;
+        });
 }
 
 class ShaderVariableLocator
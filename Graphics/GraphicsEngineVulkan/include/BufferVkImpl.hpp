@@ -115,6 +115,10 @@ public:
     /// Implementation of IBuffer::GetSparseProperties().
     virtual SparseBufferProperties DILIGENT_CALL_TYPE GetSparseProperties() const override final;
 
+    // Returns the device address of the Vulkan buffer returned by GetVkBuffer().
+    // The address is only available when the device uses descriptor buffers.
+    VkDeviceAddress GetVkBufferDeviceAddress() const;
+
     bool CheckAccessFlags(VkAccessFlags AccessFlags) const
     {
         return (GetAccessFlags() & AccessFlags) == AccessFlags;
@@ -136,6 +140,9 @@ private:
     Uint32       m_DynamicOffsetAlignment    = 0;
     VkDeviceSize m_BufferMemoryAlignedOffset = 0;
 
+    // Device address of m_VulkanBuffer, only initialized when the device uses descriptor buffers
+    VkDeviceAddress m_VkDeviceAddress = 0;
+
     // TODO (assiduous): move dynamic allocations to device context.
     static constexpr size_t CacheLineSize = 64;
     struct alignas(CacheLineSize) CtxDynamicData : VulkanDynamicAllocation
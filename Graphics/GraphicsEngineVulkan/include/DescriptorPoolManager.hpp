@@ -32,6 +32,8 @@
 
 #include <vector>
 #include <deque>
+#include <array>
+#include <memory>
 #include <mutex>
 #include <atomic>
 
@@ -43,6 +45,46 @@ namespace Diligent
 class DescriptorSetAllocator;
 class RenderDeviceVkImpl;
 
+// Descriptor pool managed by the DescriptorSetAllocator.
+// Every pool has its own lock, so that threads that allocate from different pools do not contend.
+struct DescriptorSetPool
+{
+    explicit DescriptorSetPool(VulkanUtilities::DescriptorPoolWrapper&& _Pool) noexcept :
+        Pool{std::move(_Pool)}
+    {}
+
+    enum class STATE : Uint8
+    {
+        // The pool is not used by any thread and may be acquired for allocations
+        AVAILABLE,
+
+        // The pool is used by a thread slot of the allocator
+        ACTIVE,
+
+        // Allocation from the pool failed. The pool is not used until enough sets are freed.
+        FULL
+    };
+
+    VulkanUtilities::DescriptorPoolWrapper Pool;
+
+    // Descriptor pools are externally synchronized. The mutex protects the pool as well as all members below.
+    std::mutex Mtx;
+
+    STATE State = STATE::AVAILABLE;
+
+    // The number of sets currently allocated from the pool
+    Uint32 NumAllocatedSets = 0;
+
+    // The number of sets freed since the pool became full
+    Uint32 NumFreedSinceFull = 0;
+
+    // Sets whose release fences have been completed. While the pool is active, they are freed
+    // in a single vkFreeDescriptorSets call before the next allocation.
+    // The sets are not keyed by the fence value: the device release queue already returns
+    // every set only after its fence has been completed.
+    std::vector<VkDescriptorSet> PendingFree;
+};
+
 // This class manages descriptor set allocation.
 // The class destructor calls DescriptorSetAllocator::FreeDescriptorSet() that moves
 // the set into the release queue.
@@ -52,7 +94,7 @@ class DescriptorSetAllocation
 public:
     // clang-format off
     DescriptorSetAllocation(VkDescriptorSet         _Set,
-                            VkDescriptorPool        _Pool,
+                            DescriptorSetPool*      _Pool,
                             Uint64                  _CmdQueueMask,
                             DescriptorSetAllocator& _DescrSetAllocator)noexcept :
         Set              {_Set               },
@@ -97,7 +139,7 @@ public:
     void Reset()
     {
         Set               = VK_NULL_HANDLE;
-        Pool              = VK_NULL_HANDLE;
+        Pool              = nullptr;
         CmdQueueMask      = 0;
         DescrSetAllocator = nullptr;
     }
@@ -113,7 +155,7 @@ public:
 
 private:
     VkDescriptorSet         Set               = VK_NULL_HANDLE;
-    VkDescriptorPool        Pool              = VK_NULL_HANDLE;
+    DescriptorSetPool*      Pool              = nullptr;
     Uint64                  CmdQueueMask      = 0;
     DescriptorSetAllocator* DescrSetAllocator = nullptr;
 };
@@ -183,7 +225,9 @@ private:
 
 
 // The class allocates descriptor sets from the main descriptor pool.
-// Descriptors sets can be released and returned to the pool
+// Descriptors sets can be released and returned to the pool.
+// To avoid contention, every thread allocates from the pool assigned to its thread slot.
+// Pools that failed an allocation are marked as full and are not used until enough sets are freed.
 class DescriptorSetAllocator : public DescriptorPoolManager
 {
 public:
@@ -213,6 +257,14 @@ public:
 
     DescriptorSetAllocation Allocate(Uint64 CommandQueueMask, VkDescriptorSetLayout SetLayout, const char* DebugName = "");
 
+    // The number of thread slots. Threads are assigned to slots in round-robin order.
+    // Every slot that is used allocates its own pool, so in the worst case there are
+    // NumThreadSlots full-size pools alive at the same time.
+    static constexpr size_t NumThreadSlots = 16;
+
+    // The maximum number of released sets that are kept in the pending free list of an active pool
+    static constexpr size_t MaxPendingFreeSets = 64;
+
 #ifdef DILIGENT_DEVELOPMENT
     Int32 GetAllocatedDescriptorSetCounter() const
     {
@@ -221,7 +273,27 @@ public:
 #endif
 
 private:
-    void FreeDescriptorSet(VkDescriptorSet Set, VkDescriptorPool Pool, Uint64 QueueMask);
+    void FreeDescriptorSet(VkDescriptorSet Set, DescriptorSetPool* Pool, Uint64 QueueMask);
+
+    // Returns the set to the pool after its release fence has been completed
+    void ReturnDescriptorSet(DescriptorSetPool& Pool, VkDescriptorSet Set);
+
+    // Frees all pending sets of the pool. The pool mutex must be locked.
+    void FlushPendingFreeSets(DescriptorSetPool& Pool);
+
+    // Takes an available pool or creates a new one and makes it active.
+    DescriptorSetPool& AcquirePool();
+
+    struct ThreadSlot
+    {
+        std::mutex         Mtx;
+        DescriptorSetPool* pPool = nullptr;
+    };
+    std::array<ThreadSlot, NumThreadSlots> m_ThreadSlots;
+
+    // All pools owned by the allocator and the pools that are available for allocations. Protected by m_Mutex.
+    std::deque<std::unique_ptr<DescriptorSetPool>> m_AllPools;
+    std::vector<DescriptorSetPool*>                m_AvailablePools;
 
 #ifdef DILIGENT_DEVELOPMENT
     std::atomic<Int32> m_AllocatedSetCounter;
@@ -530,6 +530,11 @@ private:
             // Note that this is not the actual number of dynamic buffers in the resource cache.
             Uint32 DynamicOffsetCount = 0;
 
+            // Indicates that the dynamic descriptor set is pushed with vkCmdPushDescriptorSetKHR
+            // rather than allocated, see PipelineResourceSignatureVkImpl::UsePushDescriptors().
+            // The dynamic set handle in vkSets is always null in this case.
+            bool PushDynamicSet = false;
+
 #ifdef DILIGENT_DEVELOPMENT
             // The descriptor set base index that was used in the last BindDescriptorSets() call
             Uint32 LastBoundBaseInd = ~0u;
@@ -547,6 +552,7 @@ private:
     __forceinline ResourceBindInfo& GetBindInfo(PIPELINE_TYPE Type);
 
     __forceinline void CommitDescriptorSets(ResourceBindInfo& BindInfo, Uint32 CommitSRBMask);
+    void               CommitDescriptorBuffers(ResourceBindInfo& BindInfo, Uint32 CommitSRBMask);
 #ifdef DILIGENT_DEVELOPMENT
     void DvpValidateCommittedShaderResources(ResourceBindInfo& BindInfo);
 #endif
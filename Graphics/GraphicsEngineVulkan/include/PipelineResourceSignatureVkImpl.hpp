@@ -51,6 +51,11 @@ namespace Diligent
 struct SPIRVShaderResourceAttribs;
 class DeviceContextVkImpl;
 
+namespace VulkanUtilities
+{
+class VulkanCommandBuffer;
+}
+
 struct ImmutableSamplerAttribsVk
 {
     Uint32 DescrSet     = ~0u;
@@ -96,6 +101,9 @@ public:
 
     static_assert(ResourceAttribs::MaxDescriptorSets >= MAX_DESCRIPTOR_SETS, "Not enough bits to store descriptor set index");
 
+    // The maximum number of descriptors in the dynamic descriptor set that may be pushed with vkCmdPushDescriptorSetKHR
+    static constexpr Uint32 MAX_PUSH_DESCRIPTORS = 32;
+
     PipelineResourceSignatureVkImpl(IReferenceCounters*                  pRefCounters,
                                     RenderDeviceVkImpl*                  pDevice,
                                     const PipelineResourceSignatureDesc& Desc,
@@ -123,6 +131,26 @@ public:
     bool   HasDescriptorSet(DESCRIPTOR_SET_ID SetId) const { return m_VkDescrSetLayouts[SetId] != VK_NULL_HANDLE; }
     Uint32 GetDescriptorSetSize(DESCRIPTOR_SET_ID SetId) const { return m_DescriptorSetSizes[SetId]; }
 
+    // Returns true if the dynamic descriptor set is not allocated, but is pushed directly into the command buffer
+    // with vkCmdPushDescriptorSetKHR, see PushDynamicResources().
+    bool UsePushDescriptors() const { return m_UsePushDescriptors; }
+
+    // Returns the size of the descriptor buffer memory required by the descriptor set with the
+    // given index in the resource cache. Only valid when the device uses descriptor buffers.
+    Uint32 GetDescriptorBufferSetSize(Uint32 SetIndex) const
+    {
+        VERIFY_EXPR(SetIndex < MAX_DESCRIPTOR_SETS);
+        return m_DescriptorBufferSetSizes[SetIndex];
+    }
+
+    // Returns descriptor locations in the descriptor buffer memory of the set with the given index,
+    // see ShaderResourceCacheVk::WriteDescriptorBufferData(). Only valid when the device uses descriptor buffers.
+    const std::vector<ShaderResourceCacheVk::DescriptorBufferSlot>& GetDescriptorBufferSlots(Uint32 SetIndex) const
+    {
+        VERIFY_EXPR(SetIndex < MAX_DESCRIPTOR_SETS);
+        return m_DescriptorBufferSlots[SetIndex];
+    }
+
     void InitSRBResourceCache(ShaderResourceCacheVk& ResourceCache);
 
     // Copies static resources from the static resource cache to the destination cache
@@ -134,6 +162,15 @@ public:
     void CommitDynamicResources(const ShaderResourceCacheVk& ResourceCache,
                                 VkDescriptorSet              vkDynamicDescriptorSet) const;
 
+    // Pushes dynamic resources from ResourceCache to the descriptor set with index SetIndex in the
+    // pipeline layout. Dynamic buffer offsets are baked into the descriptors.
+    void PushDynamicResources(const ShaderResourceCacheVk&          ResourceCache,
+                              VulkanUtilities::VulkanCommandBuffer& CmdBuffer,
+                              VkPipelineBindPoint                   BindPoint,
+                              VkPipelineLayout                      vkPipelineLayout,
+                              Uint32                                SetIndex,
+                              DeviceContextIndex                    CtxId) const;
+
 #ifdef DILIGENT_DEVELOPMENT
     /// Verifies committed resource using the SPIRV resource attributes from the PSO.
     bool DvpValidateCommittedResource(const DeviceContextVkImpl*        pDeviceCtx,
@@ -178,6 +215,18 @@ private:
 
     void CreateSetLayouts(bool IsSerialized);
 
+    // Initializes descriptor buffer memory sizes and descriptor locations for every descriptor set
+    void InitDescriptorBufferLayout(const std::array<std::vector<VkDescriptorSetLayoutBinding>, DESCRIPTOR_SET_ID_NUM_SETS>& vkSetLayoutBindings,
+                                    const std::array<Uint32, DESCRIPTOR_SET_ID_NUM_SETS>&                                    DSMapping);
+
+    // Writes descriptors of all dynamic resources and passes them to WriteDescriptors in batches.
+    // If CtxId is not null, dynamic buffer offsets of the context are baked into the buffer descriptors.
+    template <typename BatchSizes, typename WriteDescriptorsHandlerType>
+    void WriteDynamicResources(const ShaderResourceCacheVk&  ResourceCache,
+                               VkDescriptorSet               vkDynamicDescriptorSet,
+                               const DeviceContextIndex*     pCtxId,
+                               WriteDescriptorsHandlerType&& WriteDescriptors) const;
+
     static inline CACHE_GROUP       GetResourceCacheGroup(const PipelineResourceDesc& Res);
     static inline DESCRIPTOR_SET_ID VarTypeToDescriptorSetId(SHADER_RESOURCE_VARIABLE_TYPE VarType);
 
@@ -193,6 +242,16 @@ private:
     // The total number storage buffers with dynamic offsets in both descriptor sets,
     // accounting for array size.
     Uint16 m_DynamicStorageBufferCount = 0;
+
+    // Indicates that the dynamic descriptor set layout was created with VK_DESCRIPTOR_SET_LAYOUT_CREATE_PUSH_DESCRIPTOR_BIT_KHR.
+    // Dynamic uniform and storage buffers of this set are not counted in m_DynamicUniformBufferCount and
+    // m_DynamicStorageBufferCount as the set layout uses regular buffer descriptors.
+    bool m_UsePushDescriptors = false;
+
+    // Descriptor buffer memory sizes and descriptor locations, indexed by the set index in the layout
+    // (not DESCRIPTOR_SET_ID!). Only initialized when the device uses descriptor buffers.
+    std::array<Uint32, MAX_DESCRIPTOR_SETS>                                                   m_DescriptorBufferSetSizes = {};
+    std::array<std::vector<ShaderResourceCacheVk::DescriptorBufferSlot>, MAX_DESCRIPTOR_SETS> m_DescriptorBufferSlots;
 };
 
 template <> Uint32 PipelineResourceSignatureVkImpl::GetDescriptorSetIndex<PipelineResourceSignatureVkImpl::DESCRIPTOR_SET_ID_STATIC_MUTABLE>() const;
@@ -201,6 +201,18 @@ public:
                                                                   const FenceDesc& Desc,
                                                                   IFence**         ppFence) override final;
 
+    /// Implementation of IRenderDeviceVk::CreateTransientTexture().
+    virtual void DILIGENT_CALL_TYPE CreateTransientTexture(const TextureDesc& TexDesc,
+                                                           Uint32             FirstUse,
+                                                           Uint32             LastUse,
+                                                           ITexture**         ppTexture) override final;
+
+    /// Implementation of IRenderDeviceVk::GetTransientMemoryStats().
+    virtual TransientMemoryStatsVk DILIGENT_CALL_TYPE GetTransientMemoryStats() override final;
+
+    /// Implementation of IRenderDeviceVk::GetMemoryStats().
+    virtual MemoryStatsVk DILIGENT_CALL_TYPE GetMemoryStats() override final;
+
     /// Implementation of IRenderDevice::IdleGPU() in Vulkan backend.
     virtual void DILIGENT_CALL_TYPE IdleGPU() override final;
 
@@ -247,10 +259,18 @@ public:
         const auto MemoryFlags = MemoryProps.memoryTypes[MemoryTypeIndex].propertyFlags;
         return m_MemoryMgr.Allocate(Size, Alignment, MemoryTypeIndex, (MemoryFlags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) != 0, AllocateFlags);
     }
+    VulkanUtilities::VulkanTransientAllocation AllocateTransientMemory(const VkMemoryRequirements& MemReqs, VkMemoryPropertyFlags MemoryProperties, Uint32 FirstUse, Uint32 LastUse)
+    {
+        return m_MemoryMgr.AllocateTransient(MemReqs, MemoryProperties, FirstUse, LastUse);
+    }
     VulkanUtilities::VulkanMemoryManager& GetGlobalMemoryManager() { return m_MemoryMgr; }
 
     VulkanDynamicMemoryManager& GetDynamicMemoryManager() { return m_DynamicMemoryManager; }
 
+    // Returns true if shader resources are bound through descriptor buffers (VK_EXT_descriptor_buffer)
+    // rather than through descriptor sets.
+    bool UseDescriptorBuffers() const { return m_LogicalVkDevice->GetEnabledExtFeatures().DescriptorBuffer.descriptorBuffer != VK_FALSE; }
+
     void FlushStaleResources(SoftwareQueueIndex CmdQueueIndex);
 
     IDXCompiler* GetDxCompiler() const { return m_pDxCompiler.get(); }
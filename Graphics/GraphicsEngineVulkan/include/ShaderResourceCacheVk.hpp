@@ -55,6 +55,7 @@
 
 #include <vector>
 #include <memory>
+#include <array>
 
 #include "DescriptorPoolManager.hpp"
 #include "SPIRVShaderResources.hpp"
@@ -229,11 +230,61 @@ public:
         {
         }
     };
-    // Sets the resource at the given descriptor set index and offset
+
+    // Accumulates descriptor writes so that they are submitted to Vulkan with as few
+    // vkUpdateDescriptorSets calls as possible. Pending writes are flushed when the batch
+    // is full and when the batch is destroyed.
+    class DescriptorWriteBatch
+    {
+    public:
+        explicit DescriptorWriteBatch(const VulkanUtilities::VulkanLogicalDevice& LogicalDevice) noexcept :
+            m_LogicalDevice{LogicalDevice}
+        {}
+
+        ~DescriptorWriteBatch()
+        {
+            Flush();
+        }
+
+        // clang-format off
+        DescriptorWriteBatch           (const DescriptorWriteBatch&) = delete;
+        DescriptorWriteBatch           (DescriptorWriteBatch&&)      = delete;
+        DescriptorWriteBatch& operator=(const DescriptorWriteBatch&) = delete;
+        DescriptorWriteBatch& operator=(DescriptorWriteBatch&&)      = delete;
+        // clang-format on
+
+        void Flush();
+
+    private:
+        friend ShaderResourceCacheVk;
+
+        static constexpr Uint32 MaxWrites = 32;
+
+        union DescriptorInfo
+        {
+            VkDescriptorImageInfo                        vkImageInfo;
+            VkDescriptorBufferInfo                       vkBufferInfo;
+            VkBufferView                                 vkBufferView;
+            VkWriteDescriptorSetAccelerationStructureKHR vkAccelStructInfo;
+        };
+
+        const VulkanUtilities::VulkanLogicalDevice& m_LogicalDevice;
+
+        Uint32 m_NumWrites = 0;
+
+        // Do not zero-initialize!
+        std::array<VkWriteDescriptorSet, MaxWrites> m_Writes;
+        std::array<DescriptorInfo, MaxWrites>       m_Infos;
+    };
+
+    // Sets the resource at the given descriptor set index and offset.
+    // If pWriteBatch is not null, the descriptor write is added to the batch instead of
+    // being immediately submitted to Vulkan.
     const Resource& SetResource(const VulkanUtilities::VulkanLogicalDevice* pLogicalDevice,
                                 Uint32                                      DescrSetIndex,
                                 Uint32                                      CacheOffset,
-                                SetResourceInfo&&                           SrcRes);
+                                SetResourceInfo&&                           SrcRes,
+                                DescriptorWriteBatch*                       pWriteBatch = nullptr);
 
     const Resource& ResetResource(Uint32 SetIndex,
                                   Uint32 Offset)
@@ -246,6 +297,30 @@ public:
                                 Uint32 DynamicBufferOffset);
 
 
+    // Location of a descriptor in the descriptor buffer memory of a descriptor set,
+    // used when the device binds resources through descriptor buffers (VK_EXT_descriptor_buffer).
+    struct DescriptorBufferSlot
+    {
+        VkDescriptorType vkType = VK_DESCRIPTOR_TYPE_MAX_ENUM;
+
+        // Descriptor offset from the start of the set, and the descriptor size
+        Uint32 Offset = 0;
+        Uint32 Size   = 0;
+
+        // Immutable sampler that must be written to the descriptor, if any
+        VkSampler vkImmutableSampler = VK_NULL_HANDLE;
+    };
+
+    // Writes the descriptors of all resources in the given set to the descriptor buffer memory pointed to by pDstData.
+    // The first GetSize() slots correspond to the resources in the set; the remaining slots define
+    // immutable samplers that have no corresponding resource in the cache.
+    void WriteDescriptorBufferData(const VulkanUtilities::VulkanLogicalDevice& LogicalDevice,
+                                   Uint32                                      DescrSetIndex,
+                                   const DescriptorBufferSlot*                 pSlots,
+                                   Uint32                                      NumSlots,
+                                   DeviceContextIndex                          CtxId,
+                                   void*                                       pDstData) const;
+
     Uint32 GetNumDescriptorSets() const { return m_NumSets; }
     bool   HasDynamicResources() const { return m_NumDynamicBuffers > 0; }
 
@@ -260,11 +335,21 @@ public:
     template <bool VerifyOnly>
     void TransitionResources(DeviceContextVkImpl* pCtxVkImpl);
 
+    // Writes dynamic buffer offsets of the first NumSets descriptor sets to Offsets starting at StartInd.
     __forceinline Uint32 GetDynamicBufferOffsets(DeviceContextIndex     CtxId,
                                                  std::vector<uint32_t>& Offsets,
-                                                 Uint32                 StartInd) const;
+                                                 Uint32                 StartInd,
+                                                 Uint32                 NumSets) const;
 
 private:
+    // Initializes the descriptor write for the resource. The write references DescrInfo.
+    static void InitDescriptorWrite(const Resource&                       Res,
+                                    VkDescriptorSet                       vkSet,
+                                    Uint32                                BindingIndex,
+                                    Uint32                                ArrayIndex,
+                                    VkWriteDescriptorSet&                 WriteDescrSet,
+                                    DescriptorWriteBatch::DescriptorInfo& DescrInfo);
+
     Resource* GetFirstResourcePtr()
     {
         return reinterpret_cast<Resource*>(reinterpret_cast<DescriptorSet*>(m_pMemory.get()) + m_NumSets);
@@ -319,7 +404,8 @@ __forceinline auto ShaderResourceCacheVk::Resource::GetDescriptorWriteInfo<Descr
 
 __forceinline Uint32 ShaderResourceCacheVk::GetDynamicBufferOffsets(DeviceContextIndex     CtxId,
                                                                     std::vector<uint32_t>& Offsets,
-                                                                    Uint32                 StartInd) const
+                                                                    Uint32                 StartInd,
+                                                                    Uint32                 NumSets) const
 {
     // If any of the sets being bound include dynamic uniform or storage buffers, then
     // pDynamicOffsets includes one element for each array element in each dynamic descriptor
@@ -332,8 +418,9 @@ __forceinline Uint32 ShaderResourceCacheVk::GetDynamicBufferOffsets(DeviceContex
     // for every shader stage come first, followed by all storage buffers with dynamic offsets
     // (DescriptorType::StorageBufferDynamic and DescriptorType::StorageBufferDynamic_ReadOnly) for every shader stage,
     // followed by all other resources.
+    VERIFY_EXPR(NumSets <= m_NumSets);
     Uint32 OffsetInd = StartInd;
-    for (Uint32 set = 0; set < m_NumSets; ++set)
+    for (Uint32 set = 0; set < NumSets; ++set)
     {
         const auto& DescrSet = GetDescriptorSet(set);
         const auto  SetSize  = DescrSet.GetSize();
@@ -90,6 +90,7 @@ public:
     void Destroy(IMemoryAllocator& Allocator);
 
     ShaderVariableVkImpl* GetVariable(const Char* Name) const;
+    ShaderVariableVkImpl* GetVariableByHash(Uint64 NameHash, const Char* Name = nullptr) const;
     ShaderVariableVkImpl* GetVariable(Uint32 Index) const;
 
     void BindResource(Uint32 ResIndex, const BindResourceInfo& BindInfo);
@@ -103,6 +104,8 @@ public:
 
     void BindResources(IResourceMapping* pResourceMapping, BIND_SHADER_RESOURCES_FLAGS Flags);
 
+    void SetResources(const ResourceBindDesc* pDescs, Uint32 NumDescs);
+
     void CheckResources(IResourceMapping*                    pResourceMapping,
                         BIND_SHADER_RESOURCES_FLAGS          Flags,
                         SHADER_RESOURCE_VARIABLE_TYPE_FLAGS& StaleVarTypes) const;
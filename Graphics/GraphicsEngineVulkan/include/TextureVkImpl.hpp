@@ -45,12 +45,27 @@ public:
     using TTextureBase = TextureBase<EngineVkImplTraits>;
     using ViewImplType = TextureViewVkImpl;
 
+    // The range of use points of a transient texture, see IRenderDeviceVk::CreateTransientTexture()
+    struct TransientLifetime
+    {
+        Uint32 FirstUse = 0;
+        Uint32 LastUse  = 0;
+    };
+
     // Creates a new Vk resource
     TextureVkImpl(IReferenceCounters*        pRefCounters,
                   FixedBlockMemoryAllocator& TexViewObjAllocator,
                   RenderDeviceVkImpl*        pDeviceVk,
                   const TextureDesc&         TexDesc,
-                  const TextureData*         pInitData = nullptr);
+                  const TextureData*         pInitData = nullptr,
+                  const TransientLifetime*   pLifetime = nullptr);
+
+    // Creates a new transient Vk resource whose memory may alias other transient resources
+    TextureVkImpl(IReferenceCounters*        pRefCounters,
+                  FixedBlockMemoryAllocator& TexViewObjAllocator,
+                  RenderDeviceVkImpl*        pDeviceVk,
+                  const TextureDesc&         TexDesc,
+                  const TransientLifetime&   Lifetime);
 
     // Attaches to an existing Vk resource
     TextureVkImpl(IReferenceCounters*        pRefCounters,
@@ -114,7 +129,9 @@ protected:
     VulkanUtilities::ImageWrapper           m_VulkanImage;
     VulkanUtilities::BufferWrapper          m_StagingBuffer;
     VulkanUtilities::VulkanMemoryAllocation m_MemoryAllocation;
-    VkDeviceSize                            m_StagingDataAlignedOffset = 0;
+    // Memory of a transient texture
+    VulkanUtilities::VulkanTransientAllocation m_TransientAllocation;
+    VkDeviceSize                               m_StagingDataAlignedOffset = 0;
 };
 
 VkImageCreateInfo TextureDescToVkImageCreateInfo(const TextureDesc& Desc, const RenderDeviceVkImpl* pDevice) noexcept;
@@ -146,6 +146,11 @@ public:
     Uint8*   GetCPUAddress()const{return m_CPUAddress;}
     // clang-format on
 
+    // Returns the device address of the dynamic buffer. The address is only available
+    // when the device uses descriptor buffers, in which case the dynamic buffer also
+    // serves as the descriptor buffer.
+    VkDeviceAddress GetVkDeviceAddress() const { return m_VkDeviceAddress; }
+
     void Destroy();
 
     static constexpr const Uint32 MasterBlockAlignment = 1024;
@@ -156,6 +161,7 @@ private:
     VulkanUtilities::BufferWrapper       m_VkBuffer;
     VulkanUtilities::DeviceMemoryWrapper m_BufferMemory;
     Uint8*                               m_CPUAddress;
+    VkDeviceAddress                      m_VkDeviceAddress = 0;
     const VkDeviceSize                   m_DefaultAlignment;
     const Uint64                         m_CommandQueueMask;
     OffsetType                           m_TotalPeakSize = 0;
@@ -31,6 +31,11 @@
 #include "VulkanHeaders.h"
 #include "DebugUtilities.hpp"
 
+namespace Diligent
+{
+struct DeviceContextBarrierCounters;
+}
+
 namespace VulkanUtilities
 {
 
@@ -341,6 +346,8 @@ public:
         m_State       = {};
         m_Barrier     = {};
         m_ImageBarriers.clear();
+        m_MemoryBarriers2.clear();
+        m_ImageBarriers2.clear();
     }
 
     __forceinline void BindComputePipeline(VkPipeline ComputePipeline)
@@ -446,6 +453,54 @@ public:
         vkCmdBindDescriptorSets(m_VkCmdBuffer, pipelineBindPoint, layout, firstSet, descriptorSetCount, pDescriptorSets, dynamicOffsetCount, pDynamicOffsets);
     }
 
+    __forceinline void PushDescriptorSet(VkPipelineBindPoint         pipelineBindPoint,
+                                         VkPipelineLayout            layout,
+                                         uint32_t                    set,
+                                         uint32_t                    descriptorWriteCount,
+                                         const VkWriteDescriptorSet* pDescriptorWrites)
+    {
+#if DILIGENT_USE_VOLK
+        VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+        vkCmdPushDescriptorSetKHR(m_VkCmdBuffer, pipelineBindPoint, layout, set, descriptorWriteCount, pDescriptorWrites);
+#else
+        UNSUPPORTED("Push descriptors are not supported when vulkan library is linked statically");
+#endif
+    }
+
+    __forceinline void BindDescriptorBuffer(VkDeviceAddress Address, VkBufferUsageFlags Usage)
+    {
+#if DILIGENT_USE_VOLK
+        VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+        if (m_State.DescriptorBufferAddress != Address)
+        {
+            VkDescriptorBufferBindingInfoEXT BindingInfo{};
+            BindingInfo.sType   = VK_STRUCTURE_TYPE_DESCRIPTOR_BUFFER_BINDING_INFO_EXT;
+            BindingInfo.address = Address;
+            BindingInfo.usage   = Usage;
+            vkCmdBindDescriptorBuffersEXT(m_VkCmdBuffer, 1, &BindingInfo);
+            m_State.DescriptorBufferAddress = Address;
+        }
+#else
+        UNSUPPORTED("Descriptor buffers are not supported when vulkan library is linked statically");
+#endif
+    }
+
+    __forceinline void SetDescriptorBufferOffsets(VkPipelineBindPoint pipelineBindPoint,
+                                                  VkPipelineLayout    layout,
+                                                  uint32_t            firstSet,
+                                                  uint32_t            setCount,
+                                                  const uint32_t*     pBufferIndices,
+                                                  const VkDeviceSize* pOffsets)
+    {
+#if DILIGENT_USE_VOLK
+        VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+        VERIFY(m_State.DescriptorBufferAddress != 0, "No descriptor buffer bound");
+        vkCmdSetDescriptorBufferOffsetsEXT(m_VkCmdBuffer, pipelineBindPoint, layout, firstSet, setCount, pBufferIndices, pOffsets);
+#else
+        UNSUPPORTED("Descriptor buffers are not supported when vulkan library is linked statically");
+#endif
+    }
+
     __forceinline void CopyBuffer(VkBuffer            srcBuffer,
                                   VkBuffer            dstBuffer,
                                   uint32_t            regionCount,
@@ -776,6 +831,15 @@ public:
 
     void FlushBarriers();
 
+    // When synchronization2 is enabled, barriers keep exact per-resource stage masks and
+    // are issued with vkCmdPipelineBarrier2KHR. Otherwise, the stages of all pending barriers
+    // are merged into a single vkCmdPipelineBarrier call.
+    void SetSynchronization2Enabled(bool Enabled);
+    bool IsSynchronization2Enabled() const { return m_UseSync2; }
+
+    // Barrier counters are incremented every time pending barriers are flushed.
+    void SetBarrierCounters(Diligent::DeviceContextBarrierCounters* pCounters) { m_pBarrierCounters = pCounters; }
+
     __forceinline void SetVkCmdBuffer(VkCommandBuffer VkCmdBuffer, VkPipelineStageFlags StageMask, VkAccessFlags AccessMask)
     {
         m_VkCmdBuffer                 = VkCmdBuffer;
@@ -801,6 +865,8 @@ public:
         uint32_t      FramebufferHeight  = 0;
         uint32_t      InsidePassQueries  = 0;
         uint32_t      OutsidePassQueries = 0;
+
+        VkDeviceAddress DescriptorBufferAddress = 0;
     };
 
     const StateCache& GetState() const { return m_State; }
@@ -820,11 +886,25 @@ private:
         VkAccessFlags        SupportedAccessMask = ~0u;
     };
 
+    void AddMemoryBarrier2(VkPipelineStageFlags SrcStages,
+                           VkPipelineStageFlags DstStages,
+                           VkAccessFlags        SrcAccess,
+                           VkAccessFlags        DstAccess);
+    void FlushBarriers2();
+
     VkCommandBuffer m_VkCmdBuffer = VK_NULL_HANDLE;
     StateCache      m_State;
     PipelineBarrier m_Barrier;
 
     std::vector<VkImageMemoryBarrier> m_ImageBarriers;
+
+    // Synchronization2 barriers. Memory barriers with identical stage masks are merged.
+    std::vector<VkMemoryBarrier2KHR>      m_MemoryBarriers2;
+    std::vector<VkImageMemoryBarrier2KHR> m_ImageBarriers2;
+
+    bool m_UseSync2 = false;
+
+    Diligent::DeviceContextBarrierCounters* m_pBarrierCounters = nullptr;
 };
 
 } // namespace VulkanUtilities
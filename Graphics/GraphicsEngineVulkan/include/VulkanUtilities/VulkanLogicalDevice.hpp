@@ -177,7 +177,7 @@ public:
     void ReleaseVulkanObject(AccelStructWrapper&&   AccelStruct) const;
     void ReleaseVulkanObject(PipelineCacheWrapper&& PSOCache) const;
 
-    void FreeDescriptorSet(VkDescriptorPool Pool, VkDescriptorSet Set) const;
+    void FreeDescriptorSets(VkDescriptorPool Pool, uint32_t SetCount, const VkDescriptorSet* pSets) const;
     void FreeCommandBuffer(VkCommandPool Pool, VkCommandBuffer CmdBuffer) const;
 
     VkMemoryRequirements GetBufferMemoryRequirements(VkBuffer vkBuffer) const;
@@ -236,6 +236,12 @@ public:
 
     VkResult GetRayTracingShaderGroupHandles(VkPipeline pipeline, uint32_t firstGroup, uint32_t groupCount, size_t dataSize, void* pData) const;
 
+    VkDeviceAddress GetBufferDeviceAddress(VkBuffer vkBuffer) const;
+
+    VkDeviceSize GetDescriptorSetLayoutSize(VkDescriptorSetLayout vkLayout) const;
+    VkDeviceSize GetDescriptorSetLayoutBindingOffset(VkDescriptorSetLayout vkLayout, uint32_t Binding) const;
+    void         GetDescriptor(const VkDescriptorGetInfoEXT& DescriptorInfo, size_t DataSize, void* pDescriptor) const;
+
     VkPipelineStageFlags GetSupportedStagesMask(HardwareQueueIndex QueueFamilyIndex) const { return m_SupportedStagesMask[QueueFamilyIndex]; }
     VkAccessFlags        GetSupportedAccessMask(HardwareQueueIndex QueueFamilyIndex) const { return m_SupportedAccessMask[QueueFamilyIndex]; }
 
@@ -30,10 +30,13 @@
 #include <mutex>
 #include <array>
 #include <unordered_map>
+#include <vector>
+#include <memory>
 #include <atomic>
 #include <string>
 #include "MemoryAllocator.h"
 #include "VariableSizeAllocationsManager.hpp"
+#include "AliasingAllocationsManager.hpp"
 #include "VulkanUtilities/VulkanPhysicalDevice.hpp"
 #include "VulkanUtilities/VulkanLogicalDevice.hpp"
 #include "VulkanUtilities/VulkanObjectWrappers.hpp"
@@ -43,6 +46,7 @@ namespace VulkanUtilities
 {
 
 class VulkanMemoryPage;
+class VulkanAliasingPage;
 class VulkanMemoryManager;
 
 struct VulkanMemoryAllocation
@@ -134,6 +138,17 @@ public:
 
     VulkanMemoryAllocation Allocate(VkDeviceSize size, VkDeviceSize alignment);
 
+    struct Stats
+    {
+        VkDeviceSize PageSize         = 0;
+        VkDeviceSize UsedSize         = 0;
+        VkDeviceSize MaxFreeBlockSize = 0;
+    };
+    Stats GetStats();
+
+    // Returns false without waiting if the page mutex is locked by another thread
+    bool TryGetStats(Stats& PageStats);
+
     VkDeviceMemory GetVkMemory() const { return m_VkMemory; }
     void*          GetCPUMemory() const { return m_CPUMemory; }
 
@@ -152,6 +167,167 @@ private:
     void*                                    m_CPUMemory = nullptr;
 };
 
+// Memory range that is used by a transient resource in the range [FirstUse, LastUse] and may
+// alias memory of other transient resources whose use ranges do not overlap.
+struct VulkanTransientAllocation
+{
+    VulkanTransientAllocation() noexcept {}
+
+    // clang-format off
+    VulkanTransientAllocation            (const VulkanTransientAllocation&) = delete;
+    VulkanTransientAllocation& operator= (const VulkanTransientAllocation&) = delete;
+
+    VulkanTransientAllocation(VulkanAliasingPage* _Page, const Diligent::AliasingAllocationsManager::Allocation& _Alloc)noexcept :
+        Page {_Page },
+        Alloc{_Alloc}
+    {}
+
+    VulkanTransientAllocation(VulkanTransientAllocation&& rhs)noexcept :
+        Page {rhs.Page },
+        Alloc{rhs.Alloc}
+    {
+        rhs.Page  = nullptr;
+        rhs.Alloc = {};
+    }
+
+    VulkanTransientAllocation& operator= (VulkanTransientAllocation&& rhs)noexcept
+    {
+        Page  = rhs.Page;
+        Alloc = rhs.Alloc;
+
+        rhs.Page  = nullptr;
+        rhs.Alloc = {};
+
+        return *this;
+    }
+    // clang-format on
+
+    bool IsValid() const
+    {
+        return Page != nullptr;
+    }
+    explicit operator bool() const
+    {
+        return IsValid();
+    }
+
+    VkDeviceMemory GetVkMemory() const;
+
+    // Returns the offset of the allocation from the start of the device memory object
+    VkDeviceSize GetMemoryOffset() const;
+
+    // Prevents new allocations from aliasing this memory until the allocation is destroyed.
+    // Must be called before the allocation is moved into the release queue, as the memory
+    // may still be used by the GPU until the fence of the last submission is completed.
+    void Retire();
+
+    // Destructor immediately returns the allocation to the parent page.
+    // The allocation must not be in use by the GPU.
+    ~VulkanTransientAllocation();
+
+    VulkanAliasingPage*                              Page = nullptr; // Aliasing page that contains this allocation
+    Diligent::AliasingAllocationsManager::Allocation Alloc;          // Offset from the start of the page, size and use range
+};
+
+// Aliasing page is a range of a regular memory page that is shared by transient allocations.
+class VulkanAliasingPage
+{
+public:
+    VulkanAliasingPage(VulkanMemoryAllocation&&    Memory,
+                       VkDeviceSize                PageSize,
+                       VkDeviceSize                BaseAlignment,
+                       uint32_t                    MemoryTypeIndex,
+                       Diligent::IMemoryAllocator& Allocator);
+
+    // clang-format off
+    VulkanAliasingPage            (const VulkanAliasingPage&) = delete;
+    VulkanAliasingPage            (VulkanAliasingPage&&)      = delete;
+    VulkanAliasingPage& operator= (const VulkanAliasingPage&) = delete;
+    VulkanAliasingPage& operator= (VulkanAliasingPage&&)      = delete;
+    // clang-format on
+
+    VulkanTransientAllocation Allocate(VkDeviceSize Size, VkDeviceSize Alignment, Diligent::Uint32 FirstUse, Diligent::Uint32 LastUse);
+
+    struct Stats
+    {
+        VkDeviceSize PageSize           = 0;
+        VkDeviceSize UsedSize           = 0;
+        VkDeviceSize TotalAllocatedSize = 0;
+        size_t       NumAllocations     = 0;
+    };
+    Stats GetStats();
+
+    bool IsEmpty();
+
+    // clang-format off
+    VkDeviceMemory GetVkMemory()        const { return m_Memory.Page->GetVkMemory(); }
+    VkDeviceSize   GetBaseOffset()      const { return m_BaseOffset; }
+    VkDeviceSize   GetBaseAlignment()   const { return m_BaseAlignment; }
+    uint32_t       GetMemoryTypeIndex() const { return m_MemoryTypeIndex; }
+    // clang-format on
+
+private:
+    friend struct VulkanTransientAllocation;
+
+    void Retire(VulkanTransientAllocation& Allocation);
+
+    // Memory is reclaimed immediately. The application is responsible to ensure it is not in use by the GPU
+    void Free(VulkanTransientAllocation&& Allocation);
+
+    std::mutex                           m_Mutex;
+    VulkanMemoryAllocation               m_Memory;
+    const VkDeviceSize                   m_BaseOffset;
+    const VkDeviceSize                   m_BaseAlignment;
+    const uint32_t                       m_MemoryTypeIndex;
+    Diligent::AliasingAllocationsManager m_AllocationMgr;
+};
+
+// Memory statistics of pages of one kind (device-local or host-visible)
+struct VulkanMemoryPageStats
+{
+    size_t NumPages = 0;
+
+    // Total size of all pages
+    VkDeviceSize AllocatedSize = 0;
+
+    // Total size of all allocations in the pages
+    VkDeviceSize UsedSize = 0;
+
+    // The size of the largest free block in any page
+    VkDeviceSize MaxFreeBlockSize = 0;
+
+    // Returns the fragmentation of the free memory in the range [0, 1], where 0 means that
+    // all free memory is in a single block and values close to 1 mean that free memory is
+    // scattered across many small blocks, potentially in many partially occupied pages.
+    float GetFragmentation() const
+    {
+        const auto FreeSize = AllocatedSize - UsedSize;
+        return FreeSize > 0 ?
+            1.f - static_cast<float>(static_cast<double>(MaxFreeBlockSize) / static_cast<double>(FreeSize)) :
+            0.f;
+    }
+};
+
+// Transient memory statistics
+struct VulkanTransientMemoryStats
+{
+    size_t NumAllocations = 0;
+    size_t NumPages       = 0;
+
+    // Total size of all transient allocations, i.e. the memory size that would be required without aliasing
+    VkDeviceSize RequestedSize = 0;
+
+    // Memory size that is actually occupied by transient allocations
+    VkDeviceSize UsedSize = 0;
+
+    // Total size of all aliasing pages
+    VkDeviceSize PageSize = 0;
+
+    VkDeviceSize PeakRequestedSize = 0;
+    VkDeviceSize PeakUsedSize      = 0;
+    VkDeviceSize PeakPageSize      = 0;
+};
+
 class VulkanMemoryManager
 {
 public:
@@ -184,6 +360,7 @@ public:
         m_PhysicalDevice  {rhs.m_PhysicalDevice    },
         m_Allocator       {rhs.m_Allocator         },
         m_Pages           {std::move(rhs.m_Pages)  },
+        m_AliasingPages   {std::move(rhs.m_AliasingPages)},
 
         m_DeviceLocalPageSize    {rhs.m_DeviceLocalPageSize   },
         m_HostVisiblePageSize    {rhs.m_HostVisiblePageSize   },
@@ -193,7 +370,11 @@ public:
         //m_CurrUsedSize      {rhs.m_CurrUsedSize},
         m_PeakUsedSize      {rhs.m_PeakUsedSize     },
         m_CurrAllocatedSize {rhs.m_CurrAllocatedSize},
-        m_PeakAllocatedSize {rhs.m_PeakAllocatedSize}
+        m_PeakAllocatedSize {rhs.m_PeakAllocatedSize},
+
+        m_PeakTransientRequestedSize{rhs.m_PeakTransientRequestedSize},
+        m_PeakTransientUsedSize     {rhs.m_PeakTransientUsedSize     },
+        m_PeakTransientPageSize     {rhs.m_PeakTransientPageSize     }
     {
         // clang-format on
         for (size_t i = 0; i < m_CurrUsedSize.size(); ++i)
@@ -212,6 +393,14 @@ public:
     VulkanMemoryAllocation Allocate(const VkMemoryRequirements& MemReqs, VkMemoryPropertyFlags MemoryProps, VkMemoryAllocateFlags AllocateFlags);
     void                   ShrinkMemory();
 
+    // Allocates memory for a transient resource that is used in the range [FirstUse, LastUse].
+    // The memory may alias memory of other transient resources whose use ranges do not overlap.
+    VulkanTransientAllocation  AllocateTransient(const VkMemoryRequirements& MemReqs, VkMemoryPropertyFlags MemoryProps, Diligent::Uint32 FirstUse, Diligent::Uint32 LastUse);
+    VulkanTransientMemoryStats GetTransientMemoryStats();
+
+    // Returns statistics of device-local (index 0) and host-visible (index 1) pages
+    std::array<VulkanMemoryPageStats, 2> GetMemoryStats();
+
 protected:
     friend class VulkanMemoryPage;
 
@@ -259,6 +448,11 @@ protected:
     };
     std::unordered_multimap<MemoryPageIndex, VulkanMemoryPage, MemoryPageIndex::Hasher> m_Pages;
 
+    // Aliasing pages are suballocated from regular pages. The mutex must never be acquired
+    // while m_PagesMtx is held.
+    std::mutex                                       m_AliasingPagesMtx;
+    std::vector<std::unique_ptr<VulkanAliasingPage>> m_AliasingPages;
+
     const VkDeviceSize m_DeviceLocalPageSize;
     const VkDeviceSize m_HostVisiblePageSize;
     const VkDeviceSize m_DeviceLocalReserveSize;
@@ -272,6 +466,10 @@ protected:
     std::array<VkDeviceSize, 2>         m_CurrAllocatedSize = {};
     std::array<VkDeviceSize, 2>         m_PeakAllocatedSize = {};
 
+    VkDeviceSize m_PeakTransientRequestedSize = 0;
+    VkDeviceSize m_PeakTransientUsedSize      = 0;
+    VkDeviceSize m_PeakTransientPageSize      = 0;
+
     // If adding new member, do not forget to update move ctor
 };
 
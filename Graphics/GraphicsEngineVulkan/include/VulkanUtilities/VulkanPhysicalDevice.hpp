@@ -67,6 +67,8 @@ public:
         VkPhysicalDeviceMultiviewFeaturesKHR              Multiview              = {}; // Required for RenderPass2
         VkPhysicalDeviceMultiDrawFeaturesEXT              MultiDraw              = {};
         VkPhysicalDeviceShaderDrawParametersFeatures      ShaderDrawParameters   = {};
+        VkPhysicalDeviceSynchronization2FeaturesKHR       Synchronization2       = {};
+        VkPhysicalDeviceDescriptorBufferFeaturesEXT       DescriptorBuffer       = {};
 
         bool Spirv14              = false; // Ray tracing requires Vulkan 1.2 or SPIRV 1.4 extension
         bool Spirv15              = false; // DXC shaders with ray tracing requires Vulkan 1.2 with SPIRV 1.5
@@ -74,6 +76,7 @@ public:
         bool HasPortabilitySubset = false;
         bool RenderPass2          = false;
         bool DrawIndirectCount    = false;
+        bool PushDescriptor       = false;
     };
 
     struct ExtensionProperties
@@ -92,6 +95,8 @@ public:
         VkPhysicalDeviceMaintenance3Properties              Maintenance3           = {};
         VkPhysicalDeviceFragmentDensityMap2PropertiesEXT    FragmentDensityMap2    = {};
         VkPhysicalDeviceMultiDrawPropertiesEXT              MultiDraw              = {};
+        VkPhysicalDeviceDescriptorBufferPropertiesEXT       DescriptorBuffer       = {};
+        VkPhysicalDevicePushDescriptorPropertiesKHR         PushDescriptor         = {};
     };
 
 public:
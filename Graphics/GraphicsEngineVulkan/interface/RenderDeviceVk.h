@@ -38,6 +38,72 @@ DILIGENT_BEGIN_NAMESPACE(Diligent)
 static DILIGENT_CONSTEXPR INTERFACE_ID IID_RenderDeviceVk =
     {0xab8cf3a6, 0xd959, 0x41c1, {0xae, 0x0, 0xa5, 0x8a, 0xe9, 0x82, 0xe, 0x6a}};
 
+/// Statistics of device memory pages of one kind, see Diligent::MemoryStatsVk.
+struct MemoryPageStatsVk
+{
+    /// The number of memory pages.
+    Uint32 NumPages         DEFAULT_INITIALIZER(0);
+
+    /// The total size of all memory pages.
+    Uint64 AllocatedSize    DEFAULT_INITIALIZER(0);
+
+    /// The total size of all allocations in the pages.
+    Uint64 UsedSize         DEFAULT_INITIALIZER(0);
+
+    /// The size of the largest contiguous free block in any page.
+    Uint64 MaxFreeBlockSize DEFAULT_INITIALIZER(0);
+
+    /// Fragmentation of the free memory in the range [0, 1].
+
+    /// \remarks Fragmentation is computed as 1 - MaxFreeBlockSize / (AllocatedSize - UsedSize).
+    ///          Zero means that all free memory is in a single block, while values close to one
+    ///          indicate that free memory is scattered across many partially occupied pages.
+    Float32 Fragmentation   DEFAULT_INITIALIZER(0);
+};
+typedef struct MemoryPageStatsVk MemoryPageStatsVk;
+
+/// Device memory statistics, see IRenderDeviceVk::GetMemoryStats().
+struct MemoryStatsVk
+{
+    /// Statistics of device-local memory pages.
+    MemoryPageStatsVk DeviceLocal;
+
+    /// Statistics of host-visible memory pages.
+    MemoryPageStatsVk HostVisible;
+};
+typedef struct MemoryStatsVk MemoryStatsVk;
+
+/// Transient texture memory statistics, see IRenderDeviceVk::GetTransientMemoryStats().
+struct TransientMemoryStatsVk
+{
+    /// The number of transient textures that are currently alive.
+    Uint32 NumTextures DEFAULT_INITIALIZER(0);
+
+    /// The number of aliasing heaps.
+    Uint32 NumHeaps    DEFAULT_INITIALIZER(0);
+
+    /// The total memory size of all live transient textures,
+    /// i.e. the size that would be required without aliasing.
+    Uint64 RequestedSize DEFAULT_INITIALIZER(0);
+
+    /// The memory size that is actually occupied by transient textures.
+    /// The difference between RequestedSize and UsedSize is the aliasing savings.
+    Uint64 UsedSize      DEFAULT_INITIALIZER(0);
+
+    /// The total size of all aliasing heaps.
+    Uint64 HeapSize      DEFAULT_INITIALIZER(0);
+
+    /// Peak value of RequestedSize.
+    Uint64 PeakRequestedSize DEFAULT_INITIALIZER(0);
+
+    /// Peak value of UsedSize.
+    Uint64 PeakUsedSize      DEFAULT_INITIALIZER(0);
+
+    /// Peak value of HeapSize.
+    Uint64 PeakHeapSize      DEFAULT_INITIALIZER(0);
+};
+typedef struct TransientMemoryStatsVk TransientMemoryStatsVk;
+
 #define DILIGENT_INTERFACE_NAME IRenderDeviceVk
 #include "../../../Primitives/interface/DefineInterfaceHelperMacros.h"
 
@@ -157,6 +223,41 @@ DILIGENT_BEGIN_INTERFACE(IRenderDeviceVk, IRenderDevice)
                                                        VkSemaphore         vkTimelineSemaphore,
                                                        const FenceDesc REF Desc,
                                                        IFence**            ppFence) PURE;
+
+    /// Creates a transient texture whose memory may alias the memory of other transient textures
+
+    /// \param [in]  TexDesc   - Texture description. Usage must be USAGE_DEFAULT.
+    /// \param [in]  FirstUse  - The first point in time (e.g. a render pass index in a frame) when the texture is used.
+    /// \param [in]  LastUse   - The last point in time when the texture is used, inclusive.
+    /// \param [out] ppTexture - Address of the memory location where the pointer to the
+    ///                          texture interface will be stored.
+    ///                          The function calls AddRef(), so that the new object will contain
+    ///                          one reference.
+    ///
+    /// \remarks   Transient textures are placed in shared aliasing heaps. Textures whose
+    ///            [FirstUse, LastUse] ranges do not overlap may occupy the same memory.
+    ///            The texture is created with MISC_TEXTURE_FLAG_TRANSIENT flag and is initially
+    ///            in RESOURCE_STATE_UNDEFINED state. Its contents are undefined, and the application
+    ///            must issue an aliasing barrier (see Diligent::STATE_TRANSITION_FLAG_ALIASING) before
+    ///            using a texture that may share memory with a previously used one.
+    ///
+    ///            The memory is released when the texture object is destroyed and is no longer
+    ///            used by the GPU. Until then, new transient textures do not alias it regardless
+    ///            of their use ranges.
+    VIRTUAL void METHOD(CreateTransientTexture)(THIS_
+                                                const TextureDesc REF TexDesc,
+                                                Uint32                FirstUse,
+                                                Uint32                LastUse,
+                                                ITexture**            ppTexture) PURE;
+
+    /// Returns transient texture memory statistics, see Diligent::TransientMemoryStatsVk.
+    VIRTUAL TransientMemoryStatsVk METHOD(GetTransientMemoryStats)(THIS) PURE;
+
+    /// Returns device memory statistics, see Diligent::MemoryStatsVk.
+
+    /// \remarks New allocations are placed in the most occupied pages first, so that sparsely
+    ///          occupied pages are gradually drained and released by IRenderDevice::ReleaseStaleResources().
+    VIRTUAL MemoryStatsVk METHOD(GetMemoryStats)(THIS) PURE;
 };
 DILIGENT_END_INTERFACE
 
@@ -174,6 +275,9 @@ DILIGENT_END_INTERFACE
 #    define IRenderDeviceVk_CreateBLASFromVulkanResource(This, ...)   CALL_IFACE_METHOD(RenderDeviceVk, CreateBLASFromVulkanResource,   This, __VA_ARGS__)
 #    define IRenderDeviceVk_CreateTLASFromVulkanResource(This, ...)   CALL_IFACE_METHOD(RenderDeviceVk, CreateTLASFromVulkanResource,   This, __VA_ARGS__)
 #    define IRenderDeviceVk_CreateFenceFromVulkanResource(This, ...)  CALL_IFACE_METHOD(RenderDeviceVk, CreateFenceFromVulkanResource,  This, __VA_ARGS__)
+#    define IRenderDeviceVk_CreateTransientTexture(This, ...)         CALL_IFACE_METHOD(RenderDeviceVk, CreateTransientTexture,         This, __VA_ARGS__)
+#    define IRenderDeviceVk_GetTransientMemoryStats(This)             CALL_IFACE_METHOD(RenderDeviceVk, GetTransientMemoryStats,        This)
+#    define IRenderDeviceVk_GetMemoryStats(This)                      CALL_IFACE_METHOD(RenderDeviceVk, GetMemoryStats,                 This)
 
 // clang-format on
 
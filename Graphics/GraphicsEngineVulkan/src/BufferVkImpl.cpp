@@ -189,6 +189,15 @@ BufferVkImpl::BufferVkImpl(IReferenceCounters*        pRefCounters,
         // Read-only storage buffers (aka structured buffers) don't need a backing buffer.
         ((VkBuffCI.usage & VK_BUFFER_USAGE_STORAGE_BUFFER_BIT) != 0 && (m_Desc.BindFlags & BIND_UNORDERED_ACCESS) != 0);
 
+    // When descriptor buffers are used, buffer descriptors reference buffer memory through device addresses.
+    // Note that this must be done after RequiresBackingBuffer is computed so that dynamic buffers
+    // are still suballocated from the dynamic heap, which has the device address usage.
+    const bool UseDeviceAddressForDescriptors =
+        pRenderDeviceVk->UseDescriptorBuffers() &&
+        (VkBuffCI.usage & (VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_UNIFORM_TEXEL_BUFFER_BIT | VK_BUFFER_USAGE_STORAGE_TEXEL_BUFFER_BIT)) != 0;
+    if (UseDeviceAddressForDescriptors)
+        VkBuffCI.usage |= VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT;
+
     if (m_Desc.Usage == USAGE_SPARSE)
     {
         VkBuffCI.flags =
@@ -197,6 +206,8 @@ BufferVkImpl::BufferVkImpl(IReferenceCounters*        pRefCounters,
             (m_Desc.MiscFlags & MISC_BUFFER_FLAG_SPARSE_ALIASING ? VK_BUFFER_CREATE_SPARSE_ALIASED_BIT : 0);
 
         m_VulkanBuffer = LogicalDevice.CreateBuffer(VkBuffCI, m_Desc.Name);
+        if (UseDeviceAddressForDescriptors)
+            m_VkDeviceAddress = LogicalDevice.GetBufferDeviceAddress(m_VulkanBuffer);
 
         SetState(RESOURCE_STATE_UNDEFINED);
     }
@@ -326,6 +337,9 @@ BufferVkImpl::BufferVkImpl(IReferenceCounters*        pRefCounters,
         auto err    = LogicalDevice.BindBufferMemory(m_VulkanBuffer, Memory, m_BufferMemoryAlignedOffset);
         CHECK_VK_ERROR_AND_THROW(err, "Failed to bind buffer memory");
 
+        if (UseDeviceAddressForDescriptors)
+            m_VkDeviceAddress = LogicalDevice.GetBufferDeviceAddress(m_VulkanBuffer);
+
         VERIFY(!AlignToNonCoherentAtomSize || (m_BufferMemoryAlignedOffset + MemReqs.size) % DeviceLimits.nonCoherentAtomSize == 0, "End offset is not properly aligned");
 
 #ifdef DILIGENT_DEBUG
@@ -556,6 +570,21 @@ VkBuffer BufferVkImpl::GetVkBuffer() const
     }
 }
 
+VkDeviceAddress BufferVkImpl::GetVkBufferDeviceAddress() const
+{
+    VERIFY(m_pDevice->UseDescriptorBuffers(), "Buffer device address is only initialized when descriptor buffers are used");
+    if (m_VulkanBuffer != VK_NULL_HANDLE)
+    {
+        VERIFY(m_VkDeviceAddress != 0, "Device address of buffer '", m_Desc.Name, "' is not initialized");
+        return m_VkDeviceAddress;
+    }
+    else
+    {
+        VERIFY(m_Desc.Usage == USAGE_DYNAMIC, "Dynamic buffer expected");
+        return m_pDevice->GetDynamicMemoryManager().GetVkDeviceAddress();
+    }
+}
+
 void BufferVkImpl::SetAccessFlags(VkAccessFlags AccessFlags)
 {
     SetState(VkAccessFlagsToResourceStates(AccessFlags));
@@ -27,6 +27,9 @@
 
 #include "pch.h"
 #include "DescriptorPoolManager.hpp"
+
+#include <atomic>
+
 #include "RenderDeviceVkImpl.hpp"
 
 namespace Diligent
@@ -36,7 +39,7 @@ void DescriptorSetAllocation::Release()
 {
     if (Set != VK_NULL_HANDLE)
     {
-        VERIFY_EXPR(DescrSetAllocator != nullptr && Pool != VK_NULL_HANDLE);
+        VERIFY_EXPR(DescrSetAllocator != nullptr && Pool != nullptr);
         DescrSetAllocator->FreeDescriptorSet(Set, Pool, CmdQueueMask);
 
         Reset();
@@ -190,54 +193,141 @@ static VkDescriptorSet AllocateDescriptorSet(const VulkanUtilities::VulkanLogica
 }
 
 
+static size_t GetThreadSlotIndex()
+{
+    // Threads are assigned to slots in round-robin order when they first allocate a set.
+    // Thread id hashes are not suitable here as e.g. libc++ does not mix the bits of the id.
+    static std::atomic<size_t>       NextSlotIndex{0};
+    static thread_local const size_t SlotIndex = NextSlotIndex.fetch_add(1) % DescriptorSetAllocator::NumThreadSlots;
+    return SlotIndex;
+}
+
 DescriptorSetAllocator::~DescriptorSetAllocator()
 {
     DEV_CHECK_ERR(m_AllocatedSetCounter == 0, m_AllocatedSetCounter, " descriptor set(s) have not been returned to the allocator. If there are outstanding references to the sets in release queues, the app will crash when DescriptorSetAllocator::FreeDescriptorSet() is called");
+
+    // Move all pools to the pool manager that will destroy them
+    for (auto& pPool : m_AllPools)
+        m_Pools.emplace_back(std::move(pPool->Pool));
 }
 
-DescriptorSetAllocation DescriptorSetAllocator::Allocate(Uint64 CommandQueueMask, VkDescriptorSetLayout SetLayout, const char* DebugName)
+DescriptorSetPool& DescriptorSetAllocator::AcquirePool()
 {
-    // Descriptor pools are externally synchronized, meaning that the application must not allocate
-    // and/or free descriptor sets from the same pool in multiple threads simultaneously (13.2.3)
-    std::lock_guard<std::mutex> Lock{m_Mutex};
+    DescriptorSetPool* pPool = nullptr;
+    {
+        std::lock_guard<std::mutex> Lock{m_Mutex};
+        if (!m_AvailablePools.empty())
+        {
+            pPool = m_AvailablePools.back();
+            m_AvailablePools.pop_back();
+        }
+        else
+        {
+            LOG_INFO_MESSAGE("Allocated new descriptor pool");
+            m_AllPools.emplace_back(std::make_unique<DescriptorSetPool>(CreateDescriptorPool("Descriptor pool")));
+            pPool = m_AllPools.back().get();
+        }
+    }
 
+    // Note that the pool mutex is never locked while m_Mutex is held
+    std::lock_guard<std::mutex> PoolLock{pPool->Mtx};
+    VERIFY_EXPR(pPool->State == DescriptorSetPool::STATE::AVAILABLE);
+    pPool->State = DescriptorSetPool::STATE::ACTIVE;
+    return *pPool;
+}
+
+void DescriptorSetAllocator::FlushPendingFreeSets(DescriptorSetPool& Pool)
+{
+    if (!Pool.PendingFree.empty())
+    {
+        m_DeviceVkImpl.GetLogicalDevice().FreeDescriptorSets(Pool.Pool, StaticCast<uint32_t>(Pool.PendingFree.size()), Pool.PendingFree.data());
+        Pool.PendingFree.clear();
+    }
+}
+
+DescriptorSetAllocation DescriptorSetAllocator::Allocate(Uint64 CommandQueueMask, VkDescriptorSetLayout SetLayout, const char* DebugName)
+{
     const auto& LogicalDevice = m_DeviceVkImpl.GetLogicalDevice();
-    // Try all pools starting from the frontmost
-    for (auto it = m_Pools.begin(); it != m_Pools.end(); ++it)
+
+    // Threads that are assigned to different slots allocate from different pools
+    auto&                       Slot = m_ThreadSlots[GetThreadSlotIndex()];
+    std::lock_guard<std::mutex> SlotLock{Slot.Mtx};
+    while (true)
     {
-        auto& Pool = *it;
-        auto  Set  = AllocateDescriptorSet(LogicalDevice, Pool, SetLayout, DebugName);
-        if (Set != VK_NULL_HANDLE)
+        if (Slot.pPool == nullptr)
+            Slot.pPool = &AcquirePool();
+
+        auto& Pool = *Slot.pPool;
         {
-            // Move the pool to the front
-            if (it != m_Pools.begin())
-            {
-                std::swap(*it, m_Pools.front());
-            }
+            // Descriptor pools are externally synchronized, meaning that the application must not allocate
+            // and/or free descriptor sets from the same pool in multiple threads simultaneously (13.2.3)
+            std::lock_guard<std::mutex> PoolLock{Pool.Mtx};
+            VERIFY_EXPR(Pool.State == DescriptorSetPool::STATE::ACTIVE);
+
+            FlushPendingFreeSets(Pool);
 
+            auto Set = AllocateDescriptorSet(LogicalDevice, Pool.Pool, SetLayout, DebugName);
+            if (Set != VK_NULL_HANDLE)
+            {
+                ++Pool.NumAllocatedSets;
 #ifdef DILIGENT_DEVELOPMENT
-            ++m_AllocatedSetCounter;
+                ++m_AllocatedSetCounter;
 #endif
-            return {Set, Pool, CommandQueueMask, *this};
+                return {Set, &Pool, CommandQueueMask, *this};
+            }
+
+            if (Pool.NumAllocatedSets == 0)
+            {
+                // The set does not fit into an empty pool, so trying other pools is pointless
+                DEV_ERROR("Failed to allocate descriptor set '", DebugName, "'");
+                return {};
+            }
+
+            // Do not use the pool until enough sets are freed
+            Pool.State             = DescriptorSetPool::STATE::FULL;
+            Pool.NumFreedSinceFull = 0;
         }
+        Slot.pPool = nullptr;
     }
+}
 
-    // Failed to allocate descriptor from existing pools -> create a new one
-    LOG_INFO_MESSAGE("Allocated new descriptor pool");
-    m_Pools.emplace_front(CreateDescriptorPool("Descriptor pool"));
+void DescriptorSetAllocator::ReturnDescriptorSet(DescriptorSetPool& Pool, VkDescriptorSet Set)
+{
+    bool MakeAvailable = false;
+    {
+        std::lock_guard<std::mutex> PoolLock{Pool.Mtx};
+        VERIFY_EXPR(Pool.NumAllocatedSets > 0);
+        --Pool.NumAllocatedSets;
 
-    auto& NewPool = m_Pools.front();
-    auto  Set     = AllocateDescriptorSet(LogicalDevice, NewPool, SetLayout, DebugName);
-    DEV_CHECK_ERR(Set != VK_NULL_HANDLE, "Failed to allocate descriptor set");
+        // Sets released by the device in the same release queue purge are freed in batches
+        Pool.PendingFree.push_back(Set);
+        if (Pool.State != DescriptorSetPool::STATE::ACTIVE || Pool.PendingFree.size() >= MaxPendingFreeSets)
+            FlushPendingFreeSets(Pool);
+
+        if (Pool.State == DescriptorSetPool::STATE::FULL)
+        {
+            // Make the pool available again when a quarter of its sets have been freed or when it is empty
+            ++Pool.NumFreedSinceFull;
+            if (Pool.NumFreedSinceFull >= std::max(m_MaxSets / 4, 1u) || Pool.NumAllocatedSets == 0)
+            {
+                Pool.State    = DescriptorSetPool::STATE::AVAILABLE;
+                MakeAvailable = true;
+            }
+        }
+    }
+
+    if (MakeAvailable)
+    {
+        std::lock_guard<std::mutex> Lock{m_Mutex};
+        m_AvailablePools.push_back(&Pool);
+    }
 
 #ifdef DILIGENT_DEVELOPMENT
-    ++m_AllocatedSetCounter;
+    --m_AllocatedSetCounter;
 #endif
-
-    return {Set, NewPool, CommandQueueMask, *this};
 }
 
-void DescriptorSetAllocator::FreeDescriptorSet(VkDescriptorSet Set, VkDescriptorPool Pool, Uint64 QueueMask)
+void DescriptorSetAllocator::FreeDescriptorSet(VkDescriptorSet Set, DescriptorSetPool* Pool, Uint64 QueueMask)
 {
     class DescriptorSetDeleter
     {
@@ -245,7 +335,7 @@ void DescriptorSetAllocator::FreeDescriptorSet(VkDescriptorSet Set, VkDescriptor
         // clang-format off
         DescriptorSetDeleter(DescriptorSetAllocator& _Allocator,
                              VkDescriptorSet         _Set,
-                             VkDescriptorPool        _Pool) :
+                             DescriptorSetPool*      _Pool) :
             Allocator {&_Allocator},
             Set       {_Set       },
             Pool      {_Pool      }
@@ -262,7 +352,7 @@ void DescriptorSetAllocator::FreeDescriptorSet(VkDescriptorSet Set, VkDescriptor
         {
             rhs.Allocator = nullptr;
             rhs.Set       = VK_NULL_HANDLE;
-            rhs.Pool      = VK_NULL_HANDLE;
+            rhs.Pool      = nullptr;
         }
         // clang-format on
 
@@ -270,18 +360,14 @@ void DescriptorSetAllocator::FreeDescriptorSet(VkDescriptorSet Set, VkDescriptor
         {
             if (Allocator != nullptr)
             {
-                std::lock_guard<std::mutex> Lock{Allocator->m_Mutex};
-                Allocator->m_DeviceVkImpl.GetLogicalDevice().FreeDescriptorSet(Pool, Set);
-#ifdef DILIGENT_DEVELOPMENT
-                --Allocator->m_AllocatedSetCounter;
-#endif
+                Allocator->ReturnDescriptorSet(*Pool, Set);
             }
         }
 
     private:
         DescriptorSetAllocator* Allocator;
         VkDescriptorSet         Set;
-        VkDescriptorPool        Pool;
+        DescriptorSetPool*      Pool;
     };
     m_DeviceVkImpl.SafeReleaseDeviceObject(DescriptorSetDeleter{*this, Set, Pool}, QueueMask);
 }
@@ -101,6 +101,9 @@ DeviceContextVkImpl::DeviceContextVkImpl(IReferenceCounters*       pRefCounters,
     }
 // clang-format on
 {
+    m_CommandBuffer.SetSynchronization2Enabled(pDeviceVkImpl->GetLogicalDevice().GetEnabledExtFeatures().Synchronization2.synchronization2 != VK_FALSE);
+    m_CommandBuffer.SetBarrierCounters(&m_Stats.BarrierCounters);
+
     if (!IsDeferred())
     {
         PrepareCommandPool(GetCommandQueueId());
@@ -387,6 +390,7 @@ void DeviceContextVkImpl::SetPipelineState(IPipelineState* pPipelineState)
 
         SetInfo.BaseInd            = Layout.GetFirstDescrSetIndex(pSignature->GetDesc().BindingIndex);
         SetInfo.DynamicOffsetCount = pSignature->GetDynamicOffsetCount();
+        SetInfo.PushDynamicSet     = pSignature->UsePushDescriptors();
         TotalDynamicOffsetCount += SetInfo.DynamicOffsetCount;
     }
 
@@ -417,21 +421,119 @@ DeviceContextVkImpl::ResourceBindInfo& DeviceContextVkImpl::GetBindInfo(PIPELINE
     return m_BindInfo[Indices[Uint32{Type}]];
 }
 
+void DeviceContextVkImpl::CommitDescriptorBuffers(ResourceBindInfo& BindInfo, Uint32 CommitSRBMask)
+{
+    VERIFY(CommitSRBMask != 0, "This method should not be called when there is nothing to commit");
+    VERIFY_EXPR(m_State.vkPipelineBindPoint != VK_PIPELINE_BIND_POINT_MAX_ENUM);
+
+    const auto& LogicalDevice  = m_pDevice->GetLogicalDevice();
+    auto&       DynamicMemMgr  = m_pDevice->GetDynamicMemoryManager();
+    const auto  DescrAlignment = StaticCast<Uint32>(m_pDevice->GetPhysicalDevice().GetExtProperties().DescriptorBuffer.descriptorBufferOffsetAlignment);
+
+    // The global dynamic buffer is the only descriptor buffer. It is never resized, so it
+    // only needs to be bound once per command buffer.
+    m_CommandBuffer.BindDescriptorBuffer(DynamicMemMgr.GetVkDeviceAddress(),
+                                         VK_BUFFER_USAGE_RESOURCE_DESCRIPTOR_BUFFER_BIT_EXT | VK_BUFFER_USAGE_SAMPLER_DESCRIPTOR_BUFFER_BIT_EXT);
+
+    constexpr std::array<uint32_t, MAX_DESCR_SET_PER_SIGNATURE> BufferIndices = {};
+    std::array<VkDeviceSize, MAX_DESCR_SET_PER_SIGNATURE>       Offsets;
+
+    while (CommitSRBMask != 0)
+    {
+        const auto sign = PlatformMisc::GetLSB(CommitSRBMask);
+        CommitSRBMask &= ~(1u << sign);
+        VERIFY_EXPR(sign < m_pPipelineState->GetResourceSignatureCount());
+
+        const auto* pResourceCache = BindInfo.ResourceCaches[sign];
+        if (pResourceCache == nullptr)
+            continue;
+
+        const auto  NumSets    = pResourceCache->GetNumDescriptorSets();
+        const auto* pSignature = m_pPipelineState->GetResourceSignature(sign);
+        VERIFY_EXPR(pSignature != nullptr && pSignature->GetNumDescriptorSets() == NumSets);
+        if (NumSets == 0)
+            continue;
+
+        // Descriptors are written directly into the dynamic heap, so binding only requires setting the offsets.
+        // Note that compatible signatures have identical set layouts.
+        for (Uint32 s = 0; s < NumSets; ++s)
+        {
+            const auto& Slots      = pSignature->GetDescriptorBufferSlots(s);
+            const auto  Allocation = AllocateDynamicSpace(pSignature->GetDescriptorBufferSetSize(s), DescrAlignment);
+            pResourceCache->WriteDescriptorBufferData(LogicalDevice, s, Slots.data(), StaticCast<Uint32>(Slots.size()), GetContextId(),
+                                                      DynamicMemMgr.GetCPUAddress() + Allocation.AlignedOffset);
+            Offsets[s] = Allocation.AlignedOffset;
+        }
+
+        auto& SetInfo = BindInfo.SetInfo[sign];
+        m_CommandBuffer.SetDescriptorBufferOffsets(m_State.vkPipelineBindPoint, BindInfo.vkPipelineLayout, SetInfo.BaseInd, NumSets,
+                                                   BufferIndices.data(), Offsets.data());
+#ifdef DILIGENT_DEVELOPMENT
+        SetInfo.LastBoundBaseInd = SetInfo.BaseInd;
+#endif
+    }
+
+    BindInfo.StaleSRBMask &= ~BindInfo.ActiveSRBMask;
+}
+
 void DeviceContextVkImpl::CommitDescriptorSets(ResourceBindInfo& BindInfo, Uint32 CommitSRBMask)
 {
     VERIFY(CommitSRBMask != 0, "This method should not be called when there is nothing to commit");
 
+    if (m_pDevice->UseDescriptorBuffers())
+    {
+        CommitDescriptorBuffers(BindInfo, CommitSRBMask);
+        return;
+    }
+
     const auto FirstSign = PlatformMisc::GetLSB(CommitSRBMask);
     const auto LastSign  = PlatformMisc::GetMSB(CommitSRBMask);
     VERIFY_EXPR(LastSign < m_pPipelineState->GetResourceSignatureCount());
 
+    VERIFY_EXPR(m_State.vkPipelineBindPoint != VK_PIPELINE_BIND_POINT_MAX_ENUM);
+
     // Bind all descriptor sets in a single BindDescriptorSets call
-    uint32_t   DynamicOffsetCount = 0;
-    uint32_t   TotalSetCount      = 0;
-    const auto FirstSetToBind     = BindInfo.SetInfo[FirstSign].BaseInd;
+    uint32_t DynamicOffsetCount = 0;
+    uint32_t TotalSetCount      = 0;
+    auto     FirstSetToBind     = BindInfo.SetInfo[FirstSign].BaseInd;
     for (Uint32 sign = FirstSign; sign <= LastSign; ++sign)
     {
         auto& SetInfo = BindInfo.SetInfo[sign];
+        if (SetInfo.PushDynamicSet)
+        {
+            // Only the signature with binding index 0 may use push descriptors, so it is always
+            // committed first when it is in the range.
+            VERIFY_EXPR(sign == FirstSign && TotalSetCount == 0);
+
+            const auto* pResourceCache = BindInfo.ResourceCaches[sign];
+            DEV_CHECK_ERR(pResourceCache != nullptr, "Resource cache at binding index ", sign, " is null");
+            const auto* pSignature = m_pPipelineState->GetResourceSignature(sign);
+            VERIFY_EXPR(pSignature != nullptr && pSignature->UsePushDescriptors());
+
+            // The dynamic descriptor set is always the last set of the signature
+            const auto DynamicSetIdx = pSignature->GetDescriptorSetIndex<PipelineResourceSignatureVkImpl::DESCRIPTOR_SET_ID_DYNAMIC>();
+            if (SetInfo.vkSets[0] != VK_NULL_HANDLE)
+            {
+                VERIFY_EXPR(DynamicSetIdx == 1);
+                if (SetInfo.DynamicOffsetCount > 0)
+                {
+                    auto NumOffsetsWritten = pResourceCache->GetDynamicBufferOffsets(GetContextId(), m_DynamicBufferOffsets, 0, 1);
+                    VERIFY_EXPR(NumOffsetsWritten == SetInfo.DynamicOffsetCount);
+                }
+                m_CommandBuffer.BindDescriptorSets(m_State.vkPipelineBindPoint, BindInfo.vkPipelineLayout, SetInfo.BaseInd, 1,
+                                                   &SetInfo.vkSets[0], SetInfo.DynamicOffsetCount, m_DynamicBufferOffsets.data());
+            }
+            pSignature->PushDynamicResources(*pResourceCache, m_CommandBuffer, m_State.vkPipelineBindPoint, BindInfo.vkPipelineLayout,
+                                             SetInfo.BaseInd + DynamicSetIdx, GetContextId());
+
+            // Sets of the following signatures are bound after the push descriptor set
+            FirstSetToBind = SetInfo.BaseInd + DynamicSetIdx + 1;
+#ifdef DILIGENT_DEVELOPMENT
+            SetInfo.LastBoundBaseInd = SetInfo.BaseInd;
+#endif
+            continue;
+        }
+
         VERIFY(SetInfo.vkSets[0] != VK_NULL_HANDLE || (CommitSRBMask & (1u << sign)) == 0,
                "At least one descriptor set in the stale SRB must not be NULL. Empty SRBs should not be marked as stale by CommitShaderResources()");
 
@@ -458,7 +560,7 @@ void DeviceContextVkImpl::CommitDescriptorSets(ResourceBindInfo& BindInfo, Uint3
             VERIFY(m_DynamicBufferOffsets.size() >= size_t{DynamicOffsetCount} + size_t{SetInfo.DynamicOffsetCount},
                    "m_DynamicBufferOffsets must've been resized by SetPipelineState() to have enough space");
 
-            auto NumOffsetsWritten = pResourceCache->GetDynamicBufferOffsets(GetContextId(), m_DynamicBufferOffsets, DynamicOffsetCount);
+            auto NumOffsetsWritten = pResourceCache->GetDynamicBufferOffsets(GetContextId(), m_DynamicBufferOffsets, DynamicOffsetCount, pResourceCache->GetNumDescriptorSets());
             VERIFY_EXPR(NumOffsetsWritten == SetInfo.DynamicOffsetCount);
             DynamicOffsetCount += SetInfo.DynamicOffsetCount;
         }
@@ -476,9 +578,11 @@ void DeviceContextVkImpl::CommitDescriptorSets(ResourceBindInfo& BindInfo, Uint3
     // (either compute or graphics, according to the pipelineBindPoint). Any bindings that were previously
     // applied via these sets are no longer valid.
     // https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/vkCmdBindDescriptorSets.html
-    VERIFY_EXPR(m_State.vkPipelineBindPoint != VK_PIPELINE_BIND_POINT_MAX_ENUM);
-    m_CommandBuffer.BindDescriptorSets(m_State.vkPipelineBindPoint, BindInfo.vkPipelineLayout, FirstSetToBind, TotalSetCount,
-                                       m_DescriptorSets.data(), DynamicOffsetCount, m_DynamicBufferOffsets.data());
+    if (TotalSetCount > 0)
+    {
+        m_CommandBuffer.BindDescriptorSets(m_State.vkPipelineBindPoint, BindInfo.vkPipelineLayout, FirstSetToBind, TotalSetCount,
+                                           m_DescriptorSets.data(), DynamicOffsetCount, m_DynamicBufferOffsets.data());
+    }
 
     BindInfo.StaleSRBMask &= ~BindInfo.ActiveSRBMask;
 }
@@ -502,8 +606,13 @@ void DeviceContextVkImpl::DvpValidateCommittedShaderResources(ResourceBindInfo&
 
         const auto& SetInfo = BindInfo.SetInfo[i];
         const auto  DSCount = pSign->GetNumDescriptorSets();
-        for (Uint32 s = 0; s < DSCount; ++s)
+        // Descriptor sets are not used with descriptor buffers
+        for (Uint32 s = 0; s < DSCount && !m_pDevice->UseDescriptorBuffers(); ++s)
         {
+            // The dynamic set is the last one and is not allocated when it is pushed
+            if (SetInfo.PushDynamicSet && s == DSCount - 1)
+                continue;
+
             DEV_CHECK_ERR(SetInfo.vkSets[s] != VK_NULL_HANDLE,
                           "descriptor set with index ", s, " is not bound for resource signature '",
                           pSign->GetDesc().Name, "', binding index ", i, ".");
@@ -569,6 +678,10 @@ void DeviceContextVkImpl::CommitShaderResources(IShaderResourceBinding* pShaderR
     // are set by SetPipelineState().
     SetInfo.vkSets = {};
 
+    // With descriptor buffers, descriptors of all sets are written by CommitDescriptorBuffers()
+    if (m_pDevice->UseDescriptorBuffers())
+        return;
+
     Uint32 DSIndex = 0;
     if (pSignature->HasDescriptorSet(PipelineResourceSignatureVkImpl::DESCRIPTOR_SET_ID_STATIC_MUTABLE))
     {
@@ -579,7 +692,8 @@ void DeviceContextVkImpl::CommitShaderResources(IShaderResourceBinding* pShaderR
         ++DSIndex;
     }
 
-    if (pSignature->HasDescriptorSet(PipelineResourceSignatureVkImpl::DESCRIPTOR_SET_ID_DYNAMIC))
+    // Push descriptors are written by CommitDescriptorSets() when the pipeline layout is known
+    if (pSignature->HasDescriptorSet(PipelineResourceSignatureVkImpl::DESCRIPTOR_SET_ID_DYNAMIC) && !pSignature->UsePushDescriptors())
     {
         VERIFY_EXPR(DSIndex == pSignature->GetDescriptorSetIndex<PipelineResourceSignatureVkImpl::DESCRIPTOR_SET_ID_DYNAMIC>());
         VERIFY_EXPR(const_cast<const ShaderResourceCacheVk&>(ResourceCache).GetDescriptorSet(DSIndex).GetVkDescriptorSet() == VK_NULL_HANDLE);
@@ -605,7 +719,7 @@ void DeviceContextVkImpl::CommitShaderResources(IShaderResourceBinding* pShaderR
         ++DSIndex;
     }
 
-    VERIFY_EXPR(DSIndex == ResourceCache.GetNumDescriptorSets());
+    VERIFY_EXPR(DSIndex + (pSignature->UsePushDescriptors() ? 1 : 0) == ResourceCache.GetNumDescriptorSets());
 }
 
 void DeviceContextVkImpl::SetStencilRef(Uint32 StencilRef)
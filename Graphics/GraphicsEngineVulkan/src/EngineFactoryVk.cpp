@@ -1161,6 +1161,80 @@ void EngineFactoryVkImpl::CreateDeviceAndContextsVk(const EngineVkCreateInfo& En
                 NextExt  = &EnabledExtFeats.ShaderDrawParameters.pNext;
             }
 
+#if DILIGENT_USE_VOLK
+            // Synchronization2 is not exposed as a device feature, but is used by the device
+            // context to batch pipeline barriers when available.
+            // vkCmdPipelineBarrier2KHR is only available when the Vulkan loader is volk.
+            if (DeviceExtFeatures.Synchronization2.synchronization2 != VK_FALSE)
+            {
+                VERIFY_EXPR(PhysicalDevice->IsExtensionSupported(VK_KHR_SYNCHRONIZATION_2_EXTENSION_NAME));
+                DeviceExtensions.push_back(VK_KHR_SYNCHRONIZATION_2_EXTENSION_NAME);
+
+                EnabledExtFeats.Synchronization2 = DeviceExtFeatures.Synchronization2;
+
+                *NextExt = &EnabledExtFeats.Synchronization2;
+                NextExt  = &EnabledExtFeats.Synchronization2.pNext;
+            }
+
+            // Descriptor buffers replace descriptor sets for all pipelines and resource signatures
+            // created by the device, so they are only enabled when explicitly requested.
+            if (EngineCI.EnableDescriptorBuffer)
+            {
+                const auto& DescrBufferProps = PhysicalDevice->GetExtProperties().DescriptorBuffer;
+                if (DeviceExtFeatures.DescriptorBuffer.descriptorBuffer == VK_FALSE)
+                {
+                    LOG_WARNING_MESSAGE("Descriptor buffers are requested, but VK_EXT_descriptor_buffer extension is not supported by the device. Descriptor sets will be used instead.");
+                }
+                else if (DeviceExtFeatures.BufferDeviceAddress.bufferDeviceAddress == VK_FALSE)
+                {
+                    LOG_WARNING_MESSAGE("Descriptor buffers are requested, but buffer device address feature is not supported by the device. Descriptor sets will be used instead.");
+                }
+                else if (EngineCI.DynamicHeapSize > DescrBufferProps.maxResourceDescriptorBufferRange ||
+                         EngineCI.DynamicHeapSize > DescrBufferProps.maxSamplerDescriptorBufferRange)
+                {
+                    LOG_WARNING_MESSAGE("Descriptor buffers are requested, but the dynamic heap size (", EngineCI.DynamicHeapSize,
+                                        ") exceeds the maximum descriptor buffer range supported by the device. Descriptor sets will be used instead.");
+                }
+                else
+                {
+                    VERIFY_EXPR(PhysicalDevice->IsExtensionSupported(VK_EXT_DESCRIPTOR_BUFFER_EXTENSION_NAME));
+                    DeviceExtensions.push_back(VK_EXT_DESCRIPTOR_BUFFER_EXTENSION_NAME);
+
+                    EnabledExtFeats.DescriptorBuffer = DeviceExtFeatures.DescriptorBuffer;
+
+                    // disable unused features
+                    EnabledExtFeats.DescriptorBuffer.descriptorBufferCaptureReplay      = VK_FALSE;
+                    EnabledExtFeats.DescriptorBuffer.descriptorBufferImageLayoutIgnored = VK_FALSE;
+                    EnabledExtFeats.DescriptorBuffer.descriptorBufferPushDescriptors    = VK_FALSE;
+
+                    *NextExt = &EnabledExtFeats.DescriptorBuffer;
+                    NextExt  = &EnabledExtFeats.DescriptorBuffer.pNext;
+
+                    // Buffer device address may have already been enabled for ray tracing
+                    if (EnabledExtFeats.BufferDeviceAddress.bufferDeviceAddress == VK_FALSE)
+                    {
+                        VERIFY(PhysicalDevice->IsExtensionSupported(VK_KHR_BUFFER_DEVICE_ADDRESS_EXTENSION_NAME), "VK_KHR_buffer_device_address extension must be supported");
+                        DeviceExtensions.push_back(VK_KHR_BUFFER_DEVICE_ADDRESS_EXTENSION_NAME);
+
+                        EnabledExtFeats.BufferDeviceAddress = DeviceExtFeatures.BufferDeviceAddress;
+
+                        *NextExt = &EnabledExtFeats.BufferDeviceAddress;
+                        NextExt  = &EnabledExtFeats.BufferDeviceAddress.pNext;
+                    }
+                }
+            }
+
+            // Push descriptors are used by resource signatures for small dynamic descriptor sets.
+            // They are not needed when descriptor buffers are enabled.
+            if (DeviceExtFeatures.PushDescriptor && EnabledExtFeats.DescriptorBuffer.descriptorBuffer == VK_FALSE)
+            {
+                VERIFY_EXPR(PhysicalDevice->IsExtensionSupported(VK_KHR_PUSH_DESCRIPTOR_EXTENSION_NAME));
+                DeviceExtensions.push_back(VK_KHR_PUSH_DESCRIPTOR_EXTENSION_NAME);
+
+                EnabledExtFeats.PushDescriptor = true;
+            }
+#endif
+
             // Append user-defined features
             *NextExt = EngineCI.pDeviceExtensionFeatures;
         }
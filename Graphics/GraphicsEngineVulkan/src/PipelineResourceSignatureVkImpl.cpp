@@ -34,7 +34,8 @@
 #include "TextureViewVkImpl.hpp"
 
 #include "VulkanTypeConversions.hpp"
-#include "DynamicLinearAllocator.hpp"
+#include "VulkanUtilities/VulkanCommandBuffer.hpp"
+#include "FrameArena.hpp"
 #include "SPIRVShaderResources.hpp"
 
 namespace Diligent
@@ -111,6 +112,34 @@ Uint32 FindImmutableSamplerVk(const PipelineResourceDesc&          Res,
     return FindImmutableSampler(Desc.ImmutableSamplers, Desc.NumImmutableSamplers, Res.ShaderStages, Res.Name, SamplerSuffix);
 }
 
+// Descriptor update batch sizes used by CommitDynamicResources()
+struct DescriptorUpdateBatchSizes
+{
+#ifdef DILIGENT_DEBUG
+    static constexpr size_t ImgUpdateBatchSize          = 4;
+    static constexpr size_t BuffUpdateBatchSize         = 2;
+    static constexpr size_t TexelBuffUpdateBatchSize    = 2;
+    static constexpr size_t AccelStructBatchSize        = 2;
+    static constexpr size_t WriteDescriptorSetBatchSize = 2;
+#else
+    static constexpr size_t ImgUpdateBatchSize          = 64;
+    static constexpr size_t BuffUpdateBatchSize         = 32;
+    static constexpr size_t TexelBuffUpdateBatchSize    = 16;
+    static constexpr size_t AccelStructBatchSize        = 16;
+    static constexpr size_t WriteDescriptorSetBatchSize = 32;
+#endif
+};
+
+// Push descriptors must be written in a single batch, see PushDynamicResources()
+struct PushDescriptorBatchSizes
+{
+    static constexpr size_t ImgUpdateBatchSize          = PipelineResourceSignatureVkImpl::MAX_PUSH_DESCRIPTORS;
+    static constexpr size_t BuffUpdateBatchSize         = PipelineResourceSignatureVkImpl::MAX_PUSH_DESCRIPTORS;
+    static constexpr size_t TexelBuffUpdateBatchSize    = PipelineResourceSignatureVkImpl::MAX_PUSH_DESCRIPTORS;
+    static constexpr size_t AccelStructBatchSize        = PipelineResourceSignatureVkImpl::MAX_PUSH_DESCRIPTORS;
+    static constexpr size_t WriteDescriptorSetBatchSize = PipelineResourceSignatureVkImpl::MAX_PUSH_DESCRIPTORS;
+};
+
 } // namespace
 
 inline PipelineResourceSignatureVkImpl::CACHE_GROUP PipelineResourceSignatureVkImpl::GetResourceCacheGroup(const PipelineResourceDesc& Res)
@@ -246,7 +275,8 @@ void PipelineResourceSignatureVkImpl::CreateSetLayouts(const bool IsSerialized)
 
     std::array<std::vector<VkDescriptorSetLayoutBinding>, DESCRIPTOR_SET_ID_NUM_SETS> vkSetLayoutBindings;
 
-    DynamicLinearAllocator TempAllocator{GetRawAllocator(), 256};
+    FrameArena::Scope TempScope;
+    auto&             TempAllocator = TempScope.GetAllocator();
 
     std::vector<bool> ImmutableSamplerWithResource(m_Desc.NumImmutableSamplers, false);
     for (Uint32 i = 0; i < m_Desc.NumResources; ++i)
@@ -424,6 +454,40 @@ void PipelineResourceSignatureVkImpl::CreateSetLayouts(const bool IsSerialized)
         vkSetLayoutBindings[SetId].push_back(vkSetLayoutBinding);
     }
 
+    // Small dynamic descriptor sets are pushed directly into the command buffer, which avoids allocating
+    // a new descriptor set on every commit. Only one push descriptor set is allowed in a pipeline layout,
+    // so only the signature with binding index 0 may use push descriptors.
+    m_UsePushDescriptors = false;
+    if (HasDevice() && m_Desc.BindingIndex == 0 && DSMapping[DESCRIPTOR_SET_ID_DYNAMIC] < MAX_DESCRIPTOR_SETS)
+    {
+        const auto& LogicalDevice = GetDevice()->GetLogicalDevice();
+        if (LogicalDevice.GetEnabledExtFeatures().PushDescriptor)
+        {
+            Uint32 NumDynamicDescriptors = 0;
+            for (const auto& Binding : vkSetLayoutBindings[DESCRIPTOR_SET_ID_DYNAMIC])
+                NumDynamicDescriptors += Binding.descriptorCount;
+
+            const auto MaxPushDescriptors = GetDevice()->GetPhysicalDevice().GetExtProperties().PushDescriptor.maxPushDescriptors;
+            m_UsePushDescriptors          = NumDynamicDescriptors <= std::min(MaxPushDescriptors, Uint32{MAX_PUSH_DESCRIPTORS});
+        }
+    }
+
+    if (m_UsePushDescriptors)
+    {
+        // Push descriptor set layouts can't contain dynamic uniform or storage buffers.
+        // Dynamic offsets are instead baked into the descriptors when they are pushed, see PushDynamicResources().
+        // Note that resource attributes keep the original descriptor types.
+        for (auto& Binding : vkSetLayoutBindings[DESCRIPTOR_SET_ID_DYNAMIC])
+        {
+            if (Binding.descriptorType == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC)
+                Binding.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+            else if (Binding.descriptorType == VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC)
+                Binding.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+        }
+        m_DynamicUniformBufferCount = static_cast<Uint16>(CacheGroupSizes[CACHE_GROUP_DYN_UB_STAT_VAR]);
+        m_DynamicStorageBufferCount = static_cast<Uint16>(CacheGroupSizes[CACHE_GROUP_DYN_SB_STAT_VAR]);
+    }
+
     Uint32 NumSets = 0;
     if (DSMapping[DESCRIPTOR_SET_ID_STATIC_MUTABLE] < MAX_DESCRIPTOR_SETS)
     {
@@ -457,7 +521,26 @@ void PipelineResourceSignatureVkImpl::CreateSetLayouts(const bool IsSerialized)
 
     if (HasDevice())
     {
-        const auto& LogicalDevice = GetDevice()->GetLogicalDevice();
+        const auto& LogicalDevice        = GetDevice()->GetLogicalDevice();
+        const bool  UseDescriptorBuffers = GetDevice()->UseDescriptorBuffers();
+
+        if (UseDescriptorBuffers)
+        {
+            // Descriptor buffer set layouts can't contain dynamic uniform or storage buffers.
+            // Dynamic offsets are instead baked into the buffer addresses when descriptors are written.
+            // Note that resource attributes keep the original descriptor types.
+            for (auto& vkSetLayoutBinding : vkSetLayoutBindings)
+            {
+                for (auto& Binding : vkSetLayoutBinding)
+                {
+                    if (Binding.descriptorType == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC)
+                        Binding.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+                    else if (Binding.descriptorType == VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC)
+                        Binding.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+                }
+            }
+            SetLayoutCI.flags = VK_DESCRIPTOR_SET_LAYOUT_CREATE_DESCRIPTOR_BUFFER_BIT_EXT;
+        }
 
         for (size_t i = 0; i < vkSetLayoutBindings.size(); ++i)
         {
@@ -467,9 +550,99 @@ void PipelineResourceSignatureVkImpl::CreateSetLayouts(const bool IsSerialized)
 
             SetLayoutCI.bindingCount = StaticCast<uint32_t>(vkSetLayoutBinding.size());
             SetLayoutCI.pBindings    = vkSetLayoutBinding.data();
-            m_VkDescrSetLayouts[i]   = LogicalDevice.CreateDescriptorSetLayout(SetLayoutCI);
+            if (m_UsePushDescriptors)
+            {
+                SetLayoutCI.flags = i == DESCRIPTOR_SET_ID_DYNAMIC ?
+                    VK_DESCRIPTOR_SET_LAYOUT_CREATE_PUSH_DESCRIPTOR_BIT_KHR :
+                    0;
+            }
+            m_VkDescrSetLayouts[i] = LogicalDevice.CreateDescriptorSetLayout(SetLayoutCI);
         }
         VERIFY_EXPR(NumSets == GetNumDescriptorSets());
+
+        if (UseDescriptorBuffers)
+            InitDescriptorBufferLayout(vkSetLayoutBindings, DSMapping);
+    }
+}
+
+void PipelineResourceSignatureVkImpl::InitDescriptorBufferLayout(const std::array<std::vector<VkDescriptorSetLayoutBinding>, DESCRIPTOR_SET_ID_NUM_SETS>& vkSetLayoutBindings,
+                                                                 const std::array<Uint32, DESCRIPTOR_SET_ID_NUM_SETS>&                                    DSMapping)
+{
+    const auto& LogicalDevice    = GetDevice()->GetLogicalDevice();
+    const auto& DescrBufferProps = GetDevice()->GetPhysicalDevice().GetExtProperties().DescriptorBuffer;
+
+    auto GetDescriptorSize = [&DescrBufferProps](VkDescriptorType vkType) -> size_t {
+        switch (vkType)
+        {
+            // clang-format off
+            case VK_DESCRIPTOR_TYPE_SAMPLER:                    return DescrBufferProps.samplerDescriptorSize;
+            case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:     return DescrBufferProps.combinedImageSamplerDescriptorSize;
+            case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:              return DescrBufferProps.sampledImageDescriptorSize;
+            case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:              return DescrBufferProps.storageImageDescriptorSize;
+            case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:       return DescrBufferProps.uniformTexelBufferDescriptorSize;
+            case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:       return DescrBufferProps.storageTexelBufferDescriptorSize;
+            case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:             return DescrBufferProps.uniformBufferDescriptorSize;
+            case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:             return DescrBufferProps.storageBufferDescriptorSize;
+            case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT:           return DescrBufferProps.inputAttachmentDescriptorSize;
+            case VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_KHR: return DescrBufferProps.accelerationStructureDescriptorSize;
+            // clang-format on
+            default:
+                UNEXPECTED("Unexpected descriptor type");
+                return 0;
+        }
+    };
+
+    auto InitSlots = [&](DESCRIPTOR_SET_ID SetId, const VkDescriptorSetLayoutBinding& Binding, ShaderResourceCacheVk::DescriptorBufferSlot* pSlots) {
+        const VkDeviceSize BindingOffset  = LogicalDevice.GetDescriptorSetLayoutBindingOffset(m_VkDescrSetLayouts[SetId], Binding.binding);
+        const size_t       DescriptorSize = GetDescriptorSize(Binding.descriptorType);
+        for (Uint32 elem = 0; elem < Binding.descriptorCount; ++elem)
+        {
+            auto& Slot              = pSlots[elem];
+            Slot.vkType             = Binding.descriptorType;
+            Slot.Offset             = StaticCast<Uint32>(BindingOffset + elem * DescriptorSize);
+            Slot.Size               = StaticCast<Uint32>(DescriptorSize);
+            Slot.vkImmutableSampler = Binding.pImmutableSamplers != nullptr ? Binding.pImmutableSamplers[elem] : VK_NULL_HANDLE;
+        }
+    };
+
+    for (Uint32 SetId = 0; SetId < DESCRIPTOR_SET_ID_NUM_SETS; ++SetId)
+    {
+        if (!m_VkDescrSetLayouts[SetId])
+            continue;
+
+        const Uint32 SetIdx = DSMapping[SetId];
+        VERIFY_EXPR(SetIdx < MAX_DESCRIPTOR_SETS);
+        m_DescriptorBufferSetSizes[SetIdx] = StaticCast<Uint32>(LogicalDevice.GetDescriptorSetLayoutSize(m_VkDescrSetLayouts[SetId]));
+        m_DescriptorBufferSlots[SetIdx].resize(m_DescriptorSetSizes[SetIdx]);
+    }
+
+    // Bindings of resources are added to the set layouts in the same order as resources in m_Desc.Resources,
+    // followed by the immutable samplers that have no corresponding resource.
+    std::array<size_t, DESCRIPTOR_SET_ID_NUM_SETS> BindingIdx = {};
+    for (Uint32 r = 0; r < m_Desc.NumResources; ++r)
+    {
+        const auto& Attr  = GetResourceAttribs(r);
+        const auto  SetId = VarTypeToDescriptorSetId(m_Desc.Resources[r].VarType);
+
+        const auto& Binding = vkSetLayoutBindings[SetId][BindingIdx[SetId]++];
+        VERIFY_EXPR(Binding.binding == Attr.BindingIndex && Attr.DescrSet == DSMapping[SetId]);
+
+        auto& Slots = m_DescriptorBufferSlots[Attr.DescrSet];
+        VERIFY_EXPR(Attr.SRBCacheOffset + Binding.descriptorCount <= Slots.size());
+        InitSlots(SetId, Binding, &Slots[Attr.SRBCacheOffset]);
+    }
+
+    for (Uint32 SetId = 0; SetId < DESCRIPTOR_SET_ID_NUM_SETS; ++SetId)
+    {
+        for (size_t b = BindingIdx[SetId]; b < vkSetLayoutBindings[SetId].size(); ++b)
+        {
+            const auto& Binding = vkSetLayoutBindings[SetId][b];
+            VERIFY_EXPR(Binding.descriptorType == VK_DESCRIPTOR_TYPE_SAMPLER && Binding.descriptorCount == 1);
+
+            auto& Slots = m_DescriptorBufferSlots[DSMapping[SetId]];
+            Slots.emplace_back();
+            InitSlots(static_cast<DESCRIPTOR_SET_ID>(SetId), Binding, &Slots.back());
+        }
     }
 }
 
@@ -514,6 +687,10 @@ void PipelineResourceSignatureVkImpl::InitSRBResourceCache(ShaderResourceCacheVk
     ResourceCache.DbgVerifyResourceInitialization();
 #endif
 
+    // With descriptor buffers, descriptors are written to the dynamic heap when resources are committed
+    if (GetDevice()->UseDescriptorBuffers())
+        return;
+
     if (auto vkLayout = GetVkDescriptorSetLayout(DESCRIPTOR_SET_ID_STATIC_MUTABLE))
     {
         const char* DescrSetName = "Static/Mutable Descriptor Set";
@@ -605,33 +782,21 @@ Uint32 PipelineResourceSignatureVkImpl::GetDescriptorSetIndex<PipelineResourceSi
     return HasDescriptorSet(DESCRIPTOR_SET_ID_STATIC_MUTABLE) ? 1 : 0;
 }
 
-void PipelineResourceSignatureVkImpl::CommitDynamicResources(const ShaderResourceCacheVk& ResourceCache,
-                                                             VkDescriptorSet              vkDynamicDescriptorSet) const
+template <typename BatchSizes, typename WriteDescriptorsHandlerType>
+void PipelineResourceSignatureVkImpl::WriteDynamicResources(const ShaderResourceCacheVk&  ResourceCache,
+                                                            VkDescriptorSet               vkDynamicDescriptorSet,
+                                                            const DeviceContextIndex*     pCtxId,
+                                                            WriteDescriptorsHandlerType&& WriteDescriptors) const
 {
     VERIFY(HasDescriptorSet(DESCRIPTOR_SET_ID_DYNAMIC), "This signature does not contain dynamic resources");
-    VERIFY_EXPR(vkDynamicDescriptorSet != VK_NULL_HANDLE);
     VERIFY_EXPR(ResourceCache.GetContentType() == ResourceCacheContentType::SRB);
 
-#ifdef DILIGENT_DEBUG
-    static constexpr size_t ImgUpdateBatchSize          = 4;
-    static constexpr size_t BuffUpdateBatchSize         = 2;
-    static constexpr size_t TexelBuffUpdateBatchSize    = 2;
-    static constexpr size_t AccelStructBatchSize        = 2;
-    static constexpr size_t WriteDescriptorSetBatchSize = 2;
-#else
-    static constexpr size_t ImgUpdateBatchSize          = 64;
-    static constexpr size_t BuffUpdateBatchSize         = 32;
-    static constexpr size_t TexelBuffUpdateBatchSize    = 16;
-    static constexpr size_t AccelStructBatchSize        = 16;
-    static constexpr size_t WriteDescriptorSetBatchSize = 32;
-#endif
-
     // Do not zero-initialize arrays!
-    std::array<VkDescriptorImageInfo, ImgUpdateBatchSize>                          DescrImgInfoArr;
-    std::array<VkDescriptorBufferInfo, BuffUpdateBatchSize>                        DescrBuffInfoArr;
-    std::array<VkBufferView, TexelBuffUpdateBatchSize>                             DescrBuffViewArr;
-    std::array<VkWriteDescriptorSetAccelerationStructureKHR, AccelStructBatchSize> DescrAccelStructArr;
-    std::array<VkWriteDescriptorSet, WriteDescriptorSetBatchSize>                  WriteDescrSetArr;
+    std::array<VkDescriptorImageInfo, BatchSizes::ImgUpdateBatchSize>                          DescrImgInfoArr;
+    std::array<VkDescriptorBufferInfo, BatchSizes::BuffUpdateBatchSize>                        DescrBuffInfoArr;
+    std::array<VkBufferView, BatchSizes::TexelBuffUpdateBatchSize>                             DescrBuffViewArr;
+    std::array<VkWriteDescriptorSetAccelerationStructureKHR, BatchSizes::AccelStructBatchSize> DescrAccelStructArr;
+    std::array<VkWriteDescriptorSet, BatchSizes::WriteDescriptorSetBatchSize>                  WriteDescrSetArr;
 
     auto DescrImgIt      = DescrImgInfoArr.begin();
     auto DescrBuffIt     = DescrBuffInfoArr.begin();
@@ -641,7 +806,6 @@ void PipelineResourceSignatureVkImpl::CommitDynamicResources(const ShaderResourc
 
     const auto  DynamicSetIdx  = GetDescriptorSetIndex<DESCRIPTOR_SET_ID_DYNAMIC>();
     const auto& SetResources   = ResourceCache.GetDescriptorSet(DynamicSetIdx);
-    const auto& LogicalDevice  = GetDevice()->GetLogicalDevice();
     const auto  DynResIdxRange = GetResourceIndexRange(SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC);
 
     constexpr auto CacheType = ResourceCacheContentType::SRB;
@@ -664,8 +828,9 @@ void PipelineResourceSignatureVkImpl::CommitDynamicResources(const ShaderResourc
         WriteDescrSetIt->sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
         WriteDescrSetIt->pNext = nullptr;
         VERIFY(SetResources.GetVkDescriptorSet() == VK_NULL_HANDLE, "Dynamic descriptor set must not be assigned to the resource cache");
+        // dstSet is ignored for push descriptors
         WriteDescrSetIt->dstSet = vkDynamicDescriptorSet;
-        VERIFY(WriteDescrSetIt->dstSet != VK_NULL_HANDLE, "Vulkan descriptor set must not be null");
+        VERIFY(WriteDescrSetIt->dstSet != VK_NULL_HANDLE || m_UsePushDescriptors, "Vulkan descriptor set must not be null");
         WriteDescrSetIt->dstBinding      = Attr.BindingIndex;
         WriteDescrSetIt->dstArrayElement = ArrElem;
         // descriptorType must be the same type as that specified in VkDescriptorSetLayoutBinding for dstSet at dstBinding.
@@ -673,6 +838,9 @@ void PipelineResourceSignatureVkImpl::CommitDynamicResources(const ShaderResourc
         WriteDescrSetIt->descriptorType  = DescriptorTypeToVkDescriptorType(DescrType);
         WriteDescrSetIt->descriptorCount = 0;
 
+        // Do not dereference the iterator as it may be equal to end() if the buffer array is full
+        auto* const pFirstBuffInfo = DescrBuffInfoArr.data() + std::distance(DescrBuffInfoArr.begin(), DescrBuffIt);
+
         auto WriteArrayElements = [&](auto DescrType, auto& DescrIt, const auto& DescrArr) //
         {
             while (ArrElem < ArraySize && DescrIt != DescrArr.end())
@@ -756,6 +924,26 @@ void PipelineResourceSignatureVkImpl::CommitDynamicResources(const ShaderResourc
                 UNEXPECTED("Unexpected resource type");
         }
 
+        if (pCtxId != nullptr && WriteDescrSetIt->descriptorCount > 0 &&
+            (DescrType == DescriptorType::UniformBufferDynamic ||
+             DescrType == DescriptorType::StorageBufferDynamic ||
+             DescrType == DescriptorType::StorageBufferDynamic_ReadOnly))
+        {
+            // The set layout uses regular buffer descriptors, so bake the dynamic offsets into the descriptors
+            WriteDescrSetIt->descriptorType = DescrType == DescriptorType::UniformBufferDynamic ?
+                VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER :
+                VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+            for (Uint32 i = 0; i < WriteDescrSetIt->descriptorCount; ++i)
+            {
+                const auto&         CachedRes = SetResources.GetResource(CacheOffset + WriteDescrSetIt->dstArrayElement + i);
+                const BufferVkImpl* pBufferVk = DescrType == DescriptorType::UniformBufferDynamic ?
+                    CachedRes.pObject.ConstPtr<BufferVkImpl>() :
+                    CachedRes.pObject.ConstPtr<BufferViewVkImpl>()->GetBuffer<const BufferVkImpl>();
+                // Do not verify dynamic allocation here as the buffer may not be used by the PSO.
+                pFirstBuffInfo[i].offset += CachedRes.BufferDynamicOffset + pBufferVk->GetDynamicOffset(*pCtxId, nullptr /* Do not verify allocation*/);
+            }
+        }
+
         if (ArrElem == ArraySize)
         {
             ArrElem = 0;
@@ -776,7 +964,7 @@ void PipelineResourceSignatureVkImpl::CommitDynamicResources(const ShaderResourc
         {
             auto DescrWriteCount = static_cast<Uint32>(std::distance(WriteDescrSetArr.begin(), WriteDescrSetIt));
             if (DescrWriteCount > 0)
-                LogicalDevice.UpdateDescriptorSets(DescrWriteCount, WriteDescrSetArr.data(), 0, nullptr);
+                WriteDescriptors(DescrWriteCount, WriteDescrSetArr.data());
 
             DescrImgIt      = DescrImgInfoArr.begin();
             DescrBuffIt     = DescrBuffInfoArr.begin();
@@ -788,7 +976,43 @@ void PipelineResourceSignatureVkImpl::CommitDynamicResources(const ShaderResourc
 
     auto DescrWriteCount = static_cast<Uint32>(std::distance(WriteDescrSetArr.begin(), WriteDescrSetIt));
     if (DescrWriteCount > 0)
-        LogicalDevice.UpdateDescriptorSets(DescrWriteCount, WriteDescrSetArr.data(), 0, nullptr);
+        WriteDescriptors(DescrWriteCount, WriteDescrSetArr.data());
+}
+
+void PipelineResourceSignatureVkImpl::CommitDynamicResources(const ShaderResourceCacheVk& ResourceCache,
+                                                             VkDescriptorSet              vkDynamicDescriptorSet) const
+{
+    VERIFY_EXPR(vkDynamicDescriptorSet != VK_NULL_HANDLE);
+    VERIFY(!m_UsePushDescriptors, "Dynamic resources of this signature must be pushed with PushDynamicResources()");
+
+    const auto& LogicalDevice = GetDevice()->GetLogicalDevice();
+    WriteDynamicResources<DescriptorUpdateBatchSizes>(ResourceCache, vkDynamicDescriptorSet, nullptr,
+                                                      [&LogicalDevice](Uint32 DescrWriteCount, const VkWriteDescriptorSet* pDescrWrites) {
+                                                          LogicalDevice.UpdateDescriptorSets(DescrWriteCount, pDescrWrites, 0, nullptr);
+                                                      });
+}
+
+void PipelineResourceSignatureVkImpl::PushDynamicResources(const ShaderResourceCacheVk&          ResourceCache,
+                                                           VulkanUtilities::VulkanCommandBuffer& CmdBuffer,
+                                                           VkPipelineBindPoint                   BindPoint,
+                                                           VkPipelineLayout                      vkPipelineLayout,
+                                                           Uint32                                SetIndex,
+                                                           DeviceContextIndex                    CtxId) const
+{
+    VERIFY(m_UsePushDescriptors, "This signature does not use push descriptors");
+
+    // The total number of descriptors in the set does not exceed MAX_PUSH_DESCRIPTORS, so all descriptors
+    // are always written in a single batch: descriptors that are not pushed become undefined.
+#ifdef DILIGENT_DEBUG
+    Uint32 NumBatches = 0;
+#endif
+    WriteDynamicResources<PushDescriptorBatchSizes>(ResourceCache, VK_NULL_HANDLE, &CtxId,
+                                                    [&](Uint32 DescrWriteCount, const VkWriteDescriptorSet* pDescrWrites) {
+#ifdef DILIGENT_DEBUG
+                                                        VERIFY(NumBatches++ == 0, "All push descriptors must be written in a single batch");
+#endif
+                                                        CmdBuffer.PushDescriptorSet(BindPoint, vkPipelineLayout, SetIndex, DescrWriteCount, pDescrWrites);
+                                                    });
 }
 
 
@@ -116,6 +116,8 @@ void CreateComputePipeline(RenderDeviceVkImpl*                           pDevice
 #ifdef DILIGENT_DEBUG
     PipelineCI.flags = VK_PIPELINE_CREATE_DISABLE_OPTIMIZATION_BIT;
 #endif
+    if (pDeviceVk->UseDescriptorBuffers())
+        PipelineCI.flags |= VK_PIPELINE_CREATE_DESCRIPTOR_BUFFER_BIT_EXT;
     PipelineCI.basePipelineHandle = VK_NULL_HANDLE; // a pipeline to derive from
     PipelineCI.basePipelineIndex  = -1;             // an index into the pCreateInfos parameter to use as a pipeline to derive from
 
@@ -159,6 +161,8 @@ void CreateGraphicsPipeline(RenderDeviceVkImpl*                           pDevic
 #ifdef DILIGENT_DEBUG
     PipelineCI.flags = VK_PIPELINE_CREATE_DISABLE_OPTIMIZATION_BIT;
 #endif
+    if (pDeviceVk->UseDescriptorBuffers())
+        PipelineCI.flags |= VK_PIPELINE_CREATE_DESCRIPTOR_BUFFER_BIT_EXT;
 
     PipelineCI.stageCount = static_cast<Uint32>(Stages.size());
     PipelineCI.pStages    = Stages.data();
@@ -350,6 +354,8 @@ void CreateRayTracingPipeline(RenderDeviceVkImpl*
 #ifdef DILIGENT_DEBUG
     PipelineCI.flags = VK_PIPELINE_CREATE_DISABLE_OPTIMIZATION_BIT;
 #endif
+    if (pDeviceVk->UseDescriptorBuffers())
+        PipelineCI.flags |= VK_PIPELINE_CREATE_DESCRIPTOR_BUFFER_BIT_EXT;
 
     PipelineCI.stageCount                   = static_cast<Uint32>(vkStages.size());
     PipelineCI.pStages                      = vkStages.data();
@@ -631,6 +631,49 @@ void RenderDeviceVkImpl::CreateTexture(const TextureDesc& TexDesc, const Texture
     CreateTextureImpl(ppTexture, TexDesc, pData);
 }
 
+void RenderDeviceVkImpl::CreateTransientTexture(const TextureDesc& TexDesc, Uint32 FirstUse, Uint32 LastUse, ITexture** ppTexture)
+{
+    TextureDesc TransientTexDesc = TexDesc;
+    TransientTexDesc.MiscFlags |= MISC_TEXTURE_FLAG_TRANSIENT;
+    CreateTextureImpl(ppTexture, TransientTexDesc, TextureVkImpl::TransientLifetime{FirstUse, LastUse});
+}
+
+TransientMemoryStatsVk RenderDeviceVkImpl::GetTransientMemoryStats()
+{
+    const auto MemStats = m_MemoryMgr.GetTransientMemoryStats();
+
+    TransientMemoryStatsVk Stats;
+    Stats.NumTextures       = static_cast<Uint32>(MemStats.NumAllocations);
+    Stats.NumHeaps          = static_cast<Uint32>(MemStats.NumPages);
+    Stats.RequestedSize     = MemStats.RequestedSize;
+    Stats.UsedSize          = MemStats.UsedSize;
+    Stats.HeapSize          = MemStats.PageSize;
+    Stats.PeakRequestedSize = MemStats.PeakRequestedSize;
+    Stats.PeakUsedSize      = MemStats.PeakUsedSize;
+    Stats.PeakHeapSize      = MemStats.PeakPageSize;
+    return Stats;
+}
+
+MemoryStatsVk RenderDeviceVkImpl::GetMemoryStats()
+{
+    const auto MemStats = m_MemoryMgr.GetMemoryStats();
+
+    auto ConvertStats = [](const VulkanUtilities::VulkanMemoryPageStats& PageStats) {
+        MemoryPageStatsVk Stats;
+        Stats.NumPages         = static_cast<Uint32>(PageStats.NumPages);
+        Stats.AllocatedSize    = PageStats.AllocatedSize;
+        Stats.UsedSize         = PageStats.UsedSize;
+        Stats.MaxFreeBlockSize = PageStats.MaxFreeBlockSize;
+        Stats.Fragmentation    = PageStats.GetFragmentation();
+        return Stats;
+    };
+
+    MemoryStatsVk Stats;
+    Stats.DeviceLocal = ConvertStats(MemStats[0]);
+    Stats.HostVisible = ConvertStats(MemStats[1]);
+    return Stats;
+}
+
 void RenderDeviceVkImpl::CreateSampler(const SamplerDesc& SamplerDesc, ISampler** ppSampler)
 {
     CreateSamplerImpl(ppSampler, SamplerDesc);
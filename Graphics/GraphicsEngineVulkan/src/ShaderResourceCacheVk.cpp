@@ -288,11 +288,93 @@ void ShaderResourceCacheVk::Resource::SetStorageBuffer(RefCntAutoPtr<IDeviceObje
 #endif
 }
 
+void ShaderResourceCacheVk::DescriptorWriteBatch::Flush()
+{
+    if (m_NumWrites > 0)
+    {
+        m_LogicalDevice.UpdateDescriptorSets(m_NumWrites, m_Writes.data(), 0, nullptr);
+        m_NumWrites = 0;
+    }
+}
+
+void ShaderResourceCacheVk::InitDescriptorWrite(const Resource&                       Res,
+                                                VkDescriptorSet                       vkSet,
+                                                Uint32                                BindingIndex,
+                                                Uint32                                ArrayIndex,
+                                                VkWriteDescriptorSet&                 WriteDescrSet,
+                                                DescriptorWriteBatch::DescriptorInfo& DescrInfo)
+{
+    WriteDescrSet.sType           = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+    WriteDescrSet.pNext           = nullptr;
+    WriteDescrSet.dstSet          = vkSet;
+    WriteDescrSet.dstBinding      = BindingIndex;
+    WriteDescrSet.dstArrayElement = ArrayIndex;
+    WriteDescrSet.descriptorCount = 1;
+    // descriptorType must be the same type as that specified in VkDescriptorSetLayoutBinding for dstSet at dstBinding.
+    // The type of the descriptor also controls which array the descriptors are taken from. (13.2.4)
+    WriteDescrSet.descriptorType   = DescriptorTypeToVkDescriptorType(Res.Type);
+    WriteDescrSet.pImageInfo       = nullptr;
+    WriteDescrSet.pBufferInfo      = nullptr;
+    WriteDescrSet.pTexelBufferView = nullptr;
+
+    static_assert(static_cast<Uint32>(DescriptorType::Count) == 16, "Please update the switch below to handle the new descriptor type");
+    switch (Res.Type)
+    {
+        case DescriptorType::Sampler:
+            DescrInfo.vkImageInfo    = Res.GetSamplerDescriptorWriteInfo();
+            WriteDescrSet.pImageInfo = &DescrInfo.vkImageInfo;
+            break;
+
+        case DescriptorType::CombinedImageSampler:
+        case DescriptorType::SeparateImage:
+        case DescriptorType::StorageImage:
+            DescrInfo.vkImageInfo    = Res.GetImageDescriptorWriteInfo();
+            WriteDescrSet.pImageInfo = &DescrInfo.vkImageInfo;
+            break;
+
+        case DescriptorType::UniformTexelBuffer:
+        case DescriptorType::StorageTexelBuffer:
+        case DescriptorType::StorageTexelBuffer_ReadOnly:
+            DescrInfo.vkBufferView         = Res.GetBufferViewWriteInfo();
+            WriteDescrSet.pTexelBufferView = &DescrInfo.vkBufferView;
+            break;
+
+        case DescriptorType::UniformBuffer:
+        case DescriptorType::UniformBufferDynamic:
+            DescrInfo.vkBufferInfo    = Res.GetUniformBufferDescriptorWriteInfo();
+            WriteDescrSet.pBufferInfo = &DescrInfo.vkBufferInfo;
+            break;
+
+        case DescriptorType::StorageBuffer:
+        case DescriptorType::StorageBuffer_ReadOnly:
+        case DescriptorType::StorageBufferDynamic:
+        case DescriptorType::StorageBufferDynamic_ReadOnly:
+            DescrInfo.vkBufferInfo    = Res.GetStorageBufferDescriptorWriteInfo();
+            WriteDescrSet.pBufferInfo = &DescrInfo.vkBufferInfo;
+            break;
+
+        case DescriptorType::InputAttachment:
+        case DescriptorType::InputAttachment_General:
+            DescrInfo.vkImageInfo    = Res.GetInputAttachmentDescriptorWriteInfo();
+            WriteDescrSet.pImageInfo = &DescrInfo.vkImageInfo;
+            break;
+
+        case DescriptorType::AccelerationStructure:
+            DescrInfo.vkAccelStructInfo = Res.GetAccelerationStructureWriteInfo();
+            WriteDescrSet.pNext         = &DescrInfo.vkAccelStructInfo;
+            break;
+
+        default:
+            UNEXPECTED("Unexpected descriptor type");
+    }
+}
+
 const ShaderResourceCacheVk::Resource& ShaderResourceCacheVk::SetResource(
     const VulkanUtilities::VulkanLogicalDevice* pLogicalDevice,
     Uint32                                      DescrSetIndex,
     Uint32                                      CacheOffset,
-    SetResourceInfo&&                           SrcRes)
+    SetResourceInfo&&                           SrcRes,
+    DescriptorWriteBatch*                       pWriteBatch)
 {
     DescriptorSet& DescrSet = GetDescriptorSet(DescrSetIndex);
     Resource&      DstRes   = DescrSet.GetResource(CacheOffset);
@@ -333,81 +415,23 @@ const ShaderResourceCacheVk::Resource& ShaderResourceCacheVk::SetResource(
     {
         VERIFY(pLogicalDevice != nullptr, "Logical device must not be null to write descriptor to a non-null set");
 
-        VkWriteDescriptorSet WriteDescrSet;
-        WriteDescrSet.sType           = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
-        WriteDescrSet.pNext           = nullptr;
-        WriteDescrSet.dstSet          = vkSet;
-        WriteDescrSet.dstBinding      = SrcRes.BindingIndex;
-        WriteDescrSet.dstArrayElement = SrcRes.ArrayIndex;
-        WriteDescrSet.descriptorCount = 1;
-        // descriptorType must be the same type as that specified in VkDescriptorSetLayoutBinding for dstSet at dstBinding.
-        // The type of the descriptor also controls which array the descriptors are taken from. (13.2.4)
-        WriteDescrSet.descriptorType   = DescriptorTypeToVkDescriptorType(DstRes.Type);
-        WriteDescrSet.pImageInfo       = nullptr;
-        WriteDescrSet.pBufferInfo      = nullptr;
-        WriteDescrSet.pTexelBufferView = nullptr;
-
-        // Do not zero-initialize!
-        union
+        if (pWriteBatch != nullptr)
         {
-            VkDescriptorImageInfo                        vkDescrImageInfo;
-            VkDescriptorBufferInfo                       vkDescrBufferInfo;
-            VkBufferView                                 vkDescrBufferView;
-            VkWriteDescriptorSetAccelerationStructureKHR vkDescrAccelStructInfo;
-        };
+            VERIFY(&pWriteBatch->m_LogicalDevice == pLogicalDevice, "The write batch was created for a different logical device");
+            if (pWriteBatch->m_NumWrites == DescriptorWriteBatch::MaxWrites)
+                pWriteBatch->Flush();
 
-        static_assert(static_cast<Uint32>(DescriptorType::Count) == 16, "Please update the switch below to handle the new descriptor type");
-        switch (DstRes.Type)
+            const Uint32 WriteIdx = pWriteBatch->m_NumWrites++;
+            InitDescriptorWrite(DstRes, vkSet, SrcRes.BindingIndex, SrcRes.ArrayIndex, pWriteBatch->m_Writes[WriteIdx], pWriteBatch->m_Infos[WriteIdx]);
+        }
+        else
         {
-            case DescriptorType::Sampler:
-                vkDescrImageInfo         = DstRes.GetSamplerDescriptorWriteInfo();
-                WriteDescrSet.pImageInfo = &vkDescrImageInfo;
-                break;
-
-            case DescriptorType::CombinedImageSampler:
-            case DescriptorType::SeparateImage:
-            case DescriptorType::StorageImage:
-                vkDescrImageInfo         = DstRes.GetImageDescriptorWriteInfo();
-                WriteDescrSet.pImageInfo = &vkDescrImageInfo;
-                break;
-
-            case DescriptorType::UniformTexelBuffer:
-            case DescriptorType::StorageTexelBuffer:
-            case DescriptorType::StorageTexelBuffer_ReadOnly:
-                vkDescrBufferView              = DstRes.GetBufferViewWriteInfo();
-                WriteDescrSet.pTexelBufferView = &vkDescrBufferView;
-                break;
-
-            case DescriptorType::UniformBuffer:
-            case DescriptorType::UniformBufferDynamic:
-                vkDescrBufferInfo         = DstRes.GetUniformBufferDescriptorWriteInfo();
-                WriteDescrSet.pBufferInfo = &vkDescrBufferInfo;
-                break;
-
-            case DescriptorType::StorageBuffer:
-            case DescriptorType::StorageBuffer_ReadOnly:
-            case DescriptorType::StorageBufferDynamic:
-            case DescriptorType::StorageBufferDynamic_ReadOnly:
-                vkDescrBufferInfo         = DstRes.GetStorageBufferDescriptorWriteInfo();
-                WriteDescrSet.pBufferInfo = &vkDescrBufferInfo;
-                break;
-
-            case DescriptorType::InputAttachment:
-            case DescriptorType::InputAttachment_General:
-                vkDescrImageInfo         = DstRes.GetInputAttachmentDescriptorWriteInfo();
-                WriteDescrSet.pImageInfo = &vkDescrImageInfo;
-                break;
-
-            case DescriptorType::AccelerationStructure:
-                vkDescrAccelStructInfo = DstRes.GetAccelerationStructureWriteInfo();
-                WriteDescrSet.pNext    = &vkDescrAccelStructInfo;
-                break;
-
-            default:
-                UNEXPECTED("Unexpected descriptor type");
+            // Do not zero-initialize!
+            VkWriteDescriptorSet                 WriteDescrSet;
+            DescriptorWriteBatch::DescriptorInfo DescrInfo;
+            InitDescriptorWrite(DstRes, vkSet, SrcRes.BindingIndex, SrcRes.ArrayIndex, WriteDescrSet, DescrInfo);
+            pLogicalDevice->UpdateDescriptorSets(1, &WriteDescrSet, 0, nullptr);
         }
-
-        pLogicalDevice->UpdateDescriptorSets(1, &WriteDescrSet, 0, nullptr);
     }
 
     UpdateRevision();
@@ -433,6 +457,145 @@ void ShaderResourceCacheVk::SetDynamicBufferOffset(Uint32 DescrSetIndex,
     DstRes.BufferDynamicOffset = DynamicBufferOffset;
 }
 
+void ShaderResourceCacheVk::WriteDescriptorBufferData(const VulkanUtilities::VulkanLogicalDevice& LogicalDevice,
+                                                      Uint32                                      DescrSetIndex,
+                                                      const DescriptorBufferSlot*                 pSlots,
+                                                      Uint32                                      NumSlots,
+                                                      DeviceContextIndex                          CtxId,
+                                                      void*                                       pDstData) const
+{
+    static_assert(static_cast<Uint32>(DescriptorType::Count) == 16, "Please update the switch below to handle the new descriptor type");
+
+    const DescriptorSet& DescrSet     = GetDescriptorSet(DescrSetIndex);
+    const Uint32         NumResources = DescrSet.GetSize();
+    VERIFY(NumSlots >= NumResources, "The number of descriptor buffer slots (", NumSlots, ") is less than the number of resources in the set (", NumResources, ")");
+
+    Uint8* const pDstBytes = static_cast<Uint8*>(pDstData);
+    for (Uint32 i = 0; i < NumSlots; ++i)
+    {
+        const DescriptorBufferSlot& Slot = pSlots[i];
+
+        VkDescriptorGetInfoEXT DescrInfo{};
+        DescrInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_GET_INFO_EXT;
+        DescrInfo.type  = Slot.vkType;
+
+        VkDescriptorAddressInfoEXT AddressInfo{};
+        AddressInfo.sType  = VK_STRUCTURE_TYPE_DESCRIPTOR_ADDRESS_INFO_EXT;
+        AddressInfo.format = VK_FORMAT_UNDEFINED;
+
+        VkDescriptorImageInfo ImageInfo{};
+
+        const Resource* pRes = i < NumResources ? &DescrSet.GetResource(i) : nullptr;
+        if (pRes == nullptr || (pRes->Type == DescriptorType::Sampler && pRes->HasImmutableSampler))
+        {
+            // Immutable samplers are part of the set layout, but must still be written to the descriptor buffer
+            VERIFY_EXPR(Slot.vkType == VK_DESCRIPTOR_TYPE_SAMPLER);
+            if (Slot.vkImmutableSampler == VK_NULL_HANDLE)
+                continue;
+
+            DescrInfo.data.pSampler = &Slot.vkImmutableSampler;
+            LogicalDevice.GetDescriptor(DescrInfo, Slot.Size, pDstBytes + Slot.Offset);
+            continue;
+        }
+
+        const Resource& Res = *pRes;
+        if (Res.IsNull())
+            continue;
+
+        switch (Res.Type)
+        {
+            case DescriptorType::UniformBuffer:
+            case DescriptorType::UniformBufferDynamic:
+            case DescriptorType::StorageBuffer:
+            case DescriptorType::StorageBuffer_ReadOnly:
+            case DescriptorType::StorageBufferDynamic:
+            case DescriptorType::StorageBufferDynamic_ReadOnly:
+            {
+                const bool IsUniform = Res.Type == DescriptorType::UniformBuffer || Res.Type == DescriptorType::UniformBufferDynamic;
+
+                const VkDescriptorBufferInfo BuffInfo = IsUniform ?
+                    Res.GetUniformBufferDescriptorWriteInfo() :
+                    Res.GetStorageBufferDescriptorWriteInfo();
+
+                const BufferVkImpl* pBufferVk = IsUniform ?
+                    Res.pObject.ConstPtr<BufferVkImpl>() :
+                    Res.pObject.ConstPtr<BufferViewVkImpl>()->GetBuffer<const BufferVkImpl>();
+
+                AddressInfo.address = pBufferVk->GetVkBufferDeviceAddress() + BuffInfo.offset;
+                AddressInfo.range   = BuffInfo.range;
+                if (IsDynamicDescriptorType(Res.Type))
+                {
+                    // There are no dynamic offsets with descriptor buffers, so the offset is baked into the descriptor.
+                    // Do not verify dynamic allocation here as the buffer may not be used by the PSO.
+                    AddressInfo.address += Res.BufferDynamicOffset + pBufferVk->GetDynamicOffset(CtxId, nullptr /* Do not verify allocation*/);
+                }
+
+                if (IsUniform)
+                    DescrInfo.data.pUniformBuffer = &AddressInfo;
+                else
+                    DescrInfo.data.pStorageBuffer = &AddressInfo;
+                break;
+            }
+
+            case DescriptorType::UniformTexelBuffer:
+            case DescriptorType::StorageTexelBuffer:
+            case DescriptorType::StorageTexelBuffer_ReadOnly:
+            {
+                const BufferViewVkImpl* pBuffViewVk = Res.pObject.ConstPtr<BufferViewVkImpl>();
+                const BufferViewDesc&   ViewDesc    = pBuffViewVk->GetDesc();
+
+                AddressInfo.address = pBuffViewVk->GetBuffer<const BufferVkImpl>()->GetVkBufferDeviceAddress() + ViewDesc.ByteOffset;
+                AddressInfo.range   = ViewDesc.ByteWidth;
+                AddressInfo.format  = TypeToVkFormat(ViewDesc.Format.ValueType, ViewDesc.Format.NumComponents, ViewDesc.Format.IsNormalized);
+
+                if (Res.Type == DescriptorType::UniformTexelBuffer)
+                    DescrInfo.data.pUniformTexelBuffer = &AddressInfo;
+                else
+                    DescrInfo.data.pStorageTexelBuffer = &AddressInfo;
+                break;
+            }
+
+            case DescriptorType::StorageImage:
+                ImageInfo                    = Res.GetImageDescriptorWriteInfo();
+                DescrInfo.data.pStorageImage = &ImageInfo;
+                break;
+
+            case DescriptorType::SeparateImage:
+                ImageInfo                    = Res.GetImageDescriptorWriteInfo();
+                DescrInfo.data.pSampledImage = &ImageInfo;
+                break;
+
+            case DescriptorType::CombinedImageSampler:
+                ImageInfo = Res.GetImageDescriptorWriteInfo();
+                if (Res.HasImmutableSampler)
+                    ImageInfo.sampler = Slot.vkImmutableSampler;
+                DescrInfo.data.pCombinedImageSampler = &ImageInfo;
+                break;
+
+            case DescriptorType::Sampler:
+                ImageInfo               = Res.GetSamplerDescriptorWriteInfo();
+                DescrInfo.data.pSampler = &ImageInfo.sampler;
+                break;
+
+            case DescriptorType::InputAttachment:
+            case DescriptorType::InputAttachment_General:
+                ImageInfo                            = Res.GetInputAttachmentDescriptorWriteInfo();
+                DescrInfo.data.pInputAttachmentImage = &ImageInfo;
+                break;
+
+            case DescriptorType::AccelerationStructure:
+                DescrInfo.data.accelerationStructure = Res.pObject.ConstPtr<TopLevelASVkImpl>()->GetVkDeviceAddress();
+                break;
+
+            default:
+                UNEXPECTED("Unexpected descriptor type");
+                continue;
+        }
+
+        LogicalDevice.GetDescriptor(DescrInfo, Slot.Size, pDstBytes + Slot.Offset);
+    }
+}
+
 
 namespace
 {
@@ -116,13 +116,16 @@ void ShaderVariableManagerVk::Destroy(IMemoryAllocator& Allocator)
 
 ShaderVariableVkImpl* ShaderVariableManagerVk::GetVariable(const Char* Name) const
 {
-    for (Uint32 v = 0; v < m_NumVariables; ++v)
-    {
-        ShaderVariableVkImpl& Var = m_pVariables[v];
-        if (strcmp(Var.GetDesc().Name, Name) == 0)
-            return &Var;
-    }
-    return nullptr;
+    return GetVariableByHash(ComputeShaderResourceNameHash(Name), Name);
+}
+
+ShaderVariableVkImpl* ShaderVariableManagerVk::GetVariableByHash(Uint64 NameHash, const Char* Name) const
+{
+    // Variables are created in the order of resources in the signature, so they are sorted by the resource index
+    return FindVariableByNameHash<ShaderVariableVkImpl>(NameHash, Name,
+                                                        [this](Uint32 ResIndex) {
+                                                            return FindVariableByResIndex(m_pVariables, m_NumVariables, ResIndex);
+                                                        });
 }
 
 
@@ -231,10 +234,11 @@ inline TEXTURE_VIEW_TYPE DvpDescriptorTypeToTextureView(DescriptorType Type)
 
 struct BindResourceHelper
 {
-    BindResourceHelper(const PipelineResourceSignatureVkImpl& Signature,
-                       ShaderResourceCacheVk&                 ResourceCache,
-                       Uint32                                 ResIndex,
-                       Uint32                                 ArrayIndex);
+    BindResourceHelper(const PipelineResourceSignatureVkImpl&       Signature,
+                       ShaderResourceCacheVk&                       ResourceCache,
+                       Uint32                                       ResIndex,
+                       Uint32                                       ArrayIndex,
+                       ShaderResourceCacheVk::DescriptorWriteBatch* pWriteBatch = nullptr);
 
     void operator()(const BindResourceInfo& BindInfo) const;
 
@@ -268,12 +272,15 @@ private:
     const Uint32                           m_DstResCacheOffset;
     const CachedSet&                       m_CachedSet;
     const ShaderResourceCacheVk::Resource& m_DstRes;
+
+    ShaderResourceCacheVk::DescriptorWriteBatch* const m_pWriteBatch;
 };
 
-BindResourceHelper::BindResourceHelper(const PipelineResourceSignatureVkImpl& Signature,
-                                       ShaderResourceCacheVk&                 ResourceCache,
-                                       Uint32                                 ResIndex,
-                                       Uint32                                 ArrayIndex) :
+BindResourceHelper::BindResourceHelper(const PipelineResourceSignatureVkImpl&       Signature,
+                                       ShaderResourceCacheVk&                       ResourceCache,
+                                       Uint32                                       ResIndex,
+                                       Uint32                                       ArrayIndex,
+                                       ShaderResourceCacheVk::DescriptorWriteBatch* pWriteBatch) :
     // clang-format off
     m_Signature         {Signature},
     m_ResourceCache     {ResourceCache},
@@ -283,7 +290,8 @@ BindResourceHelper::BindResourceHelper(const PipelineResourceSignatureVkImpl& Si
     m_Attribs           {Signature.GetResourceAttribs(ResIndex)},
     m_DstResCacheOffset {m_Attribs.CacheOffset(m_CacheType) + ArrayIndex},
     m_CachedSet         {const_cast<const ShaderResourceCacheVk&>(ResourceCache).GetDescriptorSet(m_Attribs.DescrSet)},
-    m_DstRes            {m_CachedSet.GetResource(m_DstResCacheOffset)}
+    m_DstRes            {m_CachedSet.GetResource(m_DstResCacheOffset)},
+    m_pWriteBatch       {pWriteBatch}
 // clang-format on
 {
     VERIFY(ArrayIndex < m_ResDesc.ArraySize, "Array index is out of range, but it should've been corrected by ShaderVariableBase::SetArray()");
@@ -297,7 +305,8 @@ BindResourceHelper::BindResourceHelper(const PipelineResourceSignatureVkImpl& Si
             if (m_ResDesc.VarType == SHADER_RESOURCE_VARIABLE_TYPE_STATIC ||
                 m_ResDesc.VarType == SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE)
             {
-                VERIFY(vkDescrSet != VK_NULL_HANDLE, "Static and mutable variables must have a valid Vulkan descriptor set assigned");
+                VERIFY(vkDescrSet != VK_NULL_HANDLE || Signature.GetDevice()->UseDescriptorBuffers(),
+                       "Static and mutable variables must have a valid Vulkan descriptor set assigned");
             }
             else
             {
@@ -414,7 +423,8 @@ bool BindResourceHelper::UpdateCachedResource(RefCntAutoPtr<ObjectType>&& pObjec
                                         std::move(pObject),
                                         BufferBaseOffset,
                                         BufferRangeSize //
-                                    });
+                                    },
+                                    m_pWriteBatch);
         return true;
     }
     else
@@ -560,7 +570,8 @@ void BindResourceHelper::CacheImage(const BindResourceInfo& BindInfo) const
                         m_Signature,
                         m_ResourceCache,
                         m_Attribs.SamplerInd,
-                        SamplerResDesc.ArraySize == 1 ? 0 : m_ArrayIndex};
+                        SamplerResDesc.ArraySize == 1 ? 0 : m_ArrayIndex,
+                        m_pWriteBatch};
                     BindSeparateSampler(BindResourceInfo{BindSeparateSampler.m_ArrayIndex, pSampler, BindInfo.Flags});
                 }
                 else
@@ -633,6 +644,39 @@ void ShaderVariableManagerVk::BindResource(Uint32 ResIndex, const BindResourceIn
     BindHelper(BindInfo);
 }
 
+void ShaderVariableManagerVk::SetResources(const ResourceBindDesc* pDescs, Uint32 NumDescs)
+{
+    // All descriptor writes are submitted with a single vkUpdateDescriptorSets call
+    // when the batch goes out of scope.
+    ShaderResourceCacheVk::DescriptorWriteBatch WriteBatch{m_pSignature->GetDevice()->GetLogicalDevice()};
+
+    for (Uint32 i = 0; i < NumDescs; ++i)
+    {
+        const ResourceBindDesc& Desc = pDescs[i];
+        if (Desc.VariableIndex >= m_NumVariables)
+        {
+            DEV_ERROR("Variable index (", Desc.VariableIndex, ") is out of range. The number of variables is ", m_NumVariables);
+            continue;
+        }
+
+        const ShaderVariableVkImpl& Var = m_pVariables[Desc.VariableIndex];
+        if (Desc.ArrayIndex >= Var.GetDesc().ArraySize)
+        {
+            DEV_ERROR("Array index (", Desc.ArrayIndex, ") is out of range for variable '", Var.GetDesc().Name, "' of size ", Var.GetDesc().ArraySize);
+            continue;
+        }
+
+        BindResourceHelper BindHelper{
+            *m_pSignature,
+            m_ResourceCache,
+            Var.GetResIndex(),
+            Desc.ArrayIndex,
+            &WriteBatch};
+
+        BindHelper(BindResourceInfo{Desc.ArrayIndex, Desc.pObject, Desc.Flags});
+    }
+}
+
 void ShaderVariableManagerVk::SetBufferDynamicOffset(Uint32 ResIndex,
                                                      Uint32 ArrayIndex,
                                                      Uint32 BufferDynamicOffset)
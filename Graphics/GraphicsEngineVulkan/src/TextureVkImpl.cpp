@@ -148,7 +148,8 @@ TextureVkImpl::TextureVkImpl(IReferenceCounters*        pRefCounters,
                              FixedBlockMemoryAllocator& TexViewObjAllocator,
                              RenderDeviceVkImpl*        pRenderDeviceVk,
                              const TextureDesc&         TexDesc,
-                             const TextureData*         pInitData /*= nullptr*/) :
+                             const TextureData*         pInitData /*= nullptr*/,
+                             const TransientLifetime*   pLifetime /*= nullptr*/) :
     // clang-format off
     TTextureBase
     {
@@ -166,6 +167,12 @@ TextureVkImpl::TextureVkImpl(IReferenceCounters*        pRefCounters,
     if (IsMemoryless && pInitData != nullptr && pInitData->pSubResources != nullptr)
         LOG_ERROR_AND_THROW("Memoryless textures can't be initialized");
 
+    const auto IsTransient = (m_Desc.MiscFlags & MISC_TEXTURE_FLAG_TRANSIENT) != 0;
+    if (IsTransient != (pLifetime != nullptr))
+        LOG_ERROR_AND_THROW("Transient textures must be created with IRenderDeviceVk::CreateTransientTexture()");
+    if (IsTransient && pInitData != nullptr && pInitData->pSubResources != nullptr)
+        LOG_ERROR_AND_THROW("Transient textures can't be initialized");
+
     if (m_Desc.Usage == USAGE_SPARSE && m_Desc.Is3D() && (m_Desc.BindFlags & (BIND_RENDER_TARGET | BIND_DEPTH_STENCIL)) != 0)
         LOG_ERROR_AND_THROW("Sparse 3D texture with BIND_RENDER_TARGET or BIND_DEPTH_STENCIL is not supported in Vulkan");
 
@@ -213,15 +220,28 @@ TextureVkImpl::TextureVkImpl(IReferenceCounters*        pRefCounters,
 
             const auto ImageMemoryFlags = IsMemoryless ? VK_MEMORY_PROPERTY_LAZILY_ALLOCATED_BIT : VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
             VERIFY(IsPowerOfTwo(MemReqs.alignment), "Alignment is not power of 2!");
-            m_MemoryAllocation = pRenderDeviceVk->AllocateMemory(MemReqs, ImageMemoryFlags);
-            if (!m_MemoryAllocation)
-                LOG_ERROR_AND_THROW("Failed to allocate memory for texture '", m_Desc.Name, "'.");
+            if (IsTransient)
+            {
+                m_TransientAllocation = pRenderDeviceVk->AllocateTransientMemory(MemReqs, ImageMemoryFlags, pLifetime->FirstUse, pLifetime->LastUse);
+                if (!m_TransientAllocation)
+                    LOG_ERROR_AND_THROW("Failed to allocate transient memory for texture '", m_Desc.Name, "'.");
 
-            auto AlignedOffset = AlignUp(m_MemoryAllocation.UnalignedOffset, MemReqs.alignment);
-            VERIFY_EXPR(m_MemoryAllocation.Size >= MemReqs.size + (AlignedOffset - m_MemoryAllocation.UnalignedOffset));
-            auto Memory = m_MemoryAllocation.Page->GetVkMemory();
-            auto err    = LogicalDevice.BindImageMemory(m_VulkanImage, Memory, AlignedOffset);
-            CHECK_VK_ERROR_AND_THROW(err, "Failed to bind image memory");
+                VERIFY_EXPR(m_TransientAllocation.GetMemoryOffset() % MemReqs.alignment == 0);
+                auto err = LogicalDevice.BindImageMemory(m_VulkanImage, m_TransientAllocation.GetVkMemory(), m_TransientAllocation.GetMemoryOffset());
+                CHECK_VK_ERROR_AND_THROW(err, "Failed to bind image memory");
+            }
+            else
+            {
+                m_MemoryAllocation = pRenderDeviceVk->AllocateMemory(MemReqs, ImageMemoryFlags);
+                if (!m_MemoryAllocation)
+                    LOG_ERROR_AND_THROW("Failed to allocate memory for texture '", m_Desc.Name, "'.");
+
+                auto AlignedOffset = AlignUp(m_MemoryAllocation.UnalignedOffset, MemReqs.alignment);
+                VERIFY_EXPR(m_MemoryAllocation.Size >= MemReqs.size + (AlignedOffset - m_MemoryAllocation.UnalignedOffset));
+                auto Memory = m_MemoryAllocation.Page->GetVkMemory();
+                auto err    = LogicalDevice.BindImageMemory(m_VulkanImage, Memory, AlignedOffset);
+                CHECK_VK_ERROR_AND_THROW(err, "Failed to bind image memory");
+            }
 
             if (pInitData != nullptr && pInitData->pSubResources != nullptr && pInitData->NumSubresources > 0)
                 InitializeTextureContent(*pInitData, FmtAttribs, ImageCI);
@@ -241,6 +261,15 @@ TextureVkImpl::TextureVkImpl(IReferenceCounters*        pRefCounters,
     VERIFY_EXPR(IsInKnownState());
 }
 
+TextureVkImpl::TextureVkImpl(IReferenceCounters*        pRefCounters,
+                             FixedBlockMemoryAllocator& TexViewObjAllocator,
+                             RenderDeviceVkImpl*        pRenderDeviceVk,
+                             const TextureDesc&         TexDesc,
+                             const TransientLifetime&   Lifetime) :
+    TextureVkImpl{pRefCounters, TexViewObjAllocator, pRenderDeviceVk, TexDesc, nullptr, &Lifetime}
+{
+}
+
 void TextureVkImpl::InitializeTextureContent(const TextureData&          InitData,
                                              const TextureFormatAttribs& FmtAttribs,
                                              const VkImageCreateInfo&    ImageCI) noexcept(false)
@@ -570,6 +599,13 @@ TextureVkImpl::~TextureVkImpl()
     if (m_StagingBuffer)
         m_pDevice->SafeReleaseDeviceObject(std::move(m_StagingBuffer), m_Desc.ImmediateContextMask);
     m_pDevice->SafeReleaseDeviceObject(std::move(m_MemoryAllocation), m_Desc.ImmediateContextMask);
+    if (m_TransientAllocation)
+    {
+        // The memory must not be reused by other transient textures until the GPU is done with it.
+        // The allocation is returned to the page when the release queue purges it.
+        m_TransientAllocation.Retire();
+        m_pDevice->SafeReleaseDeviceObject(std::move(m_TransientAllocation), m_Desc.ImmediateContextMask);
+    }
 }
 
 VulkanUtilities::ImageViewWrapper TextureVkImpl::CreateImageView(TextureViewDesc& ViewDesc)
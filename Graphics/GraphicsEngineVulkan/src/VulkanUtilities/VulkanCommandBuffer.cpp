@@ -28,6 +28,7 @@
 
 #include "VulkanUtilities/VulkanCommandBuffer.hpp"
 #include "AdvancedMath.hpp"
+#include "DeviceContext.h"
 
 namespace VulkanUtilities
 {
@@ -140,6 +141,38 @@ static VkAccessFlags AccessMaskFromImageLayout(VkImageLayout Layout,
     return AccessMask;
 }
 
+// Returns true if any barrier in the list affects subresources of the image that overlap with SubresRange.
+template <typename ImageBarrierType>
+bool HasOverlappingImageBarrier(const std::vector<ImageBarrierType>& Barriers,
+                                VkImage                              Image,
+                                const VkImageSubresourceRange&       SubresRange)
+{
+    for (const auto& ImgBarrier : Barriers)
+    {
+        if (ImgBarrier.image != Image)
+            continue;
+
+        const auto& OtherRange = ImgBarrier.subresourceRange;
+
+        const auto StartLayer0 = SubresRange.baseArrayLayer;
+        const auto EndLayer0   = SubresRange.layerCount != VK_REMAINING_ARRAY_LAYERS ? (SubresRange.baseArrayLayer + SubresRange.layerCount) : ~0u;
+        const auto StartLayer1 = OtherRange.baseArrayLayer;
+        const auto EndLayer1   = OtherRange.layerCount != VK_REMAINING_ARRAY_LAYERS ? (OtherRange.baseArrayLayer + OtherRange.layerCount) : ~0u;
+
+        const auto StartMip0 = SubresRange.baseMipLevel;
+        const auto EndMip0   = SubresRange.levelCount != VK_REMAINING_MIP_LEVELS ? (SubresRange.baseMipLevel + SubresRange.levelCount) : ~0u;
+        const auto StartMip1 = OtherRange.baseMipLevel;
+        const auto EndMip1   = OtherRange.levelCount != VK_REMAINING_MIP_LEVELS ? (OtherRange.baseMipLevel + OtherRange.levelCount) : ~0u;
+
+        const auto SlicesOverlap = Diligent::CheckLineSectionOverlap<true>(StartLayer0, EndLayer0, StartLayer1, EndLayer1);
+        const auto MipsOverlap   = Diligent::CheckLineSectionOverlap<true>(StartMip0, EndMip0, StartMip1, EndMip1);
+        if (SlicesOverlap && MipsOverlap)
+            return true;
+    }
+
+    return false;
+}
+
 } // namespace
 
 
@@ -148,6 +181,23 @@ VulkanCommandBuffer::VulkanCommandBuffer() noexcept
     m_ImageBarriers.reserve(32);
 }
 
+void VulkanCommandBuffer::SetSynchronization2Enabled(bool Enabled)
+{
+    VERIFY(m_ImageBarriers.empty() && m_MemoryBarriers2.empty() && m_ImageBarriers2.empty() &&
+               m_Barrier.MemorySrcStages == 0 && m_Barrier.MemoryDstStages == 0,
+           "Synchronization mode must not be changed while there are pending barriers");
+#if !DILIGENT_USE_VOLK
+    // vkCmdPipelineBarrier2KHR is not available when vulkan library is linked statically
+    Enabled = false;
+#endif
+    m_UseSync2 = Enabled;
+    if (m_UseSync2)
+    {
+        m_MemoryBarriers2.reserve(8);
+        m_ImageBarriers2.reserve(32);
+    }
+}
+
 void VulkanCommandBuffer::TransitionImageLayout(VkImage                        Image,
                                                 VkImageLayout                  OldLayout,
                                                 VkImageLayout                  NewLayout,
@@ -165,6 +215,36 @@ void VulkanCommandBuffer::TransitionImageLayout(VkImage                        I
     VERIFY_EXPR((SrcStages & m_Barrier.SupportedStagesMask) != 0);
     VERIFY_EXPR((DstStages & m_Barrier.SupportedStagesMask) != 0);
 
+    if (m_UseSync2)
+    {
+        if (OldLayout == NewLayout)
+        {
+            AddMemoryBarrier2(SrcStages, DstStages, AccessMaskFromImageLayout(OldLayout, false), AccessMaskFromImageLayout(NewLayout, true));
+            return;
+        }
+
+        // Barriers within a single pipeline barrier command are not ordered with respect
+        // to each other, so overlapping transitions must go into separate commands.
+        if (HasOverlappingImageBarrier(m_ImageBarriers2, Image, SubresRange))
+            FlushBarriers();
+
+        VkImageMemoryBarrier2KHR ImgBarrier{};
+        ImgBarrier.sType               = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER_2_KHR;
+        ImgBarrier.pNext               = nullptr;
+        ImgBarrier.srcStageMask        = SrcStages & m_Barrier.SupportedStagesMask;
+        ImgBarrier.srcAccessMask       = AccessMaskFromImageLayout(OldLayout, false) & m_Barrier.SupportedAccessMask;
+        ImgBarrier.dstStageMask        = DstStages & m_Barrier.SupportedStagesMask;
+        ImgBarrier.dstAccessMask       = AccessMaskFromImageLayout(NewLayout, true) & m_Barrier.SupportedAccessMask;
+        ImgBarrier.oldLayout           = OldLayout;
+        ImgBarrier.newLayout           = NewLayout;
+        ImgBarrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        ImgBarrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        ImgBarrier.image               = Image;
+        ImgBarrier.subresourceRange    = SubresRange;
+        m_ImageBarriers2.emplace_back(ImgBarrier);
+        return;
+    }
+
     if (OldLayout == NewLayout)
     {
         m_Barrier.MemorySrcStages |= SrcStages;
@@ -175,36 +255,10 @@ void VulkanCommandBuffer::TransitionImageLayout(VkImage                        I
         return;
     }
 
-    // Check overlapping subresources
-    for (size_t i = 0; i < m_ImageBarriers.size(); ++i)
-    {
-        const auto& ImgBarrier = m_ImageBarriers[i];
-        if (ImgBarrier.image != Image)
-            continue;
-
-        const auto& OtherRange = ImgBarrier.subresourceRange;
-
-        const auto StartLayer0 = SubresRange.baseArrayLayer;
-        const auto EndLayer0   = SubresRange.layerCount != VK_REMAINING_ARRAY_LAYERS ? (SubresRange.baseArrayLayer + SubresRange.layerCount) : ~0u;
-        const auto StartLayer1 = OtherRange.baseArrayLayer;
-        const auto EndLayer1   = OtherRange.layerCount != VK_REMAINING_ARRAY_LAYERS ? (OtherRange.baseArrayLayer + OtherRange.layerCount) : ~0u;
-
-        const auto StartMip0 = SubresRange.baseMipLevel;
-        const auto EndMip0   = SubresRange.levelCount != VK_REMAINING_MIP_LEVELS ? (SubresRange.baseMipLevel + SubresRange.levelCount) : ~0u;
-        const auto StartMip1 = OtherRange.baseMipLevel;
-        const auto EndMip1   = OtherRange.levelCount != VK_REMAINING_MIP_LEVELS ? (OtherRange.baseMipLevel + OtherRange.levelCount) : ~0u;
-
-        const auto SlicesOverlap = Diligent::CheckLineSectionOverlap<true>(StartLayer0, EndLayer0, StartLayer1, EndLayer1);
-        const auto MipsOverlap   = Diligent::CheckLineSectionOverlap<true>(StartMip0, EndMip0, StartMip1, EndMip1);
-
-        // If the range overlaps with any of the existing barriers, we need to
-        // flush them.
-        if (SlicesOverlap && MipsOverlap)
-        {
-            FlushBarriers();
-            break;
-        }
-    }
+    // If the range overlaps with any of the existing barriers, we need to
+    // flush them.
+    if (HasOverlappingImageBarrier(m_ImageBarriers, Image, SubresRange))
+        FlushBarriers();
 
     m_Barrier.ImageSrcStages |= SrcStages;
     m_Barrier.ImageDstStages |= DstStages;
@@ -236,6 +290,12 @@ void VulkanCommandBuffer::MemoryBarrier(VkAccessFlags        srcAccessMask,
     VERIFY_EXPR((SrcStages & m_Barrier.SupportedStagesMask) != 0);
     VERIFY_EXPR((DstStages & m_Barrier.SupportedStagesMask) != 0);
 
+    if (m_UseSync2)
+    {
+        AddMemoryBarrier2(SrcStages, DstStages, srcAccessMask, dstAccessMask);
+        return;
+    }
+
     m_Barrier.MemorySrcStages |= SrcStages;
     m_Barrier.MemoryDstStages |= DstStages;
 
@@ -243,8 +303,49 @@ void VulkanCommandBuffer::MemoryBarrier(VkAccessFlags        srcAccessMask,
     m_Barrier.MemoryDstAccess |= dstAccessMask;
 }
 
+void VulkanCommandBuffer::AddMemoryBarrier2(VkPipelineStageFlags SrcStages,
+                                            VkPipelineStageFlags DstStages,
+                                            VkAccessFlags        SrcAccess,
+                                            VkAccessFlags        DstAccess)
+{
+    VERIFY_EXPR(m_UseSync2);
+
+    // Legacy stage and access flags have the same values as their synchronization2 counterparts
+    const VkPipelineStageFlags2KHR SrcStages2 = SrcStages & m_Barrier.SupportedStagesMask;
+    const VkPipelineStageFlags2KHR DstStages2 = DstStages & m_Barrier.SupportedStagesMask;
+    const VkAccessFlags2KHR        SrcAccess2 = SrcAccess & m_Barrier.SupportedAccessMask;
+    const VkAccessFlags2KHR        DstAccess2 = DstAccess & m_Barrier.SupportedAccessMask;
+
+    // Barriers between the same pairs of stages can be merged without introducing
+    // any extra dependencies.
+    for (auto& MemBarrier : m_MemoryBarriers2)
+    {
+        if (MemBarrier.srcStageMask == SrcStages2 && MemBarrier.dstStageMask == DstStages2)
+        {
+            MemBarrier.srcAccessMask |= SrcAccess2;
+            MemBarrier.dstAccessMask |= DstAccess2;
+            return;
+        }
+    }
+
+    VkMemoryBarrier2KHR MemBarrier{};
+    MemBarrier.sType         = VK_STRUCTURE_TYPE_MEMORY_BARRIER_2_KHR;
+    MemBarrier.pNext         = nullptr;
+    MemBarrier.srcStageMask  = SrcStages2;
+    MemBarrier.srcAccessMask = SrcAccess2;
+    MemBarrier.dstStageMask  = DstStages2;
+    MemBarrier.dstAccessMask = DstAccess2;
+    m_MemoryBarriers2.emplace_back(MemBarrier);
+}
+
 void VulkanCommandBuffer::FlushBarriers()
 {
+    if (m_UseSync2)
+    {
+        FlushBarriers2();
+        return;
+    }
+
     if (m_Barrier.MemorySrcStages == 0 && m_Barrier.MemoryDstStages == 0 && m_ImageBarriers.empty())
         return;
 
@@ -280,6 +381,13 @@ void VulkanCommandBuffer::FlushBarriers()
                          static_cast<uint32_t>(m_ImageBarriers.size()),
                          m_ImageBarriers.empty() ? nullptr : m_ImageBarriers.data());
 
+    if (m_pBarrierCounters != nullptr)
+    {
+        ++m_pBarrierCounters->PipelineBarriers;
+        m_pBarrierCounters->MemoryBarriers += HasMemoryBarrier ? 1 : 0;
+        m_pBarrierCounters->ImageBarriers += static_cast<Diligent::Uint32>(m_ImageBarriers.size());
+    }
+
     m_ImageBarriers.clear();
     m_Barrier.ImageSrcStages  = 0;
     m_Barrier.ImageDstStages  = 0;
@@ -290,4 +398,43 @@ void VulkanCommandBuffer::FlushBarriers()
     // Do not clear SupportedStagesMask and SupportedAccessMask
 }
 
+void VulkanCommandBuffer::FlushBarriers2()
+{
+    if (m_MemoryBarriers2.empty() && m_ImageBarriers2.empty())
+        return;
+
+    if (m_State.RenderPass != VK_NULL_HANDLE)
+    {
+        EndRenderPass();
+    }
+
+    VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+
+#if DILIGENT_USE_VOLK
+    VkDependencyInfoKHR DependencyInfo{};
+    DependencyInfo.sType                    = VK_STRUCTURE_TYPE_DEPENDENCY_INFO_KHR;
+    DependencyInfo.pNext                    = nullptr;
+    DependencyInfo.dependencyFlags          = 0;
+    DependencyInfo.memoryBarrierCount       = static_cast<uint32_t>(m_MemoryBarriers2.size());
+    DependencyInfo.pMemoryBarriers          = m_MemoryBarriers2.empty() ? nullptr : m_MemoryBarriers2.data();
+    DependencyInfo.bufferMemoryBarrierCount = 0;
+    DependencyInfo.pBufferMemoryBarriers    = nullptr;
+    DependencyInfo.imageMemoryBarrierCount  = static_cast<uint32_t>(m_ImageBarriers2.size());
+    DependencyInfo.pImageMemoryBarriers     = m_ImageBarriers2.empty() ? nullptr : m_ImageBarriers2.data();
+    vkCmdPipelineBarrier2KHR(m_VkCmdBuffer, &DependencyInfo);
+
+    if (m_pBarrierCounters != nullptr)
+    {
+        ++m_pBarrierCounters->PipelineBarriers;
+        m_pBarrierCounters->MemoryBarriers += static_cast<Diligent::Uint32>(m_MemoryBarriers2.size());
+        m_pBarrierCounters->ImageBarriers += static_cast<Diligent::Uint32>(m_ImageBarriers2.size());
+    }
+#else
+    UNEXPECTED("Synchronization2 is not supported when vulkan library is linked statically");
+#endif
+
+    m_MemoryBarriers2.clear();
+    m_ImageBarriers2.clear();
+}
+
 } // namespace VulkanUtilities
@@ -565,10 +565,10 @@ void VulkanLogicalDevice::ReleaseVulkanObject(PipelineCacheWrapper&& PipeCache)
     PipeCache.m_VkObject = VK_NULL_HANDLE;
 }
 
-void VulkanLogicalDevice::FreeDescriptorSet(VkDescriptorPool Pool, VkDescriptorSet Set) const
+void VulkanLogicalDevice::FreeDescriptorSets(VkDescriptorPool Pool, uint32_t SetCount, const VkDescriptorSet* pSets) const
 {
-    VERIFY_EXPR(Pool != VK_NULL_HANDLE && Set != VK_NULL_HANDLE);
-    vkFreeDescriptorSets(m_VkDevice, Pool, 1, &Set);
+    VERIFY_EXPR(Pool != VK_NULL_HANDLE && SetCount > 0 && pSets != nullptr);
+    vkFreeDescriptorSets(m_VkDevice, Pool, SetCount, pSets);
 }
 
 
@@ -745,4 +745,51 @@ VkResult VulkanLogicalDevice::GetRayTracingShaderGroupHandles(VkPipeline pipelin
 #endif
 }
 
+VkDeviceAddress VulkanLogicalDevice::GetBufferDeviceAddress(VkBuffer vkBuffer) const
+{
+#if DILIGENT_USE_VOLK
+    VkBufferDeviceAddressInfoKHR BufferInfo{};
+    BufferInfo.sType  = VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO_KHR;
+    BufferInfo.buffer = vkBuffer;
+    return vkGetBufferDeviceAddressKHR(m_VkDevice, &BufferInfo);
+#else
+    UNSUPPORTED("vkGetBufferDeviceAddressKHR is only available through Volk");
+    return 0;
+#endif
+}
+
+VkDeviceSize VulkanLogicalDevice::GetDescriptorSetLayoutSize(VkDescriptorSetLayout vkLayout) const
+{
+#if DILIGENT_USE_VOLK
+    VkDeviceSize Size = 0;
+    vkGetDescriptorSetLayoutSizeEXT(m_VkDevice, vkLayout, &Size);
+    return Size;
+#else
+    UNSUPPORTED("vkGetDescriptorSetLayoutSizeEXT is only available through Volk");
+    return 0;
+#endif
+}
+
+VkDeviceSize VulkanLogicalDevice::GetDescriptorSetLayoutBindingOffset(VkDescriptorSetLayout vkLayout, uint32_t Binding) const
+{
+#if DILIGENT_USE_VOLK
+    VkDeviceSize Offset = 0;
+    vkGetDescriptorSetLayoutBindingOffsetEXT(m_VkDevice, vkLayout, Binding, &Offset);
+    return Offset;
+#else
+    UNSUPPORTED("vkGetDescriptorSetLayoutBindingOffsetEXT is only available through Volk");
+    return 0;
+#endif
+}
+
+void VulkanLogicalDevice::GetDescriptor(const VkDescriptorGetInfoEXT& DescriptorInfo, size_t DataSize, void* pDescriptor) const
+{
+#if DILIGENT_USE_VOLK
+    VERIFY_EXPR(DescriptorInfo.sType == VK_STRUCTURE_TYPE_DESCRIPTOR_GET_INFO_EXT);
+    vkGetDescriptorEXT(m_VkDevice, &DescriptorInfo, DataSize, pDescriptor);
+#else
+    UNSUPPORTED("vkGetDescriptorEXT is only available through Volk");
+#endif
+}
+
 } // namespace VulkanUtilities
@@ -27,6 +27,7 @@
 
 #include "pch.h"
 #include <sstream>
+#include <algorithm>
 #include "VulkanUtilities/VulkanMemoryManager.hpp"
 
 namespace VulkanUtilities
@@ -116,6 +117,29 @@ VulkanMemoryAllocation VulkanMemoryPage::Allocate(VkDeviceSize size, VkDeviceSiz
     }
 }
 
+VulkanMemoryPage::Stats VulkanMemoryPage::GetStats()
+{
+    std::lock_guard<std::mutex> Lock{m_Mutex};
+
+    Stats PageStats;
+    PageStats.PageSize         = m_AllocationMgr.GetMaxSize();
+    PageStats.UsedSize         = m_AllocationMgr.GetUsedSize();
+    PageStats.MaxFreeBlockSize = m_AllocationMgr.GetMaxFreeBlockSize();
+    return PageStats;
+}
+
+bool VulkanMemoryPage::TryGetStats(Stats& PageStats)
+{
+    std::unique_lock<std::mutex> Lock{m_Mutex, std::try_to_lock};
+    if (!Lock.owns_lock())
+        return false;
+
+    PageStats.PageSize         = m_AllocationMgr.GetMaxSize();
+    PageStats.UsedSize         = m_AllocationMgr.GetUsedSize();
+    PageStats.MaxFreeBlockSize = m_AllocationMgr.GetMaxFreeBlockSize();
+    return true;
+}
+
 void VulkanMemoryPage::Free(VulkanMemoryAllocation&& Allocation)
 {
     m_ParentMemoryMgr.OnFreeAllocation(Allocation.Size, m_CPUMemory != nullptr);
@@ -172,12 +196,34 @@ VulkanMemoryAllocation VulkanMemoryManager::Allocate(VkDeviceSize Size, VkDevice
     MemoryPageIndex             PageIdx{MemoryTypeIndex, HostVisible, AllocateFlags};
     std::lock_guard<std::mutex> Lock{m_PagesMtx};
 
-    auto range = m_Pages.equal_range(PageIdx);
+    // Try the page with the highest occupancy first. This keeps new allocations away from
+    // sparsely occupied pages, so that they are gradually drained and can be released by ShrinkMemory().
+    // Pages whose mutex is currently locked by another thread releasing an allocation are skipped
+    // by the scan, but are still tried by the first-fit fallback below.
+    auto              range         = m_Pages.equal_range(PageIdx);
+    VulkanMemoryPage* pBestPage     = nullptr;
+    double            BestOccupancy = -1;
     for (auto page_it = range.first; page_it != range.second; ++page_it)
     {
-        Allocation = page_it->second.Allocate(Size, Alignment);
-        if (Allocation.Page != nullptr)
-            break;
+        VulkanMemoryPage::Stats PageStats;
+        if (!page_it->second.TryGetStats(PageStats) || PageStats.MaxFreeBlockSize < Size)
+            continue;
+
+        const auto Occupancy = static_cast<double>(PageStats.UsedSize) / static_cast<double>(PageStats.PageSize);
+        if (Occupancy > BestOccupancy)
+        {
+            BestOccupancy = Occupancy;
+            pBestPage     = &page_it->second;
+        }
+    }
+    if (pBestPage != nullptr)
+        Allocation = pBestPage->Allocate(Size, Alignment);
+
+    // The best page may fail to accommodate the alignment
+    for (auto page_it = range.first; page_it != range.second && Allocation.Page == nullptr; ++page_it)
+    {
+        if (&page_it->second != pBestPage)
+            Allocation = page_it->second.Allocate(Size, Alignment);
     }
 
     size_t stat_ind = HostVisible ? 1 : 0;
@@ -210,8 +256,222 @@ VulkanMemoryAllocation VulkanMemoryManager::Allocate(VkDeviceSize Size, VkDevice
     return Allocation;
 }
 
+VulkanTransientAllocation::~VulkanTransientAllocation()
+{
+    if (Page != nullptr)
+    {
+        Page->Free(std::move(*this));
+    }
+}
+
+void VulkanTransientAllocation::Retire()
+{
+    VERIFY_EXPR(Page != nullptr);
+    Page->Retire(*this);
+}
+
+VkDeviceMemory VulkanTransientAllocation::GetVkMemory() const
+{
+    VERIFY_EXPR(Page != nullptr);
+    return Page->GetVkMemory();
+}
+
+VkDeviceSize VulkanTransientAllocation::GetMemoryOffset() const
+{
+    VERIFY_EXPR(Page != nullptr);
+    return Page->GetBaseOffset() + Alloc.Offset;
+}
+
+VulkanAliasingPage::VulkanAliasingPage(VulkanMemoryAllocation&&    Memory,
+                                       VkDeviceSize                PageSize,
+                                       VkDeviceSize                BaseAlignment,
+                                       uint32_t                    MemoryTypeIndex,
+                                       Diligent::IMemoryAllocator& Allocator) :
+    // clang-format off
+    m_Memory         {std::move(Memory)},
+    m_BaseOffset     {Diligent::AlignUp(m_Memory.UnalignedOffset, BaseAlignment)},
+    m_BaseAlignment  {BaseAlignment    },
+    m_MemoryTypeIndex{MemoryTypeIndex  },
+    m_AllocationMgr  {static_cast<Diligent::AliasingAllocationsManager::OffsetType>(PageSize), Allocator}
+// clang-format on
+{
+    VERIFY_EXPR(m_Memory.IsValid());
+    VERIFY_EXPR(m_BaseOffset + PageSize <= m_Memory.UnalignedOffset + m_Memory.Size);
+}
+
+VulkanTransientAllocation VulkanAliasingPage::Allocate(VkDeviceSize Size, VkDeviceSize Alignment, Diligent::Uint32 FirstUse, Diligent::Uint32 LastUse)
+{
+    VERIFY(Alignment <= m_BaseAlignment, "Alignment (", Alignment, ") exceeds the page base alignment (", m_BaseAlignment, ")");
+
+    std::lock_guard<std::mutex> Lock{m_Mutex};
+
+    using OffsetType = Diligent::AliasingAllocationsManager::OffsetType;
+    auto Allocation  = m_AllocationMgr.Allocate(static_cast<OffsetType>(Size), static_cast<OffsetType>(Alignment), FirstUse, LastUse);
+    return Allocation.IsValid() ?
+        VulkanTransientAllocation{this, Allocation} :
+        VulkanTransientAllocation{};
+}
+
+void VulkanAliasingPage::Retire(VulkanTransientAllocation& Allocation)
+{
+    std::lock_guard<std::mutex> Lock{m_Mutex};
+    Allocation.Alloc = m_AllocationMgr.Retire(Allocation.Alloc);
+}
+
+void VulkanAliasingPage::Free(VulkanTransientAllocation&& Allocation)
+{
+    std::lock_guard<std::mutex> Lock{m_Mutex};
+    m_AllocationMgr.Free(Allocation.Alloc);
+    Allocation = VulkanTransientAllocation{};
+}
+
+VulkanAliasingPage::Stats VulkanAliasingPage::GetStats()
+{
+    std::lock_guard<std::mutex> Lock{m_Mutex};
+
+    Stats PageStats;
+    PageStats.PageSize           = m_AllocationMgr.GetMaxSize();
+    PageStats.UsedSize           = m_AllocationMgr.GetUsedSize();
+    PageStats.TotalAllocatedSize = m_AllocationMgr.GetTotalAllocatedSize();
+    PageStats.NumAllocations     = m_AllocationMgr.GetNumAllocations();
+    return PageStats;
+}
+
+bool VulkanAliasingPage::IsEmpty()
+{
+    std::lock_guard<std::mutex> Lock{m_Mutex};
+    return m_AllocationMgr.IsEmpty();
+}
+
+VulkanTransientAllocation VulkanMemoryManager::AllocateTransient(const VkMemoryRequirements& MemReqs,
+                                                                 VkMemoryPropertyFlags       MemoryProps,
+                                                                 Diligent::Uint32            FirstUse,
+                                                                 Diligent::Uint32            LastUse)
+{
+    // All aliasing resources are optimal-tiling images, so bufferImageGranularity does not need to be respected.
+    // Page base is aligned by at least 64K, which is sufficient for the majority of images.
+    constexpr VkDeviceSize MinPageAlignment = VkDeviceSize{64} << 10;
+
+    DEV_CHECK_ERR((MemoryProps & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) == 0, "Transient memory must not be host-visible");
+    DEV_CHECK_ERR(FirstUse <= LastUse, "First use (", FirstUse, ") must not be greater than the last use (", LastUse, ")");
+
+    const auto MemoryTypeIndex = m_PhysicalDevice.GetMemoryTypeIndex(MemReqs.memoryTypeBits, MemoryProps);
+    if (MemoryTypeIndex == VulkanUtilities::VulkanPhysicalDevice::InvalidMemoryTypeIndex)
+        LOG_ERROR_AND_THROW("Failed to find suitable device memory type for a transient resource");
+
+    std::lock_guard<std::mutex> Lock{m_AliasingPagesMtx};
+
+    VulkanTransientAllocation Allocation;
+    for (auto& pPage : m_AliasingPages)
+    {
+        if (pPage->GetMemoryTypeIndex() != MemoryTypeIndex || pPage->GetBaseAlignment() < MemReqs.alignment)
+            continue;
+
+        Allocation = pPage->Allocate(MemReqs.size, MemReqs.alignment, FirstUse, LastUse);
+        if (Allocation)
+            break;
+    }
+
+    if (!Allocation)
+    {
+        auto PageSize = m_DeviceLocalPageSize;
+        while (PageSize < MemReqs.size)
+            PageSize *= 2;
+        const auto BaseAlignment = std::max(MemReqs.alignment, MinPageAlignment);
+
+        // Regular pages have the same size, so the aliasing page will most likely occupy an entire page
+        auto Memory = Allocate(PageSize, BaseAlignment, MemoryTypeIndex, /*HostVisible = */ false, /*AllocateFlags = */ 0);
+        if (!Memory)
+            return VulkanTransientAllocation{};
+
+        m_AliasingPages.emplace_back(new VulkanAliasingPage{std::move(Memory), PageSize, BaseAlignment, MemoryTypeIndex, m_Allocator});
+        LOG_INFO_MESSAGE("VulkanMemoryManager '", m_MgrName, "': created new aliasing page. (",
+                         Diligent::FormatMemorySize(PageSize, 2), ", type idx: ", MemoryTypeIndex, ")");
+
+        Allocation = m_AliasingPages.back()->Allocate(MemReqs.size, MemReqs.alignment, FirstUse, LastUse);
+        DEV_CHECK_ERR(Allocation, "Failed to allocate memory from a new aliasing page");
+    }
+
+    VkDeviceSize RequestedSize = 0;
+    VkDeviceSize UsedSize      = 0;
+    VkDeviceSize PageSize      = 0;
+    for (auto& pPage : m_AliasingPages)
+    {
+        const auto PageStats = pPage->GetStats();
+        RequestedSize += PageStats.TotalAllocatedSize;
+        UsedSize += PageStats.UsedSize;
+        PageSize += PageStats.PageSize;
+    }
+    m_PeakTransientRequestedSize = std::max(m_PeakTransientRequestedSize, RequestedSize);
+    m_PeakTransientUsedSize      = std::max(m_PeakTransientUsedSize, UsedSize);
+    m_PeakTransientPageSize      = std::max(m_PeakTransientPageSize, PageSize);
+
+    return Allocation;
+}
+
+VulkanTransientMemoryStats VulkanMemoryManager::GetTransientMemoryStats()
+{
+    std::lock_guard<std::mutex> Lock{m_AliasingPagesMtx};
+
+    VulkanTransientMemoryStats Stats;
+    Stats.NumPages = m_AliasingPages.size();
+    for (auto& pPage : m_AliasingPages)
+    {
+        const auto PageStats = pPage->GetStats();
+        Stats.NumAllocations += PageStats.NumAllocations;
+        Stats.RequestedSize += PageStats.TotalAllocatedSize;
+        Stats.UsedSize += PageStats.UsedSize;
+        Stats.PageSize += PageStats.PageSize;
+    }
+    Stats.PeakRequestedSize = m_PeakTransientRequestedSize;
+    Stats.PeakUsedSize      = m_PeakTransientUsedSize;
+    Stats.PeakPageSize      = m_PeakTransientPageSize;
+
+    return Stats;
+}
+
+std::array<VulkanMemoryPageStats, 2> VulkanMemoryManager::GetMemoryStats()
+{
+    std::array<VulkanMemoryPageStats, 2> Stats;
+
+    std::lock_guard<std::mutex> Lock{m_PagesMtx};
+    for (auto& it : m_Pages)
+    {
+        auto&      Page      = it.second;
+        const auto PageStats = Page.GetStats();
+        auto&      KindStats = Stats[Page.GetCPUMemory() != nullptr ? 1 : 0];
+        KindStats.NumPages += 1;
+        KindStats.AllocatedSize += PageStats.PageSize;
+        KindStats.UsedSize += PageStats.UsedSize;
+        KindStats.MaxFreeBlockSize = std::max(KindStats.MaxFreeBlockSize, PageStats.MaxFreeBlockSize);
+    }
+
+    return Stats;
+}
+
 void VulkanMemoryManager::ShrinkMemory()
 {
+    {
+        std::lock_guard<std::mutex> AliasingLock{m_AliasingPagesMtx};
+
+        bool ExceedsReserve = false;
+        {
+            std::lock_guard<std::mutex> Lock{m_PagesMtx};
+            ExceedsReserve = m_CurrAllocatedSize[0] > m_DeviceLocalReserveSize;
+        }
+
+        // Empty aliasing pages are kept while the memory is within the reserve, so that
+        // transient resources that are recreated every frame do not cause page churn.
+        if (ExceedsReserve)
+        {
+            m_AliasingPages.erase(std::remove_if(m_AliasingPages.begin(), m_AliasingPages.end(),
+                                                 [](const std::unique_ptr<VulkanAliasingPage>& pPage) {
+                                                     return pPage->IsEmpty();
+                                                 }),
+                                  m_AliasingPages.end());
+        }
+    }
+
     std::lock_guard<std::mutex> Lock{m_PagesMtx};
     if (m_CurrAllocatedSize[0] <= m_DeviceLocalReserveSize && m_CurrAllocatedSize[1] <= m_HostVisibleReserveSize)
         return;
@@ -257,6 +517,22 @@ VulkanMemoryManager::~VulkanMemoryManager()
                      Diligent::FormatMemorySize(m_PeakAllocatedSize[1], 2, m_PeakAllocatedSize[1]),
                      " (", PeakHostVisiblePages, (PeakHostVisiblePages == 1 ? " page)" : " pages)"));
 
+    if (m_PeakTransientPageSize > 0)
+    {
+        LOG_INFO_MESSAGE("VulkanMemoryManager '", m_MgrName, "' transient memory stats:\n"
+                                                             "                       Peak requested/used/allocated size: ",
+                         Diligent::FormatMemorySize(m_PeakTransientRequestedSize, 2), " / ",
+                         Diligent::FormatMemorySize(m_PeakTransientUsedSize, 2), " / ",
+                         Diligent::FormatMemorySize(m_PeakTransientPageSize, 2),
+                         "\n                       Peak aliasing savings: ",
+                         Diligent::FormatMemorySize(m_PeakTransientRequestedSize - std::min(m_PeakTransientUsedSize, m_PeakTransientRequestedSize), 2));
+    }
+
+    for (const auto& pPage : m_AliasingPages)
+        VERIFY(pPage->IsEmpty(), "The aliasing page contains outstanding allocations");
+    // Aliasing pages return their memory to regular pages
+    m_AliasingPages.clear();
+
     for (auto it = m_Pages.begin(); it != m_Pages.end(); ++it)
         VERIFY(it->second.IsEmpty(), "The page contains outstanding allocations");
     VERIFY(m_CurrUsedSize[0] == 0 && m_CurrUsedSize[1] == 0, "Not all allocations have been released");
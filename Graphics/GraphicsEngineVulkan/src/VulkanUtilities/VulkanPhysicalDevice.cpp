@@ -336,6 +336,37 @@ VulkanPhysicalDevice::VulkanPhysicalDevice(const CreateInfo& CI) :
             m_ExtProperties.MultiDraw.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTI_DRAW_PROPERTIES_EXT;
         }
 
+        if (IsExtensionSupported(VK_KHR_SYNCHRONIZATION_2_EXTENSION_NAME))
+        {
+            *NextFeat = &m_ExtFeatures.Synchronization2;
+            NextFeat  = &m_ExtFeatures.Synchronization2.pNext;
+
+            m_ExtFeatures.Synchronization2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SYNCHRONIZATION_2_FEATURES_KHR;
+        }
+
+        if (IsExtensionSupported(VK_EXT_DESCRIPTOR_BUFFER_EXTENSION_NAME))
+        {
+            *NextFeat = &m_ExtFeatures.DescriptorBuffer;
+            NextFeat  = &m_ExtFeatures.DescriptorBuffer.pNext;
+
+            m_ExtFeatures.DescriptorBuffer.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_BUFFER_FEATURES_EXT;
+
+            *NextProp = &m_ExtProperties.DescriptorBuffer;
+            NextProp  = &m_ExtProperties.DescriptorBuffer.pNext;
+
+            m_ExtProperties.DescriptorBuffer.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_BUFFER_PROPERTIES_EXT;
+        }
+
+        if (IsExtensionSupported(VK_KHR_PUSH_DESCRIPTOR_EXTENSION_NAME))
+        {
+            m_ExtFeatures.PushDescriptor = true;
+
+            *NextProp = &m_ExtProperties.PushDescriptor;
+            NextProp  = &m_ExtProperties.PushDescriptor.pNext;
+
+            m_ExtProperties.PushDescriptor.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PUSH_DESCRIPTOR_PROPERTIES_KHR;
+        }
+
         // make sure that last pNext is null
         *NextFeat = nullptr;
         *NextProp = nullptr;
@@ -57,6 +57,7 @@ public:
     void Destroy(IMemoryAllocator& Allocator);
 
     ShaderVariableWebGPUImpl* GetVariable(const Char* Name) const;
+    ShaderVariableWebGPUImpl* GetVariableByHash(Uint64 NameHash, const Char* Name = nullptr) const;
     ShaderVariableWebGPUImpl* GetVariable(Uint32 Index) const;
 
     void BindResource(Uint32 ResIndex, const BindResourceInfo& BindInfo);
@@ -70,6 +71,8 @@ public:
 
     void BindResources(IResourceMapping* pResourceMapping, BIND_SHADER_RESOURCES_FLAGS Flags);
 
+    void SetResources(const ResourceBindDesc* pDescs, Uint32 NumDescs);
+
     void CheckResources(IResourceMapping*                    pResourceMapping,
                         BIND_SHADER_RESOURCES_FLAGS          Flags,
                         SHADER_RESOURCE_VARIABLE_TYPE_FLAGS& StaleVarTypes) const;
@@ -117,13 +117,16 @@ void ShaderVariableManagerWebGPU::Destroy(IMemoryAllocator& Allocator)
 
 ShaderVariableWebGPUImpl* ShaderVariableManagerWebGPU::GetVariable(const Char* Name) const
 {
-    for (Uint32 v = 0; v < m_NumVariables; ++v)
-    {
-        ShaderVariableWebGPUImpl& Var = m_pVariables[v];
-        if (strcmp(Var.GetDesc().Name, Name) == 0)
-            return &Var;
-    }
-    return nullptr;
+    return GetVariableByHash(ComputeShaderResourceNameHash(Name), Name);
+}
+
+ShaderVariableWebGPUImpl* ShaderVariableManagerWebGPU::GetVariableByHash(Uint64 NameHash, const Char* Name) const
+{
+    // Variables are created in the order of resources in the signature, so they are sorted by the resource index
+    return FindVariableByNameHash<ShaderVariableWebGPUImpl>(NameHash, Name,
+                                                            [this](Uint32 ResIndex) {
+                                                                return FindVariableByResIndex(m_pVariables, m_NumVariables, ResIndex);
+                                                            });
 }
 
 ShaderVariableWebGPUImpl* ShaderVariableManagerWebGPU::GetVariable(Uint32 Index) const
@@ -174,6 +177,11 @@ void ShaderVariableManagerWebGPU::BindResources(IResourceMapping* pResourceMappi
     TBase::BindResources(pResourceMapping, Flags);
 }
 
+void ShaderVariableManagerWebGPU::SetResources(const ResourceBindDesc* pDescs, Uint32 NumDescs)
+{
+    TBase::SetResources(pDescs, NumDescs);
+}
+
 void ShaderVariableManagerWebGPU::CheckResources(IResourceMapping*                    pResourceMapping,
                                                  BIND_SHADER_RESOURCES_FLAGS          Flags,
                                                  SHADER_RESOURCE_VARIABLE_TYPE_FLAGS& StaleVarTypes) const
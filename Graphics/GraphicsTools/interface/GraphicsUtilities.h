@@ -33,6 +33,7 @@
 #include "../../GraphicsEngine/interface/Texture.h"
 #include "../../GraphicsEngine/interface/Buffer.h"
 #include "../../GraphicsEngine/interface/RenderDevice.h"
+#include "../../../Common/interface/ThreadPool.h"
 
 DILIGENT_BEGIN_NAMESPACE(Diligent)
 
@@ -70,7 +71,22 @@ DILIGENT_TYPED_ENUM(MIP_FILTER_TYPE, Uint8)
     /// Use the most frequent element from the 2x2 box.
     /// This filter does not introduce new values and should be used
     /// for integer textures that contain non-filterable data (e.g. indices).
-    MIP_FILTER_TYPE_MOST_FREQUENT
+    MIP_FILTER_TYPE_MOST_FREQUENT,
+
+    /// Separable Kaiser-windowed sinc filter (radius 3, alpha 4).
+    ///
+    /// \remarks   Polyphase filters are applied to the texture in linear space:
+    ///             color channels of sRGB formats are converted to linear space
+    ///             before filtering and back to sRGB after; alpha is always linear.
+    ///             Polyphase filters are not supported for UINT/SINT formats,
+    ///             and the default filter is used instead.
+    MIP_FILTER_TYPE_KAISER,
+
+    /// Separable Lanczos filter with 3 lobes, see MIP_FILTER_TYPE_KAISER remarks.
+    MIP_FILTER_TYPE_LANCZOS,
+
+    /// Separable Mitchell-Netravali filter (B = C = 1/3), see MIP_FILTER_TYPE_KAISER remarks.
+    MIP_FILTER_TYPE_MITCHELL
 };
 
 
@@ -106,8 +122,17 @@ struct ComputeMipLevelAttribs
     /// \remarks
     ///     When AlphaCutoff is not 0, alpha channel is remapped as follows:
     ///         A_new = max(A_old; 1/3 * A_old + 2/3 * AlphaCutoff)
+    ///     unless PreserveAlphaCoverage is true.
     float AlphaCutoff          DEFAULT_INITIALIZER(0);
 
+    /// Whether to preserve the alpha-test coverage.
+    ///
+    /// \remarks
+    ///     When AlphaCutoff is not 0 and this member is true, alpha channel of the
+    ///     coarse level is scaled so that the fraction of texels with alpha greater
+    ///     than AlphaCutoff is the same as in the fine level.
+    bool PreserveAlphaCoverage DEFAULT_INITIALIZER(false);
+
 #if DILIGENT_CPP_INTERFACE
     constexpr ComputeMipLevelAttribs() noexcept {}
 
@@ -118,17 +143,19 @@ struct ComputeMipLevelAttribs
                                      size_t           _FineMipStride,
                                      void*            _pCoarseMipData,
                                      size_t           _CoarseMipStride,
-                                     MIP_FILTER_TYPE _FilterType  = ComputeMipLevelAttribs{}.FilterType,
-                                     float            _AlphaCutoff = ComputeMipLevelAttribs{}.AlphaCutoff) noexcept :
-        Format          {_Format},
-        FineMipWidth    {_FineMipWidth},
-        FineMipHeight   {_FineMipHeight},
-        pFineMipData    {_pFineMipData},
-        FineMipStride   {_FineMipStride},
-        pCoarseMipData  {_pCoarseMipData},
-        CoarseMipStride {_CoarseMipStride},
-        FilterType      {_FilterType},
-        AlphaCutoff     {_AlphaCutoff}
+                                     MIP_FILTER_TYPE _FilterType            = ComputeMipLevelAttribs{}.FilterType,
+                                     float            _AlphaCutoff           = ComputeMipLevelAttribs{}.AlphaCutoff,
+                                     bool             _PreserveAlphaCoverage = ComputeMipLevelAttribs{}.PreserveAlphaCoverage) noexcept :
+        Format                {_Format},
+        FineMipWidth          {_FineMipWidth},
+        FineMipHeight         {_FineMipHeight},
+        pFineMipData          {_pFineMipData},
+        FineMipStride         {_FineMipStride},
+        pCoarseMipData        {_pCoarseMipData},
+        CoarseMipStride       {_CoarseMipStride},
+        FilterType            {_FilterType},
+        AlphaCutoff           {_AlphaCutoff},
+        PreserveAlphaCoverage {_PreserveAlphaCoverage}
     {} 
 #endif
 };
@@ -137,6 +164,69 @@ typedef struct ComputeMipLevelAttribs ComputeMipLevelAttribs;
 
 void DILIGENT_GLOBAL_FUNCTION(ComputeMipLevel)(const ComputeMipLevelAttribs REF Attribs);
 
+// clang-format off
+
+/// Mip level data used by ComputeMipChain function
+struct MipLevelData
+{
+    /// Pointer to the mip level data.
+    void* pData   DEFAULT_INITIALIZER(nullptr);
+
+    /// Mip level data stride, in bytes.
+    size_t Stride DEFAULT_INITIALIZER(0);
+};
+typedef struct MipLevelData MipLevelData;
+
+/// ComputeMipChain function attributes
+struct ComputeMipChainAttribs
+{
+    /// Texture format.
+    TEXTURE_FORMAT Format           DEFAULT_INITIALIZER(TEX_FORMAT_UNKNOWN);
+
+    /// Top mip level width.
+    Uint32 Width                    DEFAULT_INITIALIZER(0);
+
+    /// Top mip level height.
+    Uint32 Height                   DEFAULT_INITIALIZER(0);
+
+    /// Pointer to the top mip level data.
+    const void* pData               DEFAULT_INITIALIZER(nullptr);
+
+    /// Top mip level data stride, in bytes.
+    size_t Stride                   DEFAULT_INITIALIZER(0);
+
+    /// The number of mip levels to generate, not counting the top level.
+    Uint32 NumMipLevels             DEFAULT_INITIALIZER(0);
+
+    /// Pointer to the array of NumMipLevels mip level data descriptions.
+    /// Element i describes the level i+1.
+    const MipLevelData* pMipLevels  DEFAULT_INITIALIZER(nullptr);
+
+    /// Filter type, see ComputeMipLevelAttribs::FilterType.
+    MIP_FILTER_TYPE FilterType      DEFAULT_INITIALIZER(MIP_FILTER_TYPE_DEFAULT);
+
+    /// Alpha cutoff value, see ComputeMipLevelAttribs::AlphaCutoff.
+    float AlphaCutoff               DEFAULT_INITIALIZER(0);
+
+    /// Whether to preserve the alpha-test coverage, see ComputeMipLevelAttribs::PreserveAlphaCoverage.
+    bool PreserveAlphaCoverage      DEFAULT_INITIALIZER(false);
+
+    /// An optional thread pool to process the texture rows in parallel.
+    IThreadPool* pThreadPool        DEFAULT_INITIALIZER(nullptr);
+};
+typedef struct ComputeMipChainAttribs ComputeMipChainAttribs;
+// clang-format on
+
+/// Computes the mip chain for the texture.
+
+/// \remarks   The result is identical to calling ComputeMipLevel for every level in turn, but
+///            the levels are processed in horizontal bands so that the rows of the finer level are
+///            still in the cache when the coarser level is computed. When a thread pool is provided,
+///            the bands are processed in parallel by the calling thread and the pool threads.
+///            Polyphase filters and alpha coverage preservation require the entire fine level,
+///            so in this case the levels are processed one by one.
+void DILIGENT_GLOBAL_FUNCTION(ComputeMipChain)(const ComputeMipChainAttribs REF Attribs);
+
 
 /// Creates a sparse texture in Metal backend.
 
@@ -29,6 +29,7 @@
 
 #include "../../GraphicsEngine/interface/RenderDevice.h"
 #include "../../GraphicsEngine/interface/DeviceContext.h"
+#include "../../GraphicsAccessories/interface/GraphicsAccessories.hpp"
 
 namespace Diligent
 {
@@ -146,4 +147,30 @@ public:
 
 void CreateTextureUploader(IRenderDevice* pDevice, const TextureUploaderDesc& Desc, ITextureUploader** ppUploader);
 
+
+/// Compresses uncompressed texture data directly into the mapped memory of an upload buffer.
+
+/// \param [in] pUploadBuffer - Upload buffer to write the compressed data to. The buffer format
+///                             must be one of the formats supported by Diligent::CompressTextureSubresource
+///                             (BC1, BC3, BC4, BC5 or BC7).
+/// \param [in] Mip           - Upload buffer mip level.
+/// \param [in] Slice         - Upload buffer array slice.
+/// \param [in] SrcFormat     - Source data format, see Diligent::CompressTextureSubresourceAttribs::SrcFormat.
+/// \param [in] SrcData       - Source data of the mip level.
+/// \param [in] Quality       - Compression quality, see Diligent::TEXTURE_COMPRESSION_QUALITY.
+/// \param [in] pThreadPool   - An optional thread pool to compress the data in parallel.
+///
+/// \return    true if the data was successfully compressed and false otherwise.
+///
+/// \remarks   The upload buffer subresource must be mapped, which is always the case for the buffers
+///            returned by ITextureUploader::AllocateUploadBuffer.
+///            The function can be called from any thread.
+bool CompressToUploadBuffer(IUploadBuffer*              pUploadBuffer,
+                            Uint32                      Mip,
+                            Uint32                      Slice,
+                            TEXTURE_FORMAT              SrcFormat,
+                            const TextureSubResData&    SrcData,
+                            TEXTURE_COMPRESSION_QUALITY Quality     = TEXTURE_COMPRESSION_QUALITY_FAST,
+                            IThreadPool*                pThreadPool = nullptr);
+
 } // namespace Diligent
@@ -28,12 +28,16 @@
 #include <algorithm>
 #include <cmath>
 #include <limits>
+#include <vector>
+#include <array>
 
 #include "GraphicsUtilities.h"
 #include "DebugUtilities.hpp"
 #include "GraphicsAccessories.hpp"
 #include "ColorConversion.h"
 #include "RefCntAutoPtr.hpp"
+#include "ThreadPool.hpp"
+#include "Intrinsics.hpp"
 
 #define PI_F 3.1415926f
 
@@ -160,6 +164,27 @@ ChannelType SRGBAverage(ChannelType c0, ChannelType c1, ChannelType c2, ChannelT
     return static_cast<ChannelType>(fSRGBAverage);
 }
 
+template <>
+Uint8 SRGBAverage<Uint8>(Uint8 c0, Uint8 c1, Uint8 c2, Uint8 c3, Uint32 /*col*/, Uint32 /*row*/)
+{
+    // Use the lookup table to convert gamma to linear. The values are exactly the same as in the generic version.
+    static const std::array<float, 256> ToLinear = []() {
+        std::array<float, 256> Table;
+        for (Uint32 i = 0; i < Table.size(); ++i)
+            Table[i] = FastGammaToLinear(static_cast<float>(i) * (1.f / 255.f));
+        return Table;
+    }();
+
+    float fLinearAverage = (ToLinear[c0] + ToLinear[c1] + ToLinear[c2] + ToLinear[c3]) * 0.25f;
+    float fSRGBAverage   = FastLinearToGamma(fLinearAverage) * 255.f;
+
+    // Clamping on both ends is essential because fast SRGB math is imprecise
+    fSRGBAverage = std::max(fSRGBAverage, 0.f);
+    fSRGBAverage = std::min(fSRGBAverage, 255.f);
+
+    return static_cast<Uint8>(fSRGBAverage);
+}
+
 template <typename ChannelType>
 ChannelType LinearAverage(ChannelType c0, ChannelType c1, ChannelType c2, ChannelType c3, Uint32 /*col*/, Uint32 /*row*/);
 
@@ -286,11 +311,365 @@ ChannelType MostFrequentSelector(ChannelType c0, ChannelType c1, ChannelType c2,
     }
 }
 
+// Box filter kernels process the rows of the fine level that have even width (i.e. no clamping is required).
+// Every kernel returns the number of coarse level texels it has processed.
+template <typename ChannelType>
+Uint32 BoxFilterRowSIMD(const ChannelType* /*pSrcRow0*/,
+                        const ChannelType* /*pSrcRow1*/,
+                        ChannelType* /*pDstRow*/,
+                        Uint32 /*CoarseWidth*/,
+                        Uint32 /*NumChannels*/)
+{
+    return 0;
+}
+
+#if DILIGENT_SSE2_ENABLED || DILIGENT_NEON_ENABLED
+template <>
+Uint32 BoxFilterRowSIMD<Uint8>(const Uint8* pSrcRow0,
+                               const Uint8* pSrcRow1,
+                               Uint8*       pDstRow,
+                               Uint32       CoarseWidth,
+                               Uint32       NumChannels)
+{
+    if (NumChannels != 1 && NumChannels != 2 && NumChannels != 4)
+        return 0;
+
+    const size_t NumDstBytes = size_t{CoarseWidth} * NumChannels;
+
+    size_t DstByte = 0;
+#    if DILIGENT_AVX2_ENABLED
+    if (NumChannels == 4)
+    {
+        // 32 fine bytes (8 texels) -> 16 coarse bytes (4 texels)
+        const __m256i Zero = _mm256_setzero_si256();
+        for (; DstByte + 16 <= NumDstBytes; DstByte += 16)
+        {
+            const __m256i Row0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pSrcRow0 + DstByte * 2));
+            const __m256i Row1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pSrcRow1 + DstByte * 2));
+
+            // Texels in 16-bit lanes:
+            //  Lo: | t0 t1 | t4 t5 |
+            //  Hi: | t2 t3 | t6 t7 |
+            const __m256i Lo = _mm256_add_epi16(_mm256_unpacklo_epi8(Row0, Zero), _mm256_unpacklo_epi8(Row1, Zero));
+            const __m256i Hi = _mm256_add_epi16(_mm256_unpackhi_epi8(Row0, Zero), _mm256_unpackhi_epi8(Row1, Zero));
+
+            // | t0+t1 t2+t3 | t4+t5 t6+t7 |
+            const __m256i Sum = _mm256_add_epi16(_mm256_unpacklo_epi64(Lo, Hi), _mm256_unpackhi_epi64(Lo, Hi));
+            const __m256i Res = _mm256_packus_epi16(_mm256_srli_epi16(Sum, 2), Zero);
+            // Gather the lower 64 bits of both 128-bit lanes
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(pDstRow + DstByte), _mm256_castsi256_si128(_mm256_permute4x64_epi64(Res, 0x08)));
+        }
+    }
+#    endif
+
+#    if DILIGENT_SSE2_ENABLED
+    // 16 fine bytes -> 8 coarse bytes
+    const __m128i Zero = _mm_setzero_si128();
+    const __m128i Ones = _mm_set1_epi16(1);
+    for (; DstByte + 8 <= NumDstBytes; DstByte += 8)
+    {
+        const __m128i Row0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSrcRow0 + DstByte * 2));
+        const __m128i Row1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSrcRow1 + DstByte * 2));
+
+        // Vertical sums of bytes 0-7 and 8-15 in 16-bit lanes
+        const __m128i Lo = _mm_add_epi16(_mm_unpacklo_epi8(Row0, Zero), _mm_unpacklo_epi8(Row1, Zero));
+        const __m128i Hi = _mm_add_epi16(_mm_unpackhi_epi8(Row0, Zero), _mm_unpackhi_epi8(Row1, Zero));
+
+        __m128i Sum;
+        switch (NumChannels)
+        {
+            case 1:
+                // Add adjacent 16-bit lanes
+                Sum = _mm_packs_epi32(_mm_madd_epi16(Lo, Ones), _mm_madd_epi16(Hi, Ones));
+                break;
+
+            case 2:
+            {
+                // Texels occupy 32-bit lanes: | t0 t2 t1 t3 |
+                const __m128i Lo0213 = _mm_shuffle_epi32(Lo, _MM_SHUFFLE(3, 1, 2, 0));
+                const __m128i Hi4657 = _mm_shuffle_epi32(Hi, _MM_SHUFFLE(3, 1, 2, 0));
+                Sum                  = _mm_add_epi16(_mm_unpacklo_epi64(Lo0213, Hi4657), _mm_unpackhi_epi64(Lo0213, Hi4657));
+                break;
+            }
+
+            default:
+                // Texels occupy 64-bit lanes
+                Sum = _mm_add_epi16(_mm_unpacklo_epi64(Lo, Hi), _mm_unpackhi_epi64(Lo, Hi));
+                break;
+        }
+
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(pDstRow + DstByte), _mm_packus_epi16(_mm_srli_epi16(Sum, 2), Zero));
+    }
+#    elif DILIGENT_NEON_ENABLED
+    // 32 fine bytes -> 16 coarse bytes
+    for (; DstByte + 16 <= NumDstBytes; DstByte += 16)
+    {
+        const Uint8* pSrc0 = pSrcRow0 + DstByte * 2;
+        const Uint8* pSrc1 = pSrcRow1 + DstByte * 2;
+
+        // De-interleave even and odd texels
+        uint8x16_t Even0, Odd0, Even1, Odd1;
+        switch (NumChannels)
+        {
+            case 1:
+            {
+                const uint8x16x2_t Row0 = vld2q_u8(pSrc0);
+                const uint8x16x2_t Row1 = vld2q_u8(pSrc1);
+                Even0 = Row0.val[0], Odd0 = Row0.val[1];
+                Even1 = Row1.val[0], Odd1 = Row1.val[1];
+                break;
+            }
+
+            case 2:
+            {
+                const uint16x8x2_t Row0 = vld2q_u16(reinterpret_cast<const uint16_t*>(pSrc0));
+                const uint16x8x2_t Row1 = vld2q_u16(reinterpret_cast<const uint16_t*>(pSrc1));
+                Even0 = vreinterpretq_u8_u16(Row0.val[0]), Odd0 = vreinterpretq_u8_u16(Row0.val[1]);
+                Even1 = vreinterpretq_u8_u16(Row1.val[0]), Odd1 = vreinterpretq_u8_u16(Row1.val[1]);
+                break;
+            }
+
+            default:
+            {
+                const uint32x4x2_t Row0 = vld2q_u32(reinterpret_cast<const uint32_t*>(pSrc0));
+                const uint32x4x2_t Row1 = vld2q_u32(reinterpret_cast<const uint32_t*>(pSrc1));
+                Even0 = vreinterpretq_u8_u32(Row0.val[0]), Odd0 = vreinterpretq_u8_u32(Row0.val[1]);
+                Even1 = vreinterpretq_u8_u32(Row1.val[0]), Odd1 = vreinterpretq_u8_u32(Row1.val[1]);
+                break;
+            }
+        }
+
+        const uint16x8_t SumLo = vaddq_u16(vaddl_u8(vget_low_u8(Even0), vget_low_u8(Odd0)), vaddl_u8(vget_low_u8(Even1), vget_low_u8(Odd1)));
+        const uint16x8_t SumHi = vaddq_u16(vaddl_u8(vget_high_u8(Even0), vget_high_u8(Odd0)), vaddl_u8(vget_high_u8(Even1), vget_high_u8(Odd1)));
+        vst1q_u8(pDstRow + DstByte, vcombine_u8(vshrn_n_u16(SumLo, 2), vshrn_n_u16(SumHi, 2)));
+    }
+#    endif
+
+    return static_cast<Uint32>(DstByte / NumChannels);
+}
+
+template <>
+Uint32 BoxFilterRowSIMD<Uint16>(const Uint16* pSrcRow0,
+                                const Uint16* pSrcRow1,
+                                Uint16*       pDstRow,
+                                Uint32        CoarseWidth,
+                                Uint32        NumChannels)
+{
+    if (NumChannels != 1 && NumChannels != 2 && NumChannels != 4)
+        return 0;
+
+    const size_t NumDstElements = size_t{CoarseWidth} * NumChannels;
+
+    size_t DstElem = 0;
+#    if DILIGENT_SSE2_ENABLED
+    // 8 fine elements -> 4 coarse elements
+    const __m128i Zero = _mm_setzero_si128();
+    const __m128i Bias = _mm_set1_epi32(0x8000);
+    for (; DstElem + 4 <= NumDstElements; DstElem += 4)
+    {
+        const __m128i Row0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSrcRow0 + DstElem * 2));
+        const __m128i Row1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSrcRow1 + DstElem * 2));
+
+        // Vertical sums of elements 0-3 and 4-7 in 32-bit lanes
+        const __m128i Lo = _mm_add_epi32(_mm_unpacklo_epi16(Row0, Zero), _mm_unpacklo_epi16(Row1, Zero));
+        const __m128i Hi = _mm_add_epi32(_mm_unpackhi_epi16(Row0, Zero), _mm_unpackhi_epi16(Row1, Zero));
+
+        __m128i Sum;
+        switch (NumChannels)
+        {
+            case 1:
+            {
+                const __m128i Lo0213 = _mm_shuffle_epi32(Lo, _MM_SHUFFLE(3, 1, 2, 0));
+                const __m128i Hi4657 = _mm_shuffle_epi32(Hi, _MM_SHUFFLE(3, 1, 2, 0));
+                Sum                  = _mm_add_epi32(_mm_unpacklo_epi64(Lo0213, Hi4657), _mm_unpackhi_epi64(Lo0213, Hi4657));
+                break;
+            }
+
+            case 2:
+                Sum = _mm_add_epi32(_mm_unpacklo_epi64(Lo, Hi), _mm_unpackhi_epi64(Lo, Hi));
+                break;
+
+            default:
+                Sum = _mm_add_epi32(Lo, Hi);
+                break;
+        }
+
+        // SSE2 has no unsigned 32->16 pack, so bias the values into the signed range
+        __m128i Res = _mm_sub_epi32(_mm_srli_epi32(Sum, 2), Bias);
+        Res         = _mm_add_epi16(_mm_packs_epi32(Res, Res), _mm_set1_epi16(-0x8000));
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(pDstRow + DstElem), Res);
+    }
+#    elif DILIGENT_NEON_ENABLED
+    // 16 fine elements -> 8 coarse elements
+    for (; DstElem + 8 <= NumDstElements; DstElem += 8)
+    {
+        const Uint16* pSrc0 = pSrcRow0 + DstElem * 2;
+        const Uint16* pSrc1 = pSrcRow1 + DstElem * 2;
+
+        uint16x8_t Even0, Odd0, Even1, Odd1;
+        switch (NumChannels)
+        {
+            case 1:
+            {
+                const uint16x8x2_t Row0 = vld2q_u16(pSrc0);
+                const uint16x8x2_t Row1 = vld2q_u16(pSrc1);
+                Even0 = Row0.val[0], Odd0 = Row0.val[1];
+                Even1 = Row1.val[0], Odd1 = Row1.val[1];
+                break;
+            }
+
+            case 2:
+            {
+                const uint32x4x2_t Row0 = vld2q_u32(reinterpret_cast<const uint32_t*>(pSrc0));
+                const uint32x4x2_t Row1 = vld2q_u32(reinterpret_cast<const uint32_t*>(pSrc1));
+                Even0 = vreinterpretq_u16_u32(Row0.val[0]), Odd0 = vreinterpretq_u16_u32(Row0.val[1]);
+                Even1 = vreinterpretq_u16_u32(Row1.val[0]), Odd1 = vreinterpretq_u16_u32(Row1.val[1]);
+                break;
+            }
+
+            default:
+            {
+                const uint64x2x2_t Row0 = vld2q_u64(reinterpret_cast<const uint64_t*>(pSrc0));
+                const uint64x2x2_t Row1 = vld2q_u64(reinterpret_cast<const uint64_t*>(pSrc1));
+                Even0 = vreinterpretq_u16_u64(Row0.val[0]), Odd0 = vreinterpretq_u16_u64(Row0.val[1]);
+                Even1 = vreinterpretq_u16_u64(Row1.val[0]), Odd1 = vreinterpretq_u16_u64(Row1.val[1]);
+                break;
+            }
+        }
+
+        const uint32x4_t SumLo = vaddq_u32(vaddl_u16(vget_low_u16(Even0), vget_low_u16(Odd0)), vaddl_u16(vget_low_u16(Even1), vget_low_u16(Odd1)));
+        const uint32x4_t SumHi = vaddq_u32(vaddl_u16(vget_high_u16(Even0), vget_high_u16(Odd0)), vaddl_u16(vget_high_u16(Even1), vget_high_u16(Odd1)));
+        vst1q_u16(pDstRow + DstElem, vcombine_u16(vshrn_n_u32(SumLo, 2), vshrn_n_u32(SumHi, 2)));
+    }
+#    endif
+
+    return static_cast<Uint32>(DstElem / NumChannels);
+}
+
+template <>
+Uint32 BoxFilterRowSIMD<float>(const float* pSrcRow0,
+                               const float* pSrcRow1,
+                               float*       pDstRow,
+                               Uint32       CoarseWidth,
+                               Uint32       NumChannels)
+{
+    if (NumChannels != 1 && NumChannels != 2 && NumChannels != 4)
+        return 0;
+
+    const size_t NumDstElements = size_t{CoarseWidth} * NumChannels;
+
+    // Note that the operations are performed in the same order as in LinearAverage<float>
+    // so that the results are bit-exact:
+    //      ((Row0[Even] + Row0[Odd]) + Row1[Even]) + Row1[Odd]
+
+    size_t DstElem = 0;
+#    if DILIGENT_AVX2_ENABLED
+    if (NumChannels == 4)
+    {
+        // 16 fine elements -> 8 coarse elements
+        const __m256 Quarter = _mm256_set1_ps(0.25f);
+        for (; DstElem + 8 <= NumDstElements; DstElem += 8)
+        {
+            const __m256 Row0A = _mm256_loadu_ps(pSrcRow0 + DstElem * 2);
+            const __m256 Row0B = _mm256_loadu_ps(pSrcRow0 + DstElem * 2 + 8);
+            const __m256 Row1A = _mm256_loadu_ps(pSrcRow1 + DstElem * 2);
+            const __m256 Row1B = _mm256_loadu_ps(pSrcRow1 + DstElem * 2 + 8);
+
+            __m256 Sum = _mm256_add_ps(_mm256_permute2f128_ps(Row0A, Row0B, 0x20), _mm256_permute2f128_ps(Row0A, Row0B, 0x31));
+            Sum        = _mm256_add_ps(Sum, _mm256_permute2f128_ps(Row1A, Row1B, 0x20));
+            Sum        = _mm256_add_ps(Sum, _mm256_permute2f128_ps(Row1A, Row1B, 0x31));
+            _mm256_storeu_ps(pDstRow + DstElem, _mm256_mul_ps(Sum, Quarter));
+        }
+    }
+#    endif
+
+#    if DILIGENT_SSE2_ENABLED
+    // 8 fine elements -> 4 coarse elements
+    const __m128 Quarter = _mm_set1_ps(0.25f);
+    for (; DstElem + 4 <= NumDstElements; DstElem += 4)
+    {
+        const __m128 Row0A = _mm_loadu_ps(pSrcRow0 + DstElem * 2);
+        const __m128 Row0B = _mm_loadu_ps(pSrcRow0 + DstElem * 2 + 4);
+        const __m128 Row1A = _mm_loadu_ps(pSrcRow1 + DstElem * 2);
+        const __m128 Row1B = _mm_loadu_ps(pSrcRow1 + DstElem * 2 + 4);
+
+        __m128 Even0, Odd0, Even1, Odd1;
+        switch (NumChannels)
+        {
+            case 1:
+                Even0 = _mm_shuffle_ps(Row0A, Row0B, _MM_SHUFFLE(2, 0, 2, 0));
+                Odd0  = _mm_shuffle_ps(Row0A, Row0B, _MM_SHUFFLE(3, 1, 3, 1));
+                Even1 = _mm_shuffle_ps(Row1A, Row1B, _MM_SHUFFLE(2, 0, 2, 0));
+                Odd1  = _mm_shuffle_ps(Row1A, Row1B, _MM_SHUFFLE(3, 1, 3, 1));
+                break;
+
+            case 2:
+                Even0 = _mm_movelh_ps(Row0A, Row0B);
+                Odd0  = _mm_movehl_ps(Row0B, Row0A);
+                Even1 = _mm_movelh_ps(Row1A, Row1B);
+                Odd1  = _mm_movehl_ps(Row1B, Row1A);
+                break;
+
+            default:
+                Even0 = Row0A, Odd0 = Row0B;
+                Even1 = Row1A, Odd1 = Row1B;
+                break;
+        }
+
+        const __m128 Sum = _mm_add_ps(_mm_add_ps(_mm_add_ps(Even0, Odd0), Even1), Odd1);
+        _mm_storeu_ps(pDstRow + DstElem, _mm_mul_ps(Sum, Quarter));
+    }
+#    elif DILIGENT_NEON_ENABLED
+    // 8 fine elements -> 4 coarse elements
+    for (; DstElem + 4 <= NumDstElements; DstElem += 4)
+    {
+        const float* pSrc0 = pSrcRow0 + DstElem * 2;
+        const float* pSrc1 = pSrcRow1 + DstElem * 2;
+
+        float32x4_t Even0, Odd0, Even1, Odd1;
+        switch (NumChannels)
+        {
+            case 1:
+            {
+                const float32x4x2_t Row0 = vld2q_f32(pSrc0);
+                const float32x4x2_t Row1 = vld2q_f32(pSrc1);
+                Even0 = Row0.val[0], Odd0 = Row0.val[1];
+                Even1 = Row1.val[0], Odd1 = Row1.val[1];
+                break;
+            }
+
+            case 2:
+            {
+                const uint64x2x2_t Row0 = vld2q_u64(reinterpret_cast<const uint64_t*>(pSrc0));
+                const uint64x2x2_t Row1 = vld2q_u64(reinterpret_cast<const uint64_t*>(pSrc1));
+                Even0 = vreinterpretq_f32_u64(Row0.val[0]), Odd0 = vreinterpretq_f32_u64(Row0.val[1]);
+                Even1 = vreinterpretq_f32_u64(Row1.val[0]), Odd1 = vreinterpretq_f32_u64(Row1.val[1]);
+                break;
+            }
+
+            default:
+                Even0 = vld1q_f32(pSrc0), Odd0 = vld1q_f32(pSrc0 + 4);
+                Even1 = vld1q_f32(pSrc1), Odd1 = vld1q_f32(pSrc1 + 4);
+                break;
+        }
+
+        const float32x4_t Sum = vaddq_f32(vaddq_f32(vaddq_f32(Even0, Odd0), Even1), Odd1);
+        vst1q_f32(pDstRow + DstElem, vmulq_n_f32(Sum, 0.25f));
+    }
+#    endif
+
+    return static_cast<Uint32>(DstElem / NumChannels);
+}
+#endif
+
 template <typename ChannelType,
           typename FilterType>
 void FilterMipLevel(const ComputeMipLevelAttribs& Attribs,
                     Uint32                        NumChannels,
-                    FilterType                    Filter)
+                    FilterType                    Filter,
+                    bool                          IsBoxAverage,
+                    Uint32                        StartRow,
+                    Uint32                        EndRow)
 {
     VERIFY_EXPR(Attribs.FineMipWidth > 0 && Attribs.FineMipHeight > 0);
     DEV_CHECK_ERR(Attribs.FineMipHeight == 1 || Attribs.FineMipStride >= Attribs.FineMipWidth * sizeof(ChannelType) * NumChannels, "Fine mip level stride is too small");
@@ -299,16 +678,24 @@ void FilterMipLevel(const ComputeMipLevelAttribs& Attribs,
     const auto CoarseMipHeight = std::max(Attribs.FineMipHeight / Uint32{2}, Uint32{1});
 
     VERIFY(CoarseMipHeight == 1 || Attribs.CoarseMipStride >= CoarseMipWidth * sizeof(ChannelType) * NumChannels, "Coarse mip level stride is too small");
+    VERIFY_EXPR(StartRow <= EndRow && EndRow <= CoarseMipHeight);
 
-    for (Uint32 row = 0; row < CoarseMipHeight; ++row)
+    for (Uint32 row = StartRow; row < EndRow; ++row)
     {
         auto src_row0 = row * 2;
         auto src_row1 = std::min(row * 2 + 1, Attribs.FineMipHeight - 1);
 
         auto pSrcRow0 = reinterpret_cast<const ChannelType*>(reinterpret_cast<const Uint8*>(Attribs.pFineMipData) + src_row0 * Attribs.FineMipStride);
         auto pSrcRow1 = reinterpret_cast<const ChannelType*>(reinterpret_cast<const Uint8*>(Attribs.pFineMipData) + src_row1 * Attribs.FineMipStride);
+        auto pDstRow  = reinterpret_cast<ChannelType*>(reinterpret_cast<Uint8*>(Attribs.pCoarseMipData) + row * Attribs.CoarseMipStride);
 
-        for (Uint32 col = 0; col < CoarseMipWidth; ++col)
+        Uint32 col = 0;
+        if (IsBoxAverage && Attribs.FineMipWidth > 1)
+        {
+            col = BoxFilterRowSIMD<ChannelType>(pSrcRow0, pSrcRow1, pDstRow, CoarseMipWidth, NumChannels);
+        }
+
+        for (; col < CoarseMipWidth; ++col)
         {
             auto src_col0 = col * 2;
             auto src_col1 = std::min(col * 2 + 1, Attribs.FineMipWidth - 1);
@@ -320,9 +707,7 @@ void FilterMipLevel(const ComputeMipLevelAttribs& Attribs,
                 const auto Chnl01 = pSrcRow1[src_col0 * NumChannels + c];
                 const auto Chnl11 = pSrcRow1[src_col1 * NumChannels + c];
 
-                auto& DstCol = reinterpret_cast<ChannelType*>(reinterpret_cast<Uint8*>(Attribs.pCoarseMipData) + row * Attribs.CoarseMipStride)[col * NumChannels + c];
-
-                DstCol = Filter(Chnl00, Chnl10, Chnl01, Chnl11, col, row);
+                pDstRow[col * NumChannels + c] = Filter(Chnl00, Chnl10, Chnl01, Chnl11, col, row);
             }
         }
     }
@@ -330,11 +715,12 @@ void FilterMipLevel(const ComputeMipLevelAttribs& Attribs,
 
 void RemapAlpha(const ComputeMipLevelAttribs& Attribs,
                 Uint32                        NumChannels,
-                Uint32                        AlphaChannelInd)
+                Uint32                        AlphaChannelInd,
+                Uint32                        StartRow,
+                Uint32                        EndRow)
 {
-    const auto CoarseMipWidth  = std::max(Attribs.FineMipWidth / Uint32{2}, Uint32{1});
-    const auto CoarseMipHeight = std::max(Attribs.FineMipHeight / Uint32{2}, Uint32{1});
-    for (Uint32 row = 0; row < CoarseMipHeight; ++row)
+    const auto CoarseMipWidth = std::max(Attribs.FineMipWidth / Uint32{2}, Uint32{1});
+    for (Uint32 row = StartRow; row < EndRow; ++row)
     {
         for (Uint32 col = 0; col < CoarseMipWidth; ++col)
         {
@@ -353,49 +739,524 @@ void RemapAlpha(const ComputeMipLevelAttribs& Attribs,
     }
 }
 
+bool IsPolyphaseFilter(MIP_FILTER_TYPE FilterType)
+{
+    return FilterType == MIP_FILTER_TYPE_KAISER ||
+        FilterType == MIP_FILTER_TYPE_LANCZOS ||
+        FilterType == MIP_FILTER_TYPE_MITCHELL;
+}
+
+float Sinc(float x)
+{
+    if (std::abs(x) < 1e-6f)
+        return 1.f;
+    x *= PI_F;
+    return std::sin(x) / x;
+}
+
+// Zeroth-order modified Bessel function of the first kind
+float BesselI0(float x)
+{
+    float Sum  = 1.f;
+    float Term = 1.f;
+    for (int k = 1; k < 32 && Term > Sum * 1e-8f; ++k)
+    {
+        const float HalfXOverK = x * 0.5f / static_cast<float>(k);
+        Term *= HalfXOverK * HalfXOverK;
+        Sum += Term;
+    }
+    return Sum;
+}
+
+// Polyphase filter kernel that downsamples the image by a factor of 2.
+// Since the scale is exactly 2, all coarse texels use the same weights:
+// coarse texel x is computed from fine texels [2x + FirstTap, 2x + FirstTap + NumTaps).
+struct MipFilterKernel
+{
+    static constexpr Uint32 MaxTaps = 12;
+
+    std::array<float, MaxTaps> Weights = {};
+
+    Uint32 NumTaps  = 0;
+    int    FirstTap = 0;
+
+    explicit MipFilterKernel(MIP_FILTER_TYPE FilterType)
+    {
+        // Filter radius, in coarse texels
+        int Radius = 0;
+        switch (FilterType)
+        {
+            case MIP_FILTER_TYPE_KAISER: Radius = 3; break;
+            case MIP_FILTER_TYPE_LANCZOS: Radius = 3; break;
+            case MIP_FILTER_TYPE_MITCHELL: Radius = 2; break;
+            default:
+                UNEXPECTED("Unexpected filter type");
+        }
+
+        NumTaps  = static_cast<Uint32>(Radius * 4);
+        FirstTap = 1 - Radius * 2;
+        VERIFY_EXPR(NumTaps <= MaxTaps);
+
+        float WeightSum = 0;
+        for (Uint32 t = 0; t < NumTaps; ++t)
+        {
+            // Distance between the fine texel center and the coarse texel center, in coarse texels
+            const float x = (static_cast<float>(FirstTap + static_cast<int>(t)) - 0.5f) * 0.5f;
+
+            float w = 0;
+            switch (FilterType)
+            {
+                case MIP_FILTER_TYPE_KAISER:
+                {
+                    // Kaiser-windowed sinc, alpha = 4
+                    constexpr float Alpha = 4;
+
+                    const float r = x / static_cast<float>(Radius);
+                    w             = Sinc(x) * BesselI0(Alpha * std::sqrt(std::max(1.f - r * r, 0.f))) / BesselI0(Alpha);
+                    break;
+                }
+
+                case MIP_FILTER_TYPE_LANCZOS:
+                    w = Sinc(x) * Sinc(x / static_cast<float>(Radius));
+                    break;
+
+                case MIP_FILTER_TYPE_MITCHELL:
+                {
+                    // Mitchell-Netravali filter, B = C = 1/3
+                    constexpr float B = 1.f / 3.f;
+                    constexpr float C = 1.f / 3.f;
+
+                    const float ax = std::abs(x);
+                    if (ax < 1)
+                        w = ((12 - 9 * B - 6 * C) * ax * ax * ax + (-18 + 12 * B + 6 * C) * ax * ax + (6 - 2 * B)) / 6.f;
+                    else if (ax < 2)
+                        w = ((-B - 6 * C) * ax * ax * ax + (6 * B + 30 * C) * ax * ax + (-12 * B - 48 * C) * ax + (8 * B + 24 * C)) / 6.f;
+                    break;
+                }
+
+                default:
+                    break;
+            }
+
+            Weights[t] = w;
+            WeightSum += w;
+        }
+
+        for (Uint32 t = 0; t < NumTaps; ++t)
+            Weights[t] /= WeightSum;
+    }
+};
+
+// Converts the 8-bit sRGB value to linear space using exact conversion
+float SRGB8ToLinear(Uint8 Val)
+{
+    return GammaToLinear(Val);
+}
+
+// Converts the linear value to the 8-bit sRGB value, rounding to nearest
+Uint8 LinearToSRGB8(float Val)
+{
+    // Linear values at the midpoints between adjacent sRGB values
+    static const std::array<float, 255> Thresholds = []() {
+        std::array<float, 255> Table;
+        for (Uint32 i = 0; i < Table.size(); ++i)
+            Table[i] = GammaToLinear((static_cast<float>(i) + 0.5f) / 255.f);
+        return Table;
+    }();
+
+    return static_cast<Uint8>(std::upper_bound(Thresholds.begin(), Thresholds.end(), Val) - Thresholds.begin());
+}
+
+template <typename ChannelType>
+void LoadRowAsFloat(const ChannelType*          pSrc,
+                    float*                      pDst,
+                    Uint32                      Width,
+                    const TextureFormatAttribs& FmtAttribs)
+{
+    const Uint32 NumChannels = FmtAttribs.NumComponents;
+    const size_t NumElements = size_t{Width} * NumChannels;
+    switch (FmtAttribs.ComponentType)
+    {
+        case COMPONENT_TYPE_UNORM_SRGB:
+            for (size_t i = 0; i < NumElements; ++i)
+            {
+                // Alpha channel is always linear
+                const bool IsAlpha = NumChannels == 4 && (i % 4) == 3;
+                pDst[i]            = IsAlpha ?
+                    static_cast<float>(pSrc[i]) * (1.f / 255.f) :
+                    SRGB8ToLinear(static_cast<Uint8>(pSrc[i]));
+            }
+            break;
+
+        case COMPONENT_TYPE_UNORM:
+        case COMPONENT_TYPE_SNORM:
+        {
+            constexpr float MaxValInv = 1.f / static_cast<float>(std::numeric_limits<ChannelType>::max());
+            for (size_t i = 0; i < NumElements; ++i)
+                pDst[i] = std::max(static_cast<float>(pSrc[i]) * MaxValInv, -1.f);
+            break;
+        }
+
+        default:
+            for (size_t i = 0; i < NumElements; ++i)
+                pDst[i] = static_cast<float>(pSrc[i]);
+    }
+}
+
+template <typename ChannelType>
+void StoreRowFromFloat(const float*                pSrc,
+                       ChannelType*                pDst,
+                       Uint32                      Width,
+                       const TextureFormatAttribs& FmtAttribs)
+{
+    const Uint32 NumChannels = FmtAttribs.NumComponents;
+    const size_t NumElements = size_t{Width} * NumChannels;
+    switch (FmtAttribs.ComponentType)
+    {
+        case COMPONENT_TYPE_UNORM_SRGB:
+            for (size_t i = 0; i < NumElements; ++i)
+            {
+                const bool IsAlpha = NumChannels == 4 && (i % 4) == 3;
+                pDst[i]            = IsAlpha ?
+                    static_cast<ChannelType>(clamp(pSrc[i], 0.f, 1.f) * 255.f + 0.5f) :
+                    static_cast<ChannelType>(LinearToSRGB8(pSrc[i]));
+            }
+            break;
+
+        case COMPONENT_TYPE_UNORM:
+        {
+            constexpr float MaxVal = static_cast<float>(std::numeric_limits<ChannelType>::max());
+            for (size_t i = 0; i < NumElements; ++i)
+                pDst[i] = static_cast<ChannelType>(clamp(pSrc[i], 0.f, 1.f) * MaxVal + 0.5f);
+            break;
+        }
+
+        case COMPONENT_TYPE_SNORM:
+        {
+            constexpr float MaxVal = static_cast<float>(std::numeric_limits<ChannelType>::max());
+            for (size_t i = 0; i < NumElements; ++i)
+                pDst[i] = static_cast<ChannelType>(std::floor(clamp(pSrc[i], -1.f, 1.f) * MaxVal + 0.5f));
+            break;
+        }
+
+        default:
+            for (size_t i = 0; i < NumElements; ++i)
+                pDst[i] = static_cast<ChannelType>(pSrc[i]);
+    }
+}
+
+// Filters the fine row horizontally: pDst[x] = sum_t(Weights[t] * pSrc[clamp(2x + FirstTap + t)])
+void FilterRowHorizontal(const float*           pSrc,
+                         float*                 pDst,
+                         Uint32                 FineWidth,
+                         Uint32                 CoarseWidth,
+                         Uint32                 NumChannels,
+                         const MipFilterKernel& Kernel)
+{
+    // Coarse texels in the range [InteriorStart, InteriorEnd) do not need clamping
+    const Uint32 InteriorStart = std::min(static_cast<Uint32>((-Kernel.FirstTap + 1) / 2), CoarseWidth);
+    const int    LastTapOffset = Kernel.FirstTap + static_cast<int>(Kernel.NumTaps) - 1;
+    const int    InteriorLimit = static_cast<int>(FineWidth) - 1 - LastTapOffset;
+    const Uint32 InteriorEnd   = std::max(std::min(InteriorLimit >= 0 ? static_cast<Uint32>(InteriorLimit / 2 + 1) : 0u, CoarseWidth), InteriorStart);
+
+    auto FilterClamped = [&](Uint32 x) {
+        for (Uint32 c = 0; c < NumChannels; ++c)
+        {
+            float Sum = 0;
+            for (Uint32 t = 0; t < Kernel.NumTaps; ++t)
+            {
+                const int SrcX = clamp(static_cast<int>(x * 2) + Kernel.FirstTap + static_cast<int>(t), 0, static_cast<int>(FineWidth) - 1);
+                Sum += Kernel.Weights[t] * pSrc[SrcX * NumChannels + c];
+            }
+            pDst[x * NumChannels + c] = Sum;
+        }
+    };
+
+    for (Uint32 x = 0; x < InteriorStart; ++x)
+        FilterClamped(x);
+
+    Uint32 x = InteriorStart;
+#if DILIGENT_SSE2_ENABLED || DILIGENT_NEON_ENABLED
+    if (NumChannels == 4)
+    {
+        // Every texel is processed as one 4-component vector
+        for (; x < InteriorEnd; ++x)
+        {
+            const float* pTaps = pSrc + (static_cast<int>(x * 2) + Kernel.FirstTap) * 4;
+#    if DILIGENT_SSE2_ENABLED
+            __m128 Sum = _mm_setzero_ps();
+            for (Uint32 t = 0; t < Kernel.NumTaps; ++t)
+                Sum = _mm_add_ps(Sum, _mm_mul_ps(_mm_set1_ps(Kernel.Weights[t]), _mm_loadu_ps(pTaps + t * 4)));
+            _mm_storeu_ps(pDst + x * 4, Sum);
+#    else
+            float32x4_t Sum = vdupq_n_f32(0);
+            for (Uint32 t = 0; t < Kernel.NumTaps; ++t)
+                Sum = vmlaq_n_f32(Sum, vld1q_f32(pTaps + t * 4), Kernel.Weights[t]);
+            vst1q_f32(pDst + x * 4, Sum);
+#    endif
+        }
+    }
+#endif
+    for (; x < InteriorEnd; ++x)
+    {
+        const float* pTaps = pSrc + (static_cast<int>(x * 2) + Kernel.FirstTap) * static_cast<int>(NumChannels);
+        for (Uint32 c = 0; c < NumChannels; ++c)
+        {
+            float Sum = 0;
+            for (Uint32 t = 0; t < Kernel.NumTaps; ++t)
+                Sum += Kernel.Weights[t] * pTaps[t * NumChannels + c];
+            pDst[x * NumChannels + c] = Sum;
+        }
+    }
+
+    for (x = InteriorEnd; x < CoarseWidth; ++x)
+        FilterClamped(x);
+}
+
+// Accumulates the weighted row: pDst[i] += Weight * pSrc[i]
+void AccumulateRow(const float* pSrc, float* pDst, float Weight, size_t NumElements)
+{
+    size_t i = 0;
+#if DILIGENT_SSE2_ENABLED
+    const __m128 W = _mm_set1_ps(Weight);
+    for (; i + 4 <= NumElements; i += 4)
+        _mm_storeu_ps(pDst + i, _mm_add_ps(_mm_loadu_ps(pDst + i), _mm_mul_ps(W, _mm_loadu_ps(pSrc + i))));
+#elif DILIGENT_NEON_ENABLED
+    for (; i + 4 <= NumElements; i += 4)
+        vst1q_f32(pDst + i, vmlaq_n_f32(vld1q_f32(pDst + i), vld1q_f32(pSrc + i), Weight));
+#endif
+    for (; i < NumElements; ++i)
+        pDst[i] += Weight * pSrc[i];
+}
+
+// Computes rows [StartRow, EndRow) of the coarse mip level using the separable polyphase filter
+template <typename ChannelType>
+void PolyphaseFilterMipLevel(const ComputeMipLevelAttribs& Attribs,
+                             const TextureFormatAttribs&   FmtAttribs,
+                             Uint32                        StartRow,
+                             Uint32                        EndRow)
+{
+    const MipFilterKernel Kernel{Attribs.FilterType};
+
+    const Uint32 NumChannels     = FmtAttribs.NumComponents;
+    const Uint32 FineMipWidth    = Attribs.FineMipWidth;
+    const Uint32 FineMipHeight   = Attribs.FineMipHeight;
+    const Uint32 CoarseMipWidth  = std::max(FineMipWidth / 2, 1u);
+    const size_t CoarseRowSize   = size_t{CoarseMipWidth} * NumChannels;
+    const int    MaxFineRowIndex = static_cast<int>(FineMipHeight) - 1;
+
+    // Horizontally filtered fine rows are kept in a ring buffer. Every coarse row uses
+    // NumTaps consecutive (clamped) fine rows, so slot (row % NumTaps) is never shared
+    // by two rows that are used at the same time.
+    std::vector<float> FineRow(size_t{FineMipWidth} * NumChannels);
+    std::vector<float> FilteredRows(CoarseRowSize * Kernel.NumTaps);
+    std::vector<int>   SlotRows(Kernel.NumTaps, -1);
+    std::vector<float> CoarseRow(CoarseRowSize);
+
+    for (Uint32 row = StartRow; row < EndRow; ++row)
+    {
+        std::fill(CoarseRow.begin(), CoarseRow.end(), 0.f);
+        for (Uint32 t = 0; t < Kernel.NumTaps; ++t)
+        {
+            const int    SrcRow = clamp(static_cast<int>(row * 2) + Kernel.FirstTap + static_cast<int>(t), 0, MaxFineRowIndex);
+            const Uint32 Slot   = static_cast<Uint32>(SrcRow) % Kernel.NumTaps;
+            float*       pSlot  = &FilteredRows[Slot * CoarseRowSize];
+            if (SlotRows[Slot] != SrcRow)
+            {
+                const auto* pSrcRow = reinterpret_cast<const ChannelType*>(reinterpret_cast<const Uint8*>(Attribs.pFineMipData) + SrcRow * Attribs.FineMipStride);
+                LoadRowAsFloat(pSrcRow, FineRow.data(), FineMipWidth, FmtAttribs);
+                FilterRowHorizontal(FineRow.data(), pSlot, FineMipWidth, CoarseMipWidth, NumChannels, Kernel);
+                SlotRows[Slot] = SrcRow;
+            }
+            AccumulateRow(pSlot, CoarseRow.data(), Kernel.Weights[t], CoarseRowSize);
+        }
+
+        auto* pDstRow = reinterpret_cast<ChannelType*>(reinterpret_cast<Uint8*>(Attribs.pCoarseMipData) + row * Attribs.CoarseMipStride);
+        StoreRowFromFloat(CoarseRow.data(), pDstRow, CoarseMipWidth, FmtAttribs);
+    }
+}
+
+// Computes the fraction of texels whose alpha is greater than the cutoff value
+float ComputeAlphaCoverage(const void* pData,
+                           size_t      Stride,
+                           Uint32      Width,
+                           Uint32      Height,
+                           float       AlphaCutoff)
+{
+    const float Cutoff = AlphaCutoff * 255.f;
+
+    size_t NumCovered = 0;
+    for (Uint32 row = 0; row < Height; ++row)
+    {
+        const auto* pRow = reinterpret_cast<const Uint8*>(pData) + row * Stride;
+        for (Uint32 col = 0; col < Width; ++col)
+        {
+            if (static_cast<float>(pRow[col * 4 + 3]) > Cutoff)
+                ++NumCovered;
+        }
+    }
+
+    return static_cast<float>(NumCovered) / static_cast<float>(size_t{Width} * Height);
+}
+
+// Scales the alpha channel of the coarse mip level so that its alpha-test coverage
+// matches the coverage of the fine level.
+// http://the-witness.net/news/2010/09/computing-alpha-mipmaps/
+void ScaleAlphaToCoverage(const ComputeMipLevelAttribs& Attribs)
+{
+    const Uint32 CoarseMipWidth  = std::max(Attribs.FineMipWidth / 2, 1u);
+    const Uint32 CoarseMipHeight = std::max(Attribs.FineMipHeight / 2, 1u);
+
+    const float TargetCoverage = ComputeAlphaCoverage(Attribs.pFineMipData, Attribs.FineMipStride, Attribs.FineMipWidth, Attribs.FineMipHeight, Attribs.AlphaCutoff);
+
+    // Build the alpha histogram so that the coverage for any scale can be computed quickly
+    std::array<Uint32, 256> Histogram = {};
+    for (Uint32 row = 0; row < CoarseMipHeight; ++row)
+    {
+        const auto* pRow = reinterpret_cast<const Uint8*>(Attribs.pCoarseMipData) + row * Attribs.CoarseMipStride;
+        for (Uint32 col = 0; col < CoarseMipWidth; ++col)
+            ++Histogram[pRow[col * 4 + 3]];
+    }
+
+    auto ScaleAlpha = [](Uint32 Alpha, float Scale) {
+        return static_cast<Uint8>(std::min(static_cast<float>(Alpha) * Scale + 0.5f, 255.f));
+    };
+
+    const float Cutoff       = Attribs.AlphaCutoff * 255.f;
+    const float NumTexelsInv = 1.f / static_cast<float>(size_t{CoarseMipWidth} * CoarseMipHeight);
+    auto        GetCoverage  = [&](float Scale) {
+        Uint32 NumCovered = 0;
+        for (Uint32 a = 0; a < Histogram.size(); ++a)
+        {
+            if (static_cast<float>(ScaleAlpha(a, Scale)) > Cutoff)
+                NumCovered += Histogram[a];
+        }
+        return static_cast<float>(NumCovered) * NumTexelsInv;
+    };
+
+    // Coverage is a monotonic function of the scale, so use binary search
+    float MinScale = 0;
+    float MaxScale = 4;
+    float Scale    = 1;
+    for (Uint32 i = 0; i < 16; ++i)
+    {
+        const float Coverage = GetCoverage(Scale);
+        if (Coverage < TargetCoverage)
+            MinScale = Scale;
+        else if (Coverage > TargetCoverage)
+            MaxScale = Scale;
+        else
+            break;
+        Scale = (MinScale + MaxScale) * 0.5f;
+    }
+
+    if (Scale == 1)
+        return;
+
+    for (Uint32 row = 0; row < CoarseMipHeight; ++row)
+    {
+        auto* pRow = reinterpret_cast<Uint8*>(Attribs.pCoarseMipData) + row * Attribs.CoarseMipStride;
+        for (Uint32 col = 0; col < CoarseMipWidth; ++col)
+        {
+            auto& Alpha = pRow[col * 4 + 3];
+            Alpha       = ScaleAlpha(Alpha, Scale);
+        }
+    }
+}
+
 template <typename ChannelType>
 void ComputeMipLevelInternal(const ComputeMipLevelAttribs& Attribs,
-                             const TextureFormatAttribs&   FmtAttribs)
+                             const TextureFormatAttribs&   FmtAttribs,
+                             Uint32                        StartRow,
+                             Uint32                        EndRow)
 {
     auto FilterType = Attribs.FilterType;
-    if (FilterType == MIP_FILTER_TYPE_DEFAULT)
+    if (FilterType == MIP_FILTER_TYPE_DEFAULT || IsPolyphaseFilter(FilterType))
     {
         FilterType = FmtAttribs.ComponentType == COMPONENT_TYPE_UINT || FmtAttribs.ComponentType == COMPONENT_TYPE_SINT ?
             MIP_FILTER_TYPE_MOST_FREQUENT :
             MIP_FILTER_TYPE_BOX_AVERAGE;
     }
 
-    FilterMipLevel<ChannelType>(Attribs, FmtAttribs.NumComponents,
-                                FilterType == MIP_FILTER_TYPE_BOX_AVERAGE ?
-                                    LinearAverage<ChannelType> :
-                                    MostFrequentSelector<ChannelType>);
+    // Instantiate the filter loop for every filter so that the filter calls are inlined
+    if (FilterType == MIP_FILTER_TYPE_BOX_AVERAGE)
+        FilterMipLevel<ChannelType>(Attribs, FmtAttribs.NumComponents, LinearAverage<ChannelType>, true, StartRow, EndRow);
+    else
+        FilterMipLevel<ChannelType>(Attribs, FmtAttribs.NumComponents, MostFrequentSelector<ChannelType>, false, StartRow, EndRow);
 }
 
-void ComputeMipLevel(const ComputeMipLevelAttribs& Attribs)
+// Computes rows [StartRow, EndRow) of the coarse mip level using the polyphase filter
+void PolyphaseFilterMipLevelRows(const ComputeMipLevelAttribs& Attribs,
+                                 const TextureFormatAttribs&   FmtAttribs,
+                                 Uint32                        StartRow,
+                                 Uint32                        EndRow)
 {
-    DEV_CHECK_ERR(Attribs.Format != TEX_FORMAT_UNKNOWN, "Format must not be unknown");
-    DEV_CHECK_ERR(Attribs.FineMipWidth != 0, "Fine mip width must not be zero");
-    DEV_CHECK_ERR(Attribs.FineMipHeight != 0, "Fine mip height must not be zero");
-    DEV_CHECK_ERR(Attribs.pFineMipData != nullptr, "Fine level data must not be null");
-    DEV_CHECK_ERR(Attribs.pCoarseMipData != nullptr, "Coarse level data must not be null");
+    switch (FmtAttribs.ComponentType)
+    {
+        case COMPONENT_TYPE_UNORM_SRGB:
+        case COMPONENT_TYPE_UNORM:
+            switch (FmtAttribs.ComponentSize)
+            {
+                case 1: PolyphaseFilterMipLevel<Uint8>(Attribs, FmtAttribs, StartRow, EndRow); break;
+                case 2: PolyphaseFilterMipLevel<Uint16>(Attribs, FmtAttribs, StartRow, EndRow); break;
+                default:
+                    UNEXPECTED("Unexpected component size (", FmtAttribs.ComponentSize, ") for UNORM texture format");
+            }
+            break;
 
-    const auto& FmtAttribs = GetTextureFormatAttribs(Attribs.Format);
+        case COMPONENT_TYPE_SNORM:
+            switch (FmtAttribs.ComponentSize)
+            {
+                case 1: PolyphaseFilterMipLevel<Int8>(Attribs, FmtAttribs, StartRow, EndRow); break;
+                case 2: PolyphaseFilterMipLevel<Int16>(Attribs, FmtAttribs, StartRow, EndRow); break;
+                default:
+                    UNEXPECTED("Unexpected component size (", FmtAttribs.ComponentSize, ") for SNORM texture format");
+            }
+            break;
 
-    VERIFY_EXPR(Attribs.AlphaCutoff >= 0 && Attribs.AlphaCutoff <= 1);
-    VERIFY(Attribs.AlphaCutoff == 0 || FmtAttribs.NumComponents == 4 && FmtAttribs.ComponentSize == 1,
-           "Alpha remapping is only supported for 4-channel 8-bit textures");
+        case COMPONENT_TYPE_FLOAT:
+            VERIFY(FmtAttribs.ComponentSize == 4, "Only 32-bit float formats are currently supported");
+            PolyphaseFilterMipLevel<Float32>(Attribs, FmtAttribs, StartRow, EndRow);
+            break;
+
+        default:
+            UNEXPECTED("Polyphase filters are not supported for integer formats");
+    }
+}
+
+// Computes rows [StartRow, EndRow) of the coarse mip level
+void ComputeMipLevelRows(const ComputeMipLevelAttribs& Attribs,
+                         const TextureFormatAttribs&   FmtAttribs,
+                         Uint32                        StartRow,
+                         Uint32                        EndRow)
+{
+    // When alpha coverage is preserved, alpha is rescaled after the entire level is computed
+    const bool RemapAlphaChannel = Attribs.AlphaCutoff > 0 && !Attribs.PreserveAlphaCoverage;
+
+    // Integer formats fall through to the default filter
+    if (IsPolyphaseFilter(Attribs.FilterType) &&
+        FmtAttribs.ComponentType != COMPONENT_TYPE_UINT &&
+        FmtAttribs.ComponentType != COMPONENT_TYPE_SINT)
+    {
+        PolyphaseFilterMipLevelRows(Attribs, FmtAttribs, StartRow, EndRow);
+        if (RemapAlphaChannel)
+        {
+            RemapAlpha(Attribs, FmtAttribs.NumComponents, FmtAttribs.NumComponents - 1, StartRow, EndRow);
+        }
+        return;
+    }
 
     switch (FmtAttribs.ComponentType)
     {
         case COMPONENT_TYPE_UNORM_SRGB:
             VERIFY(FmtAttribs.ComponentSize == 1, "Only 8-bit sRGB formats are expected");
-            FilterMipLevel<Uint8>(Attribs, FmtAttribs.NumComponents,
-                                  Attribs.FilterType == MIP_FILTER_TYPE_MOST_FREQUENT ?
-                                      MostFrequentSelector<Uint8> :
-                                      SRGBAverage<Uint8>);
-            if (Attribs.AlphaCutoff > 0)
+            if (Attribs.FilterType == MIP_FILTER_TYPE_MOST_FREQUENT)
+                FilterMipLevel<Uint8>(Attribs, FmtAttribs.NumComponents, MostFrequentSelector<Uint8>, false, StartRow, EndRow);
+            else
+                FilterMipLevel<Uint8>(Attribs, FmtAttribs.NumComponents, SRGBAverage<Uint8>, false, StartRow, EndRow);
+            if (RemapAlphaChannel)
             {
-                RemapAlpha(Attribs, FmtAttribs.NumComponents, FmtAttribs.NumComponents - 1);
+                RemapAlpha(Attribs, FmtAttribs.NumComponents, FmtAttribs.NumComponents - 1, StartRow, EndRow);
             }
             break;
 
@@ -404,19 +1265,19 @@ void ComputeMipLevel(const ComputeMipLevelAttribs& Attribs)
             switch (FmtAttribs.ComponentSize)
             {
                 case 1:
-                    ComputeMipLevelInternal<Uint8>(Attribs, FmtAttribs);
-                    if (Attribs.AlphaCutoff > 0)
+                    ComputeMipLevelInternal<Uint8>(Attribs, FmtAttribs, StartRow, EndRow);
+                    if (RemapAlphaChannel)
                     {
-                        RemapAlpha(Attribs, FmtAttribs.NumComponents, FmtAttribs.NumComponents - 1);
+                        RemapAlpha(Attribs, FmtAttribs.NumComponents, FmtAttribs.NumComponents - 1, StartRow, EndRow);
                     }
                     break;
 
                 case 2:
-                    ComputeMipLevelInternal<Uint16>(Attribs, FmtAttribs);
+                    ComputeMipLevelInternal<Uint16>(Attribs, FmtAttribs, StartRow, EndRow);
                     break;
 
                 case 4:
-                    ComputeMipLevelInternal<Uint32>(Attribs, FmtAttribs);
+                    ComputeMipLevelInternal<Uint32>(Attribs, FmtAttribs, StartRow, EndRow);
                     break;
 
                 default:
@@ -429,15 +1290,15 @@ void ComputeMipLevel(const ComputeMipLevelAttribs& Attribs)
             switch (FmtAttribs.ComponentSize)
             {
                 case 1:
-                    ComputeMipLevelInternal<Int8>(Attribs, FmtAttribs);
+                    ComputeMipLevelInternal<Int8>(Attribs, FmtAttribs, StartRow, EndRow);
                     break;
 
                 case 2:
-                    ComputeMipLevelInternal<Int16>(Attribs, FmtAttribs);
+                    ComputeMipLevelInternal<Int16>(Attribs, FmtAttribs, StartRow, EndRow);
                     break;
 
                 case 4:
-                    ComputeMipLevelInternal<Int32>(Attribs, FmtAttribs);
+                    ComputeMipLevelInternal<Int32>(Attribs, FmtAttribs, StartRow, EndRow);
                     break;
 
                 default:
@@ -447,7 +1308,7 @@ void ComputeMipLevel(const ComputeMipLevelAttribs& Attribs)
 
         case COMPONENT_TYPE_FLOAT:
             VERIFY(FmtAttribs.ComponentSize == 4, "Only 32-bit float formats are currently supported");
-            ComputeMipLevelInternal<Float32>(Attribs, FmtAttribs);
+            ComputeMipLevelInternal<Float32>(Attribs, FmtAttribs, StartRow, EndRow);
             break;
 
         default:
@@ -455,6 +1316,139 @@ void ComputeMipLevel(const ComputeMipLevelAttribs& Attribs)
     }
 }
 
+void ComputeMipLevel(const ComputeMipLevelAttribs& Attribs)
+{
+    DEV_CHECK_ERR(Attribs.Format != TEX_FORMAT_UNKNOWN, "Format must not be unknown");
+    DEV_CHECK_ERR(Attribs.FineMipWidth != 0, "Fine mip width must not be zero");
+    DEV_CHECK_ERR(Attribs.FineMipHeight != 0, "Fine mip height must not be zero");
+    DEV_CHECK_ERR(Attribs.pFineMipData != nullptr, "Fine level data must not be null");
+    DEV_CHECK_ERR(Attribs.pCoarseMipData != nullptr, "Coarse level data must not be null");
+
+    const auto& FmtAttribs = GetTextureFormatAttribs(Attribs.Format);
+
+    VERIFY_EXPR(Attribs.AlphaCutoff >= 0 && Attribs.AlphaCutoff <= 1);
+    VERIFY(Attribs.AlphaCutoff == 0 || FmtAttribs.NumComponents == 4 && FmtAttribs.ComponentSize == 1,
+           "Alpha remapping is only supported for 4-channel 8-bit textures");
+
+    DEV_CHECK_ERR(!IsPolyphaseFilter(Attribs.FilterType) || (FmtAttribs.ComponentType != COMPONENT_TYPE_UINT && FmtAttribs.ComponentType != COMPONENT_TYPE_SINT),
+                  "Polyphase filters are not supported for integer formats. Default filter will be used.");
+
+    const auto CoarseMipHeight = std::max(Attribs.FineMipHeight / Uint32{2}, Uint32{1});
+    ComputeMipLevelRows(Attribs, FmtAttribs, 0, CoarseMipHeight);
+
+    if (Attribs.PreserveAlphaCoverage && Attribs.AlphaCutoff > 0)
+    {
+        ScaleAlphaToCoverage(Attribs);
+    }
+}
+
+void ComputeMipChain(const ComputeMipChainAttribs& Attribs)
+{
+    DEV_CHECK_ERR(Attribs.Format != TEX_FORMAT_UNKNOWN, "Format must not be unknown");
+    DEV_CHECK_ERR(Attribs.Width != 0, "Width must not be zero");
+    DEV_CHECK_ERR(Attribs.Height != 0, "Height must not be zero");
+    DEV_CHECK_ERR(Attribs.pData != nullptr, "Top level data must not be null");
+    DEV_CHECK_ERR(Attribs.NumMipLevels == 0 || Attribs.pMipLevels != nullptr, "Mip levels must not be null");
+
+    if (Attribs.NumMipLevels == 0)
+        return;
+
+    const auto& FmtAttribs = GetTextureFormatAttribs(Attribs.Format);
+
+    VERIFY_EXPR(Attribs.AlphaCutoff >= 0 && Attribs.AlphaCutoff <= 1);
+    VERIFY(Attribs.AlphaCutoff == 0 || (FmtAttribs.NumComponents == 4 && FmtAttribs.ComponentSize == 1),
+           "Alpha remapping is only supported for 4-channel 8-bit textures");
+    DEV_CHECK_ERR(!IsPolyphaseFilter(Attribs.FilterType) || (FmtAttribs.ComponentType != COMPONENT_TYPE_UINT && FmtAttribs.ComponentType != COMPONENT_TYPE_SINT),
+                  "Polyphase filters are not supported for integer formats. Default filter will be used.");
+
+    // Attributes of every fine-to-coarse level pair
+    std::vector<ComputeMipLevelAttribs> Levels(Attribs.NumMipLevels);
+    for (Uint32 i = 0; i < Attribs.NumMipLevels; ++i)
+    {
+        const auto& DstLevel = Attribs.pMipLevels[i];
+        DEV_CHECK_ERR(DstLevel.pData != nullptr, "Data of mip level ", i + 1, " must not be null");
+
+        auto& Level{Levels[i]};
+        Level.Format                = Attribs.Format;
+        Level.FineMipWidth          = i == 0 ? Attribs.Width : std::max(Levels[i - 1].FineMipWidth / 2, 1u);
+        Level.FineMipHeight         = i == 0 ? Attribs.Height : std::max(Levels[i - 1].FineMipHeight / 2, 1u);
+        Level.pFineMipData          = i == 0 ? Attribs.pData : Attribs.pMipLevels[i - 1].pData;
+        Level.FineMipStride         = i == 0 ? Attribs.Stride : Attribs.pMipLevels[i - 1].Stride;
+        Level.pCoarseMipData        = DstLevel.pData;
+        Level.CoarseMipStride       = DstLevel.Stride;
+        Level.FilterType            = Attribs.FilterType;
+        Level.AlphaCutoff           = Attribs.AlphaCutoff;
+        Level.PreserveAlphaCoverage = Attribs.PreserveAlphaCoverage;
+    }
+
+    if (IsPolyphaseFilter(Attribs.FilterType) || (Attribs.PreserveAlphaCoverage && Attribs.AlphaCutoff > 0))
+    {
+        // Polyphase filters read fine rows outside of the 2x2 footprint, and alpha coverage
+        // is computed for the entire level, so the levels are processed one at a time.
+        // The rows of every level are split into independent blocks.
+        constexpr Uint32 RowsPerBlock = 16;
+        for (const auto& Level : Levels)
+        {
+            const Uint32 CoarseMipHeight = std::max(Level.FineMipHeight / 2, 1u);
+            ProcessInParallel(Attribs.pThreadPool, (CoarseMipHeight + RowsPerBlock - 1) / RowsPerBlock,
+                              [&](Uint32 Block) {
+                                  const Uint32 StartRow = Block * RowsPerBlock;
+                                  ComputeMipLevelRows(Level, FmtAttribs, StartRow, std::min(StartRow + RowsPerBlock, CoarseMipHeight));
+                              });
+
+            if (Level.PreserveAlphaCoverage && Level.AlphaCutoff > 0)
+            {
+                ScaleAlphaToCoverage(Level);
+            }
+        }
+        return;
+    }
+
+    // The levels are processed in stages. Every stage starts with a fine level and computes
+    // up to log2(BandHeight) coarser levels in horizontal bands of BandHeight fine rows.
+    // Coarse row r of the level that is k levels below the stage's fine level is computed from
+    // fine rows [r * 2^k, (r + 1) * 2^k), so every band only depends on its own rows and the
+    // bands can be processed independently.
+    constexpr Uint32 MaxBandHeight    = 64;
+    constexpr size_t MaxBandSizeBytes = 256 << 10;
+
+    const Uint32 TexelSize = Uint32{FmtAttribs.ComponentSize} * FmtAttribs.NumComponents;
+    for (Uint32 StageStart = 0; StageStart < Attribs.NumMipLevels;)
+    {
+        const auto& FineLevel = Levels[StageStart];
+
+        // Select the band height so that the band of the fine level fits into the cache
+        const size_t FineRowSize = size_t{FineLevel.FineMipWidth} * TexelSize;
+
+        Uint32 BandLevels = 1;
+        while (BandLevels < Attribs.NumMipLevels - StageStart &&
+               (Uint32{2} << BandLevels) <= MaxBandHeight &&
+               (size_t{2} << BandLevels) * FineRowSize <= MaxBandSizeBytes)
+            ++BandLevels;
+
+        const Uint32 BandHeight = 1u << BandLevels;
+        const Uint32 NumBands   = (FineLevel.FineMipHeight + BandHeight - 1) / BandHeight;
+
+        ProcessInParallel(Attribs.pThreadPool, NumBands,
+                          [&](Uint32 Band) {
+                              for (Uint32 l = 0; l < BandLevels; ++l)
+                              {
+                                  const auto&  Level           = Levels[StageStart + l];
+                                  const Uint32 CoarseMipHeight = std::max(Level.FineMipHeight / 2, 1u);
+                                  const Uint32 BandRows        = BandHeight >> (l + 1);
+                                  const Uint32 StartRow        = std::min(Band * BandRows, CoarseMipHeight);
+                                  const Uint32 EndRow          = std::min(StartRow + BandRows, CoarseMipHeight);
+                                  if (StartRow == EndRow)
+                                      break;
+
+                                  ComputeMipLevelRows(Level, FmtAttribs, StartRow, EndRow);
+                              }
+                          });
+
+        StageStart += BandLevels;
+    }
+}
+
 #if !METAL_SUPPORTED
 void CreateSparseTextureMtl(IRenderDevice*     pDevice,
                             const TextureDesc& TexDesc,
@@ -573,6 +1567,11 @@ extern "C"
         Diligent::ComputeMipLevel(Attribs);
     }
 
+    void Diligent_ComputeMipChain(const Diligent::ComputeMipChainAttribs& Attribs)
+    {
+        Diligent::ComputeMipChain(Attribs);
+    }
+
     void Diligent_CreateSparseTextureMtl(Diligent::IRenderDevice*     pDevice,
                                          const Diligent::TextureDesc& TexDesc,
                                          Diligent::IDeviceMemory*     pMemory,
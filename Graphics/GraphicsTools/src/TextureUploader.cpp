@@ -25,6 +25,8 @@
  *  of the possibility of such damages.
  */
 
+#include <algorithm>
+
 #include "TextureUploader.hpp"
 #include "DebugUtilities.hpp"
 
@@ -84,4 +86,40 @@ void CreateTextureUploader(IRenderDevice* pDevice, const TextureUploaderDesc& De
         (*ppUploader)->AddRef();
 }
 
+bool CompressToUploadBuffer(IUploadBuffer*              pUploadBuffer,
+                            Uint32                      Mip,
+                            Uint32                      Slice,
+                            TEXTURE_FORMAT              SrcFormat,
+                            const TextureSubResData&    SrcData,
+                            TEXTURE_COMPRESSION_QUALITY Quality,
+                            IThreadPool*                pThreadPool)
+{
+    DEV_CHECK_ERR(pUploadBuffer != nullptr, "Upload buffer must not be null");
+    DEV_CHECK_ERR(SrcData.pSrcBuffer == nullptr, "Compressing the data from a GPU buffer is not supported");
+
+    const auto& Desc       = pUploadBuffer->GetDesc();
+    const auto  MappedData = pUploadBuffer->GetMappedData(Mip, Slice);
+    if (MappedData.pData == nullptr)
+    {
+        LOG_ERROR_MESSAGE("Mip level ", Mip, " of array slice ", Slice, " of the upload buffer is not mapped");
+        return false;
+    }
+
+    CompressTextureSubresourceAttribs Attribs;
+    Attribs.SrcFormat      = SrcFormat;
+    Attribs.DstFormat      = Desc.Format;
+    Attribs.Quality        = Quality;
+    Attribs.Width          = std::max(Desc.Width >> Mip, 1u);
+    Attribs.Height         = std::max(Desc.Height >> Mip, 1u);
+    Attribs.Depth          = std::max(Desc.Depth >> Mip, 1u);
+    Attribs.pSrcData       = SrcData.pData;
+    Attribs.SrcRowStride   = SrcData.Stride;
+    Attribs.SrcDepthStride = SrcData.DepthStride;
+    Attribs.pDstData       = MappedData.pData;
+    Attribs.DstRowStride   = MappedData.Stride;
+    Attribs.DstDepthStride = MappedData.DepthStride;
+    Attribs.pThreadPool    = pThreadPool;
+    return CompressTextureSubresource(Attribs);
+}
+
 } // namespace Diligent
@@ -151,6 +151,22 @@ public:
     static BasicFile* OpenFile(FileOpenAttribs& OpenAttribs);
     static void       ReleaseFile(BasicFile*);
 
+    /// Maps the file into the address space of the process.
+
+    /// \param [in]  strFilePath - Path to the file.
+    /// \param [out] Size        - Size of the mapped data.
+    ///
+    /// \return     Pointer to the mapped file data, or null if the file could not be mapped
+    ///             or if memory mapping is not supported on this platform.
+    ///
+    /// \remarks    The mapping is private to the process: pages are loaded on first access,
+    ///             and changes to the mapped memory are not written back to the file.
+    ///             The memory must be released with UnmapFile().
+    static void* MapFile(const Char* strFilePath, size_t& Size);
+
+    /// Releases the memory mapped by MapFile().
+    static void UnmapFile(void* pData, size_t Size);
+
     static bool FileExists(const Char* strFilePath);
 
     static void SetWorkingDirectory(const Char* strWorkingDir) { m_strWorkingDirectory = strWorkingDir; }
@@ -88,6 +88,17 @@ void BasicFileSystem::ReleaseFile(BasicFile* pFile)
         delete pFile;
 }
 
+void* BasicFileSystem::MapFile(const Char* strFilePath, size_t& Size)
+{
+    Size = 0;
+    return nullptr;
+}
+
+void BasicFileSystem::UnmapFile(void* pData, size_t Size)
+{
+    VERIFY(pData == nullptr, "Memory mapping is not supported on this platform, so the pointer must be null");
+}
+
 bool BasicFileSystem::FileExists(const Char* strFilePath)
 {
     return false;
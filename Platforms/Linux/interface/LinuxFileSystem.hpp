@@ -44,6 +44,9 @@ struct LinuxFileSystem : public BasicFileSystem
 public:
     static LinuxFile* OpenFile(const FileOpenAttribs& OpenAttribs);
 
+    static void* MapFile(const Char* strFilePath, size_t& Size);
+    static void  UnmapFile(void* pData, size_t Size);
+
     static bool FileExists(const Char* strFilePath);
     static bool PathExists(const Char* strPath);
 
@@ -29,8 +29,11 @@
 #include <stdlib.h>
 #include <unistd.h>
 #include <cstdio>
+#include <cstring>
 #include <sys/stat.h>
 #include <sys/types.h>
+#include <sys/mman.h>
+#include <fcntl.h>
 #include <ftw.h>
 #include <glob.h>
 #include <mutex>
@@ -60,6 +63,55 @@ LinuxFile* LinuxFileSystem::OpenFile(const FileOpenAttribs& OpenAttribs)
 }
 #endif
 
+void* LinuxFileSystem::MapFile(const Char* strFilePath, size_t& Size)
+{
+    Size = 0;
+    if (strFilePath == nullptr || strFilePath[0] == '\0')
+    {
+        UNEXPECTED("File path must not be null or empty");
+        return nullptr;
+    }
+
+    std::string path{strFilePath};
+    CorrectSlashes(path);
+
+    const int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+        LOG_ERROR_MESSAGE("Failed to open file ", path, ": ", strerror(errno));
+        return nullptr;
+    }
+
+    void*       pData = nullptr;
+    struct stat StatBuff;
+    if (fstat(fd, &StatBuff) == 0 && StatBuff.st_size > 0)
+    {
+        // Use a private mapping so that the memory can be modified without affecting the file.
+        // Pages that are never written are shared with the page cache.
+        pData = mmap(nullptr, static_cast<size_t>(StatBuff.st_size), PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+        if (pData != MAP_FAILED)
+        {
+            Size = static_cast<size_t>(StatBuff.st_size);
+        }
+        else
+        {
+            LOG_ERROR_MESSAGE("Failed to map file ", path, ": ", strerror(errno));
+            pData = nullptr;
+        }
+    }
+
+    // The mapping remains valid after the file descriptor is closed
+    close(fd);
+
+    return pData;
+}
+
+void LinuxFileSystem::UnmapFile(void* pData, size_t Size)
+{
+    if (pData != nullptr)
+        munmap(pData, Size);
+}
+
 bool LinuxFileSystem::FileExists(const Char* strFilePath)
 {
     std::string path{strFilePath};
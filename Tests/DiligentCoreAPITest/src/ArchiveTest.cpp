@@ -1560,6 +1560,126 @@ TEST(ArchiveTest, ComputePipeline_SplitArchive_Async)
     TestComputePipeline(PSO_ARCHIVE_FLAG_DO_NOT_PACK_SIGNATURES, /*CompileAsync = */ true);
 }
 
+TEST(ArchiveTest, UnpackPipelineStates)
+{
+    auto* pEnv             = GPUTestingEnvironment::GetInstance();
+    auto* pDevice          = pEnv->GetDevice();
+    auto* pArchiverFactory = pEnv->GetArchiverFactory();
+
+    RefCntAutoPtr<IDearchiver> pDearchiver;
+    DearchiverCreateInfo       DearchiverCI{};
+    pDevice->GetEngineFactory()->CreateDearchiver(DearchiverCI, &pDearchiver);
+    if (!pDearchiver || !pArchiverFactory)
+        GTEST_SKIP() << "Archiver library is not loaded";
+
+    if (!pDevice->GetDeviceInfo().Features.ComputeShaders)
+        GTEST_SKIP() << "Compute shaders are not supported by device";
+
+    GPUTestingEnvironment::ScopedReleaseResources AutoreleaseResources;
+
+    SerializationDeviceCreateInfo SerDeviceCI;
+    SerDeviceCI.DeviceInfo.Features.SeparablePrograms = pDevice->GetDeviceInfo().Features.SeparablePrograms;
+    RefCntAutoPtr<ISerializationDevice> pSerializationDevice;
+    pArchiverFactory->CreateSerializationDevice(SerDeviceCI, &pSerializationDevice);
+    ASSERT_NE(pSerializationDevice, nullptr);
+
+    RefCntAutoPtr<IPipelineResourceSignature> pSerializedPRS;
+    {
+        constexpr PipelineResourceDesc Resources[] = {
+            {SHADER_TYPE_COMPUTE, "g_tex2DUAV", 1, SHADER_RESOURCE_TYPE_TEXTURE_UAV, SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC, PIPELINE_RESOURCE_FLAG_NONE, {WEB_GPU_BINDING_TYPE_WRITE_ONLY_TEXTURE_UAV, RESOURCE_DIM_TEX_2D, TEX_FORMAT_RGBA8_UNORM}},
+        };
+
+        PipelineResourceSignatureDesc PRSDesc;
+        PRSDesc.Name         = "ArchiveTest.UnpackPipelineStates - PRS";
+        PRSDesc.Resources    = Resources;
+        PRSDesc.NumResources = _countof(Resources);
+
+        pSerializationDevice->CreatePipelineResourceSignature(PRSDesc, ResourceSignatureArchiveInfo{GetDeviceBits()}, &pSerializedPRS);
+        ASSERT_NE(pSerializedPRS, nullptr);
+    }
+
+    constexpr Uint32 NumPSOs = 8;
+
+    std::vector<std::string> PSONames(NumPSOs);
+    {
+        RefCntAutoPtr<IArchiver> pArchiver;
+        pArchiverFactory->CreateArchiver(pSerializationDevice, &pArchiver);
+        ASSERT_NE(pArchiver, nullptr);
+
+        ShaderCreateInfo       ShaderCI;
+        RefCntAutoPtr<IShader> pSerializedCS;
+        CreateComputeShader(pDevice, pSerializationDevice, ShaderCI, nullptr, &pSerializedCS);
+        ASSERT_NE(pSerializedCS, nullptr);
+
+        for (Uint32 i = 0; i < NumPSOs; ++i)
+        {
+            PSONames[i] = "ArchiveTest.UnpackPipelineStates - PSO " + std::to_string(i);
+
+            ComputePipelineStateCreateInfo PSOCreateInfo;
+            PSOCreateInfo.PSODesc.Name         = PSONames[i].c_str();
+            PSOCreateInfo.PSODesc.PipelineType = PIPELINE_TYPE_COMPUTE;
+            PSOCreateInfo.pCS                  = pSerializedCS;
+
+            IPipelineResourceSignature* Signatures[] = {pSerializedPRS};
+            PSOCreateInfo.ResourceSignaturesCount    = _countof(Signatures);
+            PSOCreateInfo.ppResourceSignatures       = Signatures;
+
+            PipelineStateArchiveInfo ArchiveInfo;
+            ArchiveInfo.DeviceFlags = GetDeviceBits();
+#if PLATFORM_MACOS
+            // Compute shaders are not supported in OpenGL on MacOS
+            ArchiveInfo.DeviceFlags &= ~(ARCHIVE_DEVICE_DATA_FLAG_GL | ARCHIVE_DEVICE_DATA_FLAG_GLES);
+#endif
+            RefCntAutoPtr<IPipelineState> pSerializedPSO;
+            pSerializationDevice->CreateComputePipelineState(PSOCreateInfo, ArchiveInfo, &pSerializedPSO);
+            ASSERT_NE(pSerializedPSO, nullptr);
+            ASSERT_TRUE(pArchiver->AddPipelineState(pSerializedPSO));
+        }
+
+        RefCntAutoPtr<IDataBlob> pArchive;
+        pArchiver->SerializeToBlob(ContentVersion, &pArchive);
+        ASSERT_NE(pArchive, nullptr);
+        ASSERT_TRUE(pDearchiver->LoadArchive(pArchive, ContentVersion));
+    }
+
+    // All PSOs, a duplicate of the first PSO, and a PSO that does not exist
+    std::vector<PipelineStateUnpackInfo> UnpackInfos(NumPSOs + 2);
+    for (size_t i = 0; i < UnpackInfos.size(); ++i)
+    {
+        auto& UnpackInfo        = UnpackInfos[i];
+        UnpackInfo.pDevice      = pDevice;
+        UnpackInfo.PipelineType = PIPELINE_TYPE_COMPUTE;
+        UnpackInfo.Name         = i < NumPSOs ? PSONames[i].c_str() : (i == NumPSOs ? PSONames[0].c_str() : "Non-existing PSO name");
+    }
+
+    std::vector<IPipelineState*> PSOs(UnpackInfos.size());
+    pDearchiver->UnpackPipelineStates(UnpackInfos.data(), static_cast<Uint32>(UnpackInfos.size()), PSOs.data());
+
+    EXPECT_EQ(PSOs[NumPSOs], PSOs[0]);
+    EXPECT_EQ(PSOs[NumPSOs + 1], nullptr);
+    for (Uint32 i = 0; i < NumPSOs; ++i)
+    {
+        ASSERT_NE(PSOs[i], nullptr) << PSONames[i];
+        EXPECT_EQ(PSOs[i]->GetStatus(/*WaitForCompletion = */ true), PIPELINE_STATE_STATUS_READY);
+
+        // Resource signatures must be shared by all PSOs in the batch
+        EXPECT_EQ(PSOs[i]->GetResourceSignature(0), PSOs[0]->GetResourceSignature(0));
+    }
+
+    // Unpacked PSOs are cached
+    {
+        RefCntAutoPtr<IPipelineState> pPSO;
+        pDearchiver->UnpackPipelineState(UnpackInfos[1], &pPSO);
+        EXPECT_EQ(pPSO, PSOs[1]);
+    }
+
+    for (auto* pPSO : PSOs)
+    {
+        if (pPSO != nullptr)
+            pPSO->Release();
+    }
+}
+
 void TestRayTracingPipeline(bool CompileAsync = false)
 {
     auto* pEnv             = GPUTestingEnvironment::GetInstance();
@@ -768,6 +768,7 @@ TEST(ShaderResourceLayout, VariableAccess)
             tex2D_Mut->GetResourceDesc(ResDesc);
             EXPECT_EQ(ResDesc.ArraySize, 1u);
             EXPECT_EQ(tex2D_Mut, pSRB->GetVariableByName(SHADER_TYPE_VERTEX, ResDesc.Name));
+            EXPECT_EQ(tex2D_Mut, pSRB->GetVariableByHash(SHADER_TYPE_VERTEX, ComputeShaderResourceNameHash(ResDesc.Name)));
             tex2D_Mut->Set(pSRVs[0]);
             EXPECT_EQ(tex2D_Mut->Get(), pSRVs[0]);
 
@@ -783,6 +784,7 @@ TEST(ShaderResourceLayout, VariableAccess)
         {
             auto tex2D_Mut_sampler = pSRB->GetVariableByName(SHADER_TYPE_VERTEX, "g_tex2D_Mut_sampler");
             EXPECT_EQ(tex2D_Mut_sampler, nullptr);
+            EXPECT_EQ(pSRB->GetVariableByHash(SHADER_TYPE_VERTEX, ComputeShaderResourceNameHash("g_tex2D_Mut_sampler")), nullptr);
         }
 
         {
@@ -792,11 +794,46 @@ TEST(ShaderResourceLayout, VariableAccess)
             tex2D_MutArr->GetResourceDesc(ResDesc);
             EXPECT_EQ(ResDesc.ArraySize, 2u);
             EXPECT_EQ(tex2D_MutArr, pSRB->GetVariableByName(SHADER_TYPE_VERTEX, ResDesc.Name));
+            EXPECT_EQ(tex2D_MutArr, pSRB->GetVariableByHash(SHADER_TYPE_VERTEX, ComputeShaderResourceNameHash(ResDesc.Name)));
             tex2D_MutArr->SetArray(pSRVs, 0, 2);
             EXPECT_EQ(tex2D_MutArr->Get(0), pSRVs[0]);
             EXPECT_EQ(tex2D_MutArr->Get(1), pSRVs[1]);
         }
 
+        {
+            auto tex2D_MutArr = pSRB->GetVariableByName(SHADER_TYPE_VERTEX, "g_tex2D_MutArr");
+            ASSERT_NE(tex2D_MutArr, nullptr);
+            const Uint32 VarIndex = tex2D_MutArr->GetIndex();
+
+            const ResourceBindDesc SwapDescs[] = {
+                {SHADER_TYPE_VERTEX, VarIndex, pSRVs[1], 0, SET_SHADER_RESOURCE_FLAG_ALLOW_OVERWRITE},
+                {SHADER_TYPE_VERTEX, VarIndex, pSRVs[0], 1, SET_SHADER_RESOURCE_FLAG_ALLOW_OVERWRITE},
+            };
+            pSRB->SetResources(SwapDescs, _countof(SwapDescs));
+            EXPECT_EQ(tex2D_MutArr->Get(0), pSRVs[1]);
+            EXPECT_EQ(tex2D_MutArr->Get(1), pSRVs[0]);
+
+            const ResourceBindDesc RestoreDescs[] = {
+                {SHADER_TYPE_VERTEX, VarIndex, pSRVs[0], 0, SET_SHADER_RESOURCE_FLAG_ALLOW_OVERWRITE},
+                {SHADER_TYPE_VERTEX, VarIndex, pSRVs[1], 1, SET_SHADER_RESOURCE_FLAG_ALLOW_OVERWRITE},
+            };
+            pSRB->SetResources(RestoreDescs, _countof(RestoreDescs));
+            EXPECT_EQ(tex2D_MutArr->Get(0), pSRVs[0]);
+            EXPECT_EQ(tex2D_MutArr->Get(1), pSRVs[1]);
+
+            // Descriptors with out-of-range indices must be skipped without binding anything
+            const ResourceBindDesc InvalidDescs[] = {
+                {SHADER_TYPE_VERTEX, pSRB->GetVariableCount(SHADER_TYPE_VERTEX), pSRVs[1], 0, SET_SHADER_RESOURCE_FLAG_ALLOW_OVERWRITE},
+                {SHADER_TYPE_VERTEX, VarIndex, pSRVs[1], 2, SET_SHADER_RESOURCE_FLAG_ALLOW_OVERWRITE},
+            };
+            {
+                TestingEnvironment::ErrorScope ExpectedErrors{"Array index (2) is out of range", "is out of range. The number of variables is"};
+                pSRB->SetResources(InvalidDescs, _countof(InvalidDescs));
+            }
+            EXPECT_EQ(tex2D_MutArr->Get(0), pSRVs[0]);
+            EXPECT_EQ(tex2D_MutArr->Get(1), pSRVs[1]);
+        }
+
         {
             auto tex2D_MutArr_sampler = pSRB->GetVariableByName(SHADER_TYPE_VERTEX, "g_tex2D_MutArr_sampler");
             EXPECT_EQ(tex2D_MutArr_sampler, nullptr);
@@ -809,6 +846,7 @@ TEST(ShaderResourceLayout, VariableAccess)
             tex2D_Dyn->GetResourceDesc(ResDesc);
             EXPECT_EQ(ResDesc.ArraySize, 1u);
             EXPECT_EQ(tex2D_Dyn, pSRB->GetVariableByName(SHADER_TYPE_VERTEX, ResDesc.Name));
+            EXPECT_EQ(tex2D_Dyn, pSRB->GetVariableByHash(SHADER_TYPE_VERTEX, ComputeShaderResourceNameHash(ResDesc.Name)));
             //tex2D_Dyn->Set(pSRVs[0]);
             EXPECT_EQ(TestShaderResourceVariableCInterface(tex2D_Dyn, pSRVs[0]), 0);
         }
@@ -825,6 +863,7 @@ TEST(ShaderResourceLayout, VariableAccess)
             tex2D_DynArr->GetResourceDesc(ResDesc);
             EXPECT_EQ(ResDesc.ArraySize, 2u);
             EXPECT_EQ(tex2D_DynArr, pSRB->GetVariableByName(SHADER_TYPE_VERTEX, ResDesc.Name));
+            EXPECT_EQ(tex2D_DynArr, pSRB->GetVariableByHash(SHADER_TYPE_VERTEX, ComputeShaderResourceNameHash(ResDesc.Name)));
             tex2D_DynArr->SetArray(pSRVs, 0, 2);
             EXPECT_EQ(tex2D_DynArr->Get(0), pSRVs[0]);
             EXPECT_EQ(tex2D_DynArr->Get(1), pSRVs[1]);
@@ -134,4 +134,90 @@ TEST(ResourceStateTest, DiscardSubresource)
     pContext->Flush();
 }
 
+TEST(ResourceStateTest, BarrierBatching)
+{
+    auto* pEnv     = GPUTestingEnvironment::GetInstance();
+    auto* pDevice  = pEnv->GetDevice();
+    auto* pContext = pEnv->GetDeviceContext();
+    if (pDevice->GetDeviceInfo().Type != RENDER_DEVICE_TYPE_VULKAN)
+        GTEST_SKIP() << "Barrier counters are only collected by the Vulkan backend";
+
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    RefCntAutoPtr<ITexture> pTextures[2];
+    for (auto& pTexture : pTextures)
+    {
+        TextureDesc TexDesc;
+        TexDesc.Name      = "BarrierBatching test texture";
+        TexDesc.Type      = RESOURCE_DIM_TEX_2D;
+        TexDesc.Width     = 64;
+        TexDesc.Height    = 64;
+        TexDesc.BindFlags = BIND_SHADER_RESOURCE;
+        TexDesc.Format    = TEX_FORMAT_RGBA8_UNORM;
+        pDevice->CreateTexture(TexDesc, nullptr, &pTexture);
+        ASSERT_NE(pTexture, nullptr);
+    }
+
+    RefCntAutoPtr<IBuffer> pBuffers[2];
+    for (auto& pBuffer : pBuffers)
+    {
+        BufferDesc BuffDesc;
+        BuffDesc.Name      = "BarrierBatching test buffer";
+        BuffDesc.Size      = 256;
+        BuffDesc.BindFlags = BIND_VERTEX_BUFFER;
+        BuffDesc.Usage     = USAGE_DEFAULT;
+        pDevice->CreateBuffer(BuffDesc, nullptr, &pBuffer);
+        ASSERT_NE(pBuffer, nullptr);
+    }
+
+    {
+        const StateTransitionDesc Barriers[] = {
+            {pTextures[0], RESOURCE_STATE_UNKNOWN, RESOURCE_STATE_COPY_DEST, STATE_TRANSITION_FLAG_UPDATE_STATE},
+            {pTextures[1], RESOURCE_STATE_UNKNOWN, RESOURCE_STATE_COPY_DEST, STATE_TRANSITION_FLAG_UPDATE_STATE},
+            {pBuffers[0], RESOURCE_STATE_UNKNOWN, RESOURCE_STATE_COPY_DEST, STATE_TRANSITION_FLAG_UPDATE_STATE},
+            {pBuffers[1], RESOURCE_STATE_UNKNOWN, RESOURCE_STATE_COPY_DEST, STATE_TRANSITION_FLAG_UPDATE_STATE},
+        };
+        pContext->TransitionResourceStates(_countof(Barriers), Barriers);
+        pContext->Flush();
+    }
+
+    // Barriers for different images and memory barriers between identical stages are issued with a single command
+    {
+        pContext->ClearStats();
+
+        const StateTransitionDesc Barriers[] = {
+            {pTextures[0], RESOURCE_STATE_COPY_DEST, RESOURCE_STATE_SHADER_RESOURCE, STATE_TRANSITION_FLAG_UPDATE_STATE},
+            {pBuffers[0], RESOURCE_STATE_COPY_DEST, RESOURCE_STATE_VERTEX_BUFFER, STATE_TRANSITION_FLAG_UPDATE_STATE},
+            {pTextures[1], RESOURCE_STATE_COPY_DEST, RESOURCE_STATE_SHADER_RESOURCE, STATE_TRANSITION_FLAG_UPDATE_STATE},
+            {pBuffers[1], RESOURCE_STATE_COPY_DEST, RESOURCE_STATE_VERTEX_BUFFER, STATE_TRANSITION_FLAG_UPDATE_STATE},
+        };
+        pContext->TransitionResourceStates(_countof(Barriers), Barriers);
+        pContext->Flush();
+
+        const auto& Counters = pContext->GetStats().BarrierCounters;
+        EXPECT_EQ(Counters.PipelineBarriers, 1u);
+        EXPECT_EQ(Counters.ImageBarriers, 2u);
+        EXPECT_EQ(Counters.MemoryBarriers, 1u);
+    }
+
+    // Barriers for the same image are not ordered within one command, so pending barriers
+    // must be flushed before the overlapping one.
+    {
+        pContext->ClearStats();
+
+        const StateTransitionDesc Barriers[] = {
+            {pTextures[1], RESOURCE_STATE_SHADER_RESOURCE, RESOURCE_STATE_COPY_DEST, STATE_TRANSITION_FLAG_UPDATE_STATE},
+            {pTextures[0], RESOURCE_STATE_SHADER_RESOURCE, RESOURCE_STATE_COPY_DEST, STATE_TRANSITION_FLAG_UPDATE_STATE},
+            {pTextures[0], RESOURCE_STATE_COPY_DEST, RESOURCE_STATE_SHADER_RESOURCE, STATE_TRANSITION_FLAG_UPDATE_STATE},
+        };
+        pContext->TransitionResourceStates(_countof(Barriers), Barriers);
+        pContext->Flush();
+
+        const auto& Counters = pContext->GetStats().BarrierCounters;
+        EXPECT_EQ(Counters.PipelineBarriers, 2u);
+        EXPECT_EQ(Counters.ImageBarriers, 3u);
+        EXPECT_EQ(Counters.MemoryBarriers, 0u);
+    }
+}
+
 } // namespace
@@ -72,6 +72,13 @@ int TestShaderResourceBindingCInterface(struct IShaderResourceBinding* pSRB)
     if (pVar == NULL)
         ++num_errors;
 
+    // Hash that does not correspond to any variable
+    pVar = IShaderResourceBinding_GetVariableByHash(pSRB, SHADER_TYPE_VERTEX, 0);
+    if (pVar != NULL)
+        ++num_errors;
+
+    IShaderResourceBinding_SetResources(pSRB, NULL, 0);
+
     IPipelineResourceSignature_InitializeStaticSRBResources(pPRS, pSRB);
 
     if (!IShaderResourceBinding_StaticResourcesInitialized(pSRB))
@@ -26,11 +26,18 @@
  */
 
 #include <array>
+#include <thread>
+#include <vector>
+#include <atomic>
+#include <algorithm>
 
 #include "DefaultRawMemoryAllocator.hpp"
 #include "FixedBlockMemoryAllocator.hpp"
 #include "FixedLinearAllocator.hpp"
 #include "DynamicLinearAllocator.hpp"
+#include "FrameArena.hpp"
+#include "Align.hpp"
+#include "FastRand.hpp"
 
 #include "gtest/gtest.h"
 
@@ -124,6 +131,120 @@ TEST(Common_FixedBlockMemoryAllocator, UnalignedSize)
     }
 }
 
+TEST(Common_FixedBlockMemoryAllocator, PageAlignment)
+{
+    constexpr Uint32 AllocSize             = 24;
+    constexpr Uint32 NumAllocationsPerPage = 10;
+
+    FixedBlockMemoryAllocator TestAllocator{DefaultRawMemoryAllocator::GetAllocator(), AllocSize, NumAllocationsPerPage};
+
+    const auto PageSize = TestAllocator.GetPageSize();
+    EXPECT_TRUE(IsPowerOfTwo(PageSize));
+    EXPECT_GE(TestAllocator.GetNumBlocksInPage(), NumAllocationsPerPage);
+
+    std::vector<void*> Allocations(TestAllocator.GetNumBlocksInPage() * 5);
+    for (auto& Ptr : Allocations)
+    {
+        Ptr = TestAllocator.Allocate(AllocSize, "Page alignment test", __FILE__, __LINE__);
+        ASSERT_NE(Ptr, nullptr);
+        // Blocks never start at the page boundary as the page begins with the page header
+        EXPECT_NE(AlignDown(Ptr, PageSize), Ptr);
+        memset(Ptr, 0xFF, AllocSize);
+    }
+
+    for (auto* Ptr : Allocations)
+        TestAllocator.Free(Ptr);
+}
+
+TEST(Common_FixedBlockMemoryAllocator, CrossThreadFree)
+{
+    constexpr Uint32 AllocSize             = 32;
+    constexpr Uint32 NumAllocationsPerPage = 16;
+    constexpr Uint32 NumThreads            = 8;
+    constexpr Uint32 NumBlocksPerThread    = 1000;
+
+    FixedBlockMemoryAllocator TestAllocator{DefaultRawMemoryAllocator::GetAllocator(), AllocSize, NumAllocationsPerPage};
+
+    std::vector<std::vector<Uint32*>> Blocks(NumThreads);
+    std::vector<std::thread>          Threads(NumThreads);
+    std::atomic<Uint32>               NumErrors{0};
+    for (Uint32 i = 0; i < NumThreads; ++i)
+    {
+        Threads[i] = std::thread(
+            [&](Uint32 ThreadId) {
+                FastRandInt Rnd{ThreadId, 0, 3};
+
+                // Interleave allocations with frees until the thread holds NumBlocksPerThread blocks
+                auto& ThreadBlocks = Blocks[ThreadId];
+                ThreadBlocks.reserve(NumBlocksPerThread);
+                while (ThreadBlocks.size() < NumBlocksPerThread)
+                {
+                    const Uint32 Tag = ThreadId * NumBlocksPerThread + static_cast<Uint32>(ThreadBlocks.size());
+                    if (!ThreadBlocks.empty() && Rnd() == 0)
+                    {
+                        auto* Ptr = ThreadBlocks.back();
+                        ThreadBlocks.pop_back();
+                        for (Uint32 j = 0; j < AllocSize / sizeof(Uint32); ++j)
+                        {
+                            if (Ptr[j] != Tag - 1)
+                                NumErrors.fetch_add(1);
+                        }
+                        TestAllocator.Free(Ptr);
+                    }
+                    else
+                    {
+                        auto* Ptr = static_cast<Uint32*>(TestAllocator.Allocate(AllocSize, "Cross-thread free test", __FILE__, __LINE__));
+                        for (Uint32 j = 0; j < AllocSize / sizeof(Uint32); ++j)
+                            Ptr[j] = Tag;
+                        ThreadBlocks.push_back(Ptr);
+                    }
+                }
+            },
+            i);
+    }
+    for (auto& Thread : Threads)
+        Thread.join();
+
+    EXPECT_EQ(NumErrors.load(), 0u);
+    EXPECT_EQ(TestAllocator.GetNumAllocatedBlocks(), NumThreads * NumBlocksPerThread);
+
+    // Check that no two blocks overlap
+    std::vector<Uint8*> SortedBlocks;
+    for (const auto& ThreadBlocks : Blocks)
+    {
+        for (auto* Ptr : ThreadBlocks)
+            SortedBlocks.push_back(reinterpret_cast<Uint8*>(Ptr));
+    }
+    std::sort(SortedBlocks.begin(), SortedBlocks.end());
+    for (size_t i = 1; i < SortedBlocks.size(); ++i)
+        EXPECT_GE(SortedBlocks[i] - SortedBlocks[i - 1], static_cast<ptrdiff_t>(AllocSize));
+
+    // Every block is freed by a thread that did not allocate it
+    for (Uint32 i = 0; i < NumThreads; ++i)
+    {
+        Threads[i] = std::thread(
+            [&](Uint32 ThreadId) {
+                const Uint32 SrcThreadId = (ThreadId + 1) % NumThreads;
+                for (Uint32 b = 0; b < NumBlocksPerThread; ++b)
+                {
+                    auto* Ptr = Blocks[SrcThreadId][b];
+                    for (Uint32 j = 0; j < AllocSize / sizeof(Uint32); ++j)
+                    {
+                        if (Ptr[j] != SrcThreadId * NumBlocksPerThread + b)
+                            NumErrors.fetch_add(1);
+                    }
+                    TestAllocator.Free(Ptr);
+                }
+            },
+            i);
+    }
+    for (auto& Thread : Threads)
+        Thread.join();
+
+    EXPECT_EQ(NumErrors.load(), 0u);
+    EXPECT_EQ(TestAllocator.GetNumAllocatedBlocks(), 0u);
+}
+
 TEST(Common_FixedLinearAllocator, EmptyAllocator)
 {
     FixedLinearAllocator Allocator{DefaultRawMemoryAllocator::GetAllocator()};
@@ -289,4 +410,125 @@ TEST(Common_DynamicLinearAllocator, ObjectConstruction)
     EXPECT_TRUE(reinterpret_cast<size_t>(Allocator.Allocate(200, 64)) % 64 == 0);
 }
 
+TEST(Common_DynamicLinearAllocator, Rewind)
+{
+    DynamicLinearAllocator Allocator{DefaultRawMemoryAllocator::GetAllocator(), 64};
+
+    {
+        // Rewinding an empty allocator
+        DynamicLinearAllocator::ScopedMarker Scope{Allocator};
+    }
+    EXPECT_EQ(Allocator.GetCurrentSize(), size_t{0});
+
+    auto* pData0 = Allocator.Allocate(16, 8);
+    EXPECT_EQ(Allocator.GetCurrentSize(), size_t{16});
+
+    const auto Marker = Allocator.GetMarker();
+
+    auto* pData1 = Allocator.Allocate(32, 8);
+    Allocator.Rewind(Marker);
+    EXPECT_EQ(Allocator.GetCurrentSize(), size_t{16});
+    EXPECT_EQ(Allocator.Allocate(32, 8), pData1);
+    Allocator.Rewind(Marker);
+
+    {
+        DynamicLinearAllocator::ScopedMarker Scope{Allocator};
+        // Allocations that span multiple blocks
+        for (size_t i = 0; i < 10; ++i)
+            EXPECT_NE(Allocator.Allocate(48, 16), nullptr);
+        EXPECT_GT(Allocator.GetBlockCount(), size_t{5});
+        EXPECT_GE(Allocator.GetPeakSize(), size_t{16 + 480});
+
+        {
+            DynamicLinearAllocator::ScopedMarker NestedScope{Allocator};
+            EXPECT_NE(Allocator.Allocate(1000, 16), nullptr);
+        }
+    }
+    EXPECT_EQ(Allocator.GetCurrentSize(), size_t{16});
+    EXPECT_EQ(Allocator.Allocate(32, 8), pData1);
+
+    const auto BlockCount = Allocator.GetBlockCount();
+    for (size_t i = 0; i < 10; ++i)
+        EXPECT_NE(Allocator.Allocate(48, 16), nullptr);
+    // Blocks released by rewind are reused
+    EXPECT_EQ(Allocator.GetBlockCount(), BlockCount);
+
+    Allocator.Discard();
+    EXPECT_EQ(Allocator.GetCurrentSize(), size_t{0});
+    EXPECT_EQ(Allocator.Allocate(16, 8), pData0);
+
+    Allocator.ReleaseUnusedBlocks();
+    EXPECT_EQ(Allocator.GetBlockCount(), size_t{1});
+    EXPECT_EQ(Allocator.GetReservedSize(), size_t{64});
+    Allocator.Discard();
+    Allocator.ReleaseUnusedBlocks();
+    EXPECT_EQ(Allocator.GetBlockCount(), size_t{0});
+    EXPECT_EQ(Allocator.GetReservedSize(), size_t{0});
+}
+
+TEST(Common_FrameArena, Scopes)
+{
+    std::thread Thread{
+        []() {
+            auto& Arena = FrameArena::GetThreadArena();
+
+            const size_t LargeSize = FrameArena::GetMaxSize() + 1;
+            for (Uint32 i = 0; i < 4; ++i)
+            {
+                FrameArena::Scope Scope;
+
+                auto* pData = Scope.GetAllocator().Allocate(1000, 16);
+                EXPECT_NE(pData, nullptr);
+                memset(pData, 0xFF, 1000);
+                {
+                    FrameArena::Scope NestedScope;
+                    EXPECT_NE(NestedScope.GetAllocator().Allocate(3000, 16), nullptr);
+                }
+
+                if (i == 2)
+                {
+                    EXPECT_NE(Scope.GetAllocator().Allocate(LargeSize, 16), nullptr);
+                }
+            }
+
+            const auto Stats = Arena.GetStats();
+            EXPECT_EQ(Stats.NumScopes, Uint64{4});
+            EXPECT_EQ(Stats.NumOverflows, Uint64{1});
+            EXPECT_GE(Stats.PeakSize, LargeSize);
+            EXPECT_GE(Stats.AverageSize, size_t{4000});
+            EXPECT_LE(Stats.ReservedSize, FrameArena::GetMaxSize());
+        }};
+    Thread.join();
+
+    // The statistics of the exited thread are combined into the last entry
+    const auto AllStats = FrameArena::GetAllStats();
+    ASSERT_FALSE(AllStats.empty());
+    EXPECT_GE(AllStats.back().NumScopes, Uint64{4});
+    EXPECT_GE(AllStats.back().NumOverflows, Uint64{1});
+    EXPECT_EQ(AllStats.back().ReservedSize, size_t{0});
+}
+
+TEST(Common_FrameArena, ExitedThreads)
+{
+    auto RunThread = []() {
+        std::thread Thread{
+            []() {
+                FrameArena::Scope Scope;
+                EXPECT_NE(Scope.GetAllocator().Allocate(64, 16), nullptr);
+            }};
+        Thread.join();
+    };
+
+    RunThread();
+    const auto Stats0 = FrameArena::GetAllStats();
+    ASSERT_FALSE(Stats0.empty());
+
+    // Arenas of the exited threads must not add new entries
+    RunThread();
+    RunThread();
+    const auto Stats1 = FrameArena::GetAllStats();
+    ASSERT_EQ(Stats1.size(), Stats0.size());
+    EXPECT_EQ(Stats1.back().NumScopes, Stats0.back().NumScopes + 2);
+}
+
 } // namespace
@@ -29,10 +29,12 @@
 #include <unordered_set>
 #include <array>
 #include <vector>
+#include <iomanip>
 
 #include "HashUtils.hpp"
 #include "XXH128Hasher.hpp"
 #include "GraphicsTypesOutputInserters.hpp"
+#include "Timer.hpp"
 
 #include "gtest/gtest.h"
 
@@ -186,6 +188,77 @@ TEST(Common_HashUtils, ComputeHashRaw)
     }
 }
 
+TEST(Common_HashUtils, ComputeHashRaw64)
+{
+    // Reference XXH3 values: the hash must be the same on all platforms
+    EXPECT_EQ(ComputeHashRaw64(nullptr, 0), Uint64{0x2D06800538D394C2});
+
+    const char Str[] = "Diligent Engine";
+    EXPECT_EQ(ComputeHashRaw64(Str, sizeof(Str) - 1), Uint64{0x884650FFF2077E6D});
+    EXPECT_EQ(ComputeHashRaw64(Str, sizeof(Str) - 1, 42), Uint64{0x0416CC38D5D0BB1D});
+
+    std::vector<Uint8> Data(1024);
+    for (size_t i = 0; i < Data.size(); ++i)
+        Data[i] = static_cast<Uint8>(i * 31 + 7);
+    EXPECT_EQ(ComputeHashRaw64(Data.data(), Data.size()), Uint64{0x23BC880EBF0D29C6});
+    EXPECT_EQ(ComputeHashRaw64(Data.data(), Data.size(), 0x0123456789ABCDEF), Uint64{0x47AF4FE460C9956F});
+
+    EXPECT_EQ(ComputeHashRaw(Data.data(), Data.size()), static_cast<size_t>(ComputeHashRaw64(Data.data(), Data.size())));
+
+    std::unordered_set<Uint64> Hashes;
+    for (Uint64 Seed = 0; Seed < 16; ++Seed)
+    {
+        auto inserted = Hashes.insert(ComputeHashRaw64(Data.data(), Data.size(), Seed)).second;
+        EXPECT_TRUE(inserted) << Seed;
+    }
+}
+
+TEST(Common_HashUtils, ComputeHashRawThroughput)
+{
+    // Reference implementation that combines the data one 32-bit word at a time
+    const auto ComputeHashWordByWord = [](const void* pData, size_t Size) {
+        size_t Hash = 0;
+        for (const auto* DwordPtr = static_cast<const Uint32*>(pData); Size >= sizeof(Uint32); ++DwordPtr, Size -= sizeof(Uint32))
+            HashCombine(Hash, *DwordPtr);
+        return Hash;
+    };
+
+#ifdef DILIGENT_DEBUG
+    constexpr size_t TotalSize = size_t{16} << 20;
+#else
+    constexpr size_t TotalSize = size_t{256} << 20;
+#endif
+
+    std::vector<Uint8> Data(size_t{4} << 20);
+    for (size_t i = 0; i < Data.size(); ++i)
+        Data[i] = static_cast<Uint8>(i * 31 + 7);
+
+    for (size_t Size : {size_t{64}, size_t{4} << 10, size_t{4} << 20})
+    {
+        const size_t NumIterations = std::max(TotalSize / Size, size_t{1});
+
+        Uint64 Hash = 0;
+        Timer  T;
+        for (size_t i = 0; i < NumIterations; ++i)
+            Hash ^= ComputeHashRaw64(Data.data(), Size, i);
+        const double XXH3Time = std::max(T.GetElapsedTime(), 1e-6);
+
+        size_t RefHash = 0;
+        T.Restart();
+        for (size_t i = 0; i < NumIterations; ++i)
+            RefHash ^= ComputeHashWordByWord(Data.data(), Size) + i;
+        const double RefTime = std::max(T.GetElapsedTime(), 1e-6);
+
+        // Prevent the compiler from optimizing out the loops
+        EXPECT_NE(Hash, Uint64{0});
+        EXPECT_NE(RefHash, size_t{0});
+
+        const double GBytes = static_cast<double>(Size) * static_cast<double>(NumIterations) / double{1 << 30};
+        LOG_INFO_MESSAGE("ComputeHashRaw ", Size, " bytes: ", std::fixed, std::setprecision(2), GBytes / XXH3Time,
+                         " GB/s, word-by-word HashCombine: ", GBytes / RefTime, " GB/s");
+    }
+}
+
 
 template <typename Type>
 class StdHasherTestHelper
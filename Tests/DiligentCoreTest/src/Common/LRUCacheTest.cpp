@@ -32,6 +32,8 @@
 #include <functional>
 
 #include "ThreadSignal.hpp"
+#include "FastRand.hpp"
+#include "Timer.hpp"
 
 using namespace Diligent;
 
@@ -43,9 +45,10 @@ struct CacheData
     Uint32 Value = ~0u;
 };
 
-TEST(Common_LRUCache, Get)
+template <typename CacheType>
+void TestGet()
 {
-    LRUCache<int, CacheData> Cache{16};
+    CacheType Cache{16};
 
     constexpr Uint32         NumThreads = 16;
     std::vector<std::thread> Threads(NumThreads);
@@ -81,9 +84,21 @@ TEST(Common_LRUCache, Get)
 }
 
 
-TEST(Common_LRUCache, ReleaseQueue)
+TEST(Common_LRUCache, Get)
+{
+    TestGet<LRUCache<int, CacheData>>();
+}
+
+TEST(Common_LRUCache, Get_Sharded)
+{
+    TestGet<ShardedLRUCache<int, CacheData>>();
+}
+
+
+template <typename CacheType>
+void TestReleaseQueue()
 {
-    LRUCache<int, CacheData> Cache{16};
+    CacheType Cache{16};
 
     constexpr Uint32                    NumThreads = 16;
     std::vector<std::thread>            Threads(NumThreads);
@@ -127,9 +142,21 @@ TEST(Common_LRUCache, ReleaseQueue)
 }
 
 
-TEST(Common_LRUCache, Exceptions)
+TEST(Common_LRUCache, ReleaseQueue)
+{
+    TestReleaseQueue<LRUCache<int, CacheData>>();
+}
+
+TEST(Common_LRUCache, ReleaseQueue_Sharded)
+{
+    TestReleaseQueue<ShardedLRUCache<int, CacheData>>();
+}
+
+
+template <typename CacheType>
+void TestExceptions()
 {
-    LRUCache<int, CacheData> Cache{16};
+    CacheType Cache{16};
 
     constexpr Uint32                    NumThreads = 15; // Use odd number
     std::vector<std::thread>            Threads(NumThreads);
@@ -183,4 +210,116 @@ TEST(Common_LRUCache, Exceptions)
     }
 }
 
+TEST(Common_LRUCache, Exceptions)
+{
+    TestExceptions<LRUCache<int, CacheData>>();
+}
+
+TEST(Common_LRUCache, Exceptions_Sharded)
+{
+    TestExceptions<ShardedLRUCache<int, CacheData>>();
+}
+
+
+TEST(Common_LRUCache, EvictionOrder)
+{
+    LRUCache<int, CacheData> Cache{3};
+
+    std::vector<int> NumInits(8);
+
+    auto Get = [&](int Key) {
+        return Cache.Get(Key,
+                         [&](CacheData& Data, size_t& Size) //
+                         {
+                             ++NumInits[Key];
+                             Data.Value = static_cast<Uint32>(Key);
+                             Size       = 1;
+                         });
+    };
+
+    EXPECT_EQ(Get(0).Value, 0u);
+    EXPECT_EQ(Get(1).Value, 1u);
+    EXPECT_EQ(Get(2).Value, 2u);
+    EXPECT_EQ(Cache.GetCurrSize(), 3u);
+
+    // Make 0 the most recently used element
+    EXPECT_EQ(Get(0).Value, 0u);
+    EXPECT_EQ(NumInits[0], 1);
+
+    // 1 is the least recently used element and must be evicted
+    EXPECT_EQ(Get(3).Value, 3u);
+    EXPECT_EQ(Cache.GetCurrSize(), 3u);
+
+    EXPECT_EQ(Get(0).Value, 0u);
+    EXPECT_EQ(Get(2).Value, 2u);
+    EXPECT_EQ(Get(3).Value, 3u);
+    EXPECT_EQ(NumInits[0], 1);
+    EXPECT_EQ(NumInits[2], 1);
+    EXPECT_EQ(NumInits[3], 1);
+
+    EXPECT_EQ(Get(1).Value, 1u);
+    EXPECT_EQ(NumInits[1], 2);
+}
+
+
+template <typename CacheType>
+double MeasureLookupsPerSecond(Uint32 NumThreads)
+{
+    constexpr int NumKeys = 1024;
+#ifdef DILIGENT_DEBUG
+    constexpr Uint32 NumLookups = 20000;
+#else
+    constexpr Uint32 NumLookups = 200000;
+#endif
+
+    CacheType Cache{NumKeys};
+
+    std::vector<std::thread> Threads(NumThreads);
+    Threading::Signal        StartSignal;
+    std::atomic<Uint32>      NumThreadsReady{0};
+    for (Uint32 i = 0; i < NumThreads; ++i)
+    {
+        Threads[i] = std::thread(
+            [&](Uint32 ThreadId) {
+                NumThreadsReady.fetch_add(1);
+                StartSignal.Wait();
+
+                FastRandInt Rnd{ThreadId, 0, NumKeys - 1};
+                for (Uint32 j = 0; j < NumLookups; ++j)
+                {
+                    const int  Key  = Rnd();
+                    const auto Data = Cache.Get(Key,
+                                                [&](CacheData& Data, size_t& Size) //
+                                                {
+                                                    Data.Value = static_cast<Uint32>(Key);
+                                                    Size       = 1;
+                                                });
+                    VERIFY_EXPR(Data.Value == static_cast<Uint32>(Key));
+                }
+            },
+            i);
+    }
+
+    while (NumThreadsReady.load() < NumThreads)
+        std::this_thread::yield();
+
+    Timer T;
+    StartSignal.Trigger(true);
+    for (auto& Thread : Threads)
+        Thread.join();
+
+    return static_cast<double>(NumThreads) * NumLookups / std::max(T.GetElapsedTime(), 1e-6);
+}
+
+TEST(Common_LRUCache, Contention)
+{
+    for (Uint32 NumThreads : {1, 4, 16})
+    {
+        const double LookupsPerSec        = MeasureLookupsPerSecond<LRUCache<int, CacheData>>(NumThreads);
+        const double ShardedLookupsPerSec = MeasureLookupsPerSecond<ShardedLRUCache<int, CacheData>>(NumThreads);
+        LOG_INFO_MESSAGE(NumThreads, " threads: LRUCache: ", static_cast<Uint64>(LookupsPerSec),
+                         " lookups/s, ShardedLRUCache: ", static_cast<Uint64>(ShardedLookupsPerSec), " lookups/s");
+    }
+}
+
 } // namespace
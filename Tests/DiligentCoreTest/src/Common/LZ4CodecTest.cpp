@@ -0,0 +1,233 @@
+/*
+ *  Copyright 2019-2024 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "LZ4Codec.hpp"
+
+#include <vector>
+#include <string>
+#include <cstring>
+
+#include "FastRand.hpp"
+#include "Timer.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+
+namespace
+{
+
+std::vector<Uint8> Compress(const std::vector<Uint8>& Data)
+{
+    std::vector<Uint8> Compressed(GetLZ4CompressBound(Data.size()));
+
+    const size_t CompressedSize = LZ4CompressBlock(Data.data(), Data.size(), Compressed.data(), Compressed.size());
+    EXPECT_NE(CompressedSize, size_t{0});
+    Compressed.resize(CompressedSize);
+    return Compressed;
+}
+
+void TestRoundTrip(const std::vector<Uint8>& Data)
+{
+    const auto Compressed = Compress(Data);
+
+    std::vector<Uint8> Decompressed(Data.size() + 16);
+    const size_t       DecompressedSize = LZ4DecompressBlock(Compressed.data(), Compressed.size(), Decompressed.data(), Decompressed.size());
+    ASSERT_EQ(DecompressedSize, Data.size());
+    Decompressed.resize(DecompressedSize);
+    EXPECT_EQ(Decompressed, Data);
+
+    // Exact destination size
+    const size_t ExactSize = LZ4DecompressBlock(Compressed.data(), Compressed.size(), Decompressed.data(), Data.size());
+    EXPECT_EQ(ExactSize, Data.size());
+
+    if (!Data.empty())
+    {
+        // Insufficient destination size
+        EXPECT_EQ(LZ4DecompressBlock(Compressed.data(), Compressed.size(), Decompressed.data(), Data.size() - 1), size_t{0});
+    }
+}
+
+// Generates the data that resembles SPIR-V byte code: instructions with a small set of
+// opcodes whose operands are mostly increasing result ids and small constants.
+std::vector<Uint8> GenerateSPIRVLikeData(size_t Size, FastRand::StateType Seed)
+{
+    static constexpr Uint32 Opcodes[] = {
+        61,  // OpLoad
+        62,  // OpStore
+        65,  // OpAccessChain
+        129, // OpFAdd
+        133, // OpFMul
+        79,  // OpVectorShuffle
+        80,  // OpCompositeConstruct
+        81,  // OpCompositeExtract
+    };
+
+    FastRandInt OpRand{Seed, 0, static_cast<int>(sizeof(Opcodes) / sizeof(Opcodes[0])) - 1};
+    FastRandInt OperandRand{Seed + 1, 0, 32};
+
+    std::vector<Uint32> Words{0x07230203, 0x00010300, 0, 0, 0};
+
+    Uint32 NextId = 16;
+    while (Words.size() * sizeof(Uint32) < Size)
+    {
+        const Uint32 Opcode    = Opcodes[OpRand()];
+        const Uint32 WordCount = 3 + (Opcode % 3);
+        Words.push_back((WordCount << 16) | Opcode);
+        Words.push_back(Opcode % 7 + 1); // Result type
+        Words.push_back(NextId++);       // Result id
+        for (Uint32 i = 3; i < WordCount; ++i)
+            Words.push_back(NextId - 1 - static_cast<Uint32>(OperandRand()));
+    }
+
+    std::vector<Uint8> Data(Size);
+    memcpy(Data.data(), Words.data(), Size);
+    return Data;
+}
+
+TEST(Common_LZ4Codec, RoundTrip)
+{
+    TestRoundTrip({});
+    TestRoundTrip({1});
+    TestRoundTrip({1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12});
+    TestRoundTrip(std::vector<Uint8>(13, 7));
+    TestRoundTrip(std::vector<Uint8>(100000, 7));
+
+    {
+        // Repeating patterns shorter than 8 bytes produce overlapping matches
+        for (size_t Period = 1; Period <= 17; ++Period)
+        {
+            std::vector<Uint8> Data(1000);
+            for (size_t i = 0; i < Data.size(); ++i)
+                Data[i] = static_cast<Uint8>(i % Period);
+            TestRoundTrip(Data);
+        }
+    }
+
+    {
+        // Incompressible data
+        FastRandInt        Rnd{0, 0, 255};
+        std::vector<Uint8> Data(100000);
+        for (auto& Byte : Data)
+            Byte = static_cast<Uint8>(Rnd());
+        TestRoundTrip(Data);
+    }
+
+    {
+        // Long literal runs followed by matches beyond the maximum offset
+        FastRandInt        Rnd{1, 0, 255};
+        std::vector<Uint8> Data(200000);
+        for (size_t i = 0; i < Data.size(); ++i)
+            Data[i] = (i / 1000) % 2 == 0 ? static_cast<Uint8>(Rnd()) : static_cast<Uint8>(i % 251);
+        TestRoundTrip(Data);
+    }
+
+    for (size_t Size : {16, 100, 4096, 65536 + 17, 1 << 20})
+        TestRoundTrip(GenerateSPIRVLikeData(Size, static_cast<FastRand::StateType>(Size)));
+}
+
+TEST(Common_LZ4Codec, Decompress)
+{
+    // Literals 'abc', match of length 6 at offset 3, last literals '12345'
+    const Uint8 Block[] = {0x32, 'a', 'b', 'c', 0x03, 0x00, 0x50, '1', '2', '3', '4', '5'};
+
+    char         Decompressed[32] = {};
+    const size_t Size             = LZ4DecompressBlock(Block, sizeof(Block), Decompressed, sizeof(Decompressed));
+    EXPECT_EQ(std::string(Decompressed, Size), "abcabcabc12345");
+}
+
+TEST(Common_LZ4Codec, InvalidData)
+{
+    const auto Data       = GenerateSPIRVLikeData(4096, 0);
+    const auto Compressed = Compress(Data);
+
+    std::vector<Uint8> Decompressed(Data.size());
+
+    // Truncated data. The block does not store the decompressed size, so a block truncated
+    // after the literals is decoded as a shorter block.
+    for (size_t Size = 0; Size < Compressed.size(); Size += 7)
+        EXPECT_LT(LZ4DecompressBlock(Compressed.data(), Size, Decompressed.data(), Decompressed.size()), Data.size());
+
+    // Corrupted data must never read or write out of bounds
+    FastRandInt Rnd{2, 0, 255};
+    for (size_t i = 0; i < 1000; ++i)
+    {
+        auto Corrupted = Compressed;
+        for (int j = 0; j < 4; ++j)
+            Corrupted[Rnd() * Corrupted.size() / 256] = static_cast<Uint8>(Rnd());
+        LZ4DecompressBlock(Corrupted.data(), Corrupted.size(), Decompressed.data(), Decompressed.size());
+    }
+
+    // Zero offset
+    const Uint8 ZeroOffset[] = {0x10, 'a', 0x00, 0x00, 0x50, '1', '2', '3', '4', '5'};
+    EXPECT_EQ(LZ4DecompressBlock(ZeroOffset, sizeof(ZeroOffset), Decompressed.data(), Decompressed.size()), size_t{0});
+
+    // Offset beyond the beginning of the output
+    const Uint8 LargeOffset[] = {0x10, 'a', 0x02, 0x00, 0x50, '1', '2', '3', '4', '5'};
+    EXPECT_EQ(LZ4DecompressBlock(LargeOffset, sizeof(LargeOffset), Decompressed.data(), Decompressed.size()), size_t{0});
+
+    // Insufficient compression buffer
+    std::vector<Uint8> SmallBuffer(Compressed.size() - 1);
+    EXPECT_EQ(LZ4CompressBlock(Data.data(), Data.size(), SmallBuffer.data(), SmallBuffer.size()), size_t{0});
+}
+
+TEST(Common_LZ4Codec, Performance)
+{
+#ifdef DILIGENT_DEBUG
+    constexpr size_t DataSize = 1 << 20;
+#else
+    constexpr size_t DataSize = 16 << 20;
+#endif
+    constexpr int NumIterations = 10;
+
+    const auto Data = GenerateSPIRVLikeData(DataSize, 0);
+
+    std::vector<Uint8> Compressed(GetLZ4CompressBound(DataSize));
+
+    size_t CompressedSize = 0;
+    Timer  T;
+    for (int i = 0; i < NumIterations; ++i)
+        CompressedSize = LZ4CompressBlock(Data.data(), Data.size(), Compressed.data(), Compressed.size());
+    const double CompressTime = T.GetElapsedTime() / NumIterations;
+    ASSERT_NE(CompressedSize, size_t{0});
+
+    std::vector<Uint8> Decompressed(DataSize);
+
+    size_t DecompressedSize = 0;
+    T.Restart();
+    for (int i = 0; i < NumIterations; ++i)
+        DecompressedSize = LZ4DecompressBlock(Compressed.data(), CompressedSize, Decompressed.data(), Decompressed.size());
+    const double DecompressTime = T.GetElapsedTime() / NumIterations;
+    ASSERT_EQ(DecompressedSize, DataSize);
+    EXPECT_EQ(Decompressed, Data);
+
+    constexpr double MB = 1 << 20;
+    LOG_INFO_MESSAGE("LZ4 SPIR-V-like data: ", DataSize / MB, " MB -> ", CompressedSize / MB, " MB (ratio ", static_cast<double>(DataSize) / CompressedSize,
+                     "), compression: ", DataSize / MB / CompressTime, " MB/s, decompression: ", DataSize / MB / DecompressTime, " MB/s");
+}
+
+} // namespace
@@ -27,9 +27,13 @@
 
 #include <climits>
 #include <sstream>
+#include <vector>
 
 #include "BasicMath.hpp"
 #include "AdvancedMath.hpp"
+#include "FastRand.hpp"
+#include "ThreadPool.hpp"
+#include "Timer.hpp"
 
 #include "gtest/gtest.h"
 
@@ -3301,4 +3305,273 @@ TEST(Common_AdvancedMath, TriangulatePolygon3D)
     }
 }
 
+struct BoxCullingTestData
+{
+    ViewFrustumExt Frustum;
+
+    std::vector<BoundBox>            AABBs;
+    std::vector<OrientedBoundingBox> OBBs;
+
+    // AABB min/max streams
+    std::vector<float> Min[3];
+    std::vector<float> Max[3];
+
+    // AABB center/extents streams
+    std::vector<float> Center[3];
+    std::vector<float> HalfExtents[3];
+
+    // OBB streams
+    std::vector<float> OBBCenter[3];
+    std::vector<float> OBBAxes[3][3];
+    std::vector<float> OBBHalfExtents[3];
+
+    explicit BoxCullingTestData(Uint32 NumBoxes)
+    {
+        const auto View = float4x4::Translation(3, -2, 10) * float4x4::RotationY(0.3f) * float4x4::RotationX(-0.2f);
+        const auto Proj = float4x4::Projection(PI_F / 4.f, 1.5f, 1.f, 100.f, false);
+        ExtractViewFrustumPlanesFromMatrix(View * Proj, Frustum, false);
+
+        FastRandFloat rnd{0, 0, 1};
+        for (Uint32 i = 0; i < NumBoxes; ++i)
+        {
+            const float3 BoxCenter{rnd() * 160.f - 80.f, rnd() * 160.f - 80.f, rnd() * 160.f - 40.f};
+            const float3 BoxExtents{rnd() * 10.f + 0.01f, rnd() * 10.f + 0.01f, rnd() * 10.f + 0.01f};
+
+            BoundBox AABB{BoxCenter - BoxExtents, BoxCenter + BoxExtents};
+            AABBs.push_back(AABB);
+            for (Uint32 c = 0; c < 3; ++c)
+            {
+                Min[c].push_back(AABB.Min[c]);
+                Max[c].push_back(AABB.Max[c]);
+                Center[c].push_back(BoxCenter[c]);
+                HalfExtents[c].push_back(BoxExtents[c]);
+            }
+
+            const auto Rotation = float4x4::RotationArbitrary(normalize(float3{rnd() - 0.5f, rnd() - 0.5f, rnd() - 0.5f} + float3{0, 0.01f, 0}), rnd() * 6.f);
+
+            OrientedBoundingBox OBB;
+            OBB.Center = BoxCenter;
+            for (Uint32 a = 0; a < 3; ++a)
+            {
+                OBB.Axes[a]        = float3::MakeVector(Rotation[a]);
+                OBB.HalfExtents[a] = BoxExtents[a];
+                for (Uint32 c = 0; c < 3; ++c)
+                    OBBAxes[a][c].push_back(OBB.Axes[a][c]);
+                OBBCenter[a].push_back(OBB.Center[a]);
+                OBBHalfExtents[a].push_back(OBB.HalfExtents[a]);
+            }
+            OBBs.push_back(OBB);
+        }
+    }
+
+    BoundBoxMinMaxSOA GetMinMaxSOA() const
+    {
+        BoundBoxMinMaxSOA SOA;
+        for (Uint32 c = 0; c < 3; ++c)
+        {
+            SOA.Min[c] = Min[c].data();
+            SOA.Max[c] = Max[c].data();
+        }
+        return SOA;
+    }
+
+    BoundBoxCenterExtentsSOA GetCenterExtentsSOA() const
+    {
+        BoundBoxCenterExtentsSOA SOA;
+        for (Uint32 c = 0; c < 3; ++c)
+        {
+            SOA.Center[c]      = Center[c].data();
+            SOA.HalfExtents[c] = HalfExtents[c].data();
+        }
+        return SOA;
+    }
+
+    OrientedBoundingBoxSOA GetOrientedSOA() const
+    {
+        OrientedBoundingBoxSOA SOA;
+        for (Uint32 a = 0; a < 3; ++a)
+        {
+            SOA.Center[a]      = OBBCenter[a].data();
+            SOA.HalfExtents[a] = OBBHalfExtents[a].data();
+            for (Uint32 c = 0; c < 3; ++c)
+                SOA.Axes[a][c] = OBBAxes[a][c].data();
+        }
+        return SOA;
+    }
+};
+
+template <typename FrustumType, typename BoxesType, typename RefVisibilityFuncType>
+void TestGetBoxesVisibility(const FrustumType& Frustum, const BoxesType& Boxes, Uint32 NumBoxes, RefVisibilityFuncType&& GetRefVisibility)
+{
+    auto pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{2});
+    for (IThreadPool* pPool : {static_cast<IThreadPool*>(nullptr), pThreadPool.RawPtr()})
+    {
+        for (auto PlaneFlags : {FRUSTUM_PLANE_FLAG_FULL_FRUSTUM, FRUSTUM_PLANE_FLAG_OPEN_NEAR})
+        {
+            std::vector<BoxVisibility> Visibility(NumBoxes);
+            std::vector<Uint32>        Mask((NumBoxes + 31) / 32, 0xDEADBEEF);
+            std::vector<Uint32>        Indices(NumBoxes);
+
+            GetBoxesVisibilityAttribs Attribs;
+            Attribs.NumBoxes        = NumBoxes;
+            Attribs.PlaneFlags      = PlaneFlags;
+            Attribs.pVisibility     = Visibility.data();
+            Attribs.pVisibilityMask = Mask.data();
+            Attribs.pVisibleIndices = Indices.data();
+            Attribs.pThreadPool     = pPool;
+
+            const Uint32 NumVisible = GetBoxesVisibility(Frustum, Boxes, Attribs);
+
+            std::vector<Uint32> RefIndices;
+            Uint32              Counts[3] = {};
+            for (Uint32 i = 0; i < NumBoxes; ++i)
+            {
+                const auto RefVisibility = GetRefVisibility(i, PlaneFlags);
+                ASSERT_EQ(Visibility[i], RefVisibility) << "Box " << i;
+                ASSERT_EQ((Mask[i / 32] & (1u << (i % 32))) != 0, RefVisibility != BoxVisibility::Invisible) << "Box " << i;
+                if (RefVisibility != BoxVisibility::Invisible)
+                    RefIndices.push_back(i);
+                ++Counts[static_cast<int>(RefVisibility)];
+            }
+            ASSERT_EQ(NumVisible, RefIndices.size());
+            Indices.resize(NumVisible);
+            EXPECT_EQ(Indices, RefIndices);
+
+            // Make sure the test is not trivial
+            EXPECT_GT(Counts[static_cast<int>(BoxVisibility::Invisible)], 0u);
+            EXPECT_GT(Counts[static_cast<int>(BoxVisibility::Intersecting)], 0u);
+            EXPECT_GT(Counts[static_cast<int>(BoxVisibility::FullyVisible)], 0u);
+
+            // Only the number of visible boxes
+            Attribs.pVisibility     = nullptr;
+            Attribs.pVisibilityMask = nullptr;
+            Attribs.pVisibleIndices = nullptr;
+            EXPECT_EQ(GetBoxesVisibility(Frustum, Boxes, Attribs), NumVisible);
+        }
+    }
+}
+
+TEST(Common_AdvancedMath, GetBoxesVisibility)
+{
+    constexpr Uint32 NumBoxes = 10000 + 13;
+
+    const BoxCullingTestData Data{NumBoxes};
+
+    const ViewFrustum&    Frustum    = Data.Frustum;
+    const ViewFrustumExt& FrustumExt = Data.Frustum;
+
+    auto GetAABBVisibility = [&](Uint32 i, FRUSTUM_PLANE_FLAGS PlaneFlags) {
+        return GetBoxVisibility(Frustum, Data.AABBs[i], PlaneFlags);
+    };
+    auto GetAABBVisibilityExt = [&](Uint32 i, FRUSTUM_PLANE_FLAGS PlaneFlags) {
+        return GetBoxVisibility(FrustumExt, Data.AABBs[i], PlaneFlags);
+    };
+    TestGetBoxesVisibility(Frustum, Data.GetMinMaxSOA(), NumBoxes, GetAABBVisibility);
+    TestGetBoxesVisibility(Frustum, Data.AABBs.data(), NumBoxes, GetAABBVisibility);
+    TestGetBoxesVisibility(FrustumExt, Data.GetMinMaxSOA(), NumBoxes, GetAABBVisibilityExt);
+    TestGetBoxesVisibility(FrustumExt, Data.AABBs.data(), NumBoxes, GetAABBVisibilityExt);
+
+    // Boxes defined by center and extents are equivalent to oriented boxes with identity axes
+    std::vector<OrientedBoundingBox> IdentityOBBs(NumBoxes);
+    for (Uint32 i = 0; i < NumBoxes; ++i)
+    {
+        auto& OBB   = IdentityOBBs[i];
+        OBB.Center  = float3{Data.Center[0][i], Data.Center[1][i], Data.Center[2][i]};
+        OBB.Axes[0] = float3{1, 0, 0};
+        OBB.Axes[1] = float3{0, 1, 0};
+        OBB.Axes[2] = float3{0, 0, 1};
+        for (Uint32 a = 0; a < 3; ++a)
+            OBB.HalfExtents[a] = Data.HalfExtents[a][i];
+    }
+    TestGetBoxesVisibility(Frustum, Data.GetCenterExtentsSOA(), NumBoxes,
+                           [&](Uint32 i, FRUSTUM_PLANE_FLAGS PlaneFlags) {
+                               return GetBoxVisibility(Frustum, IdentityOBBs[i], PlaneFlags);
+                           });
+    TestGetBoxesVisibility(FrustumExt, Data.GetCenterExtentsSOA(), NumBoxes,
+                           [&](Uint32 i, FRUSTUM_PLANE_FLAGS PlaneFlags) {
+                               return GetBoxVisibility(FrustumExt, IdentityOBBs[i], PlaneFlags);
+                           });
+
+    TestGetBoxesVisibility(Frustum, Data.GetOrientedSOA(), NumBoxes,
+                           [&](Uint32 i, FRUSTUM_PLANE_FLAGS PlaneFlags) {
+                               return GetBoxVisibility(Frustum, Data.OBBs[i], PlaneFlags);
+                           });
+    TestGetBoxesVisibility(FrustumExt, Data.GetOrientedSOA(), NumBoxes,
+                           [&](Uint32 i, FRUSTUM_PLANE_FLAGS PlaneFlags) {
+                               return GetBoxVisibility(FrustumExt, Data.OBBs[i], PlaneFlags);
+                           });
+}
+
+TEST(Common_AdvancedMath, GetBoxesVisibilityPerformance)
+{
+#ifdef DILIGENT_DEBUG
+    constexpr Uint32 NumBoxes = 10000;
+#else
+    constexpr Uint32 NumBoxes = 200000;
+#endif
+    constexpr int NumIterations = 10;
+
+    const BoxCullingTestData Data{NumBoxes};
+
+    std::vector<Uint32> Indices(NumBoxes);
+
+    auto pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{4});
+
+    auto Measure = [&](const char* Name, auto&& Cull) {
+        Uint32 NumVisible = 0;
+        Timer  T;
+        for (int i = 0; i < NumIterations; ++i)
+            NumVisible = Cull();
+        const double Time = T.GetElapsedTime() / NumIterations;
+        LOG_INFO_MESSAGE(Name, ": ", Time * 1000.0, " ms per ", NumBoxes, " boxes (", NumVisible, " visible)");
+        return NumVisible;
+    };
+
+    auto CullBatch = [&](const auto& Frustum, const auto& Boxes, IThreadPool* pPool) {
+        GetBoxesVisibilityAttribs Attribs;
+        Attribs.NumBoxes        = NumBoxes;
+        Attribs.pVisibleIndices = Indices.data();
+        Attribs.pThreadPool     = pPool;
+        return GetBoxesVisibility(Frustum, Boxes, Attribs);
+    };
+
+    const ViewFrustum&    Frustum    = Data.Frustum;
+    const ViewFrustumExt& FrustumExt = Data.Frustum;
+
+    const Uint32 RefNumVisible = Measure("AABB, per-box", [&]() {
+        Uint32 NumVisible = 0;
+        for (Uint32 i = 0; i < NumBoxes; ++i)
+        {
+            if (GetBoxVisibility(Frustum, Data.AABBs[i]) != BoxVisibility::Invisible)
+                Indices[NumVisible++] = i;
+        }
+        return NumVisible;
+    });
+    EXPECT_EQ(Measure("AABB, batch SOA", [&]() { return CullBatch(Frustum, Data.GetMinMaxSOA(), nullptr); }), RefNumVisible);
+    EXPECT_EQ(Measure("AABB, batch array", [&]() { return CullBatch(Frustum, Data.AABBs.data(), nullptr); }), RefNumVisible);
+    EXPECT_EQ(Measure("AABB, batch SOA, thread pool", [&]() { return CullBatch(Frustum, Data.GetMinMaxSOA(), pThreadPool); }), RefNumVisible);
+
+    const Uint32 RefNumVisibleExt = Measure("AABB ext, per-box", [&]() {
+        Uint32 NumVisible = 0;
+        for (Uint32 i = 0; i < NumBoxes; ++i)
+        {
+            if (GetBoxVisibility(FrustumExt, Data.AABBs[i]) != BoxVisibility::Invisible)
+                Indices[NumVisible++] = i;
+        }
+        return NumVisible;
+    });
+    EXPECT_EQ(Measure("AABB ext, batch SOA", [&]() { return CullBatch(FrustumExt, Data.GetMinMaxSOA(), nullptr); }), RefNumVisibleExt);
+
+    const Uint32 RefNumVisibleOBB = Measure("OBB, per-box", [&]() {
+        Uint32 NumVisible = 0;
+        for (Uint32 i = 0; i < NumBoxes; ++i)
+        {
+            if (GetBoxVisibility(Frustum, Data.OBBs[i]) != BoxVisibility::Invisible)
+                Indices[NumVisible++] = i;
+        }
+        return NumVisible;
+    });
+    EXPECT_EQ(Measure("OBB, batch SOA", [&]() { return CullBatch(Frustum, Data.GetOrientedSOA(), nullptr); }), RefNumVisibleOBB);
+}
+
 } // namespace
@@ -39,11 +39,12 @@ using namespace Diligent;
 namespace
 {
 
-TEST(Common_ThreadPool, EnqueueTask)
+void TestEnqueueTask(THREAD_POOL_SCHEDULING_MODE SchedulingMode)
 {
     constexpr Uint32     NumThreads = 4;
     constexpr Uint32     NumTasks   = 32;
     ThreadPoolCreateInfo PoolCI{NumThreads};
+    PoolCI.SchedulingMode = SchedulingMode;
 
     std::array<std::atomic<bool>, NumThreads> ThreadStarted{};
 
@@ -98,13 +99,26 @@ TEST(Common_ThreadPool, EnqueueTask)
     EXPECT_EQ(NumThreadsFinished.load(), PoolCI.NumThreads);
 }
 
+TEST(Common_ThreadPool, EnqueueTask)
+{
+    TestEnqueueTask(THREAD_POOL_SCHEDULING_MODE_PRIORITY_QUEUE);
+}
 
-TEST(Common_ThreadPool, ProcessTask)
+TEST(Common_ThreadPool, EnqueueTask_WorkStealing)
+{
+    TestEnqueueTask(THREAD_POOL_SCHEDULING_MODE_WORK_STEALING);
+}
+
+
+void TestProcessTask(THREAD_POOL_SCHEDULING_MODE SchedulingMode)
 {
     constexpr Uint32 NumThreads = 4;
     constexpr Uint32 NumTasks   = 32;
 
-    auto pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{0});
+    ThreadPoolCreateInfo PoolCI{0};
+    PoolCI.SchedulingMode = SchedulingMode;
+
+    auto pThreadPool = CreateThreadPool(PoolCI);
     ASSERT_NE(pThreadPool, nullptr);
 
     std::vector<std::thread> WorkerThreads(NumThreads);
@@ -160,6 +174,16 @@ TEST(Common_ThreadPool, ProcessTask)
     }
 }
 
+TEST(Common_ThreadPool, ProcessTask)
+{
+    TestProcessTask(THREAD_POOL_SCHEDULING_MODE_PRIORITY_QUEUE);
+}
+
+TEST(Common_ThreadPool, ProcessTask_WorkStealing)
+{
+    TestProcessTask(THREAD_POOL_SCHEDULING_MODE_WORK_STEALING);
+}
+
 class WaitTask : public AsyncTaskBase
 {
 public:
@@ -193,6 +217,14 @@ public:
     }
 };
 
+// Returns the tag that the thread pool associates with the task
+Uint64 GetThreadPoolTag(IAsyncTask* pTask)
+{
+    RefCntAutoPtr<AsyncTaskBase> pTaskBase{pTask, AsyncTaskBase::IID_InternalImpl};
+    VERIFY_EXPR(pTaskBase != nullptr);
+    return pTaskBase->GetThreadPoolTag().load();
+}
+
 TEST(Common_ThreadPool, RemoveTask)
 {
     constexpr Uint32 NumThreads = 4;
@@ -295,15 +327,18 @@ TEST(Common_ThreadPool, Reprioritize)
 }
 
 
-TEST(Common_ThreadPool, Priorities)
+void TestPriorities(THREAD_POOL_SCHEDULING_MODE SchedulingMode)
 {
     constexpr Uint32 NumThreads  = 1;
     constexpr Uint32 NumTasks    = 8;
     constexpr Uint32 RepeatCount = 10;
 
+    ThreadPoolCreateInfo PoolCI{NumThreads};
+    PoolCI.SchedulingMode = SchedulingMode;
+
     for (Uint32 k = 0; k < RepeatCount; ++k)
     {
-        auto pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{NumThreads});
+        auto pThreadPool = CreateThreadPool(PoolCI);
         ASSERT_NE(pThreadPool, nullptr);
 
         Threading::Signal       Signal;
@@ -356,12 +391,27 @@ TEST(Common_ThreadPool, Priorities)
     }
 }
 
+TEST(Common_ThreadPool, Priorities)
+{
+    TestPriorities(THREAD_POOL_SCHEDULING_MODE_PRIORITY_QUEUE);
+}
 
-TEST(Common_ThreadPool, Prerequisites)
+// With a single thread, the work-stealing pool has a single queue and
+// must produce the same order after ReprioritizeAllTasks().
+TEST(Common_ThreadPool, Priorities_WorkStealing)
+{
+    TestPriorities(THREAD_POOL_SCHEDULING_MODE_WORK_STEALING);
+}
+
+
+void TestPrerequisites(THREAD_POOL_SCHEDULING_MODE SchedulingMode)
 {
     for (Uint32 NumThreads : {1, 8})
     {
-        auto pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{NumThreads});
+        ThreadPoolCreateInfo PoolCI{NumThreads};
+        PoolCI.SchedulingMode = SchedulingMode;
+
+        auto pThreadPool = CreateThreadPool(PoolCI);
         ASSERT_NE(pThreadPool, nullptr);
 
         constexpr Uint32               NumTasks = 16;
@@ -407,4 +457,389 @@ TEST(Common_ThreadPool, Prerequisites)
     }
 }
 
+TEST(Common_ThreadPool, Prerequisites)
+{
+    TestPrerequisites(THREAD_POOL_SCHEDULING_MODE_PRIORITY_QUEUE);
+}
+
+TEST(Common_ThreadPool, Prerequisites_WorkStealing)
+{
+    TestPrerequisites(THREAD_POOL_SCHEDULING_MODE_WORK_STEALING);
+}
+
+
+void TestDependencyChain(THREAD_POOL_SCHEDULING_MODE SchedulingMode)
+{
+    for (Uint32 NumThreads : {1, 4})
+    {
+        ThreadPoolCreateInfo PoolCI{NumThreads};
+        PoolCI.SchedulingMode = SchedulingMode;
+
+        auto pThreadPool = CreateThreadPool(PoolCI);
+        ASSERT_NE(pThreadPool, nullptr);
+
+        Threading::Signal       Signal;
+        RefCntAutoPtr<WaitTask> pGateTask{MakeNewRCObj<WaitTask>()(Signal)};
+        pThreadPool->EnqueueTask(pGateTask);
+        pGateTask->WaitUntilRunning();
+
+        constexpr Uint32                       NumTasks = 256;
+        std::vector<RefCntAutoPtr<IAsyncTask>> Tasks(NumTasks);
+        std::vector<Uint32>                    CompletionOrder;
+        CompletionOrder.reserve(NumTasks);
+        for (Uint32 i = 0; i < NumTasks; ++i)
+        {
+            // Every task depends on the previous one, and the first task depends on the gate task
+            IAsyncTask* pPrereq = i > 0 ? Tasks[i - 1].RawPtr() : pGateTask.RawPtr();
+            Tasks[i] =
+                EnqueueAsyncWork(pThreadPool, &pPrereq, 1,
+                                 [i, &CompletionOrder](Uint32 ThreadId) //
+                                 {
+                                     CompletionOrder.push_back(i);
+                                 });
+        }
+
+        // Tasks that wait for prerequisites are counted as queued
+        EXPECT_EQ(pThreadPool->GetQueueSize(), NumTasks);
+        // The priority of the pending task will be used when the task is placed into the queue
+        EXPECT_TRUE(pThreadPool->ReprioritizeTask(Tasks[NumTasks / 2]));
+
+        // Remove the last task that waits for its prerequisites
+        EXPECT_TRUE(pThreadPool->RemoveTask(Tasks[NumTasks - 1]));
+        EXPECT_EQ(pThreadPool->GetQueueSize(), NumTasks - 1);
+        // WaitForTask must return immediately for the removed task
+        pThreadPool->WaitForTask(Tasks[NumTasks - 1]);
+
+        Signal.Trigger(true, 1);
+
+        pThreadPool->WaitForTask(Tasks[NumTasks - 2]);
+        EXPECT_TRUE(Tasks[NumTasks - 2]->IsFinished());
+
+        pThreadPool->WaitForAllTasks();
+        EXPECT_EQ(pThreadPool->GetQueueSize(), 0u);
+        EXPECT_EQ(Tasks[NumTasks - 1]->GetStatus(), ASYNC_TASK_STATUS_NOT_STARTED);
+
+        // Finished and removed tasks are no longer tagged by the thread pool
+        EXPECT_EQ(GetThreadPoolTag(pGateTask), Uint64{0});
+        for (const auto& pTask : Tasks)
+            EXPECT_EQ(GetThreadPoolTag(pTask), Uint64{0});
+
+        ASSERT_EQ(CompletionOrder.size(), NumTasks - 1);
+        for (Uint32 i = 0; i < CompletionOrder.size(); ++i)
+            EXPECT_EQ(CompletionOrder[i], i);
+    }
+}
+
+TEST(Common_ThreadPool, DependencyChain)
+{
+    TestDependencyChain(THREAD_POOL_SCHEDULING_MODE_PRIORITY_QUEUE);
+}
+
+TEST(Common_ThreadPool, DependencyChain_WorkStealing)
+{
+    TestDependencyChain(THREAD_POOL_SCHEDULING_MODE_WORK_STEALING);
+}
+
+
+void TestLatePrerequisites(THREAD_POOL_SCHEDULING_MODE SchedulingMode)
+{
+    ThreadPoolCreateInfo PoolCI{4};
+    PoolCI.SchedulingMode = SchedulingMode;
+
+    auto pThreadPool = CreateThreadPool(PoolCI);
+    ASSERT_NE(pThreadPool, nullptr);
+
+    // Tasks without prerequisites are only registered in the dependency graph when they are
+    // used as prerequisites, which may happen while the task is running or has just finished.
+    constexpr Uint32 NumTasks = 4096;
+
+    std::vector<RefCntAutoPtr<IAsyncTask>> Tasks(NumTasks);
+    std::atomic<Uint32>                    NumOutOfOrder{0};
+    for (Uint32 i = 0; i < NumTasks; i += 2)
+    {
+        Tasks[i] = EnqueueAsyncWork(pThreadPool, [](Uint32 ThreadId) {});
+
+        IAsyncTask* pPrereq = Tasks[i];
+        Tasks[i + 1] =
+            EnqueueAsyncWork(pThreadPool, &pPrereq, 1,
+                             [pPrereq, &NumOutOfOrder](Uint32 ThreadId) //
+                             {
+                                 if (!pPrereq->IsFinished())
+                                     NumOutOfOrder.fetch_add(1);
+                             });
+    }
+
+    pThreadPool->WaitForAllTasks();
+    EXPECT_EQ(NumOutOfOrder.load(), 0u);
+    EXPECT_EQ(pThreadPool->GetQueueSize(), 0u);
+    for (const auto& pTask : Tasks)
+    {
+        EXPECT_TRUE(pTask->IsFinished());
+        EXPECT_EQ(GetThreadPoolTag(pTask), Uint64{0});
+    }
+}
+
+TEST(Common_ThreadPool, LatePrerequisites)
+{
+    TestLatePrerequisites(THREAD_POOL_SCHEDULING_MODE_PRIORITY_QUEUE);
+}
+
+TEST(Common_ThreadPool, LatePrerequisites_WorkStealing)
+{
+    TestLatePrerequisites(THREAD_POOL_SCHEDULING_MODE_WORK_STEALING);
+}
+
+
+// IAsyncTask implementation that is not derived from AsyncTaskBase
+class CustomTask final : public ObjectBase<IAsyncTask>
+{
+public:
+    using TBase = ObjectBase<IAsyncTask>;
+    CustomTask(IReferenceCounters*   pRefCounters,
+               std::function<void()> Handler) :
+        TBase{pRefCounters},
+        m_Handler{std::move(Handler)}
+    {}
+
+    IMPLEMENT_QUERY_INTERFACE_IN_PLACE(IID_AsyncTask, TBase)
+
+    virtual void DILIGENT_CALL_TYPE Run(Uint32 ThreadId) override final
+    {
+        m_Handler();
+        SetStatus(ASYNC_TASK_STATUS_COMPLETE);
+    }
+
+    virtual void DILIGENT_CALL_TYPE Cancel() override final {}
+
+    virtual void DILIGENT_CALL_TYPE SetStatus(ASYNC_TASK_STATUS TaskStatus) override final
+    {
+        m_TaskStatus.store(TaskStatus);
+    }
+
+    virtual ASYNC_TASK_STATUS DILIGENT_CALL_TYPE GetStatus() const override final
+    {
+        return m_TaskStatus.load();
+    }
+
+    virtual void DILIGENT_CALL_TYPE SetPriority(float fPriority) override final {}
+
+    virtual float DILIGENT_CALL_TYPE GetPriority() const override final
+    {
+        return 0;
+    }
+
+    virtual bool DILIGENT_CALL_TYPE IsFinished() const override final
+    {
+        return m_TaskStatus.load() >= ASYNC_TASK_STATUS_CANCELLED;
+    }
+
+    virtual void DILIGENT_CALL_TYPE WaitForCompletion() const override final
+    {
+        while (!IsFinished())
+            std::this_thread::yield();
+    }
+
+    virtual void DILIGENT_CALL_TYPE WaitUntilRunning() const override final
+    {
+        while (GetStatus() == ASYNC_TASK_STATUS_NOT_STARTED)
+            std::this_thread::yield();
+    }
+
+private:
+    const std::function<void()>    m_Handler;
+    std::atomic<ASYNC_TASK_STATUS> m_TaskStatus{ASYNC_TASK_STATUS_NOT_STARTED};
+};
+
+void TestCustomTasks(THREAD_POOL_SCHEDULING_MODE SchedulingMode)
+{
+    ThreadPoolCreateInfo PoolCI{4};
+    PoolCI.SchedulingMode = SchedulingMode;
+
+    auto pThreadPool = CreateThreadPool(PoolCI);
+    ASSERT_NE(pThreadPool, nullptr);
+
+    Threading::Signal       Signal;
+    RefCntAutoPtr<WaitTask> pGateTask{MakeNewRCObj<WaitTask>()(Signal)};
+    pThreadPool->EnqueueTask(pGateTask);
+
+    // Custom tasks alternate with the tasks derived from AsyncTaskBase in the chain
+    constexpr Uint32 NumTasks = 64;
+
+    std::vector<RefCntAutoPtr<IAsyncTask>> Tasks(NumTasks);
+    std::vector<Uint32>                    CompletionOrder;
+    CompletionOrder.reserve(NumTasks);
+    for (Uint32 i = 0; i < NumTasks; ++i)
+    {
+        IAsyncTask* pPrereq = i > 0 ? Tasks[i - 1].RawPtr() : pGateTask.RawPtr();
+        if (i % 2 == 1)
+        {
+            Tasks[i] = MakeNewRCObj<CustomTask>()([i, &CompletionOrder]() { CompletionOrder.push_back(i); });
+            pThreadPool->EnqueueTask(Tasks[i], &pPrereq, 1);
+        }
+        else
+        {
+            Tasks[i] = EnqueueAsyncWork(pThreadPool, &pPrereq, 1,
+                                        [i, &CompletionOrder](Uint32 ThreadId) //
+                                        {
+                                            CompletionOrder.push_back(i);
+                                        });
+        }
+    }
+
+    // Remove the last custom task that waits for its prerequisites
+    EXPECT_TRUE(pThreadPool->RemoveTask(Tasks[NumTasks - 1]));
+    EXPECT_FALSE(pThreadPool->RemoveTask(Tasks[NumTasks - 1]));
+    pThreadPool->WaitForTask(Tasks[NumTasks - 1]);
+
+    Signal.Trigger(true, 1);
+
+    pThreadPool->WaitForTask(Tasks[NumTasks - 2]);
+    EXPECT_TRUE(Tasks[NumTasks - 2]->IsFinished());
+
+    pThreadPool->WaitForAllTasks();
+    EXPECT_EQ(pThreadPool->GetQueueSize(), 0u);
+    EXPECT_EQ(Tasks[NumTasks - 1]->GetStatus(), ASYNC_TASK_STATUS_NOT_STARTED);
+
+    ASSERT_EQ(CompletionOrder.size(), NumTasks - 1);
+    for (Uint32 i = 0; i < CompletionOrder.size(); ++i)
+        EXPECT_EQ(CompletionOrder[i], i);
+}
+
+TEST(Common_ThreadPool, CustomTasks)
+{
+    TestCustomTasks(THREAD_POOL_SCHEDULING_MODE_PRIORITY_QUEUE);
+}
+
+TEST(Common_ThreadPool, CustomTasks_WorkStealing)
+{
+    TestCustomTasks(THREAD_POOL_SCHEDULING_MODE_WORK_STEALING);
+}
+
+
+TEST(Common_ThreadPool, ExternalPrerequisites)
+{
+    // Prerequisites enqueued into a different thread pool are checked when the task is dequeued
+    auto pThreadPool0 = CreateThreadPool(ThreadPoolCreateInfo{1});
+    auto pThreadPool1 = CreateThreadPool(ThreadPoolCreateInfo{2});
+    ASSERT_NE(pThreadPool0, nullptr);
+    ASSERT_NE(pThreadPool1, nullptr);
+
+    Threading::Signal       Signal;
+    RefCntAutoPtr<WaitTask> pGateTask{MakeNewRCObj<WaitTask>()(Signal)};
+    pThreadPool0->EnqueueTask(pGateTask);
+
+    std::atomic<bool> GateFinished{false};
+    std::atomic<bool> CorrectOrder{false};
+
+    IAsyncTask* pPrereq = pGateTask;
+    auto        pTask =
+        EnqueueAsyncWork(pThreadPool1, &pPrereq, 1,
+                         [&](Uint32 ThreadId) //
+                         {
+                             CorrectOrder.store(pGateTask->IsFinished());
+                         });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds{10});
+    EXPECT_FALSE(pTask->IsFinished());
+
+    Signal.Trigger(true, 1);
+    pThreadPool1->WaitForTask(pTask);
+    EXPECT_TRUE(CorrectOrder.load());
+
+    pThreadPool0->WaitForAllTasks();
+    pThreadPool1->WaitForAllTasks();
+}
+
+
+TEST(Common_ThreadPool, WaitForCompletion)
+{
+    auto pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{2});
+    ASSERT_NE(pThreadPool, nullptr);
+
+    Threading::Signal       Signal;
+    RefCntAutoPtr<WaitTask> pTask{MakeNewRCObj<WaitTask>()(Signal)};
+    pThreadPool->EnqueueTask(pTask);
+
+    std::atomic<int> NumWaitersFinished{0};
+
+    std::vector<std::thread> Waiters;
+    for (size_t i = 0; i < 4; ++i)
+    {
+        Waiters.emplace_back(
+            [&, i]() {
+                if (i % 2 == 0)
+                    pTask->WaitForCompletion();
+                else
+                    pThreadPool->WaitForTask(pTask);
+                EXPECT_TRUE(pTask->IsFinished());
+                NumWaitersFinished.fetch_add(1);
+            });
+    }
+
+    pTask->WaitUntilRunning();
+    std::this_thread::sleep_for(std::chrono::milliseconds{10});
+    EXPECT_EQ(NumWaitersFinished.load(), 0);
+
+    Signal.Trigger(true, 1);
+    for (auto& Waiter : Waiters)
+        Waiter.join();
+
+    EXPECT_EQ(NumWaitersFinished.load(), 4);
+}
+
+
+// Runs the tasks in the pool and returns the number of times every task has been run
+std::vector<Uint32> RunTasks(THREAD_POOL_SCHEDULING_MODE SchedulingMode, Uint32 NumThreads, Uint32 NumTasks, Uint32 PrerequisiteStride)
+{
+    ThreadPoolCreateInfo PoolCI{NumThreads};
+    PoolCI.SchedulingMode = SchedulingMode;
+
+    auto pThreadPool = CreateThreadPool(PoolCI);
+    VERIFY_EXPR(pThreadPool);
+
+    std::vector<RefCntAutoPtr<IAsyncTask>> Tasks(NumTasks);
+    std::vector<std::atomic<Uint32>>       RunCounts(NumTasks);
+    std::atomic<Uint32>                    NumOutOfOrder{0};
+    for (Uint32 i = 0; i < NumTasks; ++i)
+    {
+        // Every task depends on the task that is PrerequisiteStride tasks before it
+        IAsyncTask* pPrereq = PrerequisiteStride != 0 && i >= PrerequisiteStride ? Tasks[i - PrerequisiteStride].RawPtr() : nullptr;
+        Tasks[i] =
+            EnqueueAsyncWork(pThreadPool, &pPrereq, pPrereq != nullptr ? 1 : 0,
+                             [i, pPrereq, &RunCounts, &NumOutOfOrder](Uint32 ThreadId) //
+                             {
+                                 if (pPrereq != nullptr && !pPrereq->IsFinished())
+                                     NumOutOfOrder.fetch_add(1);
+                                 RunCounts[i].fetch_add(1);
+                             });
+    }
+    pThreadPool->WaitForAllTasks();
+
+    EXPECT_EQ(NumOutOfOrder.load(), 0u);
+    EXPECT_EQ(pThreadPool->GetQueueSize(), 0u);
+
+    std::vector<Uint32> Results(NumTasks);
+    for (Uint32 i = 0; i < NumTasks; ++i)
+        Results[i] = RunCounts[i].load();
+    return Results;
+}
+
+TEST(Common_ThreadPool, SchedulingModes)
+{
+    constexpr Uint32 NumTasks = 4096;
+
+    for (Uint32 NumThreads : {1, 8, 64})
+    {
+        for (Uint32 PrerequisiteStride : {0, 64})
+        {
+            const auto PriorityQueueResults = RunTasks(THREAD_POOL_SCHEDULING_MODE_PRIORITY_QUEUE, NumThreads, NumTasks, PrerequisiteStride);
+            const auto WorkStealingResults  = RunTasks(THREAD_POOL_SCHEDULING_MODE_WORK_STEALING, NumThreads, NumTasks, PrerequisiteStride);
+
+            // Every task must be run exactly once in both modes
+            EXPECT_EQ(PriorityQueueResults, std::vector<Uint32>(NumTasks, 1u)) << NumThreads << " threads, stride " << PrerequisiteStride;
+            EXPECT_EQ(WorkStealingResults, PriorityQueueResults) << NumThreads << " threads, stride " << PrerequisiteStride;
+        }
+    }
+}
+
 } // namespace
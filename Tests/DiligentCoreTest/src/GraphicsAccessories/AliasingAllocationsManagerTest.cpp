@@ -0,0 +1,180 @@
+/*
+ *  Copyright 2019-2024 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "AliasingAllocationsManager.hpp"
+#include "DefaultRawMemoryAllocator.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+
+namespace
+{
+
+using OffsetType = AliasingAllocationsManager::OffsetType;
+
+TEST(GraphicsAccessories_AliasingAllocationsManager, AllocateFree)
+{
+    auto& Allocator = DefaultRawMemoryAllocator::GetAllocator();
+
+    AliasingAllocationsManager Mgr{128, Allocator};
+    EXPECT_TRUE(Mgr.IsEmpty());
+    EXPECT_EQ(Mgr.GetUsedSize(), OffsetType{0});
+
+    auto a1 = Mgr.Allocate(32, 16, 0, 1);
+    EXPECT_EQ(a1.Offset, OffsetType{0});
+    EXPECT_EQ(a1.Size, OffsetType{32});
+
+    // Overlaps a1 in time
+    auto a2 = Mgr.Allocate(20, 16, 1, 2);
+    EXPECT_EQ(a2.Offset, OffsetType{32});
+
+    // Does not overlap a1 in time, but overlaps a2
+    auto a3 = Mgr.Allocate(16, 16, 2, 3);
+    EXPECT_EQ(a3.Offset, OffsetType{0});
+
+    // Does not fit before a2 as it overlaps it in time, so goes after it (aligned)
+    auto a4 = Mgr.Allocate(40, 16, 2, 2);
+    EXPECT_EQ(a4.Offset, OffsetType{64});
+
+    EXPECT_EQ(Mgr.GetNumAllocations(), size_t{4});
+    EXPECT_EQ(Mgr.GetTotalAllocatedSize(), OffsetType{32 + 20 + 16 + 40});
+    EXPECT_EQ(Mgr.GetUsedSize(), OffsetType{104});
+
+    Mgr.Free(a2);
+    Mgr.Free(a4);
+    EXPECT_EQ(Mgr.GetUsedSize(), OffsetType{32});
+
+    // Now fits right after a3
+    auto a5 = Mgr.Allocate(64, 16, 3, 5);
+    EXPECT_EQ(a5.Offset, OffsetType{16});
+
+    Mgr.Free(a1);
+    Mgr.Free(a3);
+    Mgr.Free(a5);
+    EXPECT_TRUE(Mgr.IsEmpty());
+    EXPECT_EQ(Mgr.GetTotalAllocatedSize(), OffsetType{0});
+}
+
+TEST(GraphicsAccessories_AliasingAllocationsManager, NonOverlappingLifetimes)
+{
+    auto& Allocator = DefaultRawMemoryAllocator::GetAllocator();
+
+    AliasingAllocationsManager Mgr{64, Allocator};
+
+    // Every allocation takes the whole block, but none overlap in time
+    std::vector<AliasingAllocationsManager::Allocation> Allocs;
+    for (Uint32 i = 0; i < 8; ++i)
+    {
+        Allocs.push_back(Mgr.Allocate(64, 64, i * 2, i * 2 + 1));
+        EXPECT_EQ(Allocs.back().Offset, OffsetType{0});
+    }
+    EXPECT_EQ(Mgr.GetTotalAllocatedSize(), OffsetType{64 * 8});
+    EXPECT_EQ(Mgr.GetUsedSize(), OffsetType{64});
+
+    // Overlaps the first allocation
+    EXPECT_FALSE(Mgr.Allocate(1, 1, 1, 1).IsValid());
+
+    for (const auto& Alloc : Allocs)
+        Mgr.Free(Alloc);
+    EXPECT_TRUE(Mgr.IsEmpty());
+}
+
+TEST(GraphicsAccessories_AliasingAllocationsManager, Retire)
+{
+    auto& Allocator = DefaultRawMemoryAllocator::GetAllocator();
+
+    AliasingAllocationsManager Mgr{64, Allocator};
+
+    auto a1 = Mgr.Allocate(64, 64, 0, 1);
+    EXPECT_EQ(a1.Offset, OffsetType{0});
+
+    // Retired allocation blocks its memory for all time points
+    a1 = Mgr.Retire(a1);
+    EXPECT_EQ(a1.FirstUse, 0u);
+    EXPECT_EQ(a1.LastUse, ~Uint32{0});
+    EXPECT_FALSE(Mgr.Allocate(64, 64, 2, 3).IsValid());
+    EXPECT_EQ(Mgr.GetNumAllocations(), size_t{1});
+
+    Mgr.Free(a1);
+    EXPECT_TRUE(Mgr.IsEmpty());
+
+    auto a2 = Mgr.Allocate(64, 64, 2, 3);
+    EXPECT_EQ(a2.Offset, OffsetType{0});
+    Mgr.Free(a2);
+}
+
+TEST(GraphicsAccessories_AliasingAllocationsManager, OutOfSpace)
+{
+    auto& Allocator = DefaultRawMemoryAllocator::GetAllocator();
+
+    AliasingAllocationsManager Mgr{100, Allocator};
+    EXPECT_FALSE(Mgr.Allocate(101, 1, 0, 0).IsValid());
+
+    auto a1 = Mgr.Allocate(60, 1, 0, 10);
+    EXPECT_TRUE(a1.IsValid());
+    EXPECT_FALSE(Mgr.Allocate(41, 1, 5, 5).IsValid());
+    // Alignment pushes the allocation out of the block
+    EXPECT_FALSE(Mgr.Allocate(40, 64, 5, 5).IsValid());
+
+    auto a2 = Mgr.Allocate(40, 4, 5, 5);
+    EXPECT_EQ(a2.Offset, OffsetType{60});
+
+    Mgr.Free(a1);
+    Mgr.Free(a2);
+}
+
+TEST(GraphicsAccessories_AliasingAllocationsManager, SameOffset)
+{
+    auto& Allocator = DefaultRawMemoryAllocator::GetAllocator();
+
+    AliasingAllocationsManager Mgr{256, Allocator};
+
+    auto a1 = Mgr.Allocate(32, 32, 0, 0);
+    auto a2 = Mgr.Allocate(64, 32, 1, 1);
+    auto a3 = Mgr.Allocate(32, 32, 2, 2);
+    EXPECT_EQ(a1.Offset, OffsetType{0});
+    EXPECT_EQ(a2.Offset, OffsetType{0});
+    EXPECT_EQ(a3.Offset, OffsetType{0});
+
+    // Overlaps all three
+    auto a4 = Mgr.Allocate(32, 32, 0, 2);
+    EXPECT_EQ(a4.Offset, OffsetType{64});
+
+    // Only a2 must be released
+    Mgr.Free(a2);
+    auto a5 = Mgr.Allocate(32, 32, 1, 1);
+    EXPECT_EQ(a5.Offset, OffsetType{0});
+
+    Mgr.Free(a1);
+    Mgr.Free(a3);
+    Mgr.Free(a4);
+    Mgr.Free(a5);
+    EXPECT_TRUE(Mgr.IsEmpty());
+}
+
+} // namespace
@@ -26,8 +26,10 @@
  */
 
 #include "GraphicsUtilities.h"
+#include "GraphicsAccessories.hpp"
 #include "FastRand.hpp"
 #include "ColorConversion.h"
+#include "ThreadPool.hpp"
 
 #include <vector>
 #include <array>
@@ -575,4 +577,308 @@ TEST(GraphicsTools_CalculateMipLevel, sRGB_BOX_AVE)
     EXPECT_TRUE(CoarseData == RefCoarseData);
 }
 
+template <typename ChannelType>
+void TestBoxAverageWideRows(TEXTURE_FORMAT Fmt, Uint32 NumChannels)
+{
+    using SumType = typename std::conditional<std::is_floating_point<ChannelType>::value, ChannelType, Uint32>::type;
+
+    // Use widths that exercise both the vectorized and the scalar paths
+    for (Uint32 FineWidth : {2u, 7u, 16u, 33u, 67u})
+    {
+        const Uint32 FineHeight = 5;
+
+        std::vector<ChannelType> FineData(FineWidth * FineHeight * NumChannels);
+
+        // Cover the full 16-bit range
+        FastRandInt rnd(0, 0, 255);
+        for (auto& c : FineData)
+            c = static_cast<ChannelType>((rnd() << 8) | rnd()) / (std::is_floating_point<ChannelType>::value ? ChannelType{16} : ChannelType{1});
+
+        const Uint32 CoarseWidth  = FineWidth / 2;
+        const Uint32 CoarseHeight = FineHeight / 2;
+
+        std::vector<ChannelType> RefCoarseData(CoarseWidth * CoarseHeight * NumChannels);
+        for (Uint32 y = 0; y < CoarseHeight; ++y)
+        {
+            for (Uint32 x = 0; x < CoarseWidth; ++x)
+            {
+                for (Uint32 c = 0; c < NumChannels; ++c)
+                {
+                    SumType Sum = FineData[((x * 2 + 0) + (y * 2 + 0) * FineWidth) * NumChannels + c];
+                    Sum += FineData[((x * 2 + 1) + (y * 2 + 0) * FineWidth) * NumChannels + c];
+                    Sum += FineData[((x * 2 + 0) + (y * 2 + 1) * FineWidth) * NumChannels + c];
+                    Sum += FineData[((x * 2 + 1) + (y * 2 + 1) * FineWidth) * NumChannels + c];
+
+                    RefCoarseData[(x + y * CoarseWidth) * NumChannels + c] = std::is_floating_point<ChannelType>::value ?
+                        static_cast<ChannelType>(Sum * 0.25f) :
+                        static_cast<ChannelType>(Sum / 4);
+                }
+            }
+        }
+
+        std::vector<ChannelType> CoarseData(RefCoarseData.size());
+        ComputeMipLevel({Fmt, FineWidth, FineHeight, FineData.data(), FineWidth * NumChannels * sizeof(ChannelType), CoarseData.data(), CoarseWidth * NumChannels * sizeof(ChannelType), MIP_FILTER_TYPE_BOX_AVERAGE});
+        EXPECT_TRUE(CoarseData == RefCoarseData) << "Format: " << GetTextureFormatAttribs(Fmt).Name << ", width: " << FineWidth;
+    }
+}
+
+TEST(GraphicsTools_CalculateMipLevel, BOX_AVE_WIDE_ROWS)
+{
+    TestBoxAverageWideRows<Uint16>(TEX_FORMAT_R16_UNORM, 1);
+    TestBoxAverageWideRows<Uint16>(TEX_FORMAT_RG16_UNORM, 2);
+    TestBoxAverageWideRows<Uint16>(TEX_FORMAT_RGBA16_UNORM, 4);
+    TestBoxAverageWideRows<float>(TEX_FORMAT_R32_FLOAT, 1);
+    TestBoxAverageWideRows<float>(TEX_FORMAT_RG32_FLOAT, 2);
+    TestBoxAverageWideRows<float>(TEX_FORMAT_RGBA32_FLOAT, 4);
+}
+
+
+TEST(GraphicsTools_CalculateMipLevel, POLYPHASE_CONSTANT)
+{
+    // Filter weights are normalized, so constant images must remain constant
+    const Uint32 FineWidth  = 37;
+    const Uint32 FineHeight = 22;
+
+    for (auto FilterType : {MIP_FILTER_TYPE_KAISER, MIP_FILTER_TYPE_LANCZOS, MIP_FILTER_TYPE_MITCHELL})
+    {
+        {
+            std::vector<Uint8> FineData(FineWidth * FineHeight * 4);
+            for (size_t i = 0; i < FineData.size(); ++i)
+                FineData[i] = static_cast<Uint8>(10 + (i % 4) * 70);
+
+            for (auto Fmt : {TEX_FORMAT_RGBA8_UNORM, TEX_FORMAT_RGBA8_UNORM_SRGB})
+            {
+                std::vector<Uint8> CoarseData(FineWidth / 2 * FineHeight / 2 * 4);
+                ComputeMipLevel({Fmt, FineWidth, FineHeight, FineData.data(), FineWidth * 4, CoarseData.data(), FineWidth / 2 * 4, FilterType});
+                for (size_t i = 0; i < CoarseData.size(); ++i)
+                    ASSERT_EQ(CoarseData[i], FineData[i % 4]) << GetTextureFormatAttribs(Fmt).Name;
+            }
+        }
+
+        {
+            std::vector<float> FineData(FineWidth * FineHeight, 0.75f);
+            std::vector<float> CoarseData(FineWidth / 2 * FineHeight / 2);
+            ComputeMipLevel({TEX_FORMAT_R32_FLOAT, FineWidth, FineHeight, FineData.data(), FineWidth * 4, CoarseData.data(), FineWidth / 2 * 4, FilterType});
+            for (auto f : CoarseData)
+                ASSERT_NEAR(f, 0.75f, 1e-5f);
+        }
+    }
+}
+
+TEST(GraphicsTools_CalculateMipLevel, POLYPHASE_SRGB)
+{
+    // Black and white checkerboard must be filtered to linear 0.5
+    const Uint32 FineWidth  = 32;
+    const Uint32 FineHeight = 32;
+
+    std::vector<Uint8> FineData(FineWidth * FineHeight * 4);
+    for (Uint32 y = 0; y < FineHeight; ++y)
+    {
+        for (Uint32 x = 0; x < FineWidth; ++x)
+        {
+            const Uint8 Val = ((x + y) & 0x01) ? 255 : 0;
+            for (Uint32 c = 0; c < 4; ++c)
+                FineData[(x + y * FineWidth) * 4 + c] = Val;
+        }
+    }
+
+    const Uint8 RefSRGB  = static_cast<Uint8>(LinearToGamma(0.5f) * 255.f + 0.5f);
+    const Uint8 RefAlpha = 128;
+
+    for (auto FilterType : {MIP_FILTER_TYPE_KAISER, MIP_FILTER_TYPE_LANCZOS, MIP_FILTER_TYPE_MITCHELL})
+    {
+        std::vector<Uint8> CoarseData(FineWidth / 2 * FineHeight / 2 * 4);
+        ComputeMipLevel({TEX_FORMAT_RGBA8_UNORM_SRGB, FineWidth, FineHeight, FineData.data(), FineWidth * 4, CoarseData.data(), FineWidth / 2 * 4, FilterType});
+        // Clamping breaks the pattern at the edges, so only check the interior texels
+        for (Uint32 y = 3; y < FineHeight / 2 - 3; ++y)
+        {
+            for (Uint32 x = 3; x < FineWidth / 2 - 3; ++x)
+            {
+                const auto* pTexel = &CoarseData[(x + y * FineWidth / 2) * 4];
+                EXPECT_NEAR(pTexel[0], RefSRGB, 1);
+                EXPECT_NEAR(pTexel[1], RefSRGB, 1);
+                EXPECT_NEAR(pTexel[2], RefSRGB, 1);
+                EXPECT_NEAR(pTexel[3], RefAlpha, 1);
+            }
+        }
+    }
+}
+
+TEST(GraphicsTools_CalculateMipLevel, POLYPHASE_GRADIENT)
+{
+    // Symmetric filters must preserve linear gradients away from the edges
+    const Uint32 FineWidth  = 64;
+    const Uint32 FineHeight = 16;
+
+    std::vector<float> FineData(FineWidth * FineHeight);
+    for (Uint32 y = 0; y < FineHeight; ++y)
+    {
+        for (Uint32 x = 0; x < FineWidth; ++x)
+            FineData[x + y * FineWidth] = static_cast<float>(x) + 0.5f;
+    }
+
+    for (auto FilterType : {MIP_FILTER_TYPE_KAISER, MIP_FILTER_TYPE_LANCZOS, MIP_FILTER_TYPE_MITCHELL})
+    {
+        std::vector<float> CoarseData(FineWidth / 2 * FineHeight / 2);
+        ComputeMipLevel({TEX_FORMAT_R32_FLOAT, FineWidth, FineHeight, FineData.data(), FineWidth * 4, CoarseData.data(), FineWidth / 2 * 4, FilterType});
+        for (Uint32 y = 0; y < FineHeight / 2; ++y)
+        {
+            for (Uint32 x = 3; x < FineWidth / 2 - 3; ++x)
+                EXPECT_NEAR(CoarseData[x + y * FineWidth / 2], static_cast<float>(x * 2 + 1), 1e-3f);
+        }
+    }
+}
+
+TEST(GraphicsTools_CalculateMipLevel, PRESERVE_ALPHA_COVERAGE)
+{
+    const Uint32 FineWidth   = 128;
+    const Uint32 FineHeight  = 128;
+    const float  AlphaCutoff = 0.5f;
+
+    // Foliage-like alpha: thin vertical lines
+    std::vector<Uint8> FineData(FineWidth * FineHeight * 4);
+    FastRandInt        rnd(0, 0, 255);
+    for (Uint32 y = 0; y < FineHeight; ++y)
+    {
+        for (Uint32 x = 0; x < FineWidth; ++x)
+        {
+            auto* pTexel = &FineData[(x + y * FineWidth) * 4];
+            pTexel[0] = pTexel[1] = pTexel[2] = static_cast<Uint8>(rnd());
+            pTexel[3]                         = (x % 4) == 0 ? 255 : static_cast<Uint8>(rnd() % 64);
+        }
+    }
+
+    auto GetCoverage = [&](const std::vector<Uint8>& Data) {
+        size_t NumCovered = 0;
+        for (size_t i = 3; i < Data.size(); i += 4)
+        {
+            if (Data[i] > AlphaCutoff * 255.f)
+                ++NumCovered;
+        }
+        return static_cast<float>(NumCovered) / static_cast<float>(Data.size() / 4);
+    };
+    const float FineCoverage = GetCoverage(FineData);
+
+    std::vector<Uint8> CoarseData(FineWidth / 2 * FineHeight / 2 * 4);
+
+    for (auto FilterType : {MIP_FILTER_TYPE_BOX_AVERAGE, MIP_FILTER_TYPE_KAISER})
+    {
+        ComputeMipLevel({TEX_FORMAT_RGBA8_UNORM, FineWidth, FineHeight, FineData.data(), FineWidth * 4, CoarseData.data(), FineWidth / 2 * 4, FilterType, AlphaCutoff, true});
+        EXPECT_NEAR(GetCoverage(CoarseData), FineCoverage, 0.05f);
+    }
+}
+
+
+struct MipChain
+{
+    MipChain(TEXTURE_FORMAT Fmt, Uint32 Width, Uint32 Height)
+    {
+        const auto& FmtAttribs = GetTextureFormatAttribs(Fmt);
+        TexelSize              = Uint32{FmtAttribs.ComponentSize} * FmtAttribs.NumComponents;
+
+        const Uint32 NumLevels = ComputeMipLevelsCount(Width, Height);
+        Levels.resize(NumLevels);
+        LevelData.resize(NumLevels);
+        for (Uint32 i = 0; i < NumLevels; ++i)
+        {
+            const Uint32 LevelWidth  = std::max(Width >> i, 1u);
+            const Uint32 LevelHeight = std::max(Height >> i, 1u);
+            // Add padding to the stride to make sure it is taken into account
+            LevelData[i].Stride = (LevelWidth + 3) * TexelSize;
+            Levels[i].resize(LevelData[i].Stride * LevelHeight);
+            LevelData[i].pData = Levels[i].data();
+        }
+    }
+
+    bool operator==(const MipChain& Other) const
+    {
+        return Levels == Other.Levels;
+    }
+
+    Uint32                          TexelSize = 0;
+    std::vector<std::vector<Uint8>> Levels;
+    std::vector<MipLevelData>       LevelData;
+};
+
+void TestComputeMipChain(TEXTURE_FORMAT  Fmt,
+                         Uint32          Width,
+                         Uint32          Height,
+                         MIP_FILTER_TYPE FilterType,
+                         float           AlphaCutoff,
+                         IThreadPool*    pThreadPool,
+                         bool            PreserveAlphaCoverage = false)
+{
+    MipChain RefChain{Fmt, Width, Height};
+
+    FastRandInt rnd(0, 0, 255);
+    for (auto& c : RefChain.Levels[0])
+        c = static_cast<Uint8>(rnd());
+    if (GetTextureFormatAttribs(Fmt).ComponentType == COMPONENT_TYPE_FLOAT)
+    {
+        // Make sure there are no NaNs
+        for (auto& f : RefChain.Levels[0])
+            f &= 0x3F;
+    }
+
+    MipChain Chain{Fmt, Width, Height};
+    Chain.Levels[0] = RefChain.Levels[0];
+
+    const Uint32 NumMipLevels = static_cast<Uint32>(RefChain.Levels.size() - 1);
+    for (Uint32 i = 0; i < NumMipLevels; ++i)
+    {
+        ComputeMipLevelAttribs Attribs;
+        Attribs.Format          = Fmt;
+        Attribs.FineMipWidth    = std::max(Width >> i, 1u);
+        Attribs.FineMipHeight   = std::max(Height >> i, 1u);
+        Attribs.pFineMipData    = RefChain.LevelData[i].pData;
+        Attribs.FineMipStride   = RefChain.LevelData[i].Stride;
+        Attribs.pCoarseMipData  = RefChain.LevelData[i + 1].pData;
+        Attribs.CoarseMipStride = RefChain.LevelData[i + 1].Stride;
+        Attribs.FilterType      = FilterType;
+        Attribs.AlphaCutoff     = AlphaCutoff;
+
+        Attribs.PreserveAlphaCoverage = PreserveAlphaCoverage;
+        ComputeMipLevel(Attribs);
+    }
+
+    ComputeMipChainAttribs Attribs;
+    Attribs.Format       = Fmt;
+    Attribs.Width        = Width;
+    Attribs.Height       = Height;
+    Attribs.pData        = Chain.LevelData[0].pData;
+    Attribs.Stride       = Chain.LevelData[0].Stride;
+    Attribs.NumMipLevels = NumMipLevels;
+    Attribs.pMipLevels   = &Chain.LevelData[1];
+    Attribs.FilterType   = FilterType;
+    Attribs.AlphaCutoff  = AlphaCutoff;
+    Attribs.pThreadPool  = pThreadPool;
+
+    Attribs.PreserveAlphaCoverage = PreserveAlphaCoverage;
+    ComputeMipChain(Attribs);
+
+    EXPECT_TRUE(Chain == RefChain) << "Format: " << GetTextureFormatAttribs(Fmt).Name << ", size: " << Width << "x" << Height;
+}
+
+TEST(GraphicsTools_ComputeMipChain, MatchesComputeMipLevel)
+{
+    auto pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{4});
+    for (IThreadPool* pPool : {static_cast<IThreadPool*>(nullptr), pThreadPool.RawPtr()})
+    {
+        for (auto Size : {std::make_pair(1u, 1u), std::make_pair(257u, 131u), std::make_pair(1u, 300u), std::make_pair(300u, 1u), std::make_pair(512u, 512u), std::make_pair(4096u, 7u)})
+        {
+            TestComputeMipChain(TEX_FORMAT_RGBA8_UNORM, Size.first, Size.second, MIP_FILTER_TYPE_BOX_AVERAGE, 0, pPool);
+            TestComputeMipChain(TEX_FORMAT_RGBA8_UNORM, Size.first, Size.second, MIP_FILTER_TYPE_BOX_AVERAGE, 0.5f, pPool);
+            TestComputeMipChain(TEX_FORMAT_RGBA8_UNORM_SRGB, Size.first, Size.second, MIP_FILTER_TYPE_DEFAULT, 0.25f, pPool);
+            TestComputeMipChain(TEX_FORMAT_RG8_UINT, Size.first, Size.second, MIP_FILTER_TYPE_DEFAULT, 0, pPool);
+            TestComputeMipChain(TEX_FORMAT_R16_UNORM, Size.first, Size.second, MIP_FILTER_TYPE_BOX_AVERAGE, 0, pPool);
+            TestComputeMipChain(TEX_FORMAT_RG16_SNORM, Size.first, Size.second, MIP_FILTER_TYPE_BOX_AVERAGE, 0, pPool);
+            TestComputeMipChain(TEX_FORMAT_RGBA32_FLOAT, Size.first, Size.second, MIP_FILTER_TYPE_BOX_AVERAGE, 0, pPool);
+            TestComputeMipChain(TEX_FORMAT_RGBA8_UNORM_SRGB, Size.first, Size.second, MIP_FILTER_TYPE_KAISER, 0, pPool);
+            TestComputeMipChain(TEX_FORMAT_RG16_UNORM, Size.first, Size.second, MIP_FILTER_TYPE_LANCZOS, 0, pPool);
+            TestComputeMipChain(TEX_FORMAT_R32_FLOAT, Size.first, Size.second, MIP_FILTER_TYPE_MITCHELL, 0, pPool);
+            TestComputeMipChain(TEX_FORMAT_RGBA8_UNORM, Size.first, Size.second, MIP_FILTER_TYPE_BOX_AVERAGE, 0.5f, pPool, true);
+        }
+    }
+}
+
 } // namespace
@@ -0,0 +1,477 @@
+/*
+ *  Copyright 2019-2024 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <vector>
+#include <cstring>
+#include <cmath>
+#include <algorithm>
+
+#include "GraphicsAccessories.hpp"
+#include "ThreadPool.hpp"
+#include "FastRand.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+
+namespace
+{
+
+// Generates a smooth RGBA image with some noise that resembles a natural texture
+std::vector<Uint8> GenerateTestImage(Uint32 Width, Uint32 Height)
+{
+    FastRandInt        rnd{0, 0, 8};
+    std::vector<Uint8> Data(size_t{Width} * Height * 4);
+    for (Uint32 y = 0; y < Height; ++y)
+    {
+        for (Uint32 x = 0; x < Width; ++x)
+        {
+            const float fx = static_cast<float>(x) / static_cast<float>(Width);
+            const float fy = static_cast<float>(y) / static_cast<float>(Height);
+
+            const float Values[] = {
+                0.5f + 0.5f * std::sin(fx * 6.f + fy * 2.f),
+                0.5f + 0.5f * std::cos(fy * 5.f - fx * 3.f),
+                fx * fy,
+                0.5f + 0.5f * std::sin((fx + fy) * 4.f),
+            };
+            for (Uint32 c = 0; c < 4; ++c)
+            {
+                const float Val = Values[c] * 247.f + static_cast<float>(rnd());
+
+                Data[(size_t{y} * Width + x) * 4 + c] = static_cast<Uint8>(std::min(std::max(Val, 0.f), 255.f));
+            }
+        }
+    }
+    return Data;
+}
+
+void DecodeBC1Colors(const Uint8* pBlock, bool ForceFourColors, Uint8 Texels[16][4])
+{
+    Uint16 Color0, Color1;
+    Uint32 Indices;
+    memcpy(&Color0, pBlock + 0, 2);
+    memcpy(&Color1, pBlock + 2, 2);
+    memcpy(&Indices, pBlock + 4, 4);
+
+    auto Unpack = [](Uint16 Color, Int32 RGB[3]) {
+        RGB[0] = ((Color >> 11) & 0x1F) * 255 / 31;
+        RGB[1] = ((Color >> 5) & 0x3F) * 255 / 63;
+        RGB[2] = ((Color >> 0) & 0x1F) * 255 / 31;
+    };
+
+    Int32 Palette[4][4];
+    Unpack(Color0, Palette[0]);
+    Unpack(Color1, Palette[1]);
+    Palette[0][3] = Palette[1][3] = 255;
+    for (Uint32 c = 0; c < 3; ++c)
+    {
+        if (Color0 > Color1 || ForceFourColors)
+        {
+            Palette[2][c] = (2 * Palette[0][c] + Palette[1][c] + 1) / 3;
+            Palette[3][c] = (Palette[0][c] + 2 * Palette[1][c] + 1) / 3;
+        }
+        else
+        {
+            Palette[2][c] = (Palette[0][c] + Palette[1][c] + 1) / 2;
+            Palette[3][c] = 0;
+        }
+    }
+    Palette[2][3] = 255;
+    Palette[3][3] = (Color0 > Color1 || ForceFourColors) ? 255 : 0;
+
+    for (Uint32 i = 0; i < 16; ++i)
+    {
+        const Uint32 Idx = (Indices >> (i * 2)) & 0x3;
+        for (Uint32 c = 0; c < 4; ++c)
+            Texels[i][c] = static_cast<Uint8>(Palette[Idx][c]);
+    }
+}
+
+void DecodeBC4(const Uint8* pBlock, Uint8 Texels[16][4], Uint32 Channel)
+{
+    const Int32 Value0 = pBlock[0];
+    const Int32 Value1 = pBlock[1];
+
+    Int32 Palette[8] = {Value0, Value1};
+    if (Value0 > Value1)
+    {
+        for (Int32 i = 1; i < 7; ++i)
+            Palette[i + 1] = ((7 - i) * Value0 + i * Value1 + 3) / 7;
+    }
+    else
+    {
+        for (Int32 i = 1; i < 5; ++i)
+            Palette[i + 1] = ((5 - i) * Value0 + i * Value1 + 2) / 5;
+        Palette[6] = 0;
+        Palette[7] = 255;
+    }
+
+    Uint64 Indices = 0;
+    for (Uint32 i = 0; i < 6; ++i)
+        Indices |= Uint64{pBlock[2 + i]} << (i * 8);
+    for (Uint32 i = 0; i < 16; ++i)
+        Texels[i][Channel] = static_cast<Uint8>(Palette[(Indices >> (i * 3)) & 0x7]);
+}
+
+class BitReader
+{
+public:
+    explicit BitReader(const Uint8* pData) :
+        m_pData{pData}
+    {}
+
+    Uint32 Read(Uint32 NumBits)
+    {
+        Uint32 Value = 0;
+        for (Uint32 i = 0; i < NumBits; ++i, ++m_Pos)
+            Value |= ((m_pData[m_Pos / 8] >> (m_Pos % 8)) & 1u) << i;
+        return Value;
+    }
+
+private:
+    const Uint8* const m_pData;
+    Uint32             m_Pos = 0;
+};
+
+// Decodes BC7 blocks in modes 5 and 6
+bool DecodeBC7(const Uint8* pBlock, Uint8 Texels[16][4])
+{
+    static constexpr Uint32 Weights2[] = {0, 21, 43, 64};
+    static constexpr Uint32 Weights4[] = {0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64};
+
+    auto Interpolate = [](Uint32 E0, Uint32 E1, Uint32 W) {
+        return static_cast<Uint8>(((64 - W) * E0 + W * E1 + 32) >> 6);
+    };
+
+    BitReader Reader{pBlock};
+
+    Uint32 Mode = 0;
+    while (Mode < 8 && Reader.Read(1) == 0)
+        ++Mode;
+
+    if (Mode == 6)
+    {
+        Uint32 Endpoints[2][4];
+        for (Uint32 c = 0; c < 4; ++c)
+        {
+            Endpoints[0][c] = Reader.Read(7);
+            Endpoints[1][c] = Reader.Read(7);
+        }
+        const Uint32 P0 = Reader.Read(1);
+        const Uint32 P1 = Reader.Read(1);
+        for (Uint32 c = 0; c < 4; ++c)
+        {
+            Endpoints[0][c] = (Endpoints[0][c] << 1) | P0;
+            Endpoints[1][c] = (Endpoints[1][c] << 1) | P1;
+        }
+        for (Uint32 i = 0; i < 16; ++i)
+        {
+            const Uint32 Idx = Reader.Read(i == 0 ? 3 : 4);
+            for (Uint32 c = 0; c < 4; ++c)
+                Texels[i][c] = Interpolate(Endpoints[0][c], Endpoints[1][c], Weights4[Idx]);
+        }
+        return true;
+    }
+    else if (Mode == 5)
+    {
+        const Uint32 Rotation = Reader.Read(2);
+
+        Uint32 Endpoints[2][4];
+        for (Uint32 c = 0; c < 3; ++c)
+        {
+            Endpoints[0][c] = Reader.Read(7);
+            Endpoints[1][c] = Reader.Read(7);
+            Endpoints[0][c] = (Endpoints[0][c] << 1) | (Endpoints[0][c] >> 6);
+            Endpoints[1][c] = (Endpoints[1][c] << 1) | (Endpoints[1][c] >> 6);
+        }
+        Endpoints[0][3] = Reader.Read(8);
+        Endpoints[1][3] = Reader.Read(8);
+
+        for (Uint32 i = 0; i < 16; ++i)
+        {
+            const Uint32 Idx = Reader.Read(i == 0 ? 1 : 2);
+            for (Uint32 c = 0; c < 3; ++c)
+                Texels[i][c] = Interpolate(Endpoints[0][c], Endpoints[1][c], Weights2[Idx]);
+        }
+        for (Uint32 i = 0; i < 16; ++i)
+        {
+            const Uint32 Idx = Reader.Read(i == 0 ? 1 : 2);
+            Texels[i][3]     = Interpolate(Endpoints[0][3], Endpoints[1][3], Weights2[Idx]);
+        }
+        if (Rotation != 0)
+        {
+            for (Uint32 i = 0; i < 16; ++i)
+                std::swap(Texels[i][Rotation - 1], Texels[i][3]);
+        }
+        return true;
+    }
+
+    return false;
+}
+
+std::vector<Uint8> Compress(const std::vector<Uint8>&   RGBA,
+                            Uint32                      Width,
+                            Uint32                      Height,
+                            TEXTURE_FORMAT              DstFormat,
+                            TEXTURE_COMPRESSION_QUALITY Quality,
+                            Uint64&                     DstStride,
+                            IThreadPool*                pThreadPool = nullptr)
+{
+    const auto&  FmtAttribs = GetTextureFormatAttribs(DstFormat);
+    const Uint32 NumBlocksX = (Width + 3) / 4;
+    const Uint32 NumBlocksY = (Height + 3) / 4;
+
+    // Add padding to make sure that the strides are taken into account
+    const Uint64 DstRowSize = Uint64{NumBlocksX} * FmtAttribs.ComponentSize;
+    DstStride               = DstRowSize + 16;
+
+    std::vector<Uint8> Dst(static_cast<size_t>(DstStride * NumBlocksY), 0xCD);
+
+    CompressTextureSubresourceAttribs Attribs;
+    Attribs.SrcFormat    = TEX_FORMAT_RGBA8_UNORM;
+    Attribs.DstFormat    = DstFormat;
+    Attribs.Quality      = Quality;
+    Attribs.Width        = Width;
+    Attribs.Height       = Height;
+    Attribs.pSrcData     = RGBA.data();
+    Attribs.SrcRowStride = Uint64{Width} * 4;
+    Attribs.pDstData     = Dst.data();
+    Attribs.DstRowStride = DstStride;
+    Attribs.pThreadPool  = pThreadPool;
+    EXPECT_TRUE(CompressTextureSubresource(Attribs));
+
+    for (Uint32 y = 0; y < NumBlocksY; ++y)
+    {
+        for (size_t i = static_cast<size_t>(DstRowSize); i < DstStride; ++i)
+            EXPECT_EQ(Dst[static_cast<size_t>(DstStride * y + i)], 0xCD) << "Padding must not be overwritten";
+    }
+
+    return Dst;
+}
+
+std::vector<Uint8> Decompress(const std::vector<Uint8>& Data, Uint64 Stride, Uint32 Width, Uint32 Height, TEXTURE_FORMAT Format)
+{
+    const Uint32 BlockSize = GetTextureFormatAttribs(Format).ComponentSize;
+
+    std::vector<Uint8> RGBA(size_t{Width} * Height * 4);
+    for (Uint32 by = 0; by < (Height + 3) / 4; ++by)
+    {
+        for (Uint32 bx = 0; bx < (Width + 3) / 4; ++bx)
+        {
+            const Uint8* pBlock = &Data[static_cast<size_t>(Stride * by + Uint64{bx} * BlockSize)];
+
+            Uint8 Texels[16][4] = {};
+            switch (Format)
+            {
+                case TEX_FORMAT_BC1_UNORM:
+                    DecodeBC1Colors(pBlock, false, Texels);
+                    break;
+
+                case TEX_FORMAT_BC3_UNORM:
+                    DecodeBC1Colors(pBlock + 8, true, Texels);
+                    DecodeBC4(pBlock, Texels, 3);
+                    break;
+
+                case TEX_FORMAT_BC4_UNORM:
+                    DecodeBC4(pBlock, Texels, 0);
+                    break;
+
+                case TEX_FORMAT_BC5_UNORM:
+                    DecodeBC4(pBlock, Texels, 0);
+                    DecodeBC4(pBlock + 8, Texels, 1);
+                    break;
+
+                case TEX_FORMAT_BC7_UNORM:
+                    EXPECT_TRUE(DecodeBC7(pBlock, Texels)) << "Only BC7 modes 5 and 6 are expected";
+                    break;
+
+                default:
+                    UNEXPECTED("Unexpected format");
+            }
+
+            for (Uint32 y = 0; y < 4 && by * 4 + y < Height; ++y)
+            {
+                for (Uint32 x = 0; x < 4 && bx * 4 + x < Width; ++x)
+                    memcpy(&RGBA[(size_t{by * 4 + y} * Width + bx * 4 + x) * 4], Texels[y * 4 + x], 4);
+            }
+        }
+    }
+    return RGBA;
+}
+
+double ComputePSNR(const std::vector<Uint8>& Ref, const std::vector<Uint8>& Data, Uint32 NumChannels)
+{
+    double SqError = 0;
+    for (size_t i = 0; i < Ref.size(); i += 4)
+    {
+        for (Uint32 c = 0; c < NumChannels; ++c)
+        {
+            const double Diff = static_cast<double>(Ref[i + c]) - static_cast<double>(Data[i + c]);
+            SqError += Diff * Diff;
+        }
+    }
+    const double MSE = SqError / static_cast<double>(Ref.size() / 4 * NumChannels);
+    return MSE > 0 ? 10.0 * std::log10(255.0 * 255.0 / MSE) : 100.0;
+}
+
+void TestCompression(TEXTURE_FORMAT Format, Uint32 NumChannels, double MinPSNR)
+{
+    constexpr Uint32 Width  = 125;
+    constexpr Uint32 Height = 67;
+
+    auto RGBA = GenerateTestImage(Width, Height);
+    if (Format == TEX_FORMAT_BC1_UNORM)
+    {
+        // Texels with alpha below 0.5 are transparent black in BC1
+        for (size_t i = 0; i < RGBA.size(); i += 4)
+            RGBA[i + 3] = 255;
+    }
+
+    double PSNR[2] = {};
+    for (auto Quality : {TEXTURE_COMPRESSION_QUALITY_FAST, TEXTURE_COMPRESSION_QUALITY_HIGH})
+    {
+        Uint64     Stride     = 0;
+        const auto Compressed = Compress(RGBA, Width, Height, Format, Quality, Stride);
+        const auto Decoded    = Decompress(Compressed, Stride, Width, Height, Format);
+
+        PSNR[Quality] = ComputePSNR(RGBA, Decoded, NumChannels);
+        EXPECT_GE(PSNR[Quality], MinPSNR) << GetTextureFormatAttribs(Format).Name << (Quality == TEXTURE_COMPRESSION_QUALITY_FAST ? " fast" : " high quality");
+    }
+    EXPECT_GE(PSNR[TEXTURE_COMPRESSION_QUALITY_HIGH], PSNR[TEXTURE_COMPRESSION_QUALITY_FAST] - 0.01);
+
+    LOG_INFO_MESSAGE(GetTextureFormatAttribs(Format).Name, " PSNR: fast ", PSNR[0], " dB, high quality ", PSNR[1], " dB");
+}
+
+TEST(GraphicsAccessories_TextureCompression, BC1)
+{
+    TestCompression(TEX_FORMAT_BC1_UNORM, 3, 35);
+}
+
+TEST(GraphicsAccessories_TextureCompression, BC3)
+{
+    TestCompression(TEX_FORMAT_BC3_UNORM, 4, 36);
+}
+
+TEST(GraphicsAccessories_TextureCompression, BC4)
+{
+    TestCompression(TEX_FORMAT_BC4_UNORM, 1, 42);
+}
+
+TEST(GraphicsAccessories_TextureCompression, BC5)
+{
+    TestCompression(TEX_FORMAT_BC5_UNORM, 2, 42);
+}
+
+TEST(GraphicsAccessories_TextureCompression, BC7)
+{
+    TestCompression(TEX_FORMAT_BC7_UNORM, 4, 37);
+}
+
+TEST(GraphicsAccessories_TextureCompression, BC1Transparency)
+{
+    constexpr Uint32 Width  = 8;
+    constexpr Uint32 Height = 8;
+
+    auto RGBA = GenerateTestImage(Width, Height);
+    for (size_t i = 0; i < RGBA.size(); i += 4)
+        RGBA[i + 3] = ((i / 4) % 3 == 0) ? 0 : 255;
+
+    for (auto Quality : {TEXTURE_COMPRESSION_QUALITY_FAST, TEXTURE_COMPRESSION_QUALITY_HIGH})
+    {
+        Uint64     Stride     = 0;
+        const auto Compressed = Compress(RGBA, Width, Height, TEX_FORMAT_BC1_UNORM, Quality, Stride);
+        const auto Decoded    = Decompress(Compressed, Stride, Width, Height, TEX_FORMAT_BC1_UNORM);
+        for (size_t i = 0; i < RGBA.size(); i += 4)
+            EXPECT_EQ(Decoded[i + 3], RGBA[i + 3]);
+    }
+}
+
+TEST(GraphicsAccessories_TextureCompression, SourceFormats)
+{
+    constexpr Uint32 Width  = 9;
+    constexpr Uint32 Height = 6;
+
+    const auto RGBA = GenerateTestImage(Width, Height);
+
+    std::vector<Uint8> BGRA(RGBA.size()), R(RGBA.size() / 4);
+    for (size_t i = 0; i < R.size(); ++i)
+    {
+        BGRA[i * 4 + 0] = RGBA[i * 4 + 2];
+        BGRA[i * 4 + 1] = RGBA[i * 4 + 1];
+        BGRA[i * 4 + 2] = RGBA[i * 4 + 0];
+        BGRA[i * 4 + 3] = RGBA[i * 4 + 3];
+        R[i]            = RGBA[i * 4 + 0];
+    }
+
+    auto CompressFrom = [&](const std::vector<Uint8>& Src, TEXTURE_FORMAT SrcFormat, TEXTURE_FORMAT DstFormat) {
+        const Uint32       BlockSize = GetTextureFormatAttribs(DstFormat).ComponentSize;
+        std::vector<Uint8> Dst(size_t{BlockSize} * 3 * 2);
+
+        CompressTextureSubresourceAttribs Attribs;
+        Attribs.SrcFormat    = SrcFormat;
+        Attribs.DstFormat    = DstFormat;
+        Attribs.Width        = Width;
+        Attribs.Height       = Height;
+        Attribs.pSrcData     = Src.data();
+        Attribs.SrcRowStride = Src.size() / Height;
+        Attribs.pDstData     = Dst.data();
+        Attribs.DstRowStride = size_t{BlockSize} * 3;
+        EXPECT_TRUE(CompressTextureSubresource(Attribs));
+        return Dst;
+    };
+
+    EXPECT_EQ(CompressFrom(BGRA, TEX_FORMAT_BGRA8_UNORM, TEX_FORMAT_BC7_UNORM), CompressFrom(RGBA, TEX_FORMAT_RGBA8_UNORM, TEX_FORMAT_BC7_UNORM));
+    EXPECT_EQ(CompressFrom(R, TEX_FORMAT_R8_UNORM, TEX_FORMAT_BC4_UNORM), CompressFrom(RGBA, TEX_FORMAT_RGBA8_UNORM, TEX_FORMAT_BC4_UNORM));
+
+    EXPECT_TRUE(IsTextureCompressionSupported(TEX_FORMAT_RG8_UNORM, TEX_FORMAT_BC5_UNORM));
+    EXPECT_FALSE(IsTextureCompressionSupported(TEX_FORMAT_RGBA32_FLOAT, TEX_FORMAT_BC7_UNORM));
+    EXPECT_FALSE(IsTextureCompressionSupported(TEX_FORMAT_RGBA8_UNORM, TEX_FORMAT_BC6H_UF16));
+}
+
+TEST(GraphicsAccessories_TextureCompression, ThreadPool)
+{
+    // Use a size that is not a multiple of the block size to test the edge blocks
+    constexpr Uint32 Width  = 70;
+    constexpr Uint32 Height = 50;
+
+    const auto RGBA = GenerateTestImage(Width, Height);
+
+    auto pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{4});
+    for (auto Format : {TEX_FORMAT_BC1_UNORM, TEX_FORMAT_BC3_UNORM, TEX_FORMAT_BC4_UNORM, TEX_FORMAT_BC5_UNORM, TEX_FORMAT_BC7_UNORM})
+    {
+        for (auto Quality : {TEXTURE_COMPRESSION_QUALITY_FAST, TEXTURE_COMPRESSION_QUALITY_HIGH})
+        {
+            Uint64     Stride       = 0;
+            const auto Compressed   = Compress(RGBA, Width, Height, Format, Quality, Stride);
+            const auto CompressedMT = Compress(RGBA, Width, Height, Format, Quality, Stride, pThreadPool);
+            EXPECT_EQ(Compressed, CompressedMT) << GetTextureFormatAttribs(Format).Name << (Quality == TEXTURE_COMPRESSION_QUALITY_FAST ? " fast" : " high quality");
+        }
+    }
+}
+
+} // namespace
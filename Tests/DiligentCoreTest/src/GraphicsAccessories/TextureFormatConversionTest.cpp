@@ -0,0 +1,289 @@
+/*
+ *  Copyright 2019-2024 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <vector>
+#include <array>
+#include <cstring>
+
+#include "GraphicsAccessories.hpp"
+#include "ColorConversion.h"
+#include "ThreadPool.hpp"
+#include "FastRand.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+
+namespace
+{
+
+template <typename DstType, typename SrcType>
+std::vector<DstType> Convert(const std::vector<SrcType>& SrcData,
+                             TEXTURE_FORMAT              SrcFormat,
+                             TEXTURE_FORMAT              DstFormat,
+                             Uint32                      Width,
+                             Uint32                      Height,
+                             Uint32                      SrcNumComponents = 0,
+                             IThreadPool*                pThreadPool      = nullptr)
+{
+    const auto& DstFmtAttribs = GetTextureFormatAttribs(DstFormat);
+
+    const size_t SrcRowSize = SrcData.size() * sizeof(SrcType) / Height;
+    const size_t DstRowSize = size_t{Width} * DstFmtAttribs.GetElementSize();
+
+    // Add padding to make sure that the strides are taken into account
+    const size_t DstStride = DstRowSize + 12;
+
+    std::vector<Uint8> Dst(DstStride * Height, 0xCD);
+
+    ConvertTextureSubresourceAttribs Attribs;
+    Attribs.SrcFormat        = SrcFormat;
+    Attribs.SrcNumComponents = SrcNumComponents;
+    Attribs.DstFormat        = DstFormat;
+    Attribs.Width            = Width;
+    Attribs.Height           = Height;
+    Attribs.pSrcData         = SrcData.data();
+    Attribs.SrcRowStride     = SrcRowSize;
+    Attribs.pDstData         = Dst.data();
+    Attribs.DstRowStride     = DstStride;
+    Attribs.pThreadPool      = pThreadPool;
+    EXPECT_TRUE(ConvertTextureSubresource(Attribs));
+
+    std::vector<DstType> Res(DstRowSize * Height / sizeof(DstType));
+    for (Uint32 y = 0; y < Height; ++y)
+    {
+        memcpy(reinterpret_cast<Uint8*>(Res.data()) + DstRowSize * y, &Dst[DstStride * y], DstRowSize);
+        for (size_t i = DstRowSize; i < DstStride; ++i)
+            EXPECT_EQ(Dst[DstStride * y + i], 0xCD) << "Padding must not be overwritten";
+    }
+    return Res;
+}
+
+std::vector<Uint8> GetRandomBytes(size_t Size)
+{
+    FastRandInt        rnd{0, 0, 255};
+    std::vector<Uint8> Data(Size);
+    for (auto& b : Data)
+        b = static_cast<Uint8>(rnd());
+    return Data;
+}
+
+TEST(GraphicsAccessories_TextureFormatConversion, Swizzle)
+{
+    auto pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{2});
+    for (IThreadPool* pPool : {static_cast<IThreadPool*>(nullptr), pThreadPool.RawPtr()})
+    {
+        constexpr Uint32 Width  = 37;
+        constexpr Uint32 Height = 131;
+
+        const auto RGBA = GetRandomBytes(Width * Height * 4);
+        const auto BGRA = Convert<Uint8>(RGBA, TEX_FORMAT_RGBA8_UNORM, TEX_FORMAT_BGRA8_UNORM, Width, Height, 0, pPool);
+        const auto BGRX = Convert<Uint8>(RGBA, TEX_FORMAT_RGBA8_UNORM, TEX_FORMAT_BGRX8_UNORM, Width, Height, 0, pPool);
+        for (size_t i = 0; i < RGBA.size(); i += 4)
+        {
+            ASSERT_EQ(BGRA[i + 0], RGBA[i + 2]);
+            ASSERT_EQ(BGRA[i + 1], RGBA[i + 1]);
+            ASSERT_EQ(BGRA[i + 2], RGBA[i + 0]);
+            ASSERT_EQ(BGRA[i + 3], RGBA[i + 3]);
+
+            ASSERT_EQ(BGRX[i + 0], RGBA[i + 2]);
+            ASSERT_EQ(BGRX[i + 1], RGBA[i + 1]);
+            ASSERT_EQ(BGRX[i + 2], RGBA[i + 0]);
+            ASSERT_EQ(BGRX[i + 3], 255);
+        }
+
+        EXPECT_EQ(Convert<Uint8>(BGRA, TEX_FORMAT_BGRA8_UNORM, TEX_FORMAT_RGBA8_UNORM, Width, Height, 0, pPool), RGBA);
+        EXPECT_EQ(Convert<Uint8>(RGBA, TEX_FORMAT_RGBA8_UNORM, TEX_FORMAT_RGBA8_UNORM, Width, Height, 0, pPool), RGBA);
+    }
+}
+
+TEST(GraphicsAccessories_TextureFormatConversion, RGBToRGBA)
+{
+    for (Uint32 Width : {1u, 4u, 15u, 33u})
+    {
+        constexpr Uint32 Height = 3;
+
+        const auto RGB  = GetRandomBytes(Width * Height * 3);
+        const auto RGBA = Convert<Uint8>(RGB, TEX_FORMAT_RGBA8_UNORM, TEX_FORMAT_RGBA8_UNORM, Width, Height, 3);
+        const auto BGRA = Convert<Uint8>(RGB, TEX_FORMAT_RGBA8_UNORM, TEX_FORMAT_BGRA8_UNORM, Width, Height, 3);
+        for (size_t t = 0; t < Width * Height; ++t)
+        {
+            ASSERT_EQ(RGBA[t * 4 + 0], RGB[t * 3 + 0]);
+            ASSERT_EQ(RGBA[t * 4 + 1], RGB[t * 3 + 1]);
+            ASSERT_EQ(RGBA[t * 4 + 2], RGB[t * 3 + 2]);
+            ASSERT_EQ(RGBA[t * 4 + 3], 255);
+
+            ASSERT_EQ(BGRA[t * 4 + 0], RGB[t * 3 + 2]);
+            ASSERT_EQ(BGRA[t * 4 + 1], RGB[t * 3 + 1]);
+            ASSERT_EQ(BGRA[t * 4 + 2], RGB[t * 3 + 0]);
+            ASSERT_EQ(BGRA[t * 4 + 3], 255);
+        }
+    }
+
+    const std::vector<float> RGB32F = {1, 2, 3, 4, 5, 6};
+    EXPECT_EQ(Convert<float>(RGB32F, TEX_FORMAT_RGB32_FLOAT, TEX_FORMAT_RGBA32_FLOAT, 2, 1), (std::vector<float>{1, 2, 3, 1, 4, 5, 6, 1}));
+}
+
+TEST(GraphicsAccessories_TextureFormatConversion, FloatToHalf)
+{
+    const std::vector<float>  Floats = {0.f, -0.f, 1.f, -2.f, 0.5f, 65504.f, 70000.f, -1e10f, 6.1035156e-05f, 5.9604645e-08f, 1e-9f, 0.33333334f, 1.0009766f, 1.00048828125f, 1.00146484375f};
+    const std::vector<Uint16> Halves = {0x0000, 0x8000, 0x3C00, 0xC000, 0x3800, 0x7BFF, 0x7C00, 0xFC00, 0x0400, 0x0001, 0x0000, 0x3555, 0x3C01, 0x3C00, 0x3C02};
+
+    // Use 4-component format and enough values to exercise the vectorized path
+    std::vector<float> Src = Floats;
+    Src.resize(16, 1.f);
+    auto Res = Convert<Uint16>(Src, TEX_FORMAT_RGBA32_FLOAT, TEX_FORMAT_RGBA16_FLOAT, 4, 1);
+    for (size_t i = 0; i < Floats.size(); ++i)
+        EXPECT_EQ(Res[i], Halves[i]) << "Value: " << Floats[i];
+
+    // All finite half values must round-trip exactly
+    std::vector<Uint16> AllHalves;
+    for (Uint32 h = 0; h < 0x10000; ++h)
+    {
+        if ((h & 0x7C00) != 0x7C00)
+            AllHalves.push_back(static_cast<Uint16>(h));
+    }
+    AllHalves.resize(AllHalves.size() / 4 * 4);
+    const auto AsFloats = Convert<float>(AllHalves, TEX_FORMAT_RGBA16_FLOAT, TEX_FORMAT_RGBA32_FLOAT, static_cast<Uint32>(AllHalves.size() / 4), 1);
+    for (size_t i = 0; i < 0x400; ++i)
+        EXPECT_FLOAT_EQ(AsFloats[i], static_cast<float>(i) * 5.9604645e-08f);
+    EXPECT_EQ(Convert<Uint16>(AsFloats, TEX_FORMAT_RGBA32_FLOAT, TEX_FORMAT_RGBA16_FLOAT, static_cast<Uint32>(AllHalves.size() / 4), 1), AllHalves);
+}
+
+TEST(GraphicsAccessories_TextureFormatConversion, SRGB)
+{
+    constexpr Uint32 Width  = 256;
+    constexpr Uint32 Height = 1;
+
+    std::vector<Uint8> Linear(Width * 4);
+    for (Uint32 i = 0; i < Width; ++i)
+    {
+        for (Uint32 c = 0; c < 4; ++c)
+            Linear[i * 4 + c] = static_cast<Uint8>(i);
+    }
+
+    for (auto DstFormat : {TEX_FORMAT_RGBA8_UNORM_SRGB, TEX_FORMAT_BGRA8_UNORM_SRGB})
+    {
+        const auto SRGB = Convert<Uint8>(Linear, TEX_FORMAT_RGBA8_UNORM, DstFormat, Width, Height);
+        for (Uint32 i = 0; i < Width; ++i)
+        {
+            const auto RefSRGB = static_cast<Uint8>(LinearToGamma(static_cast<float>(i) / 255.f) * 255.f + 0.5f);
+            for (Uint32 c = 0; c < 3; ++c)
+                ASSERT_EQ(SRGB[i * 4 + c], RefSRGB);
+            ASSERT_EQ(SRGB[i * 4 + 3], i) << "Alpha must not be converted";
+        }
+
+        // The generic path must produce the same results
+        const auto SRGBFromFloat = Convert<Uint8>(Convert<float>(Linear, TEX_FORMAT_RGBA8_UNORM, TEX_FORMAT_RGBA32_FLOAT, Width, Height),
+                                                  TEX_FORMAT_RGBA32_FLOAT, DstFormat, Width, Height);
+        EXPECT_EQ(SRGB, SRGBFromFloat);
+
+        // Bright linear values are quantized more coarsely in sRGB, so the round trip is off by at most one
+        const auto RoundTrip = Convert<Uint8>(SRGB, DstFormat, TEX_FORMAT_RGBA8_UNORM, Width, Height);
+        for (size_t i = 0; i < Linear.size(); ++i)
+            ASSERT_NEAR(RoundTrip[i], Linear[i], 1);
+    }
+}
+
+TEST(GraphicsAccessories_TextureFormatConversion, Integer)
+{
+    {
+        // Values above 2^24 are not exactly representable as float
+        const std::vector<Uint32> R32 = {16777217u, 2147483647u, 2147483648u, 4294967295u};
+        EXPECT_EQ(Convert<Int32>(R32, TEX_FORMAT_R32_UINT, TEX_FORMAT_R32_SINT, 4, 1),
+                  (std::vector<Int32>{16777217, 2147483647, 2147483647, 2147483647}));
+        EXPECT_EQ(Convert<Int32>(R32, TEX_FORMAT_R32_UINT, TEX_FORMAT_RG32_SINT, 2, 1),
+                  (std::vector<Int32>{16777217, 0, 2147483647, 0}));
+    }
+
+    {
+        const std::vector<Int32> RG32 = {-2147483647 - 1, 16777217, -1, 70000};
+        EXPECT_EQ(Convert<Uint32>(RG32, TEX_FORMAT_RG32_SINT, TEX_FORMAT_RG32_UINT, 2, 1),
+                  (std::vector<Uint32>{0, 16777217u, 0, 70000u}));
+        EXPECT_EQ(Convert<Int16>(RG32, TEX_FORMAT_RG32_SINT, TEX_FORMAT_RG16_SINT, 2, 1),
+                  (std::vector<Int16>{-32768, 32767, -1, 32767}));
+        // Missing alpha is set to 1
+        EXPECT_EQ(Convert<Uint8>(RG32, TEX_FORMAT_RG32_SINT, TEX_FORMAT_RGBA8_UINT, 2, 1),
+                  (std::vector<Uint8>{0, 255, 0, 1, 0, 255, 0, 1}));
+    }
+}
+
+TEST(GraphicsAccessories_TextureFormatConversion, Generic)
+{
+    {
+        const std::vector<Uint8> R8 = {0, 51, 255};
+        EXPECT_EQ(Convert<float>(R8, TEX_FORMAT_R8_UNORM, TEX_FORMAT_RGBA32_FLOAT, 3, 1),
+                  (std::vector<float>{0, 0, 0, 1, 0.2f, 0, 0, 1, 1, 0, 0, 1}));
+    }
+
+    {
+        const std::vector<Int16> RG16 = {-32768, 32767, 0, -16384};
+        EXPECT_EQ(Convert<Uint8>(RG16, TEX_FORMAT_RG16_SNORM, TEX_FORMAT_RGBA8_UNORM, 2, 1),
+                  (std::vector<Uint8>{0, 255, 0, 255, 0, 0, 0, 255}));
+        EXPECT_EQ(Convert<Int8>(RG16, TEX_FORMAT_RG16_SNORM, TEX_FORMAT_RG8_SNORM, 2, 1),
+                  (std::vector<Int8>{-127, 127, 0, -64}));
+    }
+
+    {
+        const std::vector<Uint32> RGBA32 = {0, 1, 65535, 70000, 4294967295u, 7, 8, 9};
+        EXPECT_EQ(Convert<Uint16>(RGBA32, TEX_FORMAT_RGBA32_UINT, TEX_FORMAT_R16_UINT, 2, 1),
+                  (std::vector<Uint16>{0, 65535}));
+        EXPECT_EQ(Convert<Int8>(RGBA32, TEX_FORMAT_RGBA32_UINT, TEX_FORMAT_RG8_SINT, 2, 1),
+                  (std::vector<Int8>{0, 1, 127, 7}));
+    }
+
+    {
+        const std::vector<float> Depth = {0, 0.5f, 1};
+        EXPECT_EQ(Convert<Uint16>(Depth, TEX_FORMAT_D32_FLOAT, TEX_FORMAT_D16_UNORM, 3, 1),
+                  (std::vector<Uint16>{0, 32768, 65535}));
+    }
+
+    {
+        const std::vector<Uint8> BGRX = {10, 20, 30, 40};
+        EXPECT_EQ(Convert<float>(BGRX, TEX_FORMAT_BGRX8_UNORM, TEX_FORMAT_RGBA32_FLOAT, 1, 1),
+                  (std::vector<float>{30 / 255.f, 20 / 255.f, 10 / 255.f, 1}));
+    }
+
+    {
+        // The single component of A8 is alpha
+        const std::vector<Uint8> A8 = {10, 200};
+        EXPECT_EQ(Convert<Uint8>(A8, TEX_FORMAT_A8_UNORM, TEX_FORMAT_RGBA8_UNORM, 2, 1),
+                  (std::vector<Uint8>{0, 0, 0, 10, 0, 0, 0, 200}));
+        EXPECT_EQ(Convert<float>(A8, TEX_FORMAT_A8_UNORM, TEX_FORMAT_RGBA32_FLOAT, 1, 1),
+                  (std::vector<float>{0, 0, 0, 10 / 255.f}));
+
+        const std::vector<Uint8> RGBA8 = {1, 2, 3, 4};
+        EXPECT_EQ(Convert<Uint8>(RGBA8, TEX_FORMAT_RGBA8_UNORM, TEX_FORMAT_A8_UNORM, 1, 1), (std::vector<Uint8>{4}));
+    }
+
+    EXPECT_TRUE(IsTextureFormatConversionSupported(TEX_FORMAT_RGBA16_UNORM, TEX_FORMAT_BGRA8_UNORM_SRGB));
+    EXPECT_FALSE(IsTextureFormatConversionSupported(TEX_FORMAT_BC1_UNORM, TEX_FORMAT_RGBA8_UNORM));
+    EXPECT_FALSE(IsTextureFormatConversionSupported(TEX_FORMAT_RGBA8_UNORM, TEX_FORMAT_R11G11B10_FLOAT));
+    EXPECT_FALSE(IsTextureFormatConversionSupported(TEX_FORMAT_RGBA8_TYPELESS, TEX_FORMAT_RGBA8_UNORM));
+}
+
+} // namespace
@@ -0,0 +1,563 @@
+/*
+ *  Copyright 2019-2024 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "../../../../Graphics/GraphicsEngine/include/DeviceObjectArchive.hpp"
+#include "../../../../Graphics/GraphicsEngine/include/PSOSerializer.hpp"
+#include "../../../../Graphics/GraphicsEngine/include/EngineMemory.h"
+
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "DataBlobImpl.hpp"
+#include "MappedFileDataBlob.hpp"
+#include "FileWrapper.hpp"
+#include "FastRand.hpp"
+#include "TempDirectory.hpp"
+#include "TestingEnvironment.hpp"
+#include "Timer.hpp"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+using ResourceType = DeviceObjectArchive::ResourceType;
+using DeviceType   = DeviceObjectArchive::DeviceType;
+
+SerializedData MakeRandomData(FastRandInt& Rnd, size_t Size)
+{
+    if (Size == 0)
+        return {};
+
+    SerializedData Data{Size, GetRawAllocator()};
+    for (size_t i = 0; i < Size; ++i)
+        Data.Ptr<Uint8>()[i] = static_cast<Uint8>(Rnd());
+    return Data;
+}
+
+// Makes the data that compresses well: 32-bit words from a small set of values
+SerializedData MakeCompressibleData(FastRandInt& Rnd, size_t NumWords)
+{
+    SerializedData Data{NumWords * sizeof(Uint32), GetRawAllocator()};
+    for (size_t i = 0; i < NumWords; ++i)
+        Data.Ptr<Uint32>()[i] = static_cast<Uint32>(Rnd() % 16);
+    return Data;
+}
+
+SerializedData MakeShaderIndices(std::initializer_list<Uint32> Indices)
+{
+    std::vector<Uint32> IndicesVec{Indices};
+
+    const DeviceObjectArchive::ShaderIndexArray ShaderIndices{IndicesVec.data(), static_cast<Uint32>(IndicesVec.size())};
+
+    Serializer<SerializerMode::Measure> Measurer;
+    PSOSerializer<SerializerMode::Measure>::SerializeShaderIndices(Measurer, ShaderIndices, nullptr);
+
+    auto Data = Measurer.AllocateData(GetRawAllocator());
+
+    Serializer<SerializerMode::Write> Ser{Data};
+    PSOSerializer<SerializerMode::Write>::SerializeShaderIndices(Ser, ShaderIndices, nullptr);
+    VERIFY_EXPR(Ser.IsEnded());
+    return Data;
+}
+
+// Builds an archive with a number of resource signatures and render passes with random data,
+// a compute pipeline, and shaders for Vulkan and OpenGL devices.
+void InitTestArchive(DeviceObjectArchive& Archive, Uint32 NumResources, Uint32 Seed)
+{
+    FastRandInt Rnd{Seed, 0, 255};
+    for (Uint32 i = 0; i < NumResources; ++i)
+    {
+        const auto ResType = (i % 3 == 0) ? ResourceType::RenderPass : ResourceType::ResourceSignature;
+        const auto Name    = std::string{"Resource "} + std::to_string(Seed) + '.' + std::to_string((i * 7919) % NumResources);
+        auto&      ResData = Archive.GetResourceData(ResType, Name.c_str());
+
+        ResData.Common = MakeRandomData(Rnd, 16 + Rnd() % 64);
+        for (size_t dev = 0; dev < ResData.DeviceSpecific.size(); ++dev)
+        {
+            if ((i + dev) % 2 == 0)
+                ResData.DeviceSpecific[dev] = MakeRandomData(Rnd, 1 + Rnd() % 32);
+        }
+    }
+
+    for (auto DevType : {DeviceType::Vulkan, DeviceType::OpenGL})
+    {
+        auto& Shaders = Archive.GetDeviceShaders(DevType);
+        for (Uint32 i = 0; i < 3; ++i)
+            Shaders.emplace_back(MakeRandomData(Rnd, 100 + Rnd() % 100));
+    }
+
+    auto& PSOData  = Archive.GetResourceData(ResourceType::ComputePipeline, (std::string{"PSO "} + std::to_string(Seed)).c_str());
+    PSOData.Common = MakeRandomData(Rnd, 48);
+
+    PSOData.DeviceSpecific[static_cast<size_t>(DeviceType::Vulkan)] = MakeShaderIndices({2});
+    PSOData.DeviceSpecific[static_cast<size_t>(DeviceType::OpenGL)] = MakeShaderIndices({1});
+}
+
+struct TestResourceData
+{
+    const char*        Name = nullptr;
+    std::vector<Uint8> Data;
+
+    bool Deserialize(const char* _Name, Serializer<SerializerMode::Read>& Ser)
+    {
+        Name = _Name;
+        Data.resize(Ser.GetRemainingSize());
+        return Ser.CopyBytes(Data.data(), Data.size());
+    }
+};
+
+void CheckArchivesEqual(const DeviceObjectArchive& Ref, const DeviceObjectArchive& Archive)
+{
+    EXPECT_EQ(Ref.GetContentVersion(), Archive.GetContentVersion());
+
+    size_t NumRefResources = 0;
+    Ref.ProcessResources([&](ResourceType Type, const char* Name, const DeviceObjectArchive::ResourceData& RefData) {
+        ++NumRefResources;
+        EXPECT_TRUE(Archive.HasResource(Type, Name)) << Name;
+
+        TestResourceData ResData;
+        ASSERT_TRUE(Archive.LoadResourceCommonData(Type, Name, ResData)) << Name;
+        EXPECT_STREQ(ResData.Name, Name);
+        ASSERT_EQ(ResData.Data.size(), RefData.Common.Size());
+        EXPECT_EQ(memcmp(ResData.Data.data(), RefData.Common.Ptr(), ResData.Data.size()), 0) << Name;
+
+        for (size_t dev = 0; dev < RefData.DeviceSpecific.size(); ++dev)
+        {
+            const auto DevData = Archive.GetDeviceSpecificData(Type, Name, static_cast<DeviceType>(dev));
+            EXPECT_EQ(DevData, RefData.DeviceSpecific[dev]) << Name;
+        }
+    });
+
+    size_t NumResources = 0;
+    Archive.ProcessResources([&](ResourceType, const char*, const DeviceObjectArchive::ResourceData&) { ++NumResources; });
+    EXPECT_EQ(NumResources, NumRefResources);
+
+    for (size_t dev = 0; dev < static_cast<size_t>(DeviceType::Count); ++dev)
+    {
+        const auto DevType = static_cast<DeviceType>(dev);
+        ASSERT_EQ(Archive.GetNumShaders(DevType), Ref.GetNumShaders(DevType));
+        for (size_t i = 0; i < Ref.GetNumShaders(DevType); ++i)
+        {
+            EXPECT_EQ(Archive.GetSerializedShader(DevType, i), Ref.GetSerializedShader(DevType, i));
+        }
+        EXPECT_FALSE(Archive.GetSerializedShader(DevType, Ref.GetNumShaders(DevType)));
+    }
+}
+
+RefCntAutoPtr<IDataBlob> SerializeArchive(const DeviceObjectArchive& Archive)
+{
+    RefCntAutoPtr<IDataBlob> pData;
+    Archive.Serialize(&pData);
+    return pData;
+}
+
+bool BlobsEqual(const IDataBlob* pBlob1, const IDataBlob* pBlob2)
+{
+    return pBlob1->GetSize() == pBlob2->GetSize() &&
+        memcmp(pBlob1->GetConstDataPtr(), pBlob2->GetConstDataPtr(), pBlob1->GetSize()) == 0;
+}
+
+TEST(DeviceObjectArchiveTest, SerializeDeserialize)
+{
+    DeviceObjectArchive RefArchive{7};
+    InitTestArchive(RefArchive, 257, 1);
+
+    auto pData = SerializeArchive(RefArchive);
+    ASSERT_TRUE(pData);
+
+    for (bool MakeCopy : {false, true})
+    {
+        const DeviceObjectArchive Archive{DeviceObjectArchive::CreateInfo{pData, 7, MakeCopy}};
+        CheckArchivesEqual(RefArchive, Archive);
+
+        EXPECT_FALSE(Archive.HasResource(ResourceType::ResourceSignature, "Missing resource"));
+        EXPECT_FALSE(Archive.HasResource(ResourceType::GraphicsPipeline, "Resource 1.0"));
+
+        // Serializing the archive that was not fully loaded must produce identical data
+        auto pData2 = SerializeArchive(Archive);
+        ASSERT_TRUE(pData2);
+        EXPECT_TRUE(BlobsEqual(pData, pData2));
+    }
+
+    {
+        TestingEnvironment::ErrorScope ExpectedErrors{"Invalid archive content version"};
+        EXPECT_THROW(DeviceObjectArchive(DeviceObjectArchive::CreateInfo{pData, 8}), std::runtime_error);
+    }
+}
+
+TEST(DeviceObjectArchiveTest, InvalidData)
+{
+    DeviceObjectArchive RefArchive;
+    InitTestArchive(RefArchive, 16, 2);
+
+    auto pData = SerializeArchive(RefArchive);
+    ASSERT_TRUE(pData);
+
+    TestingEnvironment::SetErrorAllowance(100, "Errors below are expected: testing invalid archive data\n");
+
+    // Header and index are truncated
+    {
+        auto pTruncated = DataBlobImpl::Create(32, pData->GetConstDataPtr());
+        EXPECT_THROW(DeviceObjectArchive(DeviceObjectArchive::CreateInfo{pTruncated}), std::runtime_error);
+    }
+
+    // Footer is truncated
+    {
+        auto pTruncated = DataBlobImpl::Create(pData->GetSize() / 2, pData->GetConstDataPtr());
+        EXPECT_THROW(DeviceObjectArchive(DeviceObjectArchive::CreateInfo{pTruncated}), std::runtime_error);
+    }
+
+    // Resource names and data are corrupted
+    {
+        auto pCorrupted = DataBlobImpl::MakeCopy(pData);
+        memset(pCorrupted->GetDataPtr<Uint8>() + 64, 0, pData->GetSize() / 4);
+
+        const DeviceObjectArchive Archive{DeviceObjectArchive::CreateInfo{pCorrupted}};
+
+        size_t NumResources = 0;
+        RefArchive.ProcessResources([&](ResourceType Type, const char* Name, const DeviceObjectArchive::ResourceData& RefData) {
+            TestResourceData ResData;
+            if (Archive.LoadResourceCommonData(Type, Name, ResData))
+            {
+                ASSERT_EQ(ResData.Data.size(), RefData.Common.Size());
+                EXPECT_EQ(memcmp(ResData.Data.data(), RefData.Common.Ptr(), ResData.Data.size()), 0) << Name;
+                ++NumResources;
+            }
+        });
+        EXPECT_LT(NumResources, size_t{17});
+    }
+
+    TestingEnvironment::SetErrorAllowance(0);
+}
+
+TEST(DeviceObjectArchiveTest, MappedFile)
+{
+    DeviceObjectArchive RefArchive{3};
+    InitTestArchive(RefArchive, 100, 3);
+
+    auto pData = SerializeArchive(RefArchive);
+    ASSERT_TRUE(pData);
+
+    TempDirectory TmpDir;
+    const auto    FilePath = TmpDir.Get() + FileSystem::SlashSymbol + "TestArchive.bin";
+    {
+        FileWrapper File{FilePath.c_str(), EFileAccessMode::Overwrite};
+        ASSERT_TRUE(File);
+        ASSERT_TRUE(File->Write(pData->GetConstDataPtr(), pData->GetSize()));
+    }
+
+    {
+        auto pMappedData = MappedFileDataBlob::Create(FilePath.c_str());
+        ASSERT_TRUE(pMappedData);
+        EXPECT_TRUE(BlobsEqual(pData, pMappedData));
+
+        const DeviceObjectArchive Archive{DeviceObjectArchive::CreateInfo{pMappedData}};
+        pMappedData.Release();
+
+        // The archive keeps the mapping alive
+        CheckArchivesEqual(RefArchive, Archive);
+    }
+
+    FileSystem::DeleteFile(FilePath.c_str());
+}
+
+TEST(DeviceObjectArchiveTest, Merge)
+{
+    DeviceObjectArchive Archive1{1};
+    InitTestArchive(Archive1, 20, 1);
+
+    DeviceObjectArchive Archive2{1};
+    InitTestArchive(Archive2, 30, 2);
+
+    auto pData1 = SerializeArchive(Archive1);
+    auto pData2 = SerializeArchive(Archive2);
+
+    // Merge in-memory archives
+    DeviceObjectArchive RefMerged{1};
+    RefMerged.Merge(Archive1);
+    RefMerged.Merge(Archive2);
+
+    // Merge archives loaded from data: the destination archive is fully loaded,
+    // while the source archive is accessed through the index.
+    DeviceObjectArchive Merged{DeviceObjectArchive::CreateInfo{pData1}};
+    Merged.Merge(DeviceObjectArchive{DeviceObjectArchive::CreateInfo{pData2}});
+    CheckArchivesEqual(RefMerged, Merged);
+
+    auto pRefMergedData = SerializeArchive(RefMerged);
+    auto pMergedData    = SerializeArchive(Merged);
+    EXPECT_TRUE(BlobsEqual(pRefMergedData, pMergedData));
+
+    // Shader indices of the second archive's pipeline must be offset by the number of shaders in the first archive
+    const auto ShaderIdxData = Merged.GetDeviceSpecificData(ResourceType::ComputePipeline, "PSO 2", DeviceType::Vulkan);
+    ASSERT_TRUE(ShaderIdxData);
+
+    DynamicLinearAllocator                Allocator{GetRawAllocator()};
+    DeviceObjectArchive::ShaderIndexArray ShaderIndices;
+    Serializer<SerializerMode::Read>      Ser{ShaderIdxData};
+    ASSERT_TRUE(PSOSerializer<SerializerMode::Read>::SerializeShaderIndices(Ser, ShaderIndices, &Allocator));
+    ASSERT_EQ(ShaderIndices.Count, 1u);
+    EXPECT_EQ(ShaderIndices.pIndices[0], 3u + 2u);
+}
+
+TEST(DeviceObjectArchiveTest, RemoveAppendDeviceData)
+{
+    DeviceObjectArchive RefArchive;
+    InitTestArchive(RefArchive, 20, 4);
+    auto pData = SerializeArchive(RefArchive);
+
+    DeviceObjectArchive Archive{DeviceObjectArchive::CreateInfo{pData}};
+    Archive.RemoveDeviceData(DeviceType::Vulkan);
+    EXPECT_EQ(Archive.GetNumShaders(DeviceType::Vulkan), size_t{0});
+    EXPECT_FALSE(Archive.GetDeviceSpecificData(ResourceType::ComputePipeline, "PSO 4", DeviceType::Vulkan));
+
+    Archive.AppendDeviceData(DeviceObjectArchive{DeviceObjectArchive::CreateInfo{pData}}, DeviceType::Vulkan);
+    CheckArchivesEqual(RefArchive, Archive);
+}
+
+TEST(DeviceObjectArchiveTest, ShaderCompression)
+{
+    DeviceObjectArchive RefArchive{5};
+    InitTestArchive(RefArchive, 30, 5);
+    {
+        FastRandInt Rnd{5, 0, 255};
+        for (Uint32 i = 0; i < 8; ++i)
+            RefArchive.GetDeviceShaders(DeviceType::Vulkan).emplace_back(MakeCompressibleData(Rnd, 256 + Rnd() * 4));
+    }
+    const auto pData = SerializeArchive(RefArchive);
+    ASSERT_TRUE(pData);
+
+    RefArchive.SetShaderCompression(ARCHIVE_SHADER_COMPRESSION_LZ4);
+    const auto pCompressedData = SerializeArchive(RefArchive);
+    ASSERT_TRUE(pCompressedData);
+    // Random shaders are stored uncompressed, compressible shaders must make the archive smaller
+    EXPECT_LT(pCompressedData->GetSize(), pData->GetSize());
+
+    {
+        const DeviceObjectArchive Archive{DeviceObjectArchive::CreateInfo{pData, 5}};
+        EXPECT_EQ(Archive.GetShaderCompression(), ARCHIVE_SHADER_COMPRESSION_NONE);
+    }
+
+    const DeviceObjectArchive Archive{DeviceObjectArchive::CreateInfo{pCompressedData, 5}};
+    EXPECT_EQ(Archive.GetShaderCompression(), ARCHIVE_SHADER_COMPRESSION_LZ4);
+    CheckArchivesEqual(RefArchive, Archive);
+
+    // Decompress into the scratch allocator
+    {
+        DynamicLinearAllocator ScratchAllocator{GetRawAllocator(), 1024};
+        for (size_t i = 0; i < RefArchive.GetNumShaders(DeviceType::Vulkan); ++i)
+        {
+            EXPECT_EQ(Archive.GetSerializedShader(DeviceType::Vulkan, i, &ScratchAllocator),
+                      RefArchive.GetSerializedShader(DeviceType::Vulkan, i));
+        }
+    }
+
+    // Serializing the compressed archive must produce identical data
+    auto pData2 = SerializeArchive(Archive);
+    ASSERT_TRUE(pData2);
+    EXPECT_TRUE(BlobsEqual(pCompressedData, pData2));
+
+    // Merged archive inherits the compression mode
+    DeviceObjectArchive Merged{5};
+    Merged.Merge(Archive);
+    EXPECT_EQ(Merged.GetShaderCompression(), ARCHIVE_SHADER_COMPRESSION_LZ4);
+    CheckArchivesEqual(RefArchive, Merged);
+}
+
+TEST(DeviceObjectArchiveTest, ShaderCompressionPerformance)
+{
+#ifdef DILIGENT_DEBUG
+    constexpr Uint32 NumShaders = 64;
+#else
+    constexpr Uint32 NumShaders = 1024;
+#endif
+    constexpr size_t ShaderWords = 4096;
+
+    DeviceObjectArchive RefArchive;
+    {
+        FastRandInt Rnd{6, 0, 255};
+        for (Uint32 i = 0; i < NumShaders; ++i)
+            RefArchive.GetDeviceShaders(DeviceType::Vulkan).emplace_back(MakeCompressibleData(Rnd, ShaderWords));
+    }
+    const auto pData = SerializeArchive(RefArchive);
+    ASSERT_TRUE(pData);
+    RefArchive.SetShaderCompression(ARCHIVE_SHADER_COMPRESSION_LZ4);
+    const auto pCompressedData = SerializeArchive(RefArchive);
+    ASSERT_TRUE(pCompressedData);
+
+    const DeviceObjectArchive Archive{DeviceObjectArchive::CreateInfo{pCompressedData}};
+
+    DynamicLinearAllocator ScratchAllocator{GetRawAllocator(), ShaderWords * sizeof(Uint32)};
+
+    size_t TotalSize = 0;
+    Timer  T;
+    for (Uint32 i = 0; i < NumShaders; ++i)
+    {
+        const auto Shader = Archive.GetSerializedShader(DeviceType::Vulkan, i, &ScratchAllocator);
+        ASSERT_TRUE(Shader);
+        TotalSize += Shader.Size();
+        ScratchAllocator.Discard();
+    }
+    const double DecodeTime = T.GetElapsedTime();
+    EXPECT_EQ(TotalSize, NumShaders * ShaderWords * sizeof(Uint32));
+
+    constexpr double MB = 1 << 20;
+    LOG_INFO_MESSAGE("Archive with ", NumShaders, " shaders: uncompressed ", pData->GetSize() / MB, " MB, LZ4 ", pCompressedData->GetSize() / MB,
+                     " MB, decode: ", TotalSize / MB / DecodeTime, " MB/s");
+}
+
+RefCntAutoPtr<IDataBlob> ConcatenateBlobs(IDataBlob* pBlob1, IDataBlob* pBlob2)
+{
+    auto pData = DataBlobImpl::Create(pBlob1->GetSize() + pBlob2->GetSize());
+    memcpy(pData->GetDataPtr<Uint8>(), pBlob1->GetConstDataPtr(), pBlob1->GetSize());
+    memcpy(pData->GetDataPtr<Uint8>() + pBlob1->GetSize(), pBlob2->GetConstDataPtr(), pBlob2->GetSize());
+    return RefCntAutoPtr<IDataBlob>{pData};
+}
+
+TEST(DeviceObjectArchiveTest, SerializeAppend)
+{
+    DeviceObjectArchive RefArchive{9};
+    InitTestArchive(RefArchive, 200, 7);
+    auto pData = SerializeArchive(RefArchive);
+    ASSERT_TRUE(pData);
+
+    // Update without changes only writes the index
+    {
+        const DeviceObjectArchive Archive{DeviceObjectArchive::CreateInfo{pData}};
+        EXPECT_EQ(Archive.GetDeadDataSize(), Uint64{0});
+
+        RefCntAutoPtr<IDataBlob> pUpdate;
+        Archive.SerializeAppend(&pUpdate);
+        ASSERT_TRUE(pUpdate);
+
+        auto pUpdated = ConcatenateBlobs(pData, pUpdate);
+
+        const DeviceObjectArchive Updated{DeviceObjectArchive::CreateInfo{pUpdated}};
+        EXPECT_GT(Updated.GetDeadDataSize(), Uint64{0});
+        CheckArchivesEqual(RefArchive, Updated);
+    }
+
+    // The update replaces the pipeline and one of the resources, and adds a new resource
+    DeviceObjectArchive UpdateArchive{9};
+    InitTestArchive(UpdateArchive, 2, 7);
+    {
+        FastRandInt Rnd{8, 0, 255};
+        UpdateArchive.GetResourceData(ResourceType::RenderPass, "New resource").Common = MakeRandomData(Rnd, 100);
+    }
+
+    DeviceObjectArchive RefUpdated{9};
+    RefUpdated.Merge(RefArchive);
+    RefUpdated.Merge(UpdateArchive, /*ReplaceExisting = */ true);
+
+    DeviceObjectArchive Archive{DeviceObjectArchive::CreateInfo{pData}};
+    Archive.Merge(UpdateArchive, /*ReplaceExisting = */ true);
+
+    RefCntAutoPtr<IDataBlob> pUpdate;
+    Archive.SerializeAppend(&pUpdate);
+    ASSERT_TRUE(pUpdate);
+    // Only the changed resources and shaders are written
+    EXPECT_LT(pUpdate->GetSize(), pData->GetSize() / 2);
+
+    auto pUpdated = ConcatenateBlobs(pData, pUpdate);
+    {
+        const DeviceObjectArchive Updated{DeviceObjectArchive::CreateInfo{pUpdated}};
+        EXPECT_GT(Updated.GetDeadDataSize(), Uint64{0});
+        CheckArchivesEqual(RefUpdated, Updated);
+
+        TestResourceData ResData;
+        EXPECT_TRUE(Updated.LoadResourceCommonData(ResourceType::RenderPass, "New resource", ResData));
+    }
+
+    // Append the second update to the updated archive
+    {
+        DeviceObjectArchive Updated{DeviceObjectArchive::CreateInfo{pUpdated}};
+        {
+            FastRandInt Rnd{9, 0, 255};
+            FastRandInt RefRnd{9, 0, 255};
+            Updated.GetResourceData(ResourceType::RenderPass, "New resource").Common    = MakeRandomData(Rnd, 200);
+            RefUpdated.GetResourceData(ResourceType::RenderPass, "New resource").Common = MakeRandomData(RefRnd, 200);
+        }
+        const auto DeadDataSize = Updated.GetDeadDataSize();
+
+        RefCntAutoPtr<IDataBlob> pUpdate2;
+        Updated.SerializeAppend(&pUpdate2);
+        ASSERT_TRUE(pUpdate2);
+
+        const DeviceObjectArchive Updated2{DeviceObjectArchive::CreateInfo{ConcatenateBlobs(pUpdated, pUpdate2)}};
+        EXPECT_GT(Updated2.GetDeadDataSize(), DeadDataSize);
+        CheckArchivesEqual(RefUpdated, Updated2);
+    }
+}
+
+TEST(DeviceObjectArchiveTest, Compact)
+{
+    DeviceObjectArchive RefArchive{9};
+    InitTestArchive(RefArchive, 50, 7);
+    auto pData = SerializeArchive(RefArchive);
+
+    DeviceObjectArchive UpdateArchive{9};
+    InitTestArchive(UpdateArchive, 2, 7);
+
+    DeviceObjectArchive Archive{DeviceObjectArchive::CreateInfo{pData}};
+    Archive.Merge(UpdateArchive, /*ReplaceExisting = */ true);
+    RefCntAutoPtr<IDataBlob> pUpdate;
+    Archive.SerializeAppend(&pUpdate);
+    auto pUpdated = ConcatenateBlobs(pData, pUpdate);
+
+    // The replaced pipeline references the shaders of the update, so only one shader per device is used
+    DeviceObjectArchive Compacted{DeviceObjectArchive::CreateInfo{pUpdated}};
+    EXPECT_EQ(Compacted.GetNumShaders(DeviceType::Vulkan), size_t{6});
+    Compacted.Compact();
+    EXPECT_EQ(Compacted.GetDeadDataSize(), Uint64{0});
+    EXPECT_LT(Compacted.GetData()->GetSize(), pUpdated->GetSize());
+    EXPECT_EQ(Compacted.GetNumShaders(DeviceType::Vulkan), size_t{1});
+    EXPECT_EQ(Compacted.GetNumShaders(DeviceType::OpenGL), size_t{1});
+
+    // The compacted archive must be identical to the compacted in-memory archive
+    DeviceObjectArchive RefCompacted{9};
+    RefCompacted.Merge(RefArchive);
+    RefCompacted.Merge(UpdateArchive, /*ReplaceExisting = */ true);
+    RefCompacted.Compact();
+    CheckArchivesEqual(RefCompacted, Compacted);
+    EXPECT_TRUE(BlobsEqual(RefCompacted.GetData(), Compacted.GetData()));
+
+    // Pipeline must reference the shader of the update archive
+    const auto ShaderIdxData = Compacted.GetDeviceSpecificData(ResourceType::ComputePipeline, "PSO 7", DeviceType::Vulkan);
+    ASSERT_TRUE(ShaderIdxData);
+
+    DynamicLinearAllocator                Allocator{GetRawAllocator()};
+    DeviceObjectArchive::ShaderIndexArray ShaderIndices;
+    Serializer<SerializerMode::Read>      Ser{ShaderIdxData};
+    ASSERT_TRUE(PSOSerializer<SerializerMode::Read>::SerializeShaderIndices(Ser, ShaderIndices, &Allocator));
+    ASSERT_EQ(ShaderIndices.Count, 1u);
+    EXPECT_EQ(Compacted.GetSerializedShader(DeviceType::Vulkan, ShaderIndices.pIndices[0]), UpdateArchive.GetSerializedShader(DeviceType::Vulkan, 2));
+}
+
+} // namespace
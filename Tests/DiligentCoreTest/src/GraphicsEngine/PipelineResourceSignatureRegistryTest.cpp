@@ -0,0 +1,88 @@
+/*
+ *  Copyright 2019-2024 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "PipelineResourceSignatureRegistry.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+
+namespace
+{
+
+struct DummySignature
+{
+    size_t Hash;
+    int    Layout;
+
+    size_t GetHash() const { return Hash; }
+
+    bool IsLayoutCompatibleWith(const DummySignature& Other) const
+    {
+        return Hash == Other.Hash && Layout == Other.Layout;
+    }
+};
+
+TEST(PipelineResourceSignatureRegistryTest, CompatibilityIDs)
+{
+    PipelineResourceSignatureRegistry<DummySignature> Registry;
+
+    DummySignature Sign0{1, 10};
+    DummySignature Sign1{1, 10};
+    DummySignature Sign2{1, 20}; // Hash collision with Sign0
+    DummySignature Sign3{2, 10};
+
+    const auto ID0 = Registry.Register(Sign0);
+    const auto ID1 = Registry.Register(Sign1);
+    const auto ID2 = Registry.Register(Sign2);
+    const auto ID3 = Registry.Register(Sign3);
+    EXPECT_NE(ID0, 0u);
+    EXPECT_EQ(ID0, ID1);
+    EXPECT_NE(ID0, ID2);
+    EXPECT_NE(ID0, ID3);
+    EXPECT_NE(ID2, ID3);
+
+    // Compatible signature that is still alive keeps the ID
+    Registry.Unregister(Sign0);
+    DummySignature Sign4{1, 10};
+    EXPECT_EQ(Registry.Register(Sign4), ID1);
+
+    // Once all compatible signatures are released, a new ID may be assigned
+    Registry.Unregister(Sign1);
+    Registry.Unregister(Sign4);
+    DummySignature Sign5{1, 10};
+    const auto     ID5 = Registry.Register(Sign5);
+    EXPECT_NE(ID5, 0u);
+    EXPECT_NE(ID5, ID2);
+    EXPECT_NE(ID5, ID3);
+
+    Registry.Unregister(Sign2);
+    Registry.Unregister(Sign3);
+    Registry.Unregister(Sign5);
+}
+
+} // namespace
@@ -0,0 +1,111 @@
+/*
+ *  Copyright 2019-2024 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <vector>
+
+#include "TextureUploaderBase.hpp"
+#include "FastRand.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+
+namespace
+{
+
+// Upload buffer backed by the CPU memory
+class TestUploadBuffer final : public UploadBufferBase
+{
+public:
+    TestUploadBuffer(IReferenceCounters* pRefCounters, const UploadBufferDesc& Desc) :
+        UploadBufferBase{pRefCounters, Desc}
+    {
+        const auto& FmtAttribs = GetTextureFormatAttribs(Desc.Format);
+        for (Uint32 Mip = 0; Mip < Desc.MipLevels; ++Mip)
+        {
+            const Uint32 NumBlocksX = (std::max(Desc.Width >> Mip, 1u) + 3) / 4;
+            const Uint32 NumBlocksY = (std::max(Desc.Height >> Mip, 1u) + 3) / 4;
+
+            // Add padding to make sure that the stride is taken into account
+            const Uint64 Stride = Uint64{NumBlocksX} * FmtAttribs.ComponentSize + 32;
+
+            m_Data.emplace_back(static_cast<size_t>(Stride * NumBlocksY));
+            SetMappedData(Mip, 0, MappedTextureSubresource{m_Data.back().data(), Stride, Stride * NumBlocksY});
+        }
+    }
+
+    virtual void WaitForCopyScheduled() override final {}
+
+    const std::vector<Uint8>& GetData(Uint32 Mip) const { return m_Data[Mip]; }
+
+private:
+    std::vector<std::vector<Uint8>> m_Data;
+};
+
+TEST(GraphicsTools_TextureUploader, CompressToUploadBuffer)
+{
+    UploadBufferDesc Desc;
+    Desc.Width     = 29;
+    Desc.Height    = 18;
+    Desc.MipLevels = 3;
+    Desc.Format    = TEX_FORMAT_BC7_UNORM;
+
+    RefCntAutoPtr<TestUploadBuffer> pBuffer{MakeNewRCObj<TestUploadBuffer>()(Desc)};
+
+    FastRandInt rnd{0, 0, 255};
+    for (Uint32 Mip = 0; Mip < Desc.MipLevels; ++Mip)
+    {
+        const Uint32 Width  = std::max(Desc.Width >> Mip, 1u);
+        const Uint32 Height = std::max(Desc.Height >> Mip, 1u);
+
+        std::vector<Uint8> RGBA(size_t{Width} * Height * 4);
+        for (auto& Val : RGBA)
+            Val = static_cast<Uint8>(rnd());
+
+        const TextureSubResData SrcData{RGBA.data(), Uint64{Width} * 4};
+        EXPECT_TRUE(CompressToUploadBuffer(pBuffer, Mip, 0, TEX_FORMAT_RGBA8_UNORM, SrcData));
+
+        const auto Mapped = pBuffer->GetMappedData(Mip, 0);
+
+        std::vector<Uint8> RefData(pBuffer->GetData(Mip).size());
+
+        CompressTextureSubresourceAttribs Attribs;
+        Attribs.SrcFormat    = TEX_FORMAT_RGBA8_UNORM;
+        Attribs.DstFormat    = Desc.Format;
+        Attribs.Width        = Width;
+        Attribs.Height       = Height;
+        Attribs.pSrcData     = RGBA.data();
+        Attribs.SrcRowStride = SrcData.Stride;
+        Attribs.pDstData     = RefData.data();
+        Attribs.DstRowStride = Mapped.Stride;
+        EXPECT_TRUE(CompressTextureSubresource(Attribs));
+
+        EXPECT_EQ(pBuffer->GetData(Mip), RefData);
+    }
+}
+
+} // namespace
@@ -467,6 +467,43 @@ TEST(Platforms_FileSystem, File)
     EXPECT_FALSE(FileSystem::FileExists(FilePath.c_str()));
 }
 
+TEST(Platforms_FileSystem, MapFile)
+{
+    TempDirectory TmpDir;
+
+    std::vector<Uint8> Data(10000);
+    FastRandInt        rnd{0, 0, 255};
+    for (auto& Elem : Data)
+        Elem = static_cast<Uint8>(rnd());
+
+    const auto FilePath = TmpDir.Get() + FileSystem::SlashSymbol + "MappedFile.bin";
+    {
+        FileWrapper File{FilePath.c_str(), EFileAccessMode::Overwrite};
+        ASSERT_TRUE(File);
+        EXPECT_TRUE(File->Write(Data.data(), Data.size()));
+    }
+
+    size_t Size  = 0;
+    void*  pData = FileSystem::MapFile(FilePath.c_str(), Size);
+    if (pData == nullptr)
+    {
+        GTEST_SKIP() << "Memory-mapped files are not supported on this platform";
+    }
+
+    ASSERT_EQ(Size, Data.size());
+    EXPECT_EQ(memcmp(pData, Data.data(), Size), 0);
+
+    // Private mapping can be modified without affecting the file
+    static_cast<Uint8*>(pData)[0] ^= 0xFF;
+    FileSystem::UnmapFile(pData, Size);
+
+    std::vector<Uint8> FileData;
+    EXPECT_TRUE(FileWrapper::ReadWholeFile(FilePath.c_str(), FileData));
+    EXPECT_EQ(FileData, Data);
+
+    FileSystem::DeleteFile(FilePath.c_str());
+}
+
 TEST(Platforms_FileSystem, Directories)
 {
     TempDirectory TmpDir;
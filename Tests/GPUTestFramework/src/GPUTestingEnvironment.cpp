@@ -619,6 +619,7 @@ GPUTestingEnvironment::~GPUTestingEnvironment()
         {
             const auto& Stats       = pCtx->GetStats();
             const auto& CmdCounters = Stats.CommandCounters;
+            const auto& BarrierCnt  = Stats.BarrierCounters;
             LOG_INFO_MESSAGE(
                 "Device context stats"
                 "\n  Command counters",
@@ -663,6 +664,10 @@ GPUTestingEnvironment::~GPUTestingEnvironment()
                 "\n    GenerateMips              ", CmdCounters.GenerateMips,
                 "\n    ResolveTextureSubresource ", CmdCounters.ResolveTextureSubresource,
                 "\n    BindSparseResourceMemory  ", CmdCounters.BindSparseResourceMemory,
+                "\n  Barrier counters",
+                "\n    PipelineBarriers          ", BarrierCnt.PipelineBarriers,
+                "\n    MemoryBarriers            ", BarrierCnt.MemoryBarriers,
+                "\n    ImageBarriers             ", BarrierCnt.ImageBarriers,
                 "\n  Primitives",
                 "\n    TRIANGLE_LIST             ", Stats.PrimitiveCounts[PRIMITIVE_TOPOLOGY_TRIANGLE_LIST],
                 "\n    TRIANGLE_STRIP            ", Stats.PrimitiveCounts[PRIMITIVE_TOPOLOGY_TRIANGLE_STRIP],
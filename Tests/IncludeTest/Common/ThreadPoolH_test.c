@@ -49,6 +49,7 @@ void TestThreadPool()
     IThreadPool_ReprioritizeAllTasks((IThreadPool*)NULL);
     IThreadPool_RemoveTask((IThreadPool*)NULL, (IAsyncTask*)NULL);
     IThreadPool_WaitForAllTasks((IThreadPool*)NULL);
+    IThreadPool_WaitForTask((IThreadPool*)NULL, (IAsyncTask*)NULL);
     Uint32 QueueSize = IThreadPool_GetQueueSize((IThreadPool*)NULL);
     (void)QueueSize;
     Uint32 TaskCount = IThreadPool_GetRunningTaskCount((IThreadPool*)NULL);
@@ -44,4 +44,11 @@ void TestRenderDeviceVkCInterface(IRenderDeviceVk* pDevice)
     IRenderDeviceVk_CreateBLASFromVulkanResource(pDevice, (VkAccelerationStructureKHR)NULL, (BottomLevelASDesc*)NULL, RESOURCE_STATE_BUILD_AS_READ, (IBottomLevelAS**)NULL);
     IRenderDeviceVk_CreateTLASFromVulkanResource(pDevice, (VkAccelerationStructureKHR)NULL, (TopLevelASDesc*)NULL, RESOURCE_STATE_BUILD_AS_READ, (ITopLevelAS**)NULL);
     IRenderDeviceVk_CreateFenceFromVulkanResource(pDevice, (VkSemaphore)NULL, (const FenceDesc*)NULL, (IFence**)NULL);
+    IRenderDeviceVk_CreateTransientTexture(pDevice, (TextureDesc*)NULL, 0, 1, (ITexture**)NULL);
+
+    TransientMemoryStatsVk TransientStats = IRenderDeviceVk_GetTransientMemoryStats(pDevice);
+    (void)TransientStats;
+
+    MemoryStatsVk MemStats = IRenderDeviceVk_GetMemoryStats(pDevice);
+    (void)MemStats;
 }
@@ -25,4 +25,13 @@
  *  of the possibility of such damages.
  */
 
+#include <string.h>
+
 #include "DiligentCore/Graphics/GraphicsTools/interface/GraphicsUtilities.h"
+
+void TestGraphicsUtilitiesCInterface()
+{
+    ComputeMipChainAttribs Attribs;
+    memset(&Attribs, 0, sizeof(Attribs));
+    Diligent_ComputeMipChain(&Attribs);
+}